@@ -0,0 +1,95 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <complex>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_SSE3_
+  #warning "Benchmarking scalar version only (SSE3 recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPCDBL_SIZE_MULTIPLE 8
+//#define DOTPCDBL_128_ALIGNED
+//#define DOTPCDBL_256_ALIGNED
+#include "DotProd/dotp_cdbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helper ('N' complex elements)
+typedef std::complex<double> (*DotPCDBL_Func)(std::complex<double> const*, std::complex<double> const*, size_t);
+
+static inline void BM_DotPCDBL_Run(benchmark::State& state, DotPCDBL_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<double>(1, 2*N, -1., 1.);
+  auto u = reinterpret_cast<std::complex<double> const*>(dv[0].u.data());
+  auto v = reinterpret_cast<std::complex<double> const*>(dv[0].v.data());
+  std::complex<double> ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(u, v, N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPCDBL_ForcedScalar(benchmark::State& state)  { BM_DotPCDBL_Run(state, dotProduct_cdbl_scalarforced); }
+void BM_DotPCDBL_Scalar(benchmark::State& state)        { BM_DotPCDBL_Run(state, dotProduct_cdbl_scalar); }
+void BM_DotPCDBL_ConjScalar(benchmark::State& state)    { BM_DotPCDBL_Run(state, dotProductConj_cdbl_scalar); }
+#ifdef HAS_SSE3_
+void BM_DotPCDBL_SSE(benchmark::State& state)           { BM_DotPCDBL_Run(state, dotProduct_cdbl_sse); }
+void BM_DotPCDBL_ConjSSE(benchmark::State& state)       { BM_DotPCDBL_Run(state, dotProductConj_cdbl_sse); }
+#endif
+#ifdef HAS_AVX_
+void BM_DotPCDBL_AVX(benchmark::State& state)           { BM_DotPCDBL_Run(state, dotProduct_cdbl_avx); }
+void BM_DotPCDBL_ConjAVX(benchmark::State& state)       { BM_DotPCDBL_Run(state, dotProductConj_cdbl_avx); }
+#endif
+#ifdef HAS_FMA_
+void BM_DotPCDBL_FMA(benchmark::State& state)           { BM_DotPCDBL_Run(state, dotProduct_cdbl_fma); }
+void BM_DotPCDBL_ConjFMA(benchmark::State& state)       { BM_DotPCDBL_Run(state, dotProductConj_cdbl_fma); }
+#endif
+
+
+//
+//BENCHMARK(BM_DotPCDBL_ForcedScalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPCDBL_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPCDBL_ConjScalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_SSE3_
+  BENCHMARK(BM_DotPCDBL_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCDBL_ConjSSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_DotPCDBL_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCDBL_ConjAVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_FMA_
+  BENCHMARK(BM_DotPCDBL_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCDBL_ConjFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
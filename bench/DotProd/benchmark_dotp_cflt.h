@@ -0,0 +1,95 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <complex>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_SSE3_
+  #warning "Benchmarking scalar version only (SSE3 recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPCFLT_SIZE_MULTIPLE 16
+//#define DOTPCFLT_128_ALIGNED
+//#define DOTPCFLT_256_ALIGNED
+#include "DotProd/dotp_cflt.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helper ('N' complex elements)
+typedef std::complex<float> (*DotPCFLT_Func)(std::complex<float> const*, std::complex<float> const*, size_t);
+
+static inline void BM_DotPCFLT_Run(benchmark::State& state, DotPCFLT_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(1, 2*N, -1.f, 1.f);
+  auto u = reinterpret_cast<std::complex<float> const*>(dv[0].u.data());
+  auto v = reinterpret_cast<std::complex<float> const*>(dv[0].v.data());
+  std::complex<float> ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(u, v, N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPCFLT_ForcedScalar(benchmark::State& state)  { BM_DotPCFLT_Run(state, dotProduct_cflt_scalarforced); }
+void BM_DotPCFLT_Scalar(benchmark::State& state)        { BM_DotPCFLT_Run(state, dotProduct_cflt_scalar); }
+void BM_DotPCFLT_ConjScalar(benchmark::State& state)    { BM_DotPCFLT_Run(state, dotProductConj_cflt_scalar); }
+#ifdef HAS_SSE3_
+void BM_DotPCFLT_SSE(benchmark::State& state)           { BM_DotPCFLT_Run(state, dotProduct_cflt_sse); }
+void BM_DotPCFLT_ConjSSE(benchmark::State& state)       { BM_DotPCFLT_Run(state, dotProductConj_cflt_sse); }
+#endif
+#ifdef HAS_AVX_
+void BM_DotPCFLT_AVX(benchmark::State& state)           { BM_DotPCFLT_Run(state, dotProduct_cflt_avx); }
+void BM_DotPCFLT_ConjAVX(benchmark::State& state)       { BM_DotPCFLT_Run(state, dotProductConj_cflt_avx); }
+#endif
+#ifdef HAS_FMA_
+void BM_DotPCFLT_FMA(benchmark::State& state)           { BM_DotPCFLT_Run(state, dotProduct_cflt_fma); }
+void BM_DotPCFLT_ConjFMA(benchmark::State& state)       { BM_DotPCFLT_Run(state, dotProductConj_cflt_fma); }
+#endif
+
+
+//
+//BENCHMARK(BM_DotPCFLT_ForcedScalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPCFLT_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPCFLT_ConjScalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_SSE3_
+  BENCHMARK(BM_DotPCFLT_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCFLT_ConjSSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_DotPCFLT_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCFLT_ConjAVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_FMA_
+  BENCHMARK(BM_DotPCFLT_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPCFLT_ConjFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
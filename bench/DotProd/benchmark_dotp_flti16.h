@@ -0,0 +1,74 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#if !defined(HAS_AVX2_) || !defined(HAS_FMA_)
+  #warning "Benchmarking SSE2 version (AVX2 + FMA recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPFI16_SIZE_MULTIPLE 32
+//#define DOTPFI16_128_ALIGNED
+//#define DOTPFI16_256_ALIGNED
+#include "DotProd/dotp_flti16.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+typedef float (*DotPFI16_Func)(float const*, int16_t const*, size_t);
+
+static inline void BM_DotPFI16_Run(benchmark::State& state, DotPFI16_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(1, N, -1.f, 1.f);
+  std::vector<int16_t> q(N);
+  vec_rrd<int16_t>(q, -1000, 1000);
+  float ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), q.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPFI16_Scalar(benchmark::State& state) { BM_DotPFI16_Run(state, dotProduct_flti16_scalar); }
+void BM_DotPFI16_SSE(benchmark::State& state)    { BM_DotPFI16_Run(state, dotProduct_flti16_sse); }
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+void BM_DotPFI16_FMA(benchmark::State& state)    { BM_DotPFI16_Run(state, dotProduct_flti16_fma); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPFI16_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPFI16_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  BENCHMARK(BM_DotPFI16_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
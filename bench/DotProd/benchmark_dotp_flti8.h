@@ -0,0 +1,93 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#if !defined(HAS_AVX2_) || !defined(HAS_FMA_)
+  #warning "Benchmarking SSE2 version (AVX2 + FMA recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPFI8_SIZE_MULTIPLE 32
+//#define DOTPFI8_128_ALIGNED
+//#define DOTPFI8_256_ALIGNED
+#include "DotProd/dotp_flti8.h"
+#include "DotProd/dotp_flt.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Reference: dequantize stored vector then plain dot product
+#ifdef HAS_FMA_
+static inline float dotProduct_flti8_dequant(float const* __restrict u, int8_t const* __restrict v, size_t n)
+{
+  static std::vector<float> dv;
+  dv.resize(n);
+  for (size_t i=0; i<n; ++i)
+    dv[i] = (float)v[i];
+  return dotProduct_flt_fma(u, dv.data(), n);
+}
+#endif
+
+// Helpers
+typedef float (*DotPFI8_Func)(float const*, int8_t const*, size_t);
+
+static inline void BM_DotPFI8_Run(benchmark::State& state, DotPFI8_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(1, N, -1.f, 1.f);
+  std::vector<int8_t> q(N);
+  vec_rrd<int8_t>(q, -128, 127);
+  float ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), q.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPFI8_Scalar(benchmark::State& state) { BM_DotPFI8_Run(state, dotProduct_flti8_scalar); }
+void BM_DotPFI8_SSE(benchmark::State& state)    { BM_DotPFI8_Run(state, dotProduct_flti8_sse); }
+#ifdef HAS_FMA_
+void BM_DotPFI8_DequantFMA(benchmark::State& state) { BM_DotPFI8_Run(state, dotProduct_flti8_dequant); }
+#endif
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+void BM_DotPFI8_FMA(benchmark::State& state)    { BM_DotPFI8_Run(state, dotProduct_flti8_fma); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPFI8_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPFI8_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_FMA_
+  BENCHMARK(BM_DotPFI8_DequantFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  BENCHMARK(BM_DotPFI8_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking SSE2 version (AVX2 recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPU16_SIZE_MULTIPLE 32
+//#define DOTPU16_128_ALIGNED
+//#define DOTPU16_256_ALIGNED
+#include "DotProd/dotp_ui16.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+typedef uint64_t (*DotPU16_Func)(uint16_t const*, uint16_t const*, size_t);
+
+static inline void BM_DotPU16_Run(benchmark::State& state, DotPU16_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrd<uint16_t, uint16_t>(1, N, 0, 65535);
+  uint64_t ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPU16_Scalar(benchmark::State& state)  { BM_DotPU16_Run(state, dotProduct_ui16_scalar); }
+void BM_DotPU16_SSE(benchmark::State& state)     { BM_DotPU16_Run(state, dotProduct_ui16_sse); }
+#ifdef HAS_AVX2_
+void BM_DotPU16_AVX2(benchmark::State& state)    { BM_DotPU16_Run(state, dotProduct_ui16_avx2); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPU16_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPU16_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_DotPU16_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
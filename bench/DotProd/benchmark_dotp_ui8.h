@@ -0,0 +1,78 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking SSE2 version (AVX2 recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPU8_SIZE_MULTIPLE 64
+//#define DOTPU8_128_ALIGNED
+//#define DOTPU8_256_ALIGNED
+#include "DotProd/dotp_ui8.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+typedef uint32_t (*DotPU8_Func)(uint8_t const*, uint8_t const*, size_t);
+
+static inline void BM_DotPU8_Run(benchmark::State& state, DotPU8_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrd<uint8_t, uint8_t>(1, N, 0, 255);
+  uint32_t ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPU8_Scalar(benchmark::State& state)  { BM_DotPU8_Run(state, dotProduct_ui8_scalar); }
+void BM_DotPU8_SSE(benchmark::State& state)     { BM_DotPU8_Run(state, dotProduct_ui8_sse); }
+#ifdef HAS_AVX2_
+void BM_DotPU8_AVX2(benchmark::State& state)    { BM_DotPU8_Run(state, dotProduct_ui8_avx2); }
+#endif
+#if defined(HAS_AVX512VNNI_) && defined(HAS_AVX512VL_)
+void BM_DotPU8_VNNI(benchmark::State& state)    { BM_DotPU8_Run(state, dotProduct_ui8_vnni); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPU8_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPU8_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_DotPU8_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#if defined(HAS_AVX512VNNI_) && defined(HAS_AVX512VL_)
+  BENCHMARK(BM_DotPU8_VNNI)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
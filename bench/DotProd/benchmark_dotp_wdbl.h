@@ -0,0 +1,125 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX_
+  #warning "Benchmarking SSE2 version (AVX recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPWDBL_SIZE_MULTIPLE 16
+//#define DOTPWDBL_128_ALIGNED
+//#define DOTPWDBL_256_ALIGNED
+#include "DotProd/dotp_wdbl.h"
+#include "DotProd/dotp_dbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Reference: materialize w*u then plain dot product
+#ifdef HAS_FMA_
+static inline double dotProductWeighted_dbl_twopass(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  static std::vector<double> wu;
+  wu.resize(n);
+  for (size_t i=0; i<n; ++i)
+    wu[i] = w[i] * u[i];
+  return dotProduct_dbl_fma(wu.data(), v, n);
+}
+#endif
+
+// Helpers
+typedef double (*DotPWDBL_Func)(double const*, double const*, double const*, size_t);
+typedef double (*DotPMDBL_Func)(double const*, double const*, uint8_t const*, size_t);
+
+static inline void BM_DotPWDBL_Run(benchmark::State& state, DotPWDBL_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<double>(2, N, -1., 1.);
+  double ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), dv[1].u.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+static inline void BM_DotPMDBL_Run(benchmark::State& state, DotPMDBL_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<double>(1, N, -1., 1.);
+  std::vector<uint8_t> mask((N + 7) / 8);
+  vec_rrd<uint8_t>(mask, 0, 255);
+  double ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), mask.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPWDBL_Scalar(benchmark::State& state)   { BM_DotPWDBL_Run(state, dotProductWeighted_dbl_scalar); }
+void BM_DotPWDBL_SSE(benchmark::State& state)      { BM_DotPWDBL_Run(state, dotProductWeighted_dbl_sse); }
+#ifdef HAS_AVX_
+void BM_DotPWDBL_AVX(benchmark::State& state)      { BM_DotPWDBL_Run(state, dotProductWeighted_dbl_avx); }
+#endif
+#ifdef HAS_FMA_
+void BM_DotPWDBL_TwoPassFMA(benchmark::State& state) { BM_DotPWDBL_Run(state, dotProductWeighted_dbl_twopass); }
+void BM_DotPWDBL_FMA(benchmark::State& state)      { BM_DotPWDBL_Run(state, dotProductWeighted_dbl_fma); }
+#endif
+void BM_DotPMDBL_Scalar(benchmark::State& state)   { BM_DotPMDBL_Run(state, dotProductMasked_dbl_scalar); }
+#ifdef HAS_AVX2_
+void BM_DotPMDBL_AVX2(benchmark::State& state)     { BM_DotPMDBL_Run(state, dotProductMasked_dbl_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_DotPMDBL_AVX512(benchmark::State& state)   { BM_DotPMDBL_Run(state, dotProductMasked_dbl_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPWDBL_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPWDBL_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_DotPWDBL_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_FMA_
+  BENCHMARK(BM_DotPWDBL_TwoPassFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPWDBL_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_DotPMDBL_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_DotPMDBL_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+  BENCHMARK(BM_DotPMDBL_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
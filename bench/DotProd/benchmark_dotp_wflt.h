@@ -0,0 +1,125 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX_
+  #warning "Benchmarking SSE2 version (AVX recommended)"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPWFLT_SIZE_MULTIPLE 32
+//#define DOTPWFLT_128_ALIGNED
+//#define DOTPWFLT_256_ALIGNED
+#include "DotProd/dotp_wflt.h"
+#include "DotProd/dotp_flt.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Reference: materialize w*u then plain dot product
+#ifdef HAS_FMA_
+static inline float dotProductWeighted_flt_twopass(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  static std::vector<float> wu;
+  wu.resize(n);
+  for (size_t i=0; i<n; ++i)
+    wu[i] = w[i] * u[i];
+  return dotProduct_flt_fma(wu.data(), v, n);
+}
+#endif
+
+// Helpers
+typedef float (*DotPWFLT_Func)(float const*, float const*, float const*, size_t);
+typedef float (*DotPMFLT_Func)(float const*, float const*, uint8_t const*, size_t);
+
+static inline void BM_DotPWFLT_Run(benchmark::State& state, DotPWFLT_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(2, N, -1.f, 1.f);
+  float ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), dv[1].u.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+static inline void BM_DotPMFLT_Run(benchmark::State& state, DotPMFLT_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(1, N, -1.f, 1.f);
+  std::vector<uint8_t> mask((N + 7) / 8);
+  vec_rrd<uint8_t>(mask, 0, 255);
+  float ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), mask.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPWFLT_Scalar(benchmark::State& state)   { BM_DotPWFLT_Run(state, dotProductWeighted_flt_scalar); }
+void BM_DotPWFLT_SSE(benchmark::State& state)      { BM_DotPWFLT_Run(state, dotProductWeighted_flt_sse); }
+#ifdef HAS_AVX_
+void BM_DotPWFLT_AVX(benchmark::State& state)      { BM_DotPWFLT_Run(state, dotProductWeighted_flt_avx); }
+#endif
+#ifdef HAS_FMA_
+void BM_DotPWFLT_TwoPassFMA(benchmark::State& state) { BM_DotPWFLT_Run(state, dotProductWeighted_flt_twopass); }
+void BM_DotPWFLT_FMA(benchmark::State& state)      { BM_DotPWFLT_Run(state, dotProductWeighted_flt_fma); }
+#endif
+void BM_DotPMFLT_Scalar(benchmark::State& state)   { BM_DotPMFLT_Run(state, dotProductMasked_flt_scalar); }
+#ifdef HAS_AVX2_
+void BM_DotPMFLT_AVX2(benchmark::State& state)     { BM_DotPMFLT_Run(state, dotProductMasked_flt_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_DotPMFLT_AVX512(benchmark::State& state)   { BM_DotPMFLT_Run(state, dotProductMasked_flt_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_DotPWFLT_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPWFLT_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_DotPWFLT_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_FMA_
+  BENCHMARK(BM_DotPWFLT_TwoPassFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_DotPWFLT_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_DotPMFLT_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_DotPMFLT_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+  BENCHMARK(BM_DotPMFLT_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
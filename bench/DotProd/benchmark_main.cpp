@@ -32,12 +32,23 @@
 // Benchmarks
 #include "benchmark_dotp_i8.h"
 #include "benchmark_dotp_i8ui8.h"
+#include "benchmark_dotp_ui8.h"
 #include "benchmark_dotp_i16i8.h"
 #include "benchmark_dotp_i16.h"
+#include "benchmark_dotp_ui16.h"
 #include "benchmark_dotp_i32i16.h"
 #include "benchmark_dotp_i32.h"
 #include "benchmark_dotp_flt.h"
+#include "benchmark_dotp_flti8.h"
+#include "benchmark_dotp_fltui8.h"
+#include "benchmark_dotp_flti16.h"
 #include "benchmark_dotp_dbl.h"
+#include "benchmark_dotp_cflt.h"
+#include "benchmark_dotp_cdbl.h"
+#include "benchmark_dotp_wflt.h"
+#include "benchmark_dotp_wdbl.h"
+#include "benchmark_xcorr_i16.h"
+#include "benchmark_xcorr_flt.h"
 
 
 //
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX_
+  #warning "Benchmarking SSE2 version (AVX recommended)"
+#endif
+
+#include "DotProd/xcorr_flt.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#ifndef XCORR_TAPS
+  #define XCORR_TAPS 64   // Kernel length (multiple of DOTPFLT_SIZE_MULTIPLE)
+#endif
+
+// Reference: one dot product per output
+#ifdef HAS_FMA_
+static inline void correlate_flt_dotp_fma(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  const size_t nout = xcorr_flt_out_size(nx, nk);
+  for (size_t i=0; i<nout; ++i)
+    out[i] = dotProduct_flt_fma(x + i, k, nk);
+}
+#endif
+
+// Helper ('N' signal length)
+typedef void (*XCorrFLT_Func)(float const*, size_t, float const*, size_t, float*);
+
+static inline void BM_XCorrFLT_Run(benchmark::State& state, XCorrFLT_Func func) {
+  const size_t N = (size_t)state.range(0) + XCORR_TAPS - 1;
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrdf<float>(1, N, -1.f, 1.f);
+  std::vector<float> out(xcorr_flt_out_size(N, XCORR_TAPS));
+  
+  for (auto _ : state)
+  {
+    for (size_t i=0; i<INNER_LOOP; ++i)
+    {
+      func(dv[0].u.data(), N, dv[0].v.data(), XCORR_TAPS, out.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  benchmark::DoNotOptimize(out.data());
+}
+
+
+//
+void BM_XCorrFLT_Scalar(benchmark::State& state)  { BM_XCorrFLT_Run(state, correlate_flt_scalar); }
+void BM_XCorrFLT_SSE(benchmark::State& state)     { BM_XCorrFLT_Run(state, correlate_flt_sse); }
+#ifdef HAS_AVX_
+void BM_XCorrFLT_AVX(benchmark::State& state)     { BM_XCorrFLT_Run(state, correlate_flt_avx); }
+#endif
+#ifdef HAS_FMA_
+void BM_XCorrFLT_DotPFMA(benchmark::State& state) { BM_XCorrFLT_Run(state, correlate_flt_dotp_fma); }
+void BM_XCorrFLT_FMA(benchmark::State& state)     { BM_XCorrFLT_Run(state, correlate_flt_fma); }
+#endif
+
+
+//
+BENCHMARK(BM_XCorrFLT_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_XCorrFLT_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_XCorrFLT_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_FMA_
+  BENCHMARK(BM_XCorrFLT_DotPFMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_XCorrFLT_FMA)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking SSE2 version (AVX2 recommended)"
+#endif
+
+#include "DotProd/xcorr_i16.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#ifndef XCORR_TAPS
+  #define XCORR_TAPS 64   // Kernel length (multiple of DOTP16_SIZE_MULTIPLE)
+#endif
+
+// Reference: one dot product per output
+#ifdef HAS_AVX2_
+static inline void correlate_i16_dotp_avx2(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+  const size_t nout = xcorr_i16_out_size(nx, nk);
+  for (size_t i=0; i<nout; ++i)
+    out[i] = dotProduct_i16_avx2(x + i, k, nk);
+}
+#endif
+
+// Helper ('N' signal length)
+typedef void (*XCorr16_Func)(int16_t const*, size_t, int16_t const*, size_t, int32_t*);
+
+static inline void BM_XCorr16_Run(benchmark::State& state, XCorr16_Func func) {
+  const size_t N = (size_t)state.range(0) + XCORR_TAPS - 1;
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrd<int16_t, int16_t>(1, N, -16, 16);
+  std::vector<int32_t> out(xcorr_i16_out_size(N, XCORR_TAPS));
+  
+  for (auto _ : state)
+  {
+    for (size_t i=0; i<INNER_LOOP; ++i)
+    {
+      func(dv[0].u.data(), N, dv[0].v.data(), XCORR_TAPS, out.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  benchmark::DoNotOptimize(out.data());
+}
+
+
+//
+void BM_XCorr16_Scalar(benchmark::State& state)   { BM_XCorr16_Run(state, correlate_i16_scalar); }
+void BM_XCorr16_SSE(benchmark::State& state)      { BM_XCorr16_Run(state, correlate_i16_sse); }
+#ifdef HAS_AVX2_
+void BM_XCorr16_DotPAVX2(benchmark::State& state) { BM_XCorr16_Run(state, correlate_i16_dotp_avx2); }
+void BM_XCorr16_AVX2(benchmark::State& state)     { BM_XCorr16_Run(state, correlate_i16_avx2); }
+#endif
+
+
+//
+BENCHMARK(BM_XCorr16_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_XCorr16_SSE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_XCorr16_DotPAVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+  BENCHMARK(BM_XCorr16_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_NEON_
+  #error "Minimum SIMD support for ARM is NEON"
+#endif
+
+
+// Data alignment optimizations
+#define DOTPU16_NEON_SIZE_MULTIPLE 16
+#include "DotProd_neon/dotp_ui16_neon.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+typedef uint64_t (*DotPU16_Neon_Func)(uint16_t const*, uint16_t const*, size_t);
+
+static inline void BM_DotPU16_Neon_Run(benchmark::State& state, DotPU16_Neon_Func func) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  auto dv = dual_vec_rrd<uint16_t, uint16_t>(1, N, 0, 65535);
+  uint64_t ttl = 0;
+  
+  for (auto _ : state)
+  {
+    ttl = 0;
+    for (size_t i=0; i<INNER_LOOP; ++i)
+      benchmark::DoNotOptimize(ttl += func(dv[0].u.data(), dv[0].v.data(), N));
+  }
+  benchmark::DoNotOptimize(ttl);
+}
+
+
+//
+void BM_DotPU16_Scalar(benchmark::State& state)  { BM_DotPU16_Neon_Run(state, dotProduct_ui16_neon_scalar); }
+void BM_DotPU16_Neon(benchmark::State& state)    { BM_DotPU16_Neon_Run(state, dotProduct_ui16_neon); }
+
+
+//
+BENCHMARK(BM_DotPU16_Scalar)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_DotPU16_Neon)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
@@ -36,6 +36,8 @@
 #include "benchmark_dotp_i32i16_neon.h"
 #include "benchmark_dotp_i32_neon.h"
 #include "benchmark_dotp_flt_neon.h"
+#include "benchmark_dotp_ui8_neon.h"
+#include "benchmark_dotp_ui16_neon.h"
 
 
 //
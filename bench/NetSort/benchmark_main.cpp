@@ -14,6 +14,16 @@
 #include "benchmark_nsort_8_i32.h"
 #include "benchmark_nsort_8_flt.h"
 #include "benchmark_nsort_8_dbl.h"
+#include "benchmark_nsort_8_batch.h"
+#include "benchmark_nsort_16.h"
+#include "benchmark_nsort_32.h"
+#include "benchmark_nsort_64.h"
+#include "benchmark_nsort_uint_i64.h"
+#include "benchmark_nsort_small.h"
+#include "benchmark_nsort_sorted.h"
+#include "benchmark_nsort_kv.h"
+#include "benchmark_nsort_order.h"
+#include "benchmark_nsort_select.h"
 
 
 //
@@ -0,0 +1,203 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only for int types (AVX2 recommended)"
+#endif
+
+
+// Data alignment optimizations
+//#define NSORT_32_I8_256_ALIGNED
+//#define NSORT_32_I16_256_ALIGNED
+//#define NSORT_32_I32_256_ALIGNED
+//#define NSORT_32_FLT_256_ALIGNED
+//#define NSORT_32_DBL_256_ALIGNED
+#include "NetSort/nsort_32_i8.h"
+#include "NetSort/nsort_32_i16.h"
+#include "NetSort/nsort_32_i32.h"
+#include "NetSort/nsort_32_flt.h"
+#include "NetSort/nsort_32_dbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+#ifndef BM_NSORT_RUN_
+#define BM_NSORT_RUN_
+template <typename T, size_t N>
+static inline void BM_NSort_std(T* __restrict v)
+{
+  std::sort(v, v + N);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_Run(benchmark::State& state, void (*func)(T*), const std::vector<T>& v0) {
+  std::vector<T> v1(v0.size());
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*INNER_LOOP*sizeof(T));
+    state.ResumeTiming();
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(v1.data() + i*N);
+    }
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_NSort_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+template <typename T, size_t N>
+static inline void BM_NSort_RND(benchmark::State& state, void (*func)(T*), T min, T max) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(N*INNER_LOOP);
+  BM_NSort_Gen(v0, min, max);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_SEQ(benchmark::State& state, void (*func)(T*)) {
+  std::vector<T> v0(N*INNER_LOOP);
+  for (size_t i=0; i<INNER_LOOP; ++i)
+    vec_seq(v0.data() + i*N, N, (T)0);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+#endif // BM_NSORT_RUN_
+
+
+//
+void BM_NSort_32I8_QSORT_RND(benchmark::State& state)   { BM_NSort_RND<int8_t, 32>(state, netsort_32_i8_qsort, (int8_t)-127, (int8_t)127); }
+void BM_NSort_32I8_QSORT_SEQ(benchmark::State& state)   { BM_NSort_SEQ<int8_t, 32>(state, netsort_32_i8_qsort); }
+void BM_NSort_32I8_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int8_t, 32>(state, BM_NSort_std<int8_t, 32>, (int8_t)-127, (int8_t)127); }
+void BM_NSort_32I8_STDSORT_SEQ(benchmark::State& state) { BM_NSort_SEQ<int8_t, 32>(state, BM_NSort_std<int8_t, 32>); }
+#ifdef HAS_AVX2_
+void BM_NSort_32I8_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int8_t, 32>(state, netsort_32_i8_avx2, (int8_t)-127, (int8_t)127); }
+void BM_NSort_32I8_AVX2_SEQ(benchmark::State& state) { BM_NSort_SEQ<int8_t, 32>(state, netsort_32_i8_avx2); }
+#endif
+void BM_NSort_32I16_QSORT_RND(benchmark::State& state)   { BM_NSort_RND<int16_t, 32>(state, netsort_32_i16_qsort, (int16_t)-5000, (int16_t)5000); }
+void BM_NSort_32I16_QSORT_SEQ(benchmark::State& state)   { BM_NSort_SEQ<int16_t, 32>(state, netsort_32_i16_qsort); }
+void BM_NSort_32I16_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int16_t, 32>(state, BM_NSort_std<int16_t, 32>, (int16_t)-5000, (int16_t)5000); }
+void BM_NSort_32I16_STDSORT_SEQ(benchmark::State& state) { BM_NSort_SEQ<int16_t, 32>(state, BM_NSort_std<int16_t, 32>); }
+#ifdef HAS_AVX2_
+void BM_NSort_32I16_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int16_t, 32>(state, netsort_32_i16_avx2, (int16_t)-5000, (int16_t)5000); }
+void BM_NSort_32I16_AVX2_SEQ(benchmark::State& state) { BM_NSort_SEQ<int16_t, 32>(state, netsort_32_i16_avx2); }
+#endif
+void BM_NSort_32I32_QSORT_RND(benchmark::State& state)   { BM_NSort_RND<int32_t, 32>(state, netsort_32_i32_qsort, -5000, 5000); }
+void BM_NSort_32I32_QSORT_SEQ(benchmark::State& state)   { BM_NSort_SEQ<int32_t, 32>(state, netsort_32_i32_qsort); }
+void BM_NSort_32I32_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 32>(state, BM_NSort_std<int32_t, 32>, -5000, 5000); }
+void BM_NSort_32I32_STDSORT_SEQ(benchmark::State& state) { BM_NSort_SEQ<int32_t, 32>(state, BM_NSort_std<int32_t, 32>); }
+#ifdef HAS_AVX2_
+void BM_NSort_32I32_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 32>(state, netsort_32_i32_avx2, -5000, 5000); }
+void BM_NSort_32I32_AVX2_SEQ(benchmark::State& state) { BM_NSort_SEQ<int32_t, 32>(state, netsort_32_i32_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_NSort_32I32_AVX512_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 32>(state, netsort_32_i32_avx512, -5000, 5000); }
+void BM_NSort_32I32_AVX512_SEQ(benchmark::State& state) { BM_NSort_SEQ<int32_t, 32>(state, netsort_32_i32_avx512); }
+#endif
+void BM_NSort_32FLT_QSORT_RND(benchmark::State& state)   { BM_NSort_RND<float, 32>(state, netsort_32_flt_qsort, -1.f, 1.f); }
+void BM_NSort_32FLT_QSORT_SEQ(benchmark::State& state)   { BM_NSort_SEQ<float, 32>(state, netsort_32_flt_qsort); }
+void BM_NSort_32FLT_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<float, 32>(state, BM_NSort_std<float, 32>, -1.f, 1.f); }
+void BM_NSort_32FLT_STDSORT_SEQ(benchmark::State& state) { BM_NSort_SEQ<float, 32>(state, BM_NSort_std<float, 32>); }
+#ifdef HAS_AVX_
+void BM_NSort_32FLT_AVX_RND(benchmark::State& state) { BM_NSort_RND<float, 32>(state, netsort_32_flt_avx, -1.f, 1.f); }
+void BM_NSort_32FLT_AVX_SEQ(benchmark::State& state) { BM_NSort_SEQ<float, 32>(state, netsort_32_flt_avx); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_NSort_32FLT_AVX512_RND(benchmark::State& state) { BM_NSort_RND<float, 32>(state, netsort_32_flt_avx512, -1.f, 1.f); }
+void BM_NSort_32FLT_AVX512_SEQ(benchmark::State& state) { BM_NSort_SEQ<float, 32>(state, netsort_32_flt_avx512); }
+#endif
+void BM_NSort_32DBL_QSORT_RND(benchmark::State& state)   { BM_NSort_RND<double, 32>(state, netsort_32_dbl_qsort, -1., 1.); }
+void BM_NSort_32DBL_QSORT_SEQ(benchmark::State& state)   { BM_NSort_SEQ<double, 32>(state, netsort_32_dbl_qsort); }
+void BM_NSort_32DBL_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<double, 32>(state, BM_NSort_std<double, 32>, -1., 1.); }
+void BM_NSort_32DBL_STDSORT_SEQ(benchmark::State& state) { BM_NSort_SEQ<double, 32>(state, BM_NSort_std<double, 32>); }
+#ifdef HAS_AVX_
+void BM_NSort_32DBL_AVX_RND(benchmark::State& state) { BM_NSort_RND<double, 32>(state, netsort_32_dbl_avx, -1., 1.); }
+void BM_NSort_32DBL_AVX_SEQ(benchmark::State& state) { BM_NSort_SEQ<double, 32>(state, netsort_32_dbl_avx); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_NSort_32DBL_AVX512_RND(benchmark::State& state) { BM_NSort_RND<double, 32>(state, netsort_32_dbl_avx512, -1., 1.); }
+void BM_NSort_32DBL_AVX512_SEQ(benchmark::State& state) { BM_NSort_SEQ<double, 32>(state, netsort_32_dbl_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_NSort_32I8_QSORT_RND);
+BENCHMARK(BM_NSort_32I8_QSORT_SEQ);
+BENCHMARK(BM_NSort_32I8_STDSORT_RND);
+BENCHMARK(BM_NSort_32I8_STDSORT_SEQ);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32I8_AVX2_RND);
+  BENCHMARK(BM_NSort_32I8_AVX2_SEQ);
+#endif
+BENCHMARK(BM_NSort_32I16_QSORT_RND);
+BENCHMARK(BM_NSort_32I16_QSORT_SEQ);
+BENCHMARK(BM_NSort_32I16_STDSORT_RND);
+BENCHMARK(BM_NSort_32I16_STDSORT_SEQ);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32I16_AVX2_RND);
+  BENCHMARK(BM_NSort_32I16_AVX2_SEQ);
+#endif
+BENCHMARK(BM_NSort_32I32_QSORT_RND);
+BENCHMARK(BM_NSort_32I32_QSORT_SEQ);
+BENCHMARK(BM_NSort_32I32_STDSORT_RND);
+BENCHMARK(BM_NSort_32I32_STDSORT_SEQ);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32I32_AVX2_RND);
+  BENCHMARK(BM_NSort_32I32_AVX2_SEQ);
+#endif
+#ifdef HAS_AVX512F_
+  BENCHMARK(BM_NSort_32I32_AVX512_RND);
+  BENCHMARK(BM_NSort_32I32_AVX512_SEQ);
+#endif
+BENCHMARK(BM_NSort_32FLT_QSORT_RND);
+BENCHMARK(BM_NSort_32FLT_QSORT_SEQ);
+BENCHMARK(BM_NSort_32FLT_STDSORT_RND);
+BENCHMARK(BM_NSort_32FLT_STDSORT_SEQ);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_32FLT_AVX_RND);
+  BENCHMARK(BM_NSort_32FLT_AVX_SEQ);
+#endif
+#ifdef HAS_AVX512F_
+  BENCHMARK(BM_NSort_32FLT_AVX512_RND);
+  BENCHMARK(BM_NSort_32FLT_AVX512_SEQ);
+#endif
+BENCHMARK(BM_NSort_32DBL_QSORT_RND);
+BENCHMARK(BM_NSort_32DBL_QSORT_SEQ);
+BENCHMARK(BM_NSort_32DBL_STDSORT_RND);
+BENCHMARK(BM_NSort_32DBL_STDSORT_SEQ);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_32DBL_AVX_RND);
+  BENCHMARK(BM_NSort_32DBL_AVX_SEQ);
+#endif
+#ifdef HAS_AVX512F_
+  BENCHMARK(BM_NSort_32DBL_AVX512_RND);
+  BENCHMARK(BM_NSort_32DBL_AVX512_SEQ);
+#endif
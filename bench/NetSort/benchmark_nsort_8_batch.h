@@ -0,0 +1,174 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_8_batch_i32.h"
+#include "NetSort/nsort_8_batch_flt.h"
+#include "NetSort/nsort_8_batch_i8.h"
+#include "NetSort/nsort_8_batch_i16.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_BATCH_GROUPS (16*INNER_LOOP)
+
+// Helpers
+template <typename T>
+static inline void BM_NSortBatch_Gen(std::vector<T>& v) { vec_rrd(v, (T)-5000, (T)5000); }
+static inline void BM_NSortBatch_Gen(std::vector<int8_t>& v) { vec_rrd(v, (int8_t)-127, (int8_t)127); }
+static inline void BM_NSortBatch_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+
+// Sort BM_BATCH_GROUPS groups of 8 values, one call
+template <typename T>
+static inline void BM_NSortBatch_RND(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(8*BM_BATCH_GROUPS), v1(8*BM_BATCH_GROUPS);
+  BM_NSortBatch_Gen(v0);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), v0.size()*sizeof(T));
+    state.ResumeTiming();
+    func(v1.data(), BM_BATCH_GROUPS);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+// Same, one group per call
+#ifdef HAS_AVX2_
+static inline void BM_NSortBatch_loop_i32_avx2(int32_t* v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_i32_avx2(v + 8*g);
+}
+#endif
+#ifdef HAS_SSSE3_
+static inline void BM_NSortBatch_loop_i8_sse(int8_t* v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_i8_sse(v + 8*g);
+}
+static inline void BM_NSortBatch_loop_i16_sse(int16_t* v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_i16_sse(v + 8*g);
+}
+#endif
+#ifdef HAS_AVX_
+static inline void BM_NSortBatch_loop_flt_avx(float* v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_flt_avx(v + 8*g);
+}
+#endif
+
+
+//
+void BM_NSortBatch_8I32_QSORT_RND(benchmark::State& state)  { BM_NSortBatch_RND<int32_t>(state, netsort_8_batch_i32_qsort); }
+#ifdef HAS_AVX2_
+void BM_NSortBatch_8I32_AVX2LOOP_RND(benchmark::State& state) { BM_NSortBatch_RND<int32_t>(state, BM_NSortBatch_loop_i32_avx2); }
+void BM_NSortBatch_8I32_AVX2_RND(benchmark::State& state)   { BM_NSortBatch_RND<int32_t>(state, netsort_8_batch_i32_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_NSortBatch_8I32_AVX512_RND(benchmark::State& state) { BM_NSortBatch_RND<int32_t>(state, netsort_8_batch_i32_avx512); }
+#endif
+void BM_NSortBatch_8FLT_QSORT_RND(benchmark::State& state)  { BM_NSortBatch_RND<float>(state, netsort_8_batch_flt_qsort); }
+#ifdef HAS_AVX_
+void BM_NSortBatch_8FLT_AVXLOOP_RND(benchmark::State& state) { BM_NSortBatch_RND<float>(state, BM_NSortBatch_loop_flt_avx); }
+void BM_NSortBatch_8FLT_AVX_RND(benchmark::State& state)    { BM_NSortBatch_RND<float>(state, netsort_8_batch_flt_avx); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_NSortBatch_8FLT_AVX512_RND(benchmark::State& state) { BM_NSortBatch_RND<float>(state, netsort_8_batch_flt_avx512); }
+#endif
+void BM_NSortBatch_8I8_QSORT_RND(benchmark::State& state)   { BM_NSortBatch_RND<int8_t>(state, netsort_8_batch_i8_qsort); }
+#ifdef HAS_SSSE3_
+void BM_NSortBatch_8I8_SSELOOP_RND(benchmark::State& state) { BM_NSortBatch_RND<int8_t>(state, BM_NSortBatch_loop_i8_sse); }
+#endif
+#ifdef HAS_SSE4_1_
+void BM_NSortBatch_8I8_SSE_RND(benchmark::State& state)     { BM_NSortBatch_RND<int8_t>(state, netsort_8_batch_i8_sse); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSortBatch_8I8_AVX2_RND(benchmark::State& state)    { BM_NSortBatch_RND<int8_t>(state, netsort_8_batch_i8_avx2); }
+#endif
+#ifdef HAS_AVX512BW_
+void BM_NSortBatch_8I8_AVX512_RND(benchmark::State& state)  { BM_NSortBatch_RND<int8_t>(state, netsort_8_batch_i8_avx512); }
+#endif
+void BM_NSortBatch_8I16_QSORT_RND(benchmark::State& state)   { BM_NSortBatch_RND<int16_t>(state, netsort_8_batch_i16_qsort); }
+#ifdef HAS_SSSE3_
+void BM_NSortBatch_8I16_SSELOOP_RND(benchmark::State& state) { BM_NSortBatch_RND<int16_t>(state, BM_NSortBatch_loop_i16_sse); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSortBatch_8I16_AVX2_RND(benchmark::State& state)    { BM_NSortBatch_RND<int16_t>(state, netsort_8_batch_i16_avx2); }
+#endif
+#ifdef HAS_AVX512BW_
+void BM_NSortBatch_8I16_AVX512_RND(benchmark::State& state)  { BM_NSortBatch_RND<int16_t>(state, netsort_8_batch_i16_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_NSortBatch_8I8_QSORT_RND);
+#ifdef HAS_SSSE3_
+BENCHMARK(BM_NSortBatch_8I8_SSELOOP_RND);
+#endif
+#ifdef HAS_SSE4_1_
+BENCHMARK(BM_NSortBatch_8I8_SSE_RND);
+#endif
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortBatch_8I8_AVX2_RND);
+#endif
+#ifdef HAS_AVX512BW_
+BENCHMARK(BM_NSortBatch_8I8_AVX512_RND);
+#endif
+BENCHMARK(BM_NSortBatch_8I16_QSORT_RND);
+#ifdef HAS_SSSE3_
+BENCHMARK(BM_NSortBatch_8I16_SSELOOP_RND);
+#endif
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortBatch_8I16_AVX2_RND);
+#endif
+#ifdef HAS_AVX512BW_
+BENCHMARK(BM_NSortBatch_8I16_AVX512_RND);
+#endif
+BENCHMARK(BM_NSortBatch_8I32_QSORT_RND);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortBatch_8I32_AVX2LOOP_RND);
+BENCHMARK(BM_NSortBatch_8I32_AVX2_RND);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_NSortBatch_8I32_AVX512_RND);
+#endif
+BENCHMARK(BM_NSortBatch_8FLT_QSORT_RND);
+#ifdef HAS_AVX_
+BENCHMARK(BM_NSortBatch_8FLT_AVXLOOP_RND);
+BENCHMARK(BM_NSortBatch_8FLT_AVX_RND);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_NSortBatch_8FLT_AVX512_RND);
+#endif
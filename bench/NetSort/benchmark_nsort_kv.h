@@ -0,0 +1,104 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_kv_i32.h"
+#include "NetSort/nsort_kv_i64.h"
+#include "NetSort/nsort_kv_flt.h"
+#include "NetSort/nsort_kv_dbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_KV_SETS 64  // input sets cycled through (no branch history learning)
+
+// Helpers
+template <typename K>
+static inline void BM_NSortKV_Gen(std::vector<K>& v) { vec_rrd(v, (K)-5000, (K)5000); }
+static inline void BM_NSortKV_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+static inline void BM_NSortKV_Gen(std::vector<double>& v) { vec_rrdf(v, -1., 1.); }
+
+// Argsort consecutive buckets of n keys (range parameter)
+template <typename K, typename P>
+static inline void BM_NSortKV_Arg(benchmark::State& state, void (*func)(const K*, P*, size_t)) {
+  const size_t n = state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<K> k(n*INNER_LOOP*BM_KV_SETS);
+  std::vector<P> idx(n*INNER_LOOP);
+  BM_NSortKV_Gen(k);
+  size_t set = 0;
+
+  for (auto _ : state)
+  {
+    const K* ks = k.data() + set*n*INNER_LOOP;
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(ks + i*n, idx.data() + i*n, n);
+    }
+    set = (set + 1) % BM_KV_SETS;
+    benchmark::ClobberMemory();
+  }
+  benchmark::DoNotOptimize(idx.data());
+}
+
+
+//
+void BM_NSortKV_I32_ARGSORT_STD(benchmark::State& state)  { BM_NSortKV_Arg<int32_t, int32_t>(state, netsort_argsort_i32_std); }
+#ifdef HAS_AVX2_
+void BM_NSortKV_I32_ARGSORT_AVX2(benchmark::State& state) { BM_NSortKV_Arg<int32_t, int32_t>(state, netsort_argsort_i32_avx2); }
+#endif
+void BM_NSortKV_FLT_ARGSORT_STD(benchmark::State& state)  { BM_NSortKV_Arg<float, int32_t>(state, netsort_argsort_flt_std); }
+#ifdef HAS_AVX2_
+void BM_NSortKV_FLT_ARGSORT_AVX2(benchmark::State& state) { BM_NSortKV_Arg<float, int32_t>(state, netsort_argsort_flt_avx2); }
+#endif
+void BM_NSortKV_I64_ARGSORT_STD(benchmark::State& state)  { BM_NSortKV_Arg<int64_t, int64_t>(state, netsort_argsort_i64_std); }
+#ifdef HAS_AVX2_
+void BM_NSortKV_I64_ARGSORT_AVX2(benchmark::State& state) { BM_NSortKV_Arg<int64_t, int64_t>(state, netsort_argsort_i64_avx2); }
+#endif
+void BM_NSortKV_DBL_ARGSORT_STD(benchmark::State& state)  { BM_NSortKV_Arg<double, int64_t>(state, netsort_argsort_dbl_std); }
+#ifdef HAS_AVX2_
+void BM_NSortKV_DBL_ARGSORT_AVX2(benchmark::State& state) { BM_NSortKV_Arg<double, int64_t>(state, netsort_argsort_dbl_avx2); }
+#endif
+
+
+//
+BENCHMARK(BM_NSortKV_I32_ARGSORT_STD)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortKV_I32_ARGSORT_AVX2)->DenseRange(8, 16, 8);
+#endif
+BENCHMARK(BM_NSortKV_FLT_ARGSORT_STD)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortKV_FLT_ARGSORT_AVX2)->DenseRange(8, 16, 8);
+#endif
+BENCHMARK(BM_NSortKV_I64_ARGSORT_STD)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortKV_I64_ARGSORT_AVX2)->DenseRange(8, 16, 8);
+#endif
+BENCHMARK(BM_NSortKV_DBL_ARGSORT_STD)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortKV_DBL_ARGSORT_AVX2)->DenseRange(8, 16, 8);
+#endif
@@ -0,0 +1,280 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_order.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+#ifndef BM_NSORT_RUN_
+#define BM_NSORT_RUN_
+template <typename T, size_t N>
+static inline void BM_NSort_std(T* __restrict v)
+{
+  std::sort(v, v + N);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_Run(benchmark::State& state, void (*func)(T*), const std::vector<T>& v0) {
+  std::vector<T> v1(v0.size());
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*INNER_LOOP*sizeof(T));
+    state.ResumeTiming();
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(v1.data() + i*N);
+    }
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_NSort_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+template <typename T, size_t N>
+static inline void BM_NSort_RND(benchmark::State& state, void (*func)(T*), T min, T max) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(N*INNER_LOOP);
+  BM_NSort_Gen(v0, min, max);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_SEQ(benchmark::State& state, void (*func)(T*)) {
+  std::vector<T> v0(N*INNER_LOOP);
+  for (size_t i=0; i<INNER_LOOP; ++i)
+    vec_seq(v0.data() + i*N, N, (T)0);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+#endif // BM_NSORT_RUN_
+
+// Reference descending sort
+template <typename T, size_t N>
+static inline void BM_NSort_std_desc(T* __restrict v)
+{
+  netsort_order_std<netsort_desc>(v, N);
+}
+
+
+//
+void BM_NSort_16I32_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 16>(state, BM_NSort_std_desc<int32_t, 16>, -5000, 5000); }
+#ifdef HAS_AVX2_
+void BM_NSort_16I32_ASC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 16>(state, netsort_16_i32_avx2_ord<netsort_asc>, -5000, 5000); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16I32_DESC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 16>(state, netsort_16_i32_avx2_ord<netsort_desc>, -5000, 5000); }
+#endif
+void BM_NSort_16I64_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 16>(state, BM_NSort_std_desc<int64_t, 16>, (int64_t)-5000, (int64_t)5000); }
+#ifdef HAS_AVX2_
+void BM_NSort_16I64_ASC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 16>(state, netsort_16_i64_avx2_ord<netsort_asc>, (int64_t)-5000, (int64_t)5000); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16I64_DESC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 16>(state, netsort_16_i64_avx2_ord<netsort_desc>, (int64_t)-5000, (int64_t)5000); }
+#endif
+void BM_NSort_16FLT_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, BM_NSort_std_desc<float, 16>, -1.f, 1.f); }
+#ifdef HAS_AVX_
+void BM_NSort_16FLT_ASC_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, netsort_16_flt_avx_ord<netsort_asc>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX_
+void BM_NSort_16FLT_DESC_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, netsort_16_flt_avx_ord<netsort_desc>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16FLT_ABS_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, netsort_16_flt_avx_ord<netsort_abs>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16FLT_TOTAL_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, netsort_16_flt_avx_ord<netsort_total>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16FLT_NANLAST_RND(benchmark::State& state) { BM_NSort_RND<float, 16>(state, netsort_16_flt_avx_ord<netsort_nan_last>, -1.f, 1.f); }
+#endif
+void BM_NSort_16DBL_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, BM_NSort_std_desc<double, 16>, -1., 1.); }
+#ifdef HAS_AVX_
+void BM_NSort_16DBL_ASC_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, netsort_16_dbl_avx_ord<netsort_asc>, -1., 1.); }
+#endif
+#ifdef HAS_AVX_
+void BM_NSort_16DBL_DESC_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, netsort_16_dbl_avx_ord<netsort_desc>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16DBL_ABS_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, netsort_16_dbl_avx_ord<netsort_abs>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16DBL_TOTAL_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, netsort_16_dbl_avx_ord<netsort_total>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_16DBL_NANLAST_RND(benchmark::State& state) { BM_NSort_RND<double, 16>(state, netsort_16_dbl_avx_ord<netsort_nan_last>, -1., 1.); }
+#endif
+void BM_NSort_64I32_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 64>(state, BM_NSort_std_desc<int32_t, 64>, -5000, 5000); }
+#ifdef HAS_AVX2_
+void BM_NSort_64I32_ASC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 64>(state, netsort_64_i32_avx2_ord<netsort_asc>, -5000, 5000); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64I32_DESC_RND(benchmark::State& state) { BM_NSort_RND<int32_t, 64>(state, netsort_64_i32_avx2_ord<netsort_desc>, -5000, 5000); }
+#endif
+void BM_NSort_64I64_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 64>(state, BM_NSort_std_desc<int64_t, 64>, (int64_t)-5000, (int64_t)5000); }
+#ifdef HAS_AVX2_
+void BM_NSort_64I64_ASC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 64>(state, netsort_64_i64_avx2_ord<netsort_asc>, (int64_t)-5000, (int64_t)5000); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64I64_DESC_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 64>(state, netsort_64_i64_avx2_ord<netsort_desc>, (int64_t)-5000, (int64_t)5000); }
+#endif
+void BM_NSort_64FLT_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, BM_NSort_std_desc<float, 64>, -1.f, 1.f); }
+#ifdef HAS_AVX_
+void BM_NSort_64FLT_ASC_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, netsort_64_flt_avx_ord<netsort_asc>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX_
+void BM_NSort_64FLT_DESC_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, netsort_64_flt_avx_ord<netsort_desc>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64FLT_ABS_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, netsort_64_flt_avx_ord<netsort_abs>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64FLT_TOTAL_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, netsort_64_flt_avx_ord<netsort_total>, -1.f, 1.f); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64FLT_NANLAST_RND(benchmark::State& state) { BM_NSort_RND<float, 64>(state, netsort_64_flt_avx_ord<netsort_nan_last>, -1.f, 1.f); }
+#endif
+void BM_NSort_64DBL_STDSORT_DESC_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, BM_NSort_std_desc<double, 64>, -1., 1.); }
+#ifdef HAS_AVX_
+void BM_NSort_64DBL_ASC_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, netsort_64_dbl_avx_ord<netsort_asc>, -1., 1.); }
+#endif
+#ifdef HAS_AVX_
+void BM_NSort_64DBL_DESC_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, netsort_64_dbl_avx_ord<netsort_desc>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64DBL_ABS_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, netsort_64_dbl_avx_ord<netsort_abs>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64DBL_TOTAL_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, netsort_64_dbl_avx_ord<netsort_total>, -1., 1.); }
+#endif
+#ifdef HAS_AVX2_
+void BM_NSort_64DBL_NANLAST_RND(benchmark::State& state) { BM_NSort_RND<double, 64>(state, netsort_64_dbl_avx_ord<netsort_nan_last>, -1., 1.); }
+#endif
+
+
+//
+BENCHMARK(BM_NSort_16I32_STDSORT_DESC_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16I32_ASC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16I32_DESC_RND);
+#endif
+BENCHMARK(BM_NSort_16I64_STDSORT_DESC_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16I64_ASC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16I64_DESC_RND);
+#endif
+BENCHMARK(BM_NSort_16FLT_STDSORT_DESC_RND);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_16FLT_ASC_RND);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_16FLT_DESC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16FLT_ABS_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16FLT_TOTAL_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16FLT_NANLAST_RND);
+#endif
+BENCHMARK(BM_NSort_16DBL_STDSORT_DESC_RND);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_16DBL_ASC_RND);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_16DBL_DESC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16DBL_ABS_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16DBL_TOTAL_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16DBL_NANLAST_RND);
+#endif
+BENCHMARK(BM_NSort_64I32_STDSORT_DESC_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64I32_ASC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64I32_DESC_RND);
+#endif
+BENCHMARK(BM_NSort_64I64_STDSORT_DESC_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64I64_ASC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64I64_DESC_RND);
+#endif
+BENCHMARK(BM_NSort_64FLT_STDSORT_DESC_RND);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_64FLT_ASC_RND);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_64FLT_DESC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64FLT_ABS_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64FLT_TOTAL_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64FLT_NANLAST_RND);
+#endif
+BENCHMARK(BM_NSort_64DBL_STDSORT_DESC_RND);
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_64DBL_ASC_RND);
+#endif
+#ifdef HAS_AVX_
+  BENCHMARK(BM_NSort_64DBL_DESC_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64DBL_ABS_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64DBL_TOTAL_RND);
+#endif
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64DBL_NANLAST_RND);
+#endif
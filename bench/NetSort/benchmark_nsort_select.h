@@ -0,0 +1,135 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_select_i16.h"
+#include "NetSort/nsort_select_i32.h"
+#include "NetSort/nsort_select_flt.h"
+#include "NetSort/nsort_select_dbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_FILTER_SIZE  (64*INNER_LOOP)
+#define BM_SELECT_GROUPS (16*INNER_LOOP)
+
+// Helpers
+template <typename T>
+static inline void BM_NSelect_Gen(std::vector<T>& v) { vec_rrd(v, (T)-5000, (T)5000); }
+static inline void BM_NSelect_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+static inline void BM_NSelect_Gen(std::vector<double>& v) { vec_rrdf(v, -1., 1.); }
+
+// Median filter over BM_FILTER_SIZE values, window of state.range(0) values
+template <typename T>
+static inline void BM_NSelect_Filter_RND(benchmark::State& state, void (*func)(const T*, size_t, size_t, T*)) {
+  std::srand(SRAND_SEED);
+  const size_t w = (size_t)state.range(0);
+  std::vector<T> v(BM_FILTER_SIZE), out(BM_FILTER_SIZE);
+  BM_NSelect_Gen(v);
+
+  for (auto _ : state)
+  {
+    func(v.data(), v.size(), w, out.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * (BM_FILTER_SIZE - w + 1));
+}
+
+// k-th smallest (median) of BM_SELECT_GROUPS groups of state.range(0) values
+template <typename T>
+static inline void BM_NSelect_Kth_RND(benchmark::State& state, void (*func8)(const T*, size_t, size_t, T*),
+                                                               void (*func16)(const T*, size_t, size_t, T*)) {
+  std::srand(SRAND_SEED);
+  const size_t n = (size_t)state.range(0);
+  std::vector<T> v(n*BM_SELECT_GROUPS), out(BM_SELECT_GROUPS);
+  BM_NSelect_Gen(v);
+
+  for (auto _ : state)
+  {
+    (n == 8 ? func8 : func16)(v.data(), BM_SELECT_GROUPS, n/2, out.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * BM_SELECT_GROUPS);
+}
+
+
+//
+void BM_NSelect_FilterI16_STD_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<int16_t>(state, netselect_median_filter_i16_std); }
+#ifdef HAS_AVX2_
+void BM_NSelect_FilterI16_AVX2_RND(benchmark::State& state) { BM_NSelect_Filter_RND<int16_t>(state, netselect_median_filter_i16_avx2); }
+#endif
+void BM_NSelect_FilterI32_STD_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<int32_t>(state, netselect_median_filter_i32_std); }
+#ifdef HAS_AVX2_
+void BM_NSelect_FilterI32_AVX2_RND(benchmark::State& state) { BM_NSelect_Filter_RND<int32_t>(state, netselect_median_filter_i32_avx2); }
+#endif
+void BM_NSelect_FilterFLT_STD_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<float>(state, netselect_median_filter_flt_std); }
+#ifdef HAS_AVX_
+void BM_NSelect_FilterFLT_AVX_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<float>(state, netselect_median_filter_flt_avx); }
+#endif
+void BM_NSelect_FilterDBL_STD_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<double>(state, netselect_median_filter_dbl_std); }
+#ifdef HAS_AVX_
+void BM_NSelect_FilterDBL_AVX_RND(benchmark::State& state)  { BM_NSelect_Filter_RND<double>(state, netselect_median_filter_dbl_avx); }
+#endif
+
+void BM_NSelect_KthI32_STD_RND(benchmark::State& state)  { BM_NSelect_Kth_RND<int32_t>(state, netselect_kth_8_batch_i32_std, netselect_kth_16_batch_i32_std); }
+#ifdef HAS_AVX2_
+void BM_NSelect_KthI32_AVX2_RND(benchmark::State& state) { BM_NSelect_Kth_RND<int32_t>(state, netselect_kth_8_batch_i32_avx2, netselect_kth_16_batch_i32_avx2); }
+#endif
+void BM_NSelect_KthFLT_STD_RND(benchmark::State& state)  { BM_NSelect_Kth_RND<float>(state, netselect_kth_8_batch_flt_std, netselect_kth_16_batch_flt_std); }
+#ifdef HAS_AVX_
+void BM_NSelect_KthFLT_AVX_RND(benchmark::State& state)  { BM_NSelect_Kth_RND<float>(state, netselect_kth_8_batch_flt_avx, netselect_kth_16_batch_flt_avx); }
+#endif
+
+
+// Window of 3/5/9/25 values
+BENCHMARK(BM_NSelect_FilterI16_STD_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSelect_FilterI16_AVX2_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#endif
+BENCHMARK(BM_NSelect_FilterI32_STD_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSelect_FilterI32_AVX2_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#endif
+BENCHMARK(BM_NSelect_FilterFLT_STD_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#ifdef HAS_AVX_
+BENCHMARK(BM_NSelect_FilterFLT_AVX_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#endif
+BENCHMARK(BM_NSelect_FilterDBL_STD_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#ifdef HAS_AVX_
+BENCHMARK(BM_NSelect_FilterDBL_AVX_RND)->Arg(3)->Arg(5)->Arg(9)->Arg(25);
+#endif
+
+// Groups of 8/16 values
+BENCHMARK(BM_NSelect_KthI32_STD_RND)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSelect_KthI32_AVX2_RND)->DenseRange(8, 16, 8);
+#endif
+BENCHMARK(BM_NSelect_KthFLT_STD_RND)->DenseRange(8, 16, 8);
+#ifdef HAS_AVX_
+BENCHMARK(BM_NSelect_KthFLT_AVX_RND)->DenseRange(8, 16, 8);
+#endif
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_small_i8.h"
+#include "NetSort/nsort_small_i16.h"
+#include "NetSort/nsort_small_i32.h"
+#include "NetSort/nsort_small_flt.h"
+#include "NetSort/nsort_small_dbl.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_SMALL_MIN 2
+#define BM_SMALL_MAX 64
+#define BM_SMALL_INC 5
+
+// Helpers
+template <typename T>
+static inline void BM_NSortSmall_std(T* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+template <typename T>
+static inline void BM_NSortSmall_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_NSortSmall_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_NSortSmall_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+// Consecutive buckets of n values (range parameter)
+template <typename T>
+static inline void BM_NSortSmall_RND(benchmark::State& state, void (*func)(T*, size_t), T min, T max) {
+  const size_t n = state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(n*INNER_LOOP);
+  BM_NSortSmall_Gen(v0, min, max);
+  std::vector<T> v1(v0.size());
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), n*INNER_LOOP*sizeof(T));
+    state.ResumeTiming();
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(v1.data() + i*n, n);
+    }
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+
+//
+void BM_NSortSmall_I8_STDSORT(benchmark::State& state) { BM_NSortSmall_RND<int8_t>(state, BM_NSortSmall_std<int8_t>, (int8_t)-127, (int8_t)127); }
+#ifdef HAS_AVX2_
+void BM_NSortSmall_I8_AVX2(benchmark::State& state)    { BM_NSortSmall_RND<int8_t>(state, netsort_small_i8_avx2, (int8_t)-127, (int8_t)127); }
+#endif
+void BM_NSortSmall_I16_STDSORT(benchmark::State& state) { BM_NSortSmall_RND<int16_t>(state, BM_NSortSmall_std<int16_t>, (int16_t)-5000, (int16_t)5000); }
+#ifdef HAS_AVX2_
+void BM_NSortSmall_I16_AVX2(benchmark::State& state)    { BM_NSortSmall_RND<int16_t>(state, netsort_small_i16_avx2, (int16_t)-5000, (int16_t)5000); }
+#endif
+void BM_NSortSmall_I32_QSORT(benchmark::State& state)   { BM_NSortSmall_RND<int32_t>(state, netsort_small_i32_qsort, -5000, 5000); }
+void BM_NSortSmall_I32_STDSORT(benchmark::State& state) { BM_NSortSmall_RND<int32_t>(state, BM_NSortSmall_std<int32_t>, -5000, 5000); }
+#ifdef HAS_AVX2_
+void BM_NSortSmall_I32_AVX2(benchmark::State& state)    { BM_NSortSmall_RND<int32_t>(state, netsort_small_i32_avx2, -5000, 5000); }
+#endif
+void BM_NSortSmall_FLT_STDSORT(benchmark::State& state) { BM_NSortSmall_RND<float>(state, BM_NSortSmall_std<float>, -1.f, 1.f); }
+#ifdef HAS_AVX2_
+void BM_NSortSmall_FLT_AVX2(benchmark::State& state)    { BM_NSortSmall_RND<float>(state, netsort_small_flt_avx2, -1.f, 1.f); }
+#endif
+void BM_NSortSmall_DBL_STDSORT(benchmark::State& state) { BM_NSortSmall_RND<double>(state, BM_NSortSmall_std<double>, -1., 1.); }
+#ifdef HAS_AVX2_
+void BM_NSortSmall_DBL_AVX2(benchmark::State& state)    { BM_NSortSmall_RND<double>(state, netsort_small_dbl_avx2, -1., 1.); }
+#endif
+
+//
+BENCHMARK(BM_NSortSmall_I8_STDSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSmall_I8_AVX2)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#endif
+BENCHMARK(BM_NSortSmall_I16_STDSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSmall_I16_AVX2)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#endif
+BENCHMARK(BM_NSortSmall_I32_QSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+BENCHMARK(BM_NSortSmall_I32_STDSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSmall_I32_AVX2)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#endif
+BENCHMARK(BM_NSortSmall_FLT_STDSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSmall_FLT_AVX2)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#endif
+BENCHMARK(BM_NSortSmall_DBL_STDSORT)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSmall_DBL_AVX2)->DenseRange(BM_SMALL_MIN, BM_SMALL_MAX, BM_SMALL_INC);
+#endif
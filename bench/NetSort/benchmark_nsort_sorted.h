@@ -0,0 +1,152 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_sorted.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_SORTED_MIN (1<<6)
+#define BM_SORTED_MAX (1<<16)
+#define BM_ADAPTIVE_MIN 4
+#define BM_ADAPTIVE_MAX 64
+#define BM_ADAPTIVE_INC 12
+#define BM_ADAPTIVE_SHF 0.05f
+
+// Helpers
+template <typename T>
+static inline void BM_NSortAdaptive_small(T* __restrict v, size_t n) { netsort_small(v, n); }
+template <typename T>
+static inline void BM_NSortAdaptive_adaptive(T* __restrict v, size_t n) { netsort_adaptive(v, n); }
+
+// Full scan of an already sorted array (worst case)
+template <typename T>
+static inline void BM_NSortSorted(benchmark::State& state, bool (*func)(const T*, size_t)) {
+  const size_t n = state.range(0);
+  std::vector<T> v(n);
+  for (size_t i=0; i<n; ++i)
+    v[i] = (T)(i * 100 / n);
+
+  bool r = true;
+  for (auto _ : state)
+  {
+    r &= func(v.data(), n);
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(T));
+}
+
+// Consecutive buckets of n values: sorted (0), nearly sorted (1, 'vec_shf') or random (2)
+template <typename T>
+static inline void BM_NSortAdaptive(benchmark::State& state, void (*func)(T*, size_t), int kind) {
+  const size_t n = state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(n*INNER_LOOP);
+  std::vector<int> b(n);
+  for (size_t i=0; i<INNER_LOOP; ++i)
+  {
+    if (kind == 2)
+      vec_rrd(b, -5000, 5000);
+    else
+      vec_shf(b, kind == 1 ? BM_ADAPTIVE_SHF : 0.f);
+    for (size_t j=0; j<n; ++j)
+      v0[i*n + j] = (T)b[j];
+  }
+  std::vector<T> v1(v0.size());
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), n*INNER_LOOP*sizeof(T));
+    state.ResumeTiming();
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(v1.data() + i*n, n);
+    }
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+
+//
+void BM_NSortSorted_I8_STD(benchmark::State& state)   { BM_NSortSorted<int8_t>(state, netsort_is_sorted_std<int8_t>); }
+void BM_NSortSorted_I32_STD(benchmark::State& state)  { BM_NSortSorted<int32_t>(state, netsort_is_sorted_std<int32_t>); }
+void BM_NSortSorted_FLT_STD(benchmark::State& state)  { BM_NSortSorted<float>(state, netsort_is_sorted_std<float>); }
+void BM_NSortSorted_DBL_STD(benchmark::State& state)  { BM_NSortSorted<double>(state, netsort_is_sorted_std<double>); }
+#ifdef HAS_AVX2_
+void BM_NSortSorted_I8_AVX2(benchmark::State& state)  { BM_NSortSorted<int8_t>(state, netsort_is_sorted_avx2<int8_t>); }
+void BM_NSortSorted_I32_AVX2(benchmark::State& state) { BM_NSortSorted<int32_t>(state, netsort_is_sorted_avx2<int32_t>); }
+void BM_NSortSorted_FLT_AVX2(benchmark::State& state) { BM_NSortSorted<float>(state, netsort_is_sorted_avx2<float>); }
+void BM_NSortSorted_DBL_AVX2(benchmark::State& state) { BM_NSortSorted<double>(state, netsort_is_sorted_avx2<double>); }
+#endif
+
+void BM_NSortAdaptive_I32_SEQ_SMALL(benchmark::State& state)    { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_small<int32_t>, 0); }
+void BM_NSortAdaptive_I32_SEQ_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_adaptive<int32_t>, 0); }
+void BM_NSortAdaptive_I32_SHF_SMALL(benchmark::State& state)    { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_small<int32_t>, 1); }
+void BM_NSortAdaptive_I32_SHF_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_adaptive<int32_t>, 1); }
+void BM_NSortAdaptive_I32_RND_SMALL(benchmark::State& state)    { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_small<int32_t>, 2); }
+void BM_NSortAdaptive_I32_RND_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<int32_t>(state, BM_NSortAdaptive_adaptive<int32_t>, 2); }
+void BM_NSortAdaptive_FLT_SEQ_SMALL(benchmark::State& state)    { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_small<float>, 0); }
+void BM_NSortAdaptive_FLT_SEQ_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_adaptive<float>, 0); }
+void BM_NSortAdaptive_FLT_SHF_SMALL(benchmark::State& state)    { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_small<float>, 1); }
+void BM_NSortAdaptive_FLT_SHF_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_adaptive<float>, 1); }
+void BM_NSortAdaptive_FLT_RND_SMALL(benchmark::State& state)    { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_small<float>, 2); }
+void BM_NSortAdaptive_FLT_RND_ADAPTIVE(benchmark::State& state) { BM_NSortAdaptive<float>(state, BM_NSortAdaptive_adaptive<float>, 2); }
+
+//
+BENCHMARK(BM_NSortSorted_I8_STD)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSorted_I8_AVX2)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#endif
+BENCHMARK(BM_NSortSorted_I32_STD)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSorted_I32_AVX2)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#endif
+BENCHMARK(BM_NSortSorted_FLT_STD)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSorted_FLT_AVX2)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#endif
+BENCHMARK(BM_NSortSorted_DBL_STD)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_NSortSorted_DBL_AVX2)->Range(BM_SORTED_MIN, BM_SORTED_MAX);
+#endif
+
+BENCHMARK(BM_NSortAdaptive_I32_SEQ_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_I32_SEQ_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_I32_SHF_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_I32_SHF_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_I32_RND_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_I32_RND_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_SEQ_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_SEQ_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_SHF_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_SHF_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_RND_SMALL)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
+BENCHMARK(BM_NSortAdaptive_FLT_RND_ADAPTIVE)->DenseRange(BM_ADAPTIVE_MIN, BM_ADAPTIVE_MAX, BM_ADAPTIVE_INC);
@@ -0,0 +1,253 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "NetSort/nsort_u8.h"
+#include "NetSort/nsort_u16.h"
+#include "NetSort/nsort_u32.h"
+#include "NetSort/nsort_i64.h"
+#include "NetSort/nsort_u64.h"
+
+// Constants
+#ifndef INNER_LOOP
+  #define INNER_LOOP 50
+#endif
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+#ifndef BM_NSORT_RUN_
+#define BM_NSORT_RUN_
+template <typename T, size_t N>
+static inline void BM_NSort_std(T* __restrict v)
+{
+  std::sort(v, v + N);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_Run(benchmark::State& state, void (*func)(T*), const std::vector<T>& v0) {
+  std::vector<T> v1(v0.size());
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*INNER_LOOP*sizeof(T));
+    state.ResumeTiming();
+    for (size_t i=0; i<INNER_LOOP; ++i) {
+      func(v1.data() + i*N);
+    }
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_NSort_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_NSort_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+template <typename T, size_t N>
+static inline void BM_NSort_RND(benchmark::State& state, void (*func)(T*), T min, T max) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0(N*INNER_LOOP);
+  BM_NSort_Gen(v0, min, max);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+
+template <typename T, size_t N>
+static inline void BM_NSort_SEQ(benchmark::State& state, void (*func)(T*)) {
+  std::vector<T> v0(N*INNER_LOOP);
+  for (size_t i=0; i<INNER_LOOP; ++i)
+    vec_seq(v0.data() + i*N, N, (T)0);
+  BM_NSort_Run<T, N>(state, func, v0);
+}
+#endif // BM_NSORT_RUN_
+
+
+//
+void BM_NSort_8U8_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 8>(state, BM_NSort_std<uint8_t, 8>, (uint8_t)0, (uint8_t)255); }
+#ifdef HAS_SSSE3_
+void BM_NSort_8U8_SSE_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 8>(state, netsort_8_u8_sse, (uint8_t)0, (uint8_t)255); }
+#endif
+void BM_NSort_16U8_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 16>(state, BM_NSort_std<uint8_t, 16>, (uint8_t)0, (uint8_t)255); }
+#ifdef HAS_SSE4_1_
+void BM_NSort_16U8_SSE_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 16>(state, netsort_16_u8_sse, (uint8_t)0, (uint8_t)255); }
+#endif
+void BM_NSort_32U8_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 32>(state, BM_NSort_std<uint8_t, 32>, (uint8_t)0, (uint8_t)255); }
+#ifdef HAS_AVX2_
+void BM_NSort_32U8_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 32>(state, netsort_32_u8_avx2, (uint8_t)0, (uint8_t)255); }
+#endif
+void BM_NSort_64U8_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 64>(state, BM_NSort_std<uint8_t, 64>, (uint8_t)0, (uint8_t)255); }
+#ifdef HAS_AVX2_
+void BM_NSort_64U8_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint8_t, 64>(state, netsort_64_u8_avx2, (uint8_t)0, (uint8_t)255); }
+#endif
+void BM_NSort_8U16_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 8>(state, BM_NSort_std<uint16_t, 8>, (uint16_t)0, (uint16_t)65535); }
+#ifdef HAS_SSSE3_
+void BM_NSort_8U16_SSE_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 8>(state, netsort_8_u16_sse, (uint16_t)0, (uint16_t)65535); }
+#endif
+void BM_NSort_16U16_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 16>(state, BM_NSort_std<uint16_t, 16>, (uint16_t)0, (uint16_t)65535); }
+#ifdef HAS_AVX2_
+void BM_NSort_16U16_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 16>(state, netsort_16_u16_avx2, (uint16_t)0, (uint16_t)65535); }
+#endif
+void BM_NSort_32U16_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 32>(state, BM_NSort_std<uint16_t, 32>, (uint16_t)0, (uint16_t)65535); }
+#ifdef HAS_AVX2_
+void BM_NSort_32U16_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 32>(state, netsort_32_u16_avx2, (uint16_t)0, (uint16_t)65535); }
+#endif
+void BM_NSort_64U16_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 64>(state, BM_NSort_std<uint16_t, 64>, (uint16_t)0, (uint16_t)65535); }
+#ifdef HAS_AVX2_
+void BM_NSort_64U16_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint16_t, 64>(state, netsort_64_u16_avx2, (uint16_t)0, (uint16_t)65535); }
+#endif
+void BM_NSort_8U32_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 8>(state, BM_NSort_std<uint32_t, 8>, (uint32_t)0, (uint32_t)4000000000u); }
+#ifdef HAS_AVX2_
+void BM_NSort_8U32_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 8>(state, netsort_8_u32_avx2, (uint32_t)0, (uint32_t)4000000000u); }
+#endif
+void BM_NSort_16U32_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 16>(state, BM_NSort_std<uint32_t, 16>, (uint32_t)0, (uint32_t)4000000000u); }
+#ifdef HAS_AVX2_
+void BM_NSort_16U32_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 16>(state, netsort_16_u32_avx2, (uint32_t)0, (uint32_t)4000000000u); }
+#endif
+void BM_NSort_32U32_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 32>(state, BM_NSort_std<uint32_t, 32>, (uint32_t)0, (uint32_t)4000000000u); }
+#ifdef HAS_AVX2_
+void BM_NSort_32U32_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 32>(state, netsort_32_u32_avx2, (uint32_t)0, (uint32_t)4000000000u); }
+#endif
+void BM_NSort_64U32_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 64>(state, BM_NSort_std<uint32_t, 64>, (uint32_t)0, (uint32_t)4000000000u); }
+#ifdef HAS_AVX2_
+void BM_NSort_64U32_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint32_t, 64>(state, netsort_64_u32_avx2, (uint32_t)0, (uint32_t)4000000000u); }
+#endif
+void BM_NSort_8I64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 8>(state, BM_NSort_std<int64_t, 8>, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#ifdef HAS_AVX2_
+void BM_NSort_8I64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 8>(state, netsort_8_i64_avx2, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#endif
+void BM_NSort_16I64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 16>(state, BM_NSort_std<int64_t, 16>, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#ifdef HAS_AVX2_
+void BM_NSort_16I64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 16>(state, netsort_16_i64_avx2, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#endif
+void BM_NSort_32I64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 32>(state, BM_NSort_std<int64_t, 32>, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#ifdef HAS_AVX2_
+void BM_NSort_32I64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 32>(state, netsort_32_i64_avx2, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#endif
+void BM_NSort_64I64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 64>(state, BM_NSort_std<int64_t, 64>, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#ifdef HAS_AVX2_
+void BM_NSort_64I64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<int64_t, 64>(state, netsort_64_i64_avx2, (int64_t)-4000000000000000000ll, (int64_t)4000000000000000000ll); }
+#endif
+void BM_NSort_8U64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 8>(state, BM_NSort_std<uint64_t, 8>, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#ifdef HAS_AVX2_
+void BM_NSort_8U64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 8>(state, netsort_8_u64_avx2, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#endif
+void BM_NSort_16U64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 16>(state, BM_NSort_std<uint64_t, 16>, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#ifdef HAS_AVX2_
+void BM_NSort_16U64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 16>(state, netsort_16_u64_avx2, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#endif
+void BM_NSort_32U64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 32>(state, BM_NSort_std<uint64_t, 32>, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#ifdef HAS_AVX2_
+void BM_NSort_32U64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 32>(state, netsort_32_u64_avx2, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#endif
+void BM_NSort_64U64_STDSORT_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 64>(state, BM_NSort_std<uint64_t, 64>, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#ifdef HAS_AVX2_
+void BM_NSort_64U64_AVX2_RND(benchmark::State& state) { BM_NSort_RND<uint64_t, 64>(state, netsort_64_u64_avx2, (uint64_t)0, (uint64_t)18000000000000000000ull); }
+#endif
+
+
+//
+BENCHMARK(BM_NSort_8U8_STDSORT_RND);
+#ifdef HAS_SSSE3_
+  BENCHMARK(BM_NSort_8U8_SSE_RND);
+#endif
+BENCHMARK(BM_NSort_16U8_STDSORT_RND);
+#ifdef HAS_SSE4_1_
+  BENCHMARK(BM_NSort_16U8_SSE_RND);
+#endif
+BENCHMARK(BM_NSort_32U8_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32U8_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_64U8_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64U8_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_8U16_STDSORT_RND);
+#ifdef HAS_SSSE3_
+  BENCHMARK(BM_NSort_8U16_SSE_RND);
+#endif
+BENCHMARK(BM_NSort_16U16_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16U16_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_32U16_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32U16_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_64U16_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64U16_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_8U32_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_8U32_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_16U32_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16U32_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_32U32_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32U32_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_64U32_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64U32_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_8I64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_8I64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_16I64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16I64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_32I64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32I64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_64I64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64I64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_8U64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_8U64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_16U64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_16U64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_32U64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_32U64_AVX2_RND);
+#endif
+BENCHMARK(BM_NSort_64U64_STDSORT_RND);
+#ifdef HAS_AVX2_
+  BENCHMARK(BM_NSort_64U64_AVX2_RND);
+#endif
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Google benchmark
+#include <benchmark/benchmark.h>
+
+// Options
+//#define SRAND_SEED 55150
+
+#define BM_MULT 8     // Sparse range multiplier
+#ifndef BM_MULT       // or
+  #define BM_INC 1<<17 // Dense range increment
+#endif
+#define BM_MIN 1<<10  // 1024
+#define BM_MAX 1<<20  // 1048576
+
+// Helper
+#ifdef BM_MULT
+  constexpr int bm_mult = BM_MULT;
+  #define BM_PARAM bm_mult
+  #define BM_RANGE(mult, min, max) RangeMultiplier(mult)->Range(min, max)
+#else
+  constexpr int bm_inc = BM_INC;
+  #define BM_PARAM bm_inc
+  #define BM_RANGE(inc, min, max) DenseRange(min, max, inc)
+#endif
+
+
+// Benchmarks
+#include "benchmark_ssort_i32.h"
+#include "benchmark_ssort_u32.h"
+#include "benchmark_ssort_i64.h"
+#include "benchmark_ssort_flt.h"
+#include "benchmark_ssort_dbl.h"
+#include "benchmark_ssort_merge.h"
+#include "benchmark_ssort_topk.h"
+#include "benchmark_ssort_hybrid.h"
+#include "benchmark_ssort_radix.h"
+#include "benchmark_ssort_parallel.h"
+#include "benchmark_ssort_records.h"
+#include "benchmark_ssort_unique.h"
+#include "benchmark_ssort_partition.h"
+
+
+//
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Base case size
+//#define SSORT_FLT_BASE 64
+#include "SimdSort/ssort_flt.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+//
+void BM_SSort_FLT_STD_RND(benchmark::State& state) { BM_SSort_RND<float>(state, simdsort_flt_std, -1.f, 1.f); }
+void BM_SSort_FLT_STD_SEQ(benchmark::State& state) { BM_SSort_SEQ<float>(state, simdsort_flt_std); }
+void BM_SSort_FLT_STD_INV(benchmark::State& state) { BM_SSort_INV<float>(state, simdsort_flt_std); }
+void BM_SSort_FLT_STD_FEW(benchmark::State& state) { BM_SSort_FEW<float>(state, simdsort_flt_std); }
+void BM_SSort_FLT_QSORT_RND(benchmark::State& state) { BM_SSort_RND<float>(state, simdsort_flt_qsort, -1.f, 1.f); }
+void BM_SSort_FLT_QSORT_SEQ(benchmark::State& state) { BM_SSort_SEQ<float>(state, simdsort_flt_qsort); }
+void BM_SSort_FLT_QSORT_INV(benchmark::State& state) { BM_SSort_INV<float>(state, simdsort_flt_qsort); }
+void BM_SSort_FLT_QSORT_FEW(benchmark::State& state) { BM_SSort_FEW<float>(state, simdsort_flt_qsort); }
+#ifdef HAS_AVX2_
+void BM_SSort_FLT_AVX2_RND(benchmark::State& state) { BM_SSort_RND<float>(state, simdsort_flt_avx2, -1.f, 1.f); }
+void BM_SSort_FLT_AVX2_SEQ(benchmark::State& state) { BM_SSort_SEQ<float>(state, simdsort_flt_avx2); }
+void BM_SSort_FLT_AVX2_INV(benchmark::State& state) { BM_SSort_INV<float>(state, simdsort_flt_avx2); }
+void BM_SSort_FLT_AVX2_FEW(benchmark::State& state) { BM_SSort_FEW<float>(state, simdsort_flt_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSort_FLT_AVX512_RND(benchmark::State& state) { BM_SSort_RND<float>(state, simdsort_flt_avx512, -1.f, 1.f); }
+void BM_SSort_FLT_AVX512_SEQ(benchmark::State& state) { BM_SSort_SEQ<float>(state, simdsort_flt_avx512); }
+void BM_SSort_FLT_AVX512_INV(benchmark::State& state) { BM_SSort_INV<float>(state, simdsort_flt_avx512); }
+void BM_SSort_FLT_AVX512_FEW(benchmark::State& state) { BM_SSort_FEW<float>(state, simdsort_flt_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_SSort_FLT_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_QSORT_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_QSORT_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_QSORT_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_QSORT_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSort_FLT_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX2_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX2_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSort_FLT_AVX512_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX512_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX512_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_FLT_AVX512_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
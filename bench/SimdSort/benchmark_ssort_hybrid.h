@@ -0,0 +1,186 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Base case size
+//#define SSORT_HYBRID_BASE 32
+#include "SimdSort/ssort_hybrid.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+template <typename T>
+static inline void BM_SSortHybrid_std(T* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_Run(benchmark::State& state, void (*func)(T*, size_t), const std::vector<T>& v0) {
+  const size_t N = v0.size();
+  std::vector<T> v1(N);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*sizeof(T));
+    state.ResumeTiming();
+    func(v1.data(), N);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_Gen(std::vector<T>& v) { vec_rrd(v, (T)-1000000000, (T)1000000000); }
+static inline void BM_SSortHybrid_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+static inline void BM_SSortHybrid_Gen(std::vector<double>& v) { vec_rrdf(v, -1., 1.); }
+
+// Random, sorted, reversed, pipe organ and sorted with 1% shuffled inputs
+template <typename T>
+static inline void BM_SSortHybrid_RND(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0((size_t)state.range(0));
+  BM_SSortHybrid_Gen(v0);
+  BM_SSortHybrid_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_SEQ(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::vector<T> v0((size_t)state.range(0));
+  vec_seq(v0, (T)0);
+  BM_SSortHybrid_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_INV(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::vector<T> v0((size_t)state.range(0));
+  vec_inv(v0, (T)0);
+  BM_SSortHybrid_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_PIP(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::vector<T> v0((size_t)state.range(0));
+  vec_pip(v0, (T)0);
+  BM_SSortHybrid_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSortHybrid_SHF(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0((size_t)state.range(0));
+  vec_shf(v0);
+  BM_SSortHybrid_Run<T>(state, func, v0);
+}
+
+
+//
+void BM_SSortHybrid_I32_STD_RND(benchmark::State& state) { BM_SSortHybrid_RND<int32_t>(state, BM_SSortHybrid_std<int32_t>); }
+void BM_SSortHybrid_I32_STD_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<int32_t>(state, BM_SSortHybrid_std<int32_t>); }
+void BM_SSortHybrid_I32_STD_INV(benchmark::State& state) { BM_SSortHybrid_INV<int32_t>(state, BM_SSortHybrid_std<int32_t>); }
+void BM_SSortHybrid_I32_STD_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<int32_t>(state, BM_SSortHybrid_std<int32_t>); }
+void BM_SSortHybrid_I32_STD_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<int32_t>(state, BM_SSortHybrid_std<int32_t>); }
+void BM_SSortHybrid_I32_HYBRID_RND(benchmark::State& state) { BM_SSortHybrid_RND<int32_t>(state, simdsort_hybrid<int32_t>); }
+void BM_SSortHybrid_I32_HYBRID_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<int32_t>(state, simdsort_hybrid<int32_t>); }
+void BM_SSortHybrid_I32_HYBRID_INV(benchmark::State& state) { BM_SSortHybrid_INV<int32_t>(state, simdsort_hybrid<int32_t>); }
+void BM_SSortHybrid_I32_HYBRID_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<int32_t>(state, simdsort_hybrid<int32_t>); }
+void BM_SSortHybrid_I32_HYBRID_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<int32_t>(state, simdsort_hybrid<int32_t>); }
+void BM_SSortHybrid_I64_STD_RND(benchmark::State& state) { BM_SSortHybrid_RND<int64_t>(state, BM_SSortHybrid_std<int64_t>); }
+void BM_SSortHybrid_I64_STD_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<int64_t>(state, BM_SSortHybrid_std<int64_t>); }
+void BM_SSortHybrid_I64_STD_INV(benchmark::State& state) { BM_SSortHybrid_INV<int64_t>(state, BM_SSortHybrid_std<int64_t>); }
+void BM_SSortHybrid_I64_STD_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<int64_t>(state, BM_SSortHybrid_std<int64_t>); }
+void BM_SSortHybrid_I64_STD_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<int64_t>(state, BM_SSortHybrid_std<int64_t>); }
+void BM_SSortHybrid_I64_HYBRID_RND(benchmark::State& state) { BM_SSortHybrid_RND<int64_t>(state, simdsort_hybrid<int64_t>); }
+void BM_SSortHybrid_I64_HYBRID_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<int64_t>(state, simdsort_hybrid<int64_t>); }
+void BM_SSortHybrid_I64_HYBRID_INV(benchmark::State& state) { BM_SSortHybrid_INV<int64_t>(state, simdsort_hybrid<int64_t>); }
+void BM_SSortHybrid_I64_HYBRID_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<int64_t>(state, simdsort_hybrid<int64_t>); }
+void BM_SSortHybrid_I64_HYBRID_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<int64_t>(state, simdsort_hybrid<int64_t>); }
+void BM_SSortHybrid_FLT_STD_RND(benchmark::State& state) { BM_SSortHybrid_RND<float>(state, BM_SSortHybrid_std<float>); }
+void BM_SSortHybrid_FLT_STD_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<float>(state, BM_SSortHybrid_std<float>); }
+void BM_SSortHybrid_FLT_STD_INV(benchmark::State& state) { BM_SSortHybrid_INV<float>(state, BM_SSortHybrid_std<float>); }
+void BM_SSortHybrid_FLT_STD_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<float>(state, BM_SSortHybrid_std<float>); }
+void BM_SSortHybrid_FLT_STD_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<float>(state, BM_SSortHybrid_std<float>); }
+void BM_SSortHybrid_FLT_HYBRID_RND(benchmark::State& state) { BM_SSortHybrid_RND<float>(state, simdsort_hybrid<float>); }
+void BM_SSortHybrid_FLT_HYBRID_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<float>(state, simdsort_hybrid<float>); }
+void BM_SSortHybrid_FLT_HYBRID_INV(benchmark::State& state) { BM_SSortHybrid_INV<float>(state, simdsort_hybrid<float>); }
+void BM_SSortHybrid_FLT_HYBRID_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<float>(state, simdsort_hybrid<float>); }
+void BM_SSortHybrid_FLT_HYBRID_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<float>(state, simdsort_hybrid<float>); }
+void BM_SSortHybrid_DBL_STD_RND(benchmark::State& state) { BM_SSortHybrid_RND<double>(state, BM_SSortHybrid_std<double>); }
+void BM_SSortHybrid_DBL_STD_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<double>(state, BM_SSortHybrid_std<double>); }
+void BM_SSortHybrid_DBL_STD_INV(benchmark::State& state) { BM_SSortHybrid_INV<double>(state, BM_SSortHybrid_std<double>); }
+void BM_SSortHybrid_DBL_STD_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<double>(state, BM_SSortHybrid_std<double>); }
+void BM_SSortHybrid_DBL_STD_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<double>(state, BM_SSortHybrid_std<double>); }
+void BM_SSortHybrid_DBL_HYBRID_RND(benchmark::State& state) { BM_SSortHybrid_RND<double>(state, simdsort_hybrid<double>); }
+void BM_SSortHybrid_DBL_HYBRID_SEQ(benchmark::State& state) { BM_SSortHybrid_SEQ<double>(state, simdsort_hybrid<double>); }
+void BM_SSortHybrid_DBL_HYBRID_INV(benchmark::State& state) { BM_SSortHybrid_INV<double>(state, simdsort_hybrid<double>); }
+void BM_SSortHybrid_DBL_HYBRID_PIP(benchmark::State& state) { BM_SSortHybrid_PIP<double>(state, simdsort_hybrid<double>); }
+void BM_SSortHybrid_DBL_HYBRID_SHF(benchmark::State& state) { BM_SSortHybrid_SHF<double>(state, simdsort_hybrid<double>); }
+
+
+//
+BENCHMARK(BM_SSortHybrid_I32_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_STD_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_STD_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_HYBRID_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_HYBRID_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_HYBRID_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_HYBRID_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I32_HYBRID_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_STD_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_STD_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_HYBRID_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_HYBRID_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_HYBRID_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_HYBRID_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_I64_HYBRID_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_STD_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_STD_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_HYBRID_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_HYBRID_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_HYBRID_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_HYBRID_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_FLT_HYBRID_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_STD_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_STD_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_HYBRID_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_HYBRID_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_HYBRID_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_HYBRID_PIP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortHybrid_DBL_HYBRID_SHF)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
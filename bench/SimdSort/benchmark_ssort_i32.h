@@ -0,0 +1,134 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Base case size
+//#define SSORT_I32_BASE 64
+#include "SimdSort/ssort_i32.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+#ifndef BM_SSORT_RUN_
+#define BM_SSORT_RUN_
+template <typename T>
+static inline void BM_SSort_Run(benchmark::State& state, void (*func)(T*, size_t), const std::vector<T>& v0) {
+  const size_t N = v0.size();
+  std::vector<T> v1(N);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*sizeof(T));
+    state.ResumeTiming();
+    func(v1.data(), N);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_SSort_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_SSort_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_SSort_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+// Random, sorted, reversed and few unique (0..15) inputs
+template <typename T>
+static inline void BM_SSort_RND(benchmark::State& state, void (*func)(T*, size_t), T min, T max) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0((size_t)state.range(0));
+  BM_SSort_Gen(v0, min, max);
+  BM_SSort_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSort_SEQ(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::vector<T> v0((size_t)state.range(0));
+  vec_seq(v0, (T)0);
+  BM_SSort_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSort_INV(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::vector<T> v0((size_t)state.range(0));
+  vec_inv(v0, (T)0);
+  BM_SSort_Run<T>(state, func, v0);
+}
+
+template <typename T>
+static inline void BM_SSort_FEW(benchmark::State& state, void (*func)(T*, size_t)) {
+  std::srand(SRAND_SEED);
+  std::vector<T> v0((size_t)state.range(0));
+  vec_rrd(v0, (T)0, (T)15);
+  BM_SSort_Run<T>(state, func, v0);
+}
+#endif // BM_SSORT_RUN_
+
+//
+void BM_SSort_I32_STD_RND(benchmark::State& state) { BM_SSort_RND<int32_t>(state, simdsort_i32_std, -1000000000, 1000000000); }
+void BM_SSort_I32_STD_SEQ(benchmark::State& state) { BM_SSort_SEQ<int32_t>(state, simdsort_i32_std); }
+void BM_SSort_I32_STD_INV(benchmark::State& state) { BM_SSort_INV<int32_t>(state, simdsort_i32_std); }
+void BM_SSort_I32_STD_FEW(benchmark::State& state) { BM_SSort_FEW<int32_t>(state, simdsort_i32_std); }
+void BM_SSort_I32_QSORT_RND(benchmark::State& state) { BM_SSort_RND<int32_t>(state, simdsort_i32_qsort, -1000000000, 1000000000); }
+void BM_SSort_I32_QSORT_SEQ(benchmark::State& state) { BM_SSort_SEQ<int32_t>(state, simdsort_i32_qsort); }
+void BM_SSort_I32_QSORT_INV(benchmark::State& state) { BM_SSort_INV<int32_t>(state, simdsort_i32_qsort); }
+void BM_SSort_I32_QSORT_FEW(benchmark::State& state) { BM_SSort_FEW<int32_t>(state, simdsort_i32_qsort); }
+#ifdef HAS_AVX2_
+void BM_SSort_I32_AVX2_RND(benchmark::State& state) { BM_SSort_RND<int32_t>(state, simdsort_i32_avx2, -1000000000, 1000000000); }
+void BM_SSort_I32_AVX2_SEQ(benchmark::State& state) { BM_SSort_SEQ<int32_t>(state, simdsort_i32_avx2); }
+void BM_SSort_I32_AVX2_INV(benchmark::State& state) { BM_SSort_INV<int32_t>(state, simdsort_i32_avx2); }
+void BM_SSort_I32_AVX2_FEW(benchmark::State& state) { BM_SSort_FEW<int32_t>(state, simdsort_i32_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSort_I32_AVX512_RND(benchmark::State& state) { BM_SSort_RND<int32_t>(state, simdsort_i32_avx512, -1000000000, 1000000000); }
+void BM_SSort_I32_AVX512_SEQ(benchmark::State& state) { BM_SSort_SEQ<int32_t>(state, simdsort_i32_avx512); }
+void BM_SSort_I32_AVX512_INV(benchmark::State& state) { BM_SSort_INV<int32_t>(state, simdsort_i32_avx512); }
+void BM_SSort_I32_AVX512_FEW(benchmark::State& state) { BM_SSort_FEW<int32_t>(state, simdsort_i32_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_SSort_I32_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_QSORT_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_QSORT_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_QSORT_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_QSORT_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSort_I32_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX2_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX2_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSort_I32_AVX512_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX512_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX512_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I32_AVX512_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
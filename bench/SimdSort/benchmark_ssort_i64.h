@@ -0,0 +1,79 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Base case size
+//#define SSORT_I64_BASE 64
+#include "SimdSort/ssort_i64.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+//
+void BM_SSort_I64_STD_RND(benchmark::State& state) { BM_SSort_RND<int64_t>(state, simdsort_i64_std, (int64_t)-1000000000, (int64_t)1000000000); }
+void BM_SSort_I64_STD_SEQ(benchmark::State& state) { BM_SSort_SEQ<int64_t>(state, simdsort_i64_std); }
+void BM_SSort_I64_STD_INV(benchmark::State& state) { BM_SSort_INV<int64_t>(state, simdsort_i64_std); }
+void BM_SSort_I64_STD_FEW(benchmark::State& state) { BM_SSort_FEW<int64_t>(state, simdsort_i64_std); }
+void BM_SSort_I64_QSORT_RND(benchmark::State& state) { BM_SSort_RND<int64_t>(state, simdsort_i64_qsort, (int64_t)-1000000000, (int64_t)1000000000); }
+void BM_SSort_I64_QSORT_SEQ(benchmark::State& state) { BM_SSort_SEQ<int64_t>(state, simdsort_i64_qsort); }
+void BM_SSort_I64_QSORT_INV(benchmark::State& state) { BM_SSort_INV<int64_t>(state, simdsort_i64_qsort); }
+void BM_SSort_I64_QSORT_FEW(benchmark::State& state) { BM_SSort_FEW<int64_t>(state, simdsort_i64_qsort); }
+#ifdef HAS_AVX2_
+void BM_SSort_I64_AVX2_RND(benchmark::State& state) { BM_SSort_RND<int64_t>(state, simdsort_i64_avx2, (int64_t)-1000000000, (int64_t)1000000000); }
+void BM_SSort_I64_AVX2_SEQ(benchmark::State& state) { BM_SSort_SEQ<int64_t>(state, simdsort_i64_avx2); }
+void BM_SSort_I64_AVX2_INV(benchmark::State& state) { BM_SSort_INV<int64_t>(state, simdsort_i64_avx2); }
+void BM_SSort_I64_AVX2_FEW(benchmark::State& state) { BM_SSort_FEW<int64_t>(state, simdsort_i64_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSort_I64_AVX512_RND(benchmark::State& state) { BM_SSort_RND<int64_t>(state, simdsort_i64_avx512, (int64_t)-1000000000, (int64_t)1000000000); }
+void BM_SSort_I64_AVX512_SEQ(benchmark::State& state) { BM_SSort_SEQ<int64_t>(state, simdsort_i64_avx512); }
+void BM_SSort_I64_AVX512_INV(benchmark::State& state) { BM_SSort_INV<int64_t>(state, simdsort_i64_avx512); }
+void BM_SSort_I64_AVX512_FEW(benchmark::State& state) { BM_SSort_FEW<int64_t>(state, simdsort_i64_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_SSort_I64_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_QSORT_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_QSORT_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_QSORT_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_QSORT_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSort_I64_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX2_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX2_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSort_I64_AVX512_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX512_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX512_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_I64_AVX512_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+
+
+#include "SimdSort/ssort_merge_i32.h"
+#include "SimdSort/ssort_merge_flt.h"
+#include "SimdSort/ssort_merge_dbl.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+template <typename T>
+static inline void BM_SMerge_Gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void BM_SMerge_Gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void BM_SMerge_Gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+// Merge 2 sorted random arrays of N/2 values
+template <typename T>
+static inline void BM_SMerge_Run(benchmark::State& state, void (*func)(const T*, size_t, const T*, size_t, T*), T min, T max) {
+  const size_t N = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<T> a(N/2), b(N - N/2), o(N);
+  BM_SMerge_Gen(a, min, max);
+  BM_SMerge_Gen(b, min, max);
+  std::sort(a.begin(), a.end());
+  std::sort(b.begin(), b.end());
+
+  for (auto _ : state)
+  {
+    func(a.data(), a.size(), b.data(), b.size(), o.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark::DoNotOptimize(o.data());
+}
+
+//
+void BM_SMerge_I32_STD(benchmark::State& state) { BM_SMerge_Run<int32_t>(state, simdmerge_i32_std, -1000000000, 1000000000); }
+void BM_SMerge_FLT_STD(benchmark::State& state) { BM_SMerge_Run<float>(state, simdmerge_flt_std, -1.f, 1.f); }
+void BM_SMerge_DBL_STD(benchmark::State& state) { BM_SMerge_Run<double>(state, simdmerge_dbl_std, -1., 1.); }
+#ifdef HAS_AVX2_
+void BM_SMerge_I32_AVX2(benchmark::State& state) { BM_SMerge_Run<int32_t>(state, simdmerge_i32_avx2, -1000000000, 1000000000); }
+#endif
+#ifdef HAS_AVX_
+void BM_SMerge_FLT_AVX(benchmark::State& state) { BM_SMerge_Run<float>(state, simdmerge_flt_avx, -1.f, 1.f); }
+void BM_SMerge_DBL_AVX(benchmark::State& state) { BM_SMerge_Run<double>(state, simdmerge_dbl_avx, -1., 1.); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SMerge_I32_AVX512(benchmark::State& state) { BM_SMerge_Run<int32_t>(state, simdmerge_i32_avx512, -1000000000, 1000000000); }
+void BM_SMerge_FLT_AVX512(benchmark::State& state) { BM_SMerge_Run<float>(state, simdmerge_flt_avx512, -1.f, 1.f); }
+void BM_SMerge_DBL_AVX512(benchmark::State& state) { BM_SMerge_Run<double>(state, simdmerge_dbl_avx512, -1., 1.); }
+#endif
+
+
+//
+BENCHMARK(BM_SMerge_I32_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SMerge_FLT_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SMerge_DBL_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SMerge_I32_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX_
+BENCHMARK(BM_SMerge_FLT_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SMerge_DBL_AVX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SMerge_I32_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SMerge_FLT_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SMerge_DBL_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
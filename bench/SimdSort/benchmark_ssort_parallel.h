@@ -0,0 +1,101 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+
+
+// Minimum values per thread
+//#define SSORT_PARALLEL_MIN 65536
+#include "SimdSort/ssort_parallel.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+template <typename T>
+static inline void BM_SSortParallel_Gen(std::vector<T>& v) { vec_rrd(v, (T)-1000000000, (T)1000000000); }
+static inline void BM_SSortParallel_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+static inline void BM_SSortParallel_Gen(std::vector<double>& v) { vec_rrdf(v, -1., 1.); }
+
+// Random input of range(0) values, range(1) threads (wall clock time)
+template <typename T>
+static inline void BM_SSortParallel_Run(benchmark::State& state, void (*func)(T*, size_t, unsigned)) {
+  std::srand(SRAND_SEED);
+  const size_t N = (size_t)state.range(0);
+  const unsigned threads = (unsigned)state.range(1);
+  std::vector<T> v0(N), v1(N);
+  BM_SSortParallel_Gen(v0);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*sizeof(T));
+    state.ResumeTiming();
+    func(v1.data(), N, threads);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+// Scaling: 1 to hardware threads (powers of 2, and the max)
+static void BM_SSortParallel_Args(benchmark::internal::Benchmark* b) {
+  const int hw = (int)std::max(1u, std::thread::hardware_concurrency());
+  for (int n=1<<20; n<=1<<24; n<<=2)
+  {
+    for (int t=1; t<hw; t<<=1)
+      b->Args({ n, t });
+    b->Args({ n, hw });
+  }
+}
+
+
+//
+void BM_SSortParallel_I32_STD(benchmark::State& state) { BM_SSortParallel_Run<int32_t>(state, simdsort_parallel_i32_std); }
+void BM_SSortParallel_FLT_STD(benchmark::State& state) { BM_SSortParallel_Run<float>(state, simdsort_parallel_flt_std); }
+void BM_SSortParallel_DBL_STD(benchmark::State& state) { BM_SSortParallel_Run<double>(state, simdsort_parallel_dbl_std); }
+#ifdef HAS_AVX2_
+void BM_SSortParallel_I32_AVX2(benchmark::State& state) { BM_SSortParallel_Run<int32_t>(state, simdsort_parallel_i32_avx2); }
+void BM_SSortParallel_FLT_AVX2(benchmark::State& state) { BM_SSortParallel_Run<float>(state, simdsort_parallel_flt_avx2); }
+void BM_SSortParallel_DBL_AVX2(benchmark::State& state) { BM_SSortParallel_Run<double>(state, simdsort_parallel_dbl_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSortParallel_I32_AVX512(benchmark::State& state) { BM_SSortParallel_Run<int32_t>(state, simdsort_parallel_i32_avx512); }
+void BM_SSortParallel_FLT_AVX512(benchmark::State& state) { BM_SSortParallel_Run<float>(state, simdsort_parallel_flt_avx512); }
+void BM_SSortParallel_DBL_AVX512(benchmark::State& state) { BM_SSortParallel_Run<double>(state, simdsort_parallel_dbl_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_SSortParallel_I32_STD)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_FLT_STD)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_DBL_STD)->Apply(BM_SSortParallel_Args)->UseRealTime();
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortParallel_I32_AVX2)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_FLT_AVX2)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_DBL_AVX2)->Apply(BM_SSortParallel_Args)->UseRealTime();
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortParallel_I32_AVX512)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_FLT_AVX512)->Apply(BM_SSortParallel_Args)->UseRealTime();
+BENCHMARK(BM_SSortParallel_DBL_AVX512)->Apply(BM_SSortParallel_Args)->UseRealTime();
+#endif
@@ -0,0 +1,235 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "SimdSort/ssort_partition.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_PARTITION_RANGE 1000000   // inputs in [-range, range] (unsigned: [0, 2*range]), pivot in the middle
+
+// Predicate: values in the middle half of the range
+template <typename T>
+struct BM_SSortPartition_Pred
+{
+  bool operator()(T x) const { return (T)(-BM_PARTITION_RANGE / 2) <= x && x < (T)(BM_PARTITION_RANGE / 2); }
+};
+
+template <typename T>
+static inline T BM_SSortPartition_Pivot() { return std::is_signed<T>::value ? (T)0 : (T)BM_PARTITION_RANGE; }
+
+template <typename T>
+static inline void BM_SSortPartition_Gen(std::vector<T>& v)
+{
+  std::srand(SRAND_SEED);
+  for (size_t i=0; i<v.size(); ++i)
+    v[i] = (T)(std::rand() % (2 * BM_PARTITION_RANGE + 1) - BM_PARTITION_RANGE) + BM_SSortPartition_Pivot<T>();
+}
+
+// In-place, input restored out of timing
+template <typename T>
+static inline void BM_SSortPartition_InPlace(benchmark::State& state, size_t (*func)(T*, size_t, T)) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v0(N), v(N);
+  BM_SSortPartition_Gen(v0);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v.data(), v0.data(), N * sizeof(T));
+    state.ResumeTiming();
+    size_t r = func(v.data(), N, BM_SSortPartition_Pivot<T>());
+    benchmark::DoNotOptimize(r);
+  }
+  benchmark::DoNotOptimize(v.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+template <typename T>
+static inline void BM_SSortPartition_If(benchmark::State& state, size_t (*func)(T*, size_t, BM_SSortPartition_Pred<T>)) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v0(N), v(N);
+  BM_SSortPartition_Gen(v0);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v.data(), v0.data(), N * sizeof(T));
+    state.ResumeTiming();
+    size_t r = func(v.data(), N, BM_SSortPartition_Pred<T>());
+    benchmark::DoNotOptimize(r);
+  }
+  benchmark::DoNotOptimize(v.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+// Out-of-place, input read once per iteration
+template <typename T>
+static inline void BM_SSortPartition_Copy(benchmark::State& state, size_t (*func)(const T*, size_t, T, T*, T*)) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v(N), t(N), f(N);
+  BM_SSortPartition_Gen(v);
+
+  for (auto _ : state)
+  {
+    size_t r = func(v.data(), N, BM_SSortPartition_Pivot<T>(), t.data(), f.data());
+    benchmark::DoNotOptimize(r);
+  }
+  benchmark::DoNotOptimize(t.data());
+  benchmark::DoNotOptimize(f.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+// K buckets of equal width
+template <typename T, size_t K>
+static inline void BM_SSortPartition_Buckets(benchmark::State& state, void (*func)(const T*, size_t, const T*, size_t, T*, size_t*)) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v(N), out(N), s(K - 1);
+  std::vector<size_t> bounds(K + 1);
+  BM_SSortPartition_Gen(v);
+  for (size_t j=0; j<K-1; ++j)
+    s[j] = (T)(-BM_PARTITION_RANGE + (int64_t)(j + 1) * 2 * BM_PARTITION_RANGE / (int64_t)K);
+
+  for (auto _ : state)
+  {
+    func(v.data(), N, s.data(), K, out.data(), bounds.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+  benchmark::DoNotOptimize(bounds.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+
+//
+void BM_SSortPartition_I32_STD(benchmark::State& state)       { BM_SSortPartition_InPlace<int32_t>(state, simdpartition_std<int32_t>); }
+void BM_SSortPartition_FLT_STD(benchmark::State& state)       { BM_SSortPartition_InPlace<float>(state, simdpartition_std<float>); }
+void BM_SSortPartition_DBL_STD(benchmark::State& state)       { BM_SSortPartition_InPlace<double>(state, simdpartition_std<double>); }
+void BM_SSortPartition_I32_IF_STD(benchmark::State& state)    { BM_SSortPartition_If<int32_t>(state, simdpartition_if_std<int32_t, BM_SSortPartition_Pred<int32_t>>); }
+void BM_SSortPartition_I32_COPY_STD(benchmark::State& state)  { BM_SSortPartition_Copy<int32_t>(state, simdpartition_copy_std<int32_t>); }
+void BM_SSortPartition_U32_COPY_STD(benchmark::State& state)  { BM_SSortPartition_Copy<uint32_t>(state, simdpartition_copy_std<uint32_t>); }
+void BM_SSortPartition_DBL_COPY_STD(benchmark::State& state)  { BM_SSortPartition_Copy<double>(state, simdpartition_copy_std<double>); }
+void BM_SSortPartition_I32_K4_STD(benchmark::State& state)    { BM_SSortPartition_Buckets<int32_t, 4>(state, simdpartition_buckets_std<int32_t>); }
+void BM_SSortPartition_I32_K16_STD(benchmark::State& state)   { BM_SSortPartition_Buckets<int32_t, 16>(state, simdpartition_buckets_std<int32_t>); }
+void BM_SSortPartition_FLT_K8_STD(benchmark::State& state)    { BM_SSortPartition_Buckets<float, 8>(state, simdpartition_buckets_std<float>); }
+#ifdef HAS_AVX2_
+void BM_SSortPartition_I32_AVX2(benchmark::State& state)      { BM_SSortPartition_InPlace<int32_t>(state, simdpartition_avx2<int32_t>); }
+void BM_SSortPartition_FLT_AVX2(benchmark::State& state)      { BM_SSortPartition_InPlace<float>(state, simdpartition_avx2<float>); }
+void BM_SSortPartition_DBL_AVX2(benchmark::State& state)      { BM_SSortPartition_InPlace<double>(state, simdpartition_avx2<double>); }
+void BM_SSortPartition_I32_IF_AVX2(benchmark::State& state)   { BM_SSortPartition_If<int32_t>(state, simdpartition_if_avx2<int32_t, BM_SSortPartition_Pred<int32_t>>); }
+void BM_SSortPartition_I32_COPY_AVX2(benchmark::State& state) { BM_SSortPartition_Copy<int32_t>(state, simdpartition_copy_avx2<int32_t>); }
+void BM_SSortPartition_U32_COPY_AVX2(benchmark::State& state) { BM_SSortPartition_Copy<uint32_t>(state, simdpartition_copy_avx2<uint32_t>); }
+void BM_SSortPartition_DBL_COPY_AVX2(benchmark::State& state) { BM_SSortPartition_Copy<double>(state, simdpartition_copy_avx2<double>); }
+void BM_SSortPartition_I32_K4_AVX2(benchmark::State& state)   { BM_SSortPartition_Buckets<int32_t, 4>(state, simdpartition_buckets_avx2<int32_t>); }
+void BM_SSortPartition_I32_K16_AVX2(benchmark::State& state)  { BM_SSortPartition_Buckets<int32_t, 16>(state, simdpartition_buckets_avx2<int32_t>); }
+void BM_SSortPartition_FLT_K8_AVX2(benchmark::State& state)   { BM_SSortPartition_Buckets<float, 8>(state, simdpartition_buckets_avx2<float>); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSortPartition_I32_AVX512(benchmark::State& state)      { BM_SSortPartition_InPlace<int32_t>(state, simdpartition_avx512<int32_t>); }
+void BM_SSortPartition_FLT_AVX512(benchmark::State& state)      { BM_SSortPartition_InPlace<float>(state, simdpartition_avx512<float>); }
+void BM_SSortPartition_DBL_AVX512(benchmark::State& state)      { BM_SSortPartition_InPlace<double>(state, simdpartition_avx512<double>); }
+void BM_SSortPartition_I32_IF_AVX512(benchmark::State& state)   { BM_SSortPartition_If<int32_t>(state, simdpartition_if_avx512<int32_t, BM_SSortPartition_Pred<int32_t>>); }
+void BM_SSortPartition_I32_COPY_AVX512(benchmark::State& state) { BM_SSortPartition_Copy<int32_t>(state, simdpartition_copy_avx512<int32_t>); }
+void BM_SSortPartition_U32_COPY_AVX512(benchmark::State& state) { BM_SSortPartition_Copy<uint32_t>(state, simdpartition_copy_avx512<uint32_t>); }
+void BM_SSortPartition_DBL_COPY_AVX512(benchmark::State& state) { BM_SSortPartition_Copy<double>(state, simdpartition_copy_avx512<double>); }
+void BM_SSortPartition_I32_K4_AVX512(benchmark::State& state)   { BM_SSortPartition_Buckets<int32_t, 4>(state, simdpartition_buckets_avx512<int32_t>); }
+void BM_SSortPartition_I32_K16_AVX512(benchmark::State& state)  { BM_SSortPartition_Buckets<int32_t, 16>(state, simdpartition_buckets_avx512<int32_t>); }
+void BM_SSortPartition_FLT_K8_AVX512(benchmark::State& state)   { BM_SSortPartition_Buckets<float, 8>(state, simdpartition_buckets_avx512<float>); }
+#endif
+
+
+//
+BENCHMARK(BM_SSortPartition_I32_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_I32_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_I32_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_FLT_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_FLT_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_FLT_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_DBL_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_DBL_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_DBL_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_I32_IF_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_I32_IF_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_I32_IF_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_I32_COPY_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_I32_COPY_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_I32_COPY_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_U32_COPY_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_U32_COPY_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_U32_COPY_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_DBL_COPY_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_DBL_COPY_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_DBL_COPY_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_I32_K4_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_I32_K4_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_I32_K4_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_I32_K16_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_I32_K16_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_I32_K16_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortPartition_FLT_K8_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortPartition_FLT_K8_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortPartition_FLT_K8_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
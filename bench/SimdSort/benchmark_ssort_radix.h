@@ -0,0 +1,185 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Write-combining buffer size (0: direct scatter)
+//#define SSORT_RADIX_WC 128
+#include "SimdSort/ssort_radix.h"
+#include "SimdSort/ssort_i32.h"
+#include "SimdSort/ssort_i64.h"
+#include "SimdSort/ssort_flt.h"
+#include "SimdSort/ssort_dbl.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Helpers
+template <typename T>
+static inline void BM_SSortRadix_std(T* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+template <typename T>
+static inline void BM_SSortRadix_Gen(std::vector<T>& v) { vec_rrd(v, (T)-1000000000, (T)1000000000); }
+static inline void BM_SSortRadix_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+static inline void BM_SSortRadix_Gen(std::vector<double>& v) { vec_rrdf(v, -1., 1.); }
+
+// Random and few unique (skipped passes) inputs
+template <typename T>
+static inline void BM_SSortRadix_Run(benchmark::State& state, void (*func)(T*, size_t), bool few) {
+  std::srand(SRAND_SEED);
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v0(N), v1(N);
+  if (few) vec_rrd(v0, (T)0, (T)255);
+  else     BM_SSortRadix_Gen(v0);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*sizeof(T));
+    state.ResumeTiming();
+    func(v1.data(), N);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename T>
+static inline void BM_SSortRadix_RND(benchmark::State& state, void (*func)(T*, size_t)) { BM_SSortRadix_Run<T>(state, func, false); }
+template <typename T>
+static inline void BM_SSortRadix_FEW(benchmark::State& state, void (*func)(T*, size_t)) { BM_SSortRadix_Run<T>(state, func, true); }
+
+// Key-value: std::stable_sort of pairs vs radix on separate arrays
+template <typename K, typename P>
+static inline void BM_SSortRadix_KV_STD(benchmark::State& state) {
+  std::srand(SRAND_SEED);
+  const size_t N = (size_t)state.range(0);
+  std::vector<K> k(N);
+  BM_SSortRadix_Gen(k);
+  std::vector<std::pair<K, P>> v0(N), v1(N);
+  for (size_t i=0; i<N; ++i)
+    v0[i] = std::make_pair(k[i], (P)i);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    v1 = v0;
+    state.ResumeTiming();
+    std::stable_sort(v1.begin(), v1.end(), [](const std::pair<K, P>& a, const std::pair<K, P>& b) { return a.first < b.first; });
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+template <typename K, typename P>
+static inline void BM_SSortRadix_KV_RADIX(benchmark::State& state, void (*func)(K*, P*, size_t)) {
+  std::srand(SRAND_SEED);
+  const size_t N = (size_t)state.range(0);
+  std::vector<K> k0(N), k1(N);
+  std::vector<P> p0(N), p1(N);
+  BM_SSortRadix_Gen(k0);
+  for (size_t i=0; i<N; ++i)
+    p0[i] = (P)i;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(k1.data(), k0.data(), N*sizeof(K));
+    memcpy(p1.data(), p0.data(), N*sizeof(P));
+    state.ResumeTiming();
+    func(k1.data(), p1.data(), N);
+  }
+  benchmark::DoNotOptimize(k1.data());
+  benchmark::DoNotOptimize(p1.data());
+}
+
+
+//
+void BM_SSortRadix_I32_STD_RND(benchmark::State& state) { BM_SSortRadix_RND<int32_t>(state, BM_SSortRadix_std<int32_t>); }
+void BM_SSortRadix_I32_STD_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int32_t>(state, BM_SSortRadix_std<int32_t>); }
+#ifdef HAS_AVX2_
+void BM_SSortRadix_I32_AVX2_RND(benchmark::State& state) { BM_SSortRadix_RND<int32_t>(state, simdsort_i32_avx2); }
+void BM_SSortRadix_I32_AVX2_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int32_t>(state, simdsort_i32_avx2); }
+#endif
+void BM_SSortRadix_I32_RADIX_RND(benchmark::State& state) { BM_SSortRadix_RND<int32_t>(state, simdsort_radix_i32); }
+void BM_SSortRadix_I32_RADIX_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int32_t>(state, simdsort_radix_i32); }
+void BM_SSortRadix_I64_STD_RND(benchmark::State& state) { BM_SSortRadix_RND<int64_t>(state, BM_SSortRadix_std<int64_t>); }
+void BM_SSortRadix_I64_STD_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int64_t>(state, BM_SSortRadix_std<int64_t>); }
+#ifdef HAS_AVX2_
+void BM_SSortRadix_I64_AVX2_RND(benchmark::State& state) { BM_SSortRadix_RND<int64_t>(state, simdsort_i64_avx2); }
+void BM_SSortRadix_I64_AVX2_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int64_t>(state, simdsort_i64_avx2); }
+#endif
+void BM_SSortRadix_I64_RADIX_RND(benchmark::State& state) { BM_SSortRadix_RND<int64_t>(state, simdsort_radix_i64); }
+void BM_SSortRadix_I64_RADIX_FEW(benchmark::State& state) { BM_SSortRadix_FEW<int64_t>(state, simdsort_radix_i64); }
+void BM_SSortRadix_FLT_STD_RND(benchmark::State& state) { BM_SSortRadix_RND<float>(state, BM_SSortRadix_std<float>); }
+#ifdef HAS_AVX2_
+void BM_SSortRadix_FLT_AVX2_RND(benchmark::State& state) { BM_SSortRadix_RND<float>(state, simdsort_flt_avx2); }
+#endif
+void BM_SSortRadix_FLT_RADIX_RND(benchmark::State& state) { BM_SSortRadix_RND<float>(state, simdsort_radix_flt); }
+void BM_SSortRadix_DBL_STD_RND(benchmark::State& state) { BM_SSortRadix_RND<double>(state, BM_SSortRadix_std<double>); }
+#ifdef HAS_AVX2_
+void BM_SSortRadix_DBL_AVX2_RND(benchmark::State& state) { BM_SSortRadix_RND<double>(state, simdsort_dbl_avx2); }
+#endif
+void BM_SSortRadix_DBL_RADIX_RND(benchmark::State& state) { BM_SSortRadix_RND<double>(state, simdsort_radix_dbl); }
+void BM_SSortRadix_KV_I32_STD(benchmark::State& state) { BM_SSortRadix_KV_STD<int32_t, int32_t>(state); }
+void BM_SSortRadix_KV_I32_RADIX(benchmark::State& state) { BM_SSortRadix_KV_RADIX<int32_t, int32_t>(state, simdsort_radix_kv_i32); }
+void BM_SSortRadix_KV_DBL_STD(benchmark::State& state) { BM_SSortRadix_KV_STD<double, int64_t>(state); }
+void BM_SSortRadix_KV_DBL_RADIX(benchmark::State& state) { BM_SSortRadix_KV_RADIX<double, int64_t>(state, simdsort_radix_kv_dbl); }
+
+
+//
+BENCHMARK(BM_SSortRadix_I32_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I32_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortRadix_I32_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I32_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortRadix_I32_RADIX_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I32_RADIX_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I64_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I64_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortRadix_I64_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I64_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortRadix_I64_RADIX_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_I64_RADIX_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_FLT_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortRadix_FLT_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortRadix_FLT_RADIX_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_DBL_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortRadix_DBL_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortRadix_DBL_RADIX_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_KV_I32_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_KV_I32_RADIX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_KV_DBL_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRadix_KV_DBL_RADIX)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
@@ -0,0 +1,106 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+
+
+// Radix sort threshold
+//#define SSORT_RECORDS_MIN 2048
+#include "SimdSort/ssort_records.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+// Records
+struct BM_SSortRecords_R16 { uint64_t key; uint32_t id; uint32_t flags; };  // 16 bytes, 64 bits key
+struct BM_SSortRecords_R8  { float key; int32_t id; };                       // 8 bytes, float key
+struct BM_SSortRecords_R64 { int32_t id; int32_t key; double data[7]; };     // 64 bytes, int32 key
+
+// Helpers
+template <typename R, typename K>
+static inline void BM_SSortRecords_sort(R* v, size_t n, K R::* key)
+{
+  std::sort(v, v + n, [key](const R& a, const R& b) { return a.*key < b.*key; });
+}
+
+// Full range uint64 keys, int32 and float keys
+static inline void BM_SSortRecords_Keys(std::vector<uint64_t>& k) {
+  for (size_t i=0; i<k.size(); ++i)
+    k[i] = ((uint64_t)std::rand() << 42) ^ ((uint64_t)std::rand() << 21) ^ (uint64_t)std::rand();
+}
+static inline void BM_SSortRecords_Keys(std::vector<int32_t>& k) { vec_rrd(k, -1000000000, 1000000000); }
+static inline void BM_SSortRecords_Keys(std::vector<float>& k) { vec_rrdf(k, -1.f, 1.f); }
+
+template <typename R, typename K>
+static inline void BM_SSortRecords_Gen(std::vector<R>& v, K R::* key)
+{
+  std::vector<K> k(v.size());
+  BM_SSortRecords_Keys(k);
+  for (size_t i=0; i<v.size(); ++i)
+  {
+    memset(&v[i], 0, sizeof(R));
+    v[i].*key = k[i];
+  }
+}
+
+// Random keys
+template <typename R, typename K>
+static inline void BM_SSortRecords_Run(benchmark::State& state, void (*func)(R*, size_t, K R::*), K R::* key) {
+  std::srand(SRAND_SEED);
+  const size_t N = (size_t)state.range(0);
+  std::vector<R> v0(N), v1(N);
+  BM_SSortRecords_Gen(v0, key);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memcpy(v1.data(), v0.data(), N*sizeof(R));
+    state.ResumeTiming();
+    func(v1.data(), N, key);
+  }
+  benchmark::DoNotOptimize(v1.data());
+}
+
+
+//
+void BM_SSortRecords_R16_STD(benchmark::State& state)        { BM_SSortRecords_Run<BM_SSortRecords_R16, uint64_t>(state, BM_SSortRecords_sort, &BM_SSortRecords_R16::key); }
+void BM_SSortRecords_R16_STD_STABLE(benchmark::State& state) { BM_SSortRecords_Run<BM_SSortRecords_R16, uint64_t>(state, simdsort_records_std, &BM_SSortRecords_R16::key); }
+void BM_SSortRecords_R16_SIMD(benchmark::State& state)       { BM_SSortRecords_Run<BM_SSortRecords_R16, uint64_t>(state, simdsort_records, &BM_SSortRecords_R16::key); }
+void BM_SSortRecords_R8_STD(benchmark::State& state)         { BM_SSortRecords_Run<BM_SSortRecords_R8, float>(state, BM_SSortRecords_sort, &BM_SSortRecords_R8::key); }
+void BM_SSortRecords_R8_STD_STABLE(benchmark::State& state)  { BM_SSortRecords_Run<BM_SSortRecords_R8, float>(state, simdsort_records_std, &BM_SSortRecords_R8::key); }
+void BM_SSortRecords_R8_SIMD(benchmark::State& state)        { BM_SSortRecords_Run<BM_SSortRecords_R8, float>(state, simdsort_records, &BM_SSortRecords_R8::key); }
+void BM_SSortRecords_R64_STD(benchmark::State& state)        { BM_SSortRecords_Run<BM_SSortRecords_R64, int32_t>(state, BM_SSortRecords_sort, &BM_SSortRecords_R64::key); }
+void BM_SSortRecords_R64_STD_STABLE(benchmark::State& state) { BM_SSortRecords_Run<BM_SSortRecords_R64, int32_t>(state, simdsort_records_std, &BM_SSortRecords_R64::key); }
+void BM_SSortRecords_R64_SIMD(benchmark::State& state)       { BM_SSortRecords_Run<BM_SSortRecords_R64, int32_t>(state, simdsort_records, &BM_SSortRecords_R64::key); }
+
+
+//
+BENCHMARK(BM_SSortRecords_R16_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R16_STD_STABLE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R16_SIMD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R8_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R8_STD_STABLE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R8_SIMD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R64_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R64_STD_STABLE)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortRecords_R64_SIMD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+
+
+#include "SimdSort/ssort_topk_i32.h"
+#include "SimdSort/ssort_topk_flt.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_TOPK_SIZE (1<<22)
+
+// Helpers
+template <typename T>
+static inline void BM_STopK_Gen(std::vector<T>& v) { vec_rrd(v, (T)-1000000000, (T)1000000000); }
+static inline void BM_STopK_Gen(std::vector<float>& v) { vec_rrdf(v, -1.f, 1.f); }
+
+// k = state.range(0) largest of BM_TOPK_SIZE random values
+template <typename T>
+static inline void BM_STopK_Run(benchmark::State& state, void (*func)(const T*, size_t, size_t, T*)) {
+  const size_t k = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<T> v(BM_TOPK_SIZE), o(k);
+  BM_STopK_Gen(v);
+
+  for (auto _ : state)
+  {
+    func(v.data(), v.size(), k, o.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark::DoNotOptimize(o.data());
+}
+
+// Same, with indices
+template <typename T>
+static inline void BM_STopK_RunIdx(benchmark::State& state, void (*func)(const T*, size_t, size_t, T*, int32_t*)) {
+  const size_t k = (size_t)state.range(0);
+  std::srand(SRAND_SEED);
+  std::vector<T> v(BM_TOPK_SIZE), o(k);
+  std::vector<int32_t> idx(k);
+  BM_STopK_Gen(v);
+
+  for (auto _ : state)
+  {
+    func(v.data(), v.size(), k, o.data(), idx.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark::DoNotOptimize(o.data());
+  benchmark::DoNotOptimize(idx.data());
+}
+
+//
+void BM_STopK_I32_PARTIAL_SORT(benchmark::State& state) { BM_STopK_Run<int32_t>(state, simdtopk_i32_partial_sort); }
+void BM_STopK_I32_NTH_ELEMENT(benchmark::State& state)  { BM_STopK_Run<int32_t>(state, simdtopk_i32_nth_element); }
+void BM_STopK_FLT_PARTIAL_SORT(benchmark::State& state) { BM_STopK_Run<float>(state, simdtopk_flt_partial_sort); }
+void BM_STopK_FLT_NTH_ELEMENT(benchmark::State& state)  { BM_STopK_Run<float>(state, simdtopk_flt_nth_element); }
+#ifdef HAS_AVX2_
+void BM_STopK_I32_AVX2(benchmark::State& state)     { BM_STopK_Run<int32_t>(state, simdtopk_i32_avx2); }
+void BM_STopK_I32_IDX_AVX2(benchmark::State& state) { BM_STopK_RunIdx<int32_t>(state, simdtopk_idx_i32_avx2); }
+void BM_STopK_FLT_AVX2(benchmark::State& state)     { BM_STopK_Run<float>(state, simdtopk_flt_avx2); }
+void BM_STopK_FLT_IDX_AVX2(benchmark::State& state) { BM_STopK_RunIdx<float>(state, simdtopk_idx_flt_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_STopK_I32_AVX512(benchmark::State& state)     { BM_STopK_Run<int32_t>(state, simdtopk_i32_avx512); }
+void BM_STopK_I32_IDX_AVX512(benchmark::State& state) { BM_STopK_RunIdx<int32_t>(state, simdtopk_idx_i32_avx512); }
+void BM_STopK_FLT_AVX512(benchmark::State& state)     { BM_STopK_Run<float>(state, simdtopk_flt_avx512); }
+void BM_STopK_FLT_IDX_AVX512(benchmark::State& state) { BM_STopK_RunIdx<float>(state, simdtopk_idx_flt_avx512); }
+#endif
+
+
+// k = 10, 100, 1000
+BENCHMARK(BM_STopK_I32_PARTIAL_SORT)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_I32_NTH_ELEMENT)->RangeMultiplier(10)->Range(10, 1000);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_STopK_I32_AVX2)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_I32_IDX_AVX2)->RangeMultiplier(10)->Range(10, 1000);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_STopK_I32_AVX512)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_I32_IDX_AVX512)->RangeMultiplier(10)->Range(10, 1000);
+#endif
+BENCHMARK(BM_STopK_FLT_PARTIAL_SORT)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_FLT_NTH_ELEMENT)->RangeMultiplier(10)->Range(10, 1000);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_STopK_FLT_AVX2)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_FLT_IDX_AVX2)->RangeMultiplier(10)->Range(10, 1000);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_STopK_FLT_AVX512)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_STopK_FLT_IDX_AVX512)->RangeMultiplier(10)->Range(10, 1000);
+#endif
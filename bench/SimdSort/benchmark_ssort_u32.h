@@ -0,0 +1,79 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+// Base case size
+//#define SSORT_U32_BASE 64
+#include "SimdSort/ssort_u32.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+
+//
+void BM_SSort_U32_STD_RND(benchmark::State& state) { BM_SSort_RND<uint32_t>(state, simdsort_u32_std, (uint32_t)0, (uint32_t)4000000000u); }
+void BM_SSort_U32_STD_SEQ(benchmark::State& state) { BM_SSort_SEQ<uint32_t>(state, simdsort_u32_std); }
+void BM_SSort_U32_STD_INV(benchmark::State& state) { BM_SSort_INV<uint32_t>(state, simdsort_u32_std); }
+void BM_SSort_U32_STD_FEW(benchmark::State& state) { BM_SSort_FEW<uint32_t>(state, simdsort_u32_std); }
+void BM_SSort_U32_QSORT_RND(benchmark::State& state) { BM_SSort_RND<uint32_t>(state, simdsort_u32_qsort, (uint32_t)0, (uint32_t)4000000000u); }
+void BM_SSort_U32_QSORT_SEQ(benchmark::State& state) { BM_SSort_SEQ<uint32_t>(state, simdsort_u32_qsort); }
+void BM_SSort_U32_QSORT_INV(benchmark::State& state) { BM_SSort_INV<uint32_t>(state, simdsort_u32_qsort); }
+void BM_SSort_U32_QSORT_FEW(benchmark::State& state) { BM_SSort_FEW<uint32_t>(state, simdsort_u32_qsort); }
+#ifdef HAS_AVX2_
+void BM_SSort_U32_AVX2_RND(benchmark::State& state) { BM_SSort_RND<uint32_t>(state, simdsort_u32_avx2, (uint32_t)0, (uint32_t)4000000000u); }
+void BM_SSort_U32_AVX2_SEQ(benchmark::State& state) { BM_SSort_SEQ<uint32_t>(state, simdsort_u32_avx2); }
+void BM_SSort_U32_AVX2_INV(benchmark::State& state) { BM_SSort_INV<uint32_t>(state, simdsort_u32_avx2); }
+void BM_SSort_U32_AVX2_FEW(benchmark::State& state) { BM_SSort_FEW<uint32_t>(state, simdsort_u32_avx2); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSort_U32_AVX512_RND(benchmark::State& state) { BM_SSort_RND<uint32_t>(state, simdsort_u32_avx512, (uint32_t)0, (uint32_t)4000000000u); }
+void BM_SSort_U32_AVX512_SEQ(benchmark::State& state) { BM_SSort_SEQ<uint32_t>(state, simdsort_u32_avx512); }
+void BM_SSort_U32_AVX512_INV(benchmark::State& state) { BM_SSort_INV<uint32_t>(state, simdsort_u32_avx512); }
+void BM_SSort_U32_AVX512_FEW(benchmark::State& state) { BM_SSort_FEW<uint32_t>(state, simdsort_u32_avx512); }
+#endif
+
+
+//
+BENCHMARK(BM_SSort_U32_STD_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_STD_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_STD_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_STD_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_QSORT_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_QSORT_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_QSORT_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_QSORT_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSort_U32_AVX2_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX2_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX2_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX2_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSort_U32_AVX512_RND)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX512_SEQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX512_INV)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSort_U32_AVX512_FEW)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
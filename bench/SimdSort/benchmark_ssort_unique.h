@@ -0,0 +1,156 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Utils
+#include "Utils/generators.h"
+#include "Utils/compiler_utils.h"
+
+#ifndef HAS_SSE2_
+  #error "Minimum SIMD support is SSE2"
+#endif
+#ifndef HAS_AVX2_
+  #warning "Benchmarking reference versions only (AVX2 recommended)"
+#endif
+
+
+#include "SimdSort/ssort_unique.h"
+
+// Constants
+#ifndef SRAND_SEED
+  #define SRAND_SEED 55150
+#endif
+#define BM_UNIQUE_DUP 8   // average run length of duplicated inputs
+
+// Sorted input: runs of about BM_UNIQUE_DUP values (dup) or mostly unique values
+template <typename T>
+static inline void BM_SSortUnique_Gen(std::vector<T>& v, bool dup)
+{
+  std::srand(SRAND_SEED);
+  const size_t N = v.size();
+  const size_t range = std::max((size_t)1, dup ? N / BM_UNIQUE_DUP : 4 * N);
+  for (size_t i=0; i<N; ++i)
+    v[i] = (T)(std::rand() % range);
+  std::sort(v.begin(), v.end());
+}
+
+// Out-of-place, input read once per iteration
+template <typename T>
+static inline void BM_SSortUnique_Run(benchmark::State& state, size_t (*func)(const T*, size_t, T*), bool dup) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v(N), out(N);
+  BM_SSortUnique_Gen(v, dup);
+
+  for (auto _ : state)
+  {
+    size_t r = func(v.data(), N, out.data());
+    benchmark::DoNotOptimize(r);
+  }
+  benchmark::DoNotOptimize(out.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+template <typename T>
+static inline void BM_SSortUnique_Count(benchmark::State& state, size_t (*func)(const T*, size_t, T*, size_t*), bool dup) {
+  const size_t N = (size_t)state.range(0);
+  std::vector<T> v(N), out(N);
+  std::vector<size_t> cnt(N);
+  BM_SSortUnique_Gen(v, dup);
+
+  for (auto _ : state)
+  {
+    size_t r = func(v.data(), N, out.data(), cnt.data());
+    benchmark::DoNotOptimize(r);
+  }
+  benchmark::DoNotOptimize(out.data());
+  benchmark::DoNotOptimize(cnt.data());
+  state.SetBytesProcessed(state.iterations() * N * sizeof(T));
+}
+
+
+//
+void BM_SSortUnique_U8_STD(benchmark::State& state)      { BM_SSortUnique_Run<uint8_t>(state, simdunique_std<uint8_t>, true); }
+void BM_SSortUnique_I16_STD_DUP(benchmark::State& state) { BM_SSortUnique_Run<int16_t>(state, simdunique_std<int16_t>, true); }
+void BM_SSortUnique_I32_STD_DUP(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_std<int32_t>, true); }
+void BM_SSortUnique_I32_STD_UNQ(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_std<int32_t>, false); }
+void BM_SSortUnique_I64_STD_DUP(benchmark::State& state) { BM_SSortUnique_Run<int64_t>(state, simdunique_std<int64_t>, true); }
+void BM_SSortUnique_FLT_STD_DUP(benchmark::State& state) { BM_SSortUnique_Run<float>(state, simdunique_std<float>, true); }
+void BM_SSortUnique_DBL_STD_DUP(benchmark::State& state) { BM_SSortUnique_Run<double>(state, simdunique_std<double>, true); }
+void BM_SSortUnique_I32_COUNT_STD(benchmark::State& state) { BM_SSortUnique_Count<int32_t>(state, simdunique_count_std<int32_t>, true); }
+#ifdef HAS_AVX2_
+void BM_SSortUnique_U8_AVX2(benchmark::State& state)      { BM_SSortUnique_Run<uint8_t>(state, simdunique_avx2<uint8_t>, true); }
+void BM_SSortUnique_I16_AVX2_DUP(benchmark::State& state) { BM_SSortUnique_Run<int16_t>(state, simdunique_avx2<int16_t>, true); }
+void BM_SSortUnique_I32_AVX2_DUP(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_avx2<int32_t>, true); }
+void BM_SSortUnique_I32_AVX2_UNQ(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_avx2<int32_t>, false); }
+void BM_SSortUnique_I64_AVX2_DUP(benchmark::State& state) { BM_SSortUnique_Run<int64_t>(state, simdunique_avx2<int64_t>, true); }
+void BM_SSortUnique_FLT_AVX2_DUP(benchmark::State& state) { BM_SSortUnique_Run<float>(state, simdunique_avx2<float>, true); }
+void BM_SSortUnique_DBL_AVX2_DUP(benchmark::State& state) { BM_SSortUnique_Run<double>(state, simdunique_avx2<double>, true); }
+void BM_SSortUnique_I32_COUNT_AVX2(benchmark::State& state) { BM_SSortUnique_Count<int32_t>(state, simdunique_count_avx2<int32_t>, true); }
+#endif
+#ifdef HAS_AVX512F_
+void BM_SSortUnique_I32_AVX512_DUP(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_avx512<int32_t>, true); }
+void BM_SSortUnique_I32_AVX512_UNQ(benchmark::State& state) { BM_SSortUnique_Run<int32_t>(state, simdunique_avx512<int32_t>, false); }
+void BM_SSortUnique_I64_AVX512_DUP(benchmark::State& state) { BM_SSortUnique_Run<int64_t>(state, simdunique_avx512<int64_t>, true); }
+void BM_SSortUnique_FLT_AVX512_DUP(benchmark::State& state) { BM_SSortUnique_Run<float>(state, simdunique_avx512<float>, true); }
+void BM_SSortUnique_DBL_AVX512_DUP(benchmark::State& state) { BM_SSortUnique_Run<double>(state, simdunique_avx512<double>, true); }
+void BM_SSortUnique_I32_COUNT_AVX512(benchmark::State& state) { BM_SSortUnique_Count<int32_t>(state, simdunique_count_avx512<int32_t>, true); }
+#endif
+
+
+//
+BENCHMARK(BM_SSortUnique_U8_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_U8_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_I16_STD_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_I16_AVX2_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_I32_STD_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortUnique_I32_STD_UNQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_I32_AVX2_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortUnique_I32_AVX2_UNQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortUnique_I32_AVX512_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+BENCHMARK(BM_SSortUnique_I32_AVX512_UNQ)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_I64_STD_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_I64_AVX2_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortUnique_I64_AVX512_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_FLT_STD_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_FLT_AVX2_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortUnique_FLT_AVX512_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_DBL_STD_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_DBL_AVX2_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortUnique_DBL_AVX512_DUP)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+BENCHMARK(BM_SSortUnique_I32_COUNT_STD)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#ifdef HAS_AVX2_
+BENCHMARK(BM_SSortUnique_I32_COUNT_AVX2)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
+#ifdef HAS_AVX512F_
+BENCHMARK(BM_SSortUnique_I32_COUNT_AVX512)->BM_RANGE(BM_PARAM, BM_MIN, BM_MAX);
+#endif
@@ -0,0 +1,516 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_CDBL_H
+#define DOTP_CDBL_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <complex>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_SSE3_
+  #include <pmmintrin.h>  // SSE3
+#endif
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, FMA
+#endif
+
+// Complex vectors are interleaved [re, im] pairs (std::complex<double> layout)
+// Same accumulation scheme as 'dotp_cflt.h': [ac, bd] and [ad, bc] terms, recombined with 'addsub'
+
+// SIMD optimization options
+#ifndef DOTPCDBL_SIZE_MULTIPLE
+  #define DOTPCDBL_SIZE_MULTIPLE 0   // 8, 4, 2 (0: no optim) - in complex elements
+#endif
+#if defined DOTPCDBL_256_ALIGNED
+  #define DOTPCDBL_LOAD_128(x) _mm_load_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPCDBL_LOAD_256(x) _mm256_load_pd(x)
+  #endif
+#elif defined DOTPCDBL_128_ALIGNED
+  #define DOTPCDBL_LOAD_128(x) _mm_load_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPCDBL_LOAD_256(x) _mm256_loadu_pd(x)
+  #endif
+#else
+  #define DOTPCDBL_LOAD_128(x) _mm_loadu_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPCDBL_LOAD_256(x) _mm256_loadu_pd(x)
+  #endif
+#endif
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline std::complex<double> dotProduct_cdbl_scalarforced_(std::complex<double> const* __restrict cu, std::complex<double> const* __restrict cv, size_t n, const bool conj)
+{
+  double const* u = reinterpret_cast<double const*>(cu);
+  double const* v = reinterpret_cast<double const*>(cv);
+  const double sign = conj ? -1. : 1.;
+  double re = 0, im = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<2*n; i+=2)
+  {
+    re += u[i] * v[i] - sign * u[i+1] * v[i+1];
+    im += u[i] * v[i+1] + sign * u[i+1] * v[i];
+  }
+  return std::complex<double>(re, im);
+}
+
+//
+static inline std::complex<double> dotProduct_cdbl_scalar_(std::complex<double> const* __restrict cu, std::complex<double> const* __restrict cv, size_t n, const bool conj)
+{
+  double const* u = reinterpret_cast<double const*>(cu);
+  double const* v = reinterpret_cast<double const*>(cv);
+  const double sign = conj ? -1. : 1.;
+  double re = 0, im = 0;
+  for (size_t i=0; i<2*n; i+=2)
+  {
+    re += u[i] * v[i] - sign * u[i+1] * v[i+1];
+    im += u[i] * v[i+1] + sign * u[i+1] * v[i];
+  }
+  return std::complex<double>(re, im);
+}
+
+//
+#ifdef HAS_SSE3_
+// [ac, bd] & [ad, bc] -> [ac-bd, ad+bc] (or [ac+bd, ad-bc] if conjugated)
+static inline std::complex<double> dotp_cdbl_reduce(const __m128d accuA, const __m128d accuB, const bool conj)
+{
+  __m128d p = _mm_unpacklo_pd(accuA, accuB); // [ac, ad]
+  __m128d q = _mm_unpackhi_pd(accuA, accuB); // [bd, bc]
+  if (conj)
+    q = _mm_xor_pd(q, _mm_set1_pd(-0.));
+  p = _mm_addsub_pd(p, q); // SSE3
+
+  double res[2];
+  _mm_storeu_pd(res, p);
+  return std::complex<double>(res[0], res[1]);
+}
+
+//
+static inline std::complex<double> dotProduct_cdbl_sse_(std::complex<double> const* __restrict cu, std::complex<double> const* __restrict cv, size_t n, const bool conj)
+{
+  double const* u = reinterpret_cast<double const*>(cu);
+  double const* v = reinterpret_cast<double const*>(cv);
+  size_t count = n >> 2;
+
+  // Accumulators
+  __m128d accuA0 = _mm_setzero_pd();
+  __m128d accuA1 = _mm_setzero_pd();
+  __m128d accuB0 = _mm_setzero_pd();
+  __m128d accuB1 = _mm_setzero_pd();
+
+  // Unroll x4 (4 complex)
+  while (count--)
+  {
+    __m128d u0_2, u1_2, u2_2, u3_2;
+    __m128d v0_2, v1_2, v2_2, v3_2;
+    __m128d s0_2, s1_2, s2_2, s3_2;
+
+    // 0
+    u0_2 = DOTPCDBL_LOAD_128(u);
+    v0_2 = DOTPCDBL_LOAD_128(v);
+    s0_2 = _mm_shuffle_pd(v0_2, v0_2, 0x01);
+
+    // 1
+    u1_2 = DOTPCDBL_LOAD_128(u + 2);
+    v1_2 = DOTPCDBL_LOAD_128(v + 2);
+    s1_2 = _mm_shuffle_pd(v1_2, v1_2, 0x01);
+
+    // 2
+    u2_2 = DOTPCDBL_LOAD_128(u + 4);
+    v2_2 = DOTPCDBL_LOAD_128(v + 4);
+    s2_2 = _mm_shuffle_pd(v2_2, v2_2, 0x01);
+
+    // 3
+    u3_2 = DOTPCDBL_LOAD_128(u + 6);
+    v3_2 = DOTPCDBL_LOAD_128(v + 6);
+    s3_2 = _mm_shuffle_pd(v3_2, v3_2, 0x01);
+
+    // Sum
+    accuA0 = _mm_add_pd(accuA0, _mm_mul_pd(u0_2, v0_2));
+    accuB0 = _mm_add_pd(accuB0, _mm_mul_pd(u0_2, s0_2));
+    accuA1 = _mm_add_pd(accuA1, _mm_mul_pd(u1_2, v1_2));
+    accuB1 = _mm_add_pd(accuB1, _mm_mul_pd(u1_2, s1_2));
+    accuA0 = _mm_add_pd(accuA0, _mm_mul_pd(u2_2, v2_2));
+    accuB0 = _mm_add_pd(accuB0, _mm_mul_pd(u2_2, s2_2));
+    accuA1 = _mm_add_pd(accuA1, _mm_mul_pd(u3_2, v3_2));
+    accuB1 = _mm_add_pd(accuB1, _mm_mul_pd(u3_2, s3_2));
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+
+#if DOTPCDBL_SIZE_MULTIPLE < 4
+  // Unroll remaining x2
+  if (n & 2)
+  {
+    __m128d u0_2, u1_2;
+    __m128d v0_2, v1_2;
+    __m128d s0_2, s1_2;
+
+    // 0
+    u0_2 = DOTPCDBL_LOAD_128(u);
+    v0_2 = DOTPCDBL_LOAD_128(v);
+    s0_2 = _mm_shuffle_pd(v0_2, v0_2, 0x01);
+
+    // 1
+    u1_2 = DOTPCDBL_LOAD_128(u + 2);
+    v1_2 = DOTPCDBL_LOAD_128(v + 2);
+    s1_2 = _mm_shuffle_pd(v1_2, v1_2, 0x01);
+
+    // Sum
+    accuA0 = _mm_add_pd(accuA0, _mm_mul_pd(u0_2, v0_2));
+    accuB0 = _mm_add_pd(accuB0, _mm_mul_pd(u0_2, s0_2));
+    accuA1 = _mm_add_pd(accuA1, _mm_mul_pd(u1_2, v1_2));
+    accuB1 = _mm_add_pd(accuB1, _mm_mul_pd(u1_2, s1_2));
+
+    // Next
+    u += 4;
+    v += 4;
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 4
+
+#if DOTPCDBL_SIZE_MULTIPLE < 2
+  // Remaining x1
+  if (n & 1)
+  {
+    __m128d u_2, v_2, s_2;
+
+    u_2 = DOTPCDBL_LOAD_128(u);
+    v_2 = DOTPCDBL_LOAD_128(v);
+    s_2 = _mm_shuffle_pd(v_2, v_2, 0x01);
+
+    accuA0 = _mm_add_pd(accuA0, _mm_mul_pd(u_2, v_2));
+    accuB0 = _mm_add_pd(accuB0, _mm_mul_pd(u_2, s_2));
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 2
+
+  // Sum accumulators
+  accuA0 = _mm_add_pd(accuA0, accuA1);
+  accuB0 = _mm_add_pd(accuB0, accuB1);
+
+  return dotp_cdbl_reduce(accuA0, accuB0, conj);
+}
+#endif // HAS_SSE3_
+
+//
+#ifdef HAS_AVX_
+static inline std::complex<double> dotProduct_cdbl_avx_(std::complex<double> const* __restrict cu, std::complex<double> const* __restrict cv, size_t n, const bool conj)
+{
+  double const* u = reinterpret_cast<double const*>(cu);
+  double const* v = reinterpret_cast<double const*>(cv);
+  size_t count = n >> 3;
+
+  // Accumulators
+  __m256d accuA0 = _mm256_setzero_pd();
+  __m256d accuA1 = _mm256_setzero_pd();
+  __m256d accuB0 = _mm256_setzero_pd();
+  __m256d accuB1 = _mm256_setzero_pd();
+
+  // Unroll x4 (8 complex)
+  while (count--)
+  {
+    __m256d u0_4, u1_4, u2_4, u3_4;
+    __m256d v0_4, v1_4, v2_4, v3_4;
+    __m256d s0_4, s1_4, s2_4, s3_4;
+
+    // 0
+    u0_4 = DOTPCDBL_LOAD_256(u);
+    v0_4 = DOTPCDBL_LOAD_256(v);
+    s0_4 = _mm256_permute_pd(v0_4, 0x05);
+
+    // 1
+    u1_4 = DOTPCDBL_LOAD_256(u + 4);
+    v1_4 = DOTPCDBL_LOAD_256(v + 4);
+    s1_4 = _mm256_permute_pd(v1_4, 0x05);
+
+    // 2
+    u2_4 = DOTPCDBL_LOAD_256(u + 8);
+    v2_4 = DOTPCDBL_LOAD_256(v + 8);
+    s2_4 = _mm256_permute_pd(v2_4, 0x05);
+
+    // 3
+    u3_4 = DOTPCDBL_LOAD_256(u + 12);
+    v3_4 = DOTPCDBL_LOAD_256(v + 12);
+    s3_4 = _mm256_permute_pd(v3_4, 0x05);
+
+    // Sum
+    accuA0 = _mm256_add_pd(accuA0, _mm256_mul_pd(u0_4, v0_4));
+    accuB0 = _mm256_add_pd(accuB0, _mm256_mul_pd(u0_4, s0_4));
+    accuA1 = _mm256_add_pd(accuA1, _mm256_mul_pd(u1_4, v1_4));
+    accuB1 = _mm256_add_pd(accuB1, _mm256_mul_pd(u1_4, s1_4));
+    accuA0 = _mm256_add_pd(accuA0, _mm256_mul_pd(u2_4, v2_4));
+    accuB0 = _mm256_add_pd(accuB0, _mm256_mul_pd(u2_4, s2_4));
+    accuA1 = _mm256_add_pd(accuA1, _mm256_mul_pd(u3_4, v3_4));
+    accuB1 = _mm256_add_pd(accuB1, _mm256_mul_pd(u3_4, s3_4));
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+
+#if DOTPCDBL_SIZE_MULTIPLE < 8
+  // Unroll remaining x2
+  if (n & 4)
+  {
+    __m256d u0_4, u1_4;
+    __m256d v0_4, v1_4;
+    __m256d s0_4, s1_4;
+
+    // 0
+    u0_4 = DOTPCDBL_LOAD_256(u);
+    v0_4 = DOTPCDBL_LOAD_256(v);
+    s0_4 = _mm256_permute_pd(v0_4, 0x05);
+
+    // 1
+    u1_4 = DOTPCDBL_LOAD_256(u + 4);
+    v1_4 = DOTPCDBL_LOAD_256(v + 4);
+    s1_4 = _mm256_permute_pd(v1_4, 0x05);
+
+    // Sum
+    accuA0 = _mm256_add_pd(accuA0, _mm256_mul_pd(u0_4, v0_4));
+    accuB0 = _mm256_add_pd(accuB0, _mm256_mul_pd(u0_4, s0_4));
+    accuA1 = _mm256_add_pd(accuA1, _mm256_mul_pd(u1_4, v1_4));
+    accuB1 = _mm256_add_pd(accuB1, _mm256_mul_pd(u1_4, s1_4));
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 8
+
+#if DOTPCDBL_SIZE_MULTIPLE < 4
+  // Remaining x1
+  if (n & 2)
+  {
+    __m256d u_4, v_4, s_4;
+
+    u_4 = DOTPCDBL_LOAD_256(u);
+    v_4 = DOTPCDBL_LOAD_256(v);
+    s_4 = _mm256_permute_pd(v_4, 0x05);
+
+    accuA0 = _mm256_add_pd(accuA0, _mm256_mul_pd(u_4, v_4));
+    accuB0 = _mm256_add_pd(accuB0, _mm256_mul_pd(u_4, s_4));
+
+    // Next
+    u += 4;
+    v += 4;
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 4
+
+  // Sum accumulators
+  accuA0 = _mm256_add_pd(accuA0, accuA1);
+  accuB0 = _mm256_add_pd(accuB0, accuB1);
+  __m128d accuA = _mm_add_pd(_mm256_castpd256_pd128(accuA0), _mm256_extractf128_pd(accuA0, 1));
+  __m128d accuB = _mm_add_pd(_mm256_castpd256_pd128(accuB0), _mm256_extractf128_pd(accuB0, 1));
+
+#if DOTPCDBL_SIZE_MULTIPLE < 2
+  // Remaining < 2
+  if (n & 1)
+  {
+    __m128d u_2, v_2;
+
+    u_2 = DOTPCDBL_LOAD_128(u);
+    v_2 = DOTPCDBL_LOAD_128(v);
+
+    accuA = _mm_add_pd(accuA, _mm_mul_pd(u_2, v_2));
+    accuB = _mm_add_pd(accuB, _mm_mul_pd(u_2, _mm_shuffle_pd(v_2, v_2, 0x01)));
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 2
+
+  return dotp_cdbl_reduce(accuA, accuB, conj);
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_FMA_
+static inline std::complex<double> dotProduct_cdbl_fma_(std::complex<double> const* __restrict cu, std::complex<double> const* __restrict cv, size_t n, const bool conj)
+{
+  double const* u = reinterpret_cast<double const*>(cu);
+  double const* v = reinterpret_cast<double const*>(cv);
+  size_t count = n >> 3;
+
+  // Accumulators
+  __m256d accuA0 = _mm256_setzero_pd();
+  __m256d accuA1 = _mm256_setzero_pd();
+  __m256d accuB0 = _mm256_setzero_pd();
+  __m256d accuB1 = _mm256_setzero_pd();
+
+  // Unroll x4 (8 complex)
+  while (count--)
+  {
+    __m256d u0_4, u1_4, u2_4, u3_4;
+    __m256d v0_4, v1_4, v2_4, v3_4;
+
+    // 0
+    u0_4 = DOTPCDBL_LOAD_256(u);
+    v0_4 = DOTPCDBL_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_pd(u0_4, v0_4, accuA0);
+    accuB0 = _mm256_fmadd_pd(u0_4, _mm256_permute_pd(v0_4, 0x05), accuB0);
+
+    // 1
+    u1_4 = DOTPCDBL_LOAD_256(u + 4);
+    v1_4 = DOTPCDBL_LOAD_256(v + 4);
+
+    accuA1 = _mm256_fmadd_pd(u1_4, v1_4, accuA1);
+    accuB1 = _mm256_fmadd_pd(u1_4, _mm256_permute_pd(v1_4, 0x05), accuB1);
+
+    // 2
+    u2_4 = DOTPCDBL_LOAD_256(u + 8);
+    v2_4 = DOTPCDBL_LOAD_256(v + 8);
+
+    accuA0 = _mm256_fmadd_pd(u2_4, v2_4, accuA0);
+    accuB0 = _mm256_fmadd_pd(u2_4, _mm256_permute_pd(v2_4, 0x05), accuB0);
+
+    // 3
+    u3_4 = DOTPCDBL_LOAD_256(u + 12);
+    v3_4 = DOTPCDBL_LOAD_256(v + 12);
+
+    accuA1 = _mm256_fmadd_pd(u3_4, v3_4, accuA1);
+    accuB1 = _mm256_fmadd_pd(u3_4, _mm256_permute_pd(v3_4, 0x05), accuB1);
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+
+#if DOTPCDBL_SIZE_MULTIPLE < 8
+  // Unroll remaining x2
+  if (n & 4)
+  {
+    __m256d u0_4, u1_4;
+    __m256d v0_4, v1_4;
+
+    // 0
+    u0_4 = DOTPCDBL_LOAD_256(u);
+    v0_4 = DOTPCDBL_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_pd(u0_4, v0_4, accuA0);
+    accuB0 = _mm256_fmadd_pd(u0_4, _mm256_permute_pd(v0_4, 0x05), accuB0);
+
+    // 1
+    u1_4 = DOTPCDBL_LOAD_256(u + 4);
+    v1_4 = DOTPCDBL_LOAD_256(v + 4);
+
+    accuA1 = _mm256_fmadd_pd(u1_4, v1_4, accuA1);
+    accuB1 = _mm256_fmadd_pd(u1_4, _mm256_permute_pd(v1_4, 0x05), accuB1);
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 8
+
+#if DOTPCDBL_SIZE_MULTIPLE < 4
+  // Remaining x1
+  if (n & 2)
+  {
+    __m256d u_4, v_4;
+
+    u_4 = DOTPCDBL_LOAD_256(u);
+    v_4 = DOTPCDBL_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_pd(u_4, v_4, accuA0);
+    accuB0 = _mm256_fmadd_pd(u_4, _mm256_permute_pd(v_4, 0x05), accuB0);
+
+    // Next
+    u += 4;
+    v += 4;
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 4
+
+  // Sum accumulators
+  accuA0 = _mm256_add_pd(accuA0, accuA1);
+  accuB0 = _mm256_add_pd(accuB0, accuB1);
+  __m128d accuA = _mm_add_pd(_mm256_castpd256_pd128(accuA0), _mm256_extractf128_pd(accuA0, 1));
+  __m128d accuB = _mm_add_pd(_mm256_castpd256_pd128(accuB0), _mm256_extractf128_pd(accuB0, 1));
+
+#if DOTPCDBL_SIZE_MULTIPLE < 2
+  // Remaining < 2
+  if (n & 1)
+  {
+    __m128d u_2, v_2;
+
+    u_2 = DOTPCDBL_LOAD_128(u);
+    v_2 = DOTPCDBL_LOAD_128(v);
+
+    accuA = _mm_fmadd_pd(u_2, v_2, accuA);
+    accuB = _mm_fmadd_pd(u_2, _mm_shuffle_pd(v_2, v_2, 0x01), accuB);
+  }
+#endif // DOTPCDBL_SIZE_MULTIPLE < 2
+
+  return dotp_cdbl_reduce(accuA, accuB, conj);
+}
+#endif // HAS_FMA_
+
+
+//// Sum(u * v) - dotu
+//
+static inline std::complex<double> dotProduct_cdbl_scalarforced(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_scalarforced_(u, v, n, false);
+}
+//
+static inline std::complex<double> dotProduct_cdbl_scalar(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_scalar_(u, v, n, false);
+}
+#ifdef HAS_SSE3_
+static inline std::complex<double> dotProduct_cdbl_sse(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_sse_(u, v, n, false);
+}
+#endif
+#ifdef HAS_AVX_
+static inline std::complex<double> dotProduct_cdbl_avx(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_avx_(u, v, n, false);
+}
+#endif
+#ifdef HAS_FMA_
+static inline std::complex<double> dotProduct_cdbl_fma(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_fma_(u, v, n, false);
+}
+#endif
+
+//// Sum(conj(u) * v) - dotc
+//
+static inline std::complex<double> dotProductConj_cdbl_scalarforced(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_scalarforced_(u, v, n, true);
+}
+//
+static inline std::complex<double> dotProductConj_cdbl_scalar(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_scalar_(u, v, n, true);
+}
+#ifdef HAS_SSE3_
+static inline std::complex<double> dotProductConj_cdbl_sse(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_sse_(u, v, n, true);
+}
+#endif
+#ifdef HAS_AVX_
+static inline std::complex<double> dotProductConj_cdbl_avx(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_avx_(u, v, n, true);
+}
+#endif
+#ifdef HAS_FMA_
+static inline std::complex<double> dotProductConj_cdbl_fma(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+  return dotProduct_cdbl_fma_(u, v, n, true);
+}
+#endif
+
+
+#endif // DOTP_CDBL_H
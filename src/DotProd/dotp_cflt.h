@@ -0,0 +1,518 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_CFLT_H
+#define DOTP_CFLT_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <complex>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_SSE3_
+  #include <pmmintrin.h>  // SSE3
+#endif
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, FMA
+#endif
+
+// Complex vectors are interleaved [re, im] pairs (std::complex<float> layout)
+// Accumulation is split into u*v = [ac, bd] and u*swap(v) = [ad, bc] terms,
+// so the loop only needs one shuffle per vector: real/imaginary parts are
+// recombined once at the end with 'addsub' (dotu and dotc only differ there)
+
+// SIMD optimization options
+#ifndef DOTPCFLT_SIZE_MULTIPLE
+  #define DOTPCFLT_SIZE_MULTIPLE 0   // 16, 8, 4, 2 (0: no optim) - in complex elements
+#endif
+#if defined DOTPCFLT_256_ALIGNED
+  #define DOTPCFLT_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPCFLT_LOAD_256(x) _mm256_load_ps(x)
+  #endif
+#elif defined DOTPCFLT_128_ALIGNED
+  #define DOTPCFLT_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPCFLT_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#else
+  #define DOTPCFLT_LOAD_128(x) _mm_loadu_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPCFLT_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#endif
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline std::complex<float> dotProduct_cflt_scalarforced_(std::complex<float> const* __restrict cu, std::complex<float> const* __restrict cv, size_t n, const bool conj)
+{
+  float const* u = reinterpret_cast<float const*>(cu);
+  float const* v = reinterpret_cast<float const*>(cv);
+  const float sign = conj ? -1.f : 1.f;
+  float re = 0, im = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<2*n; i+=2)
+  {
+    re += u[i] * v[i] - sign * u[i+1] * v[i+1];
+    im += u[i] * v[i+1] + sign * u[i+1] * v[i];
+  }
+  return std::complex<float>(re, im);
+}
+
+//
+static inline std::complex<float> dotProduct_cflt_scalar_(std::complex<float> const* __restrict cu, std::complex<float> const* __restrict cv, size_t n, const bool conj)
+{
+  float const* u = reinterpret_cast<float const*>(cu);
+  float const* v = reinterpret_cast<float const*>(cv);
+  const float sign = conj ? -1.f : 1.f;
+  float re = 0, im = 0;
+  for (size_t i=0; i<2*n; i+=2)
+  {
+    re += u[i] * v[i] - sign * u[i+1] * v[i+1];
+    im += u[i] * v[i+1] + sign * u[i+1] * v[i];
+  }
+  return std::complex<float>(re, im);
+}
+
+//
+#ifdef HAS_SSE3_
+// [ac0+ac1, bd0+bd1] & [ad0+ad1, bc0+bc1] -> [ac-bd, ad+bc] (or [ac+bd, ad-bc] if conjugated)
+static inline std::complex<float> dotp_cflt_reduce(const __m128 accuA, const __m128 accuB, const bool conj)
+{
+  __m128 a = _mm_add_ps(accuA, _mm_movehl_ps(accuA, accuA)); // [ac, bd, -, -]
+  __m128 b = _mm_add_ps(accuB, _mm_movehl_ps(accuB, accuB)); // [ad, bc, -, -]
+  __m128 p = _mm_unpacklo_ps(a, b);                          // [ac, ad, bd, bc]
+  __m128 q = _mm_movehl_ps(p, p);                            // [bd, bc, -, -]
+  if (conj)
+    q = _mm_xor_ps(q, _mm_set1_ps(-0.f));
+  p = _mm_addsub_ps(p, q); // SSE3
+
+  float res[4];
+  _mm_storeu_ps(res, p);
+  return std::complex<float>(res[0], res[1]);
+}
+
+//
+static inline std::complex<float> dotProduct_cflt_sse_(std::complex<float> const* __restrict cu, std::complex<float> const* __restrict cv, size_t n, const bool conj)
+{
+  float const* u = reinterpret_cast<float const*>(cu);
+  float const* v = reinterpret_cast<float const*>(cv);
+  size_t count = n >> 3;
+
+  // Accumulators
+  __m128 accuA0 = _mm_setzero_ps();
+  __m128 accuA1 = _mm_setzero_ps();
+  __m128 accuB0 = _mm_setzero_ps();
+  __m128 accuB1 = _mm_setzero_ps();
+
+  // Unroll x4 (8 complex)
+  while (count--)
+  {
+    __m128 u0_4, u1_4, u2_4, u3_4;
+    __m128 v0_4, v1_4, v2_4, v3_4;
+    __m128 s0_4, s1_4, s2_4, s3_4;
+
+    // 0
+    u0_4 = DOTPCFLT_LOAD_128(u);
+    v0_4 = DOTPCFLT_LOAD_128(v);
+    s0_4 = _mm_shuffle_ps(v0_4, v0_4, _MM_SHUFFLE(2,3,0,1));
+
+    // 1
+    u1_4 = DOTPCFLT_LOAD_128(u + 4);
+    v1_4 = DOTPCFLT_LOAD_128(v + 4);
+    s1_4 = _mm_shuffle_ps(v1_4, v1_4, _MM_SHUFFLE(2,3,0,1));
+
+    // 2
+    u2_4 = DOTPCFLT_LOAD_128(u + 8);
+    v2_4 = DOTPCFLT_LOAD_128(v + 8);
+    s2_4 = _mm_shuffle_ps(v2_4, v2_4, _MM_SHUFFLE(2,3,0,1));
+
+    // 3
+    u3_4 = DOTPCFLT_LOAD_128(u + 12);
+    v3_4 = DOTPCFLT_LOAD_128(v + 12);
+    s3_4 = _mm_shuffle_ps(v3_4, v3_4, _MM_SHUFFLE(2,3,0,1));
+
+    // Sum
+    accuA0 = _mm_add_ps(accuA0, _mm_mul_ps(u0_4, v0_4));
+    accuB0 = _mm_add_ps(accuB0, _mm_mul_ps(u0_4, s0_4));
+    accuA1 = _mm_add_ps(accuA1, _mm_mul_ps(u1_4, v1_4));
+    accuB1 = _mm_add_ps(accuB1, _mm_mul_ps(u1_4, s1_4));
+    accuA0 = _mm_add_ps(accuA0, _mm_mul_ps(u2_4, v2_4));
+    accuB0 = _mm_add_ps(accuB0, _mm_mul_ps(u2_4, s2_4));
+    accuA1 = _mm_add_ps(accuA1, _mm_mul_ps(u3_4, v3_4));
+    accuB1 = _mm_add_ps(accuB1, _mm_mul_ps(u3_4, s3_4));
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+
+#if DOTPCFLT_SIZE_MULTIPLE < 8
+  // Unroll remaining x2
+  if (n & 4)
+  {
+    __m128 u0_4, u1_4;
+    __m128 v0_4, v1_4;
+    __m128 s0_4, s1_4;
+
+    // 0
+    u0_4 = DOTPCFLT_LOAD_128(u);
+    v0_4 = DOTPCFLT_LOAD_128(v);
+    s0_4 = _mm_shuffle_ps(v0_4, v0_4, _MM_SHUFFLE(2,3,0,1));
+
+    // 1
+    u1_4 = DOTPCFLT_LOAD_128(u + 4);
+    v1_4 = DOTPCFLT_LOAD_128(v + 4);
+    s1_4 = _mm_shuffle_ps(v1_4, v1_4, _MM_SHUFFLE(2,3,0,1));
+
+    // Sum
+    accuA0 = _mm_add_ps(accuA0, _mm_mul_ps(u0_4, v0_4));
+    accuB0 = _mm_add_ps(accuB0, _mm_mul_ps(u0_4, s0_4));
+    accuA1 = _mm_add_ps(accuA1, _mm_mul_ps(u1_4, v1_4));
+    accuB1 = _mm_add_ps(accuB1, _mm_mul_ps(u1_4, s1_4));
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 8
+
+#if DOTPCFLT_SIZE_MULTIPLE < 4
+  // Remaining x1
+  if (n & 2)
+  {
+    __m128 u_4, v_4, s_4;
+
+    u_4 = DOTPCFLT_LOAD_128(u);
+    v_4 = DOTPCFLT_LOAD_128(v);
+    s_4 = _mm_shuffle_ps(v_4, v_4, _MM_SHUFFLE(2,3,0,1));
+
+    accuA0 = _mm_add_ps(accuA0, _mm_mul_ps(u_4, v_4));
+    accuB0 = _mm_add_ps(accuB0, _mm_mul_ps(u_4, s_4));
+
+    // Next
+    u += 4;
+    v += 4;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 4
+
+  // Sum accumulators
+  accuA0 = _mm_add_ps(accuA0, accuA1);
+  accuB0 = _mm_add_ps(accuB0, accuB1);
+  std::complex<float> res = dotp_cflt_reduce(accuA0, accuB0, conj);
+
+#if DOTPCFLT_SIZE_MULTIPLE < 2
+  // Remaining < 2
+  if (n & 1)
+    res += dotProduct_cflt_scalar_(reinterpret_cast<std::complex<float> const*>(u),
+                                   reinterpret_cast<std::complex<float> const*>(v), 1, conj);
+#endif // DOTPCFLT_SIZE_MULTIPLE < 2
+
+  return res;
+}
+#endif // HAS_SSE3_
+
+//
+#ifdef HAS_AVX_
+static inline std::complex<float> dotProduct_cflt_avx_(std::complex<float> const* __restrict cu, std::complex<float> const* __restrict cv, size_t n, const bool conj)
+{
+  float const* u = reinterpret_cast<float const*>(cu);
+  float const* v = reinterpret_cast<float const*>(cv);
+  size_t count = n >> 4;
+
+  // Accumulators
+  __m256 accuA0 = _mm256_setzero_ps();
+  __m256 accuA1 = _mm256_setzero_ps();
+  __m256 accuB0 = _mm256_setzero_ps();
+  __m256 accuB1 = _mm256_setzero_ps();
+
+  // Unroll x4 (16 complex)
+  while (count--)
+  {
+    __m256 u0_8, u1_8, u2_8, u3_8;
+    __m256 v0_8, v1_8, v2_8, v3_8;
+    __m256 s0_8, s1_8, s2_8, s3_8;
+
+    // 0
+    u0_8 = DOTPCFLT_LOAD_256(u);
+    v0_8 = DOTPCFLT_LOAD_256(v);
+    s0_8 = _mm256_permute_ps(v0_8, _MM_SHUFFLE(2,3,0,1));
+
+    // 1
+    u1_8 = DOTPCFLT_LOAD_256(u + 8);
+    v1_8 = DOTPCFLT_LOAD_256(v + 8);
+    s1_8 = _mm256_permute_ps(v1_8, _MM_SHUFFLE(2,3,0,1));
+
+    // 2
+    u2_8 = DOTPCFLT_LOAD_256(u + 16);
+    v2_8 = DOTPCFLT_LOAD_256(v + 16);
+    s2_8 = _mm256_permute_ps(v2_8, _MM_SHUFFLE(2,3,0,1));
+
+    // 3
+    u3_8 = DOTPCFLT_LOAD_256(u + 24);
+    v3_8 = DOTPCFLT_LOAD_256(v + 24);
+    s3_8 = _mm256_permute_ps(v3_8, _MM_SHUFFLE(2,3,0,1));
+
+    // Sum
+    accuA0 = _mm256_add_ps(accuA0, _mm256_mul_ps(u0_8, v0_8));
+    accuB0 = _mm256_add_ps(accuB0, _mm256_mul_ps(u0_8, s0_8));
+    accuA1 = _mm256_add_ps(accuA1, _mm256_mul_ps(u1_8, v1_8));
+    accuB1 = _mm256_add_ps(accuB1, _mm256_mul_ps(u1_8, s1_8));
+    accuA0 = _mm256_add_ps(accuA0, _mm256_mul_ps(u2_8, v2_8));
+    accuB0 = _mm256_add_ps(accuB0, _mm256_mul_ps(u2_8, s2_8));
+    accuA1 = _mm256_add_ps(accuA1, _mm256_mul_ps(u3_8, v3_8));
+    accuB1 = _mm256_add_ps(accuB1, _mm256_mul_ps(u3_8, s3_8));
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+
+#if DOTPCFLT_SIZE_MULTIPLE < 16
+  // Unroll remaining x2
+  if (n & 8)
+  {
+    __m256 u0_8, u1_8;
+    __m256 v0_8, v1_8;
+    __m256 s0_8, s1_8;
+
+    // 0
+    u0_8 = DOTPCFLT_LOAD_256(u);
+    v0_8 = DOTPCFLT_LOAD_256(v);
+    s0_8 = _mm256_permute_ps(v0_8, _MM_SHUFFLE(2,3,0,1));
+
+    // 1
+    u1_8 = DOTPCFLT_LOAD_256(u + 8);
+    v1_8 = DOTPCFLT_LOAD_256(v + 8);
+    s1_8 = _mm256_permute_ps(v1_8, _MM_SHUFFLE(2,3,0,1));
+
+    // Sum
+    accuA0 = _mm256_add_ps(accuA0, _mm256_mul_ps(u0_8, v0_8));
+    accuB0 = _mm256_add_ps(accuB0, _mm256_mul_ps(u0_8, s0_8));
+    accuA1 = _mm256_add_ps(accuA1, _mm256_mul_ps(u1_8, v1_8));
+    accuB1 = _mm256_add_ps(accuB1, _mm256_mul_ps(u1_8, s1_8));
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 16
+
+#if DOTPCFLT_SIZE_MULTIPLE < 8
+  // Remaining x1
+  if (n & 4)
+  {
+    __m256 u_8, v_8, s_8;
+
+    u_8 = DOTPCFLT_LOAD_256(u);
+    v_8 = DOTPCFLT_LOAD_256(v);
+    s_8 = _mm256_permute_ps(v_8, _MM_SHUFFLE(2,3,0,1));
+
+    accuA0 = _mm256_add_ps(accuA0, _mm256_mul_ps(u_8, v_8));
+    accuB0 = _mm256_add_ps(accuB0, _mm256_mul_ps(u_8, s_8));
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accuA0 = _mm256_add_ps(accuA0, accuA1);
+  accuB0 = _mm256_add_ps(accuB0, accuB1);
+  __m128 accuA = _mm_add_ps(_mm256_castps256_ps128(accuA0), _mm256_extractf128_ps(accuA0, 1));
+  __m128 accuB = _mm_add_ps(_mm256_castps256_ps128(accuB0), _mm256_extractf128_ps(accuB0, 1));
+  std::complex<float> res = dotp_cflt_reduce(accuA, accuB, conj);
+
+#if DOTPCFLT_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  res += dotProduct_cflt_scalar_(reinterpret_cast<std::complex<float> const*>(u),
+                                 reinterpret_cast<std::complex<float> const*>(v), n & 3, conj);
+#endif // DOTPCFLT_SIZE_MULTIPLE < 4
+
+  return res;
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_FMA_
+static inline std::complex<float> dotProduct_cflt_fma_(std::complex<float> const* __restrict cu, std::complex<float> const* __restrict cv, size_t n, const bool conj)
+{
+  float const* u = reinterpret_cast<float const*>(cu);
+  float const* v = reinterpret_cast<float const*>(cv);
+  size_t count = n >> 4;
+
+  // Accumulators
+  __m256 accuA0 = _mm256_setzero_ps();
+  __m256 accuA1 = _mm256_setzero_ps();
+  __m256 accuB0 = _mm256_setzero_ps();
+  __m256 accuB1 = _mm256_setzero_ps();
+
+  // Unroll x4 (16 complex)
+  while (count--)
+  {
+    __m256 u0_8, u1_8, u2_8, u3_8;
+    __m256 v0_8, v1_8, v2_8, v3_8;
+
+    // 0
+    u0_8 = DOTPCFLT_LOAD_256(u);
+    v0_8 = DOTPCFLT_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_ps(u0_8, v0_8, accuA0);
+    accuB0 = _mm256_fmadd_ps(u0_8, _mm256_permute_ps(v0_8, _MM_SHUFFLE(2,3,0,1)), accuB0);
+
+    // 1
+    u1_8 = DOTPCFLT_LOAD_256(u + 8);
+    v1_8 = DOTPCFLT_LOAD_256(v + 8);
+
+    accuA1 = _mm256_fmadd_ps(u1_8, v1_8, accuA1);
+    accuB1 = _mm256_fmadd_ps(u1_8, _mm256_permute_ps(v1_8, _MM_SHUFFLE(2,3,0,1)), accuB1);
+
+    // 2
+    u2_8 = DOTPCFLT_LOAD_256(u + 16);
+    v2_8 = DOTPCFLT_LOAD_256(v + 16);
+
+    accuA0 = _mm256_fmadd_ps(u2_8, v2_8, accuA0);
+    accuB0 = _mm256_fmadd_ps(u2_8, _mm256_permute_ps(v2_8, _MM_SHUFFLE(2,3,0,1)), accuB0);
+
+    // 3
+    u3_8 = DOTPCFLT_LOAD_256(u + 24);
+    v3_8 = DOTPCFLT_LOAD_256(v + 24);
+
+    accuA1 = _mm256_fmadd_ps(u3_8, v3_8, accuA1);
+    accuB1 = _mm256_fmadd_ps(u3_8, _mm256_permute_ps(v3_8, _MM_SHUFFLE(2,3,0,1)), accuB1);
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+
+#if DOTPCFLT_SIZE_MULTIPLE < 16
+  // Unroll remaining x2
+  if (n & 8)
+  {
+    __m256 u0_8, u1_8;
+    __m256 v0_8, v1_8;
+
+    // 0
+    u0_8 = DOTPCFLT_LOAD_256(u);
+    v0_8 = DOTPCFLT_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_ps(u0_8, v0_8, accuA0);
+    accuB0 = _mm256_fmadd_ps(u0_8, _mm256_permute_ps(v0_8, _MM_SHUFFLE(2,3,0,1)), accuB0);
+
+    // 1
+    u1_8 = DOTPCFLT_LOAD_256(u + 8);
+    v1_8 = DOTPCFLT_LOAD_256(v + 8);
+
+    accuA1 = _mm256_fmadd_ps(u1_8, v1_8, accuA1);
+    accuB1 = _mm256_fmadd_ps(u1_8, _mm256_permute_ps(v1_8, _MM_SHUFFLE(2,3,0,1)), accuB1);
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 16
+
+#if DOTPCFLT_SIZE_MULTIPLE < 8
+  // Remaining x1
+  if (n & 4)
+  {
+    __m256 u_8, v_8;
+
+    u_8 = DOTPCFLT_LOAD_256(u);
+    v_8 = DOTPCFLT_LOAD_256(v);
+
+    accuA0 = _mm256_fmadd_ps(u_8, v_8, accuA0);
+    accuB0 = _mm256_fmadd_ps(u_8, _mm256_permute_ps(v_8, _MM_SHUFFLE(2,3,0,1)), accuB0);
+
+    // Next
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPCFLT_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accuA0 = _mm256_add_ps(accuA0, accuA1);
+  accuB0 = _mm256_add_ps(accuB0, accuB1);
+  __m128 accuA = _mm_add_ps(_mm256_castps256_ps128(accuA0), _mm256_extractf128_ps(accuA0, 1));
+  __m128 accuB = _mm_add_ps(_mm256_castps256_ps128(accuB0), _mm256_extractf128_ps(accuB0, 1));
+  std::complex<float> res = dotp_cflt_reduce(accuA, accuB, conj);
+
+#if DOTPCFLT_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  res += dotProduct_cflt_scalar_(reinterpret_cast<std::complex<float> const*>(u),
+                                 reinterpret_cast<std::complex<float> const*>(v), n & 3, conj);
+#endif // DOTPCFLT_SIZE_MULTIPLE < 4
+
+  return res;
+}
+#endif // HAS_FMA_
+
+
+//// Sum(u * v) - dotu
+//
+static inline std::complex<float> dotProduct_cflt_scalarforced(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_scalarforced_(u, v, n, false);
+}
+//
+static inline std::complex<float> dotProduct_cflt_scalar(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_scalar_(u, v, n, false);
+}
+#ifdef HAS_SSE3_
+static inline std::complex<float> dotProduct_cflt_sse(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_sse_(u, v, n, false);
+}
+#endif
+#ifdef HAS_AVX_
+static inline std::complex<float> dotProduct_cflt_avx(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_avx_(u, v, n, false);
+}
+#endif
+#ifdef HAS_FMA_
+static inline std::complex<float> dotProduct_cflt_fma(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_fma_(u, v, n, false);
+}
+#endif
+
+//// Sum(conj(u) * v) - dotc
+//
+static inline std::complex<float> dotProductConj_cflt_scalarforced(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_scalarforced_(u, v, n, true);
+}
+//
+static inline std::complex<float> dotProductConj_cflt_scalar(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_scalar_(u, v, n, true);
+}
+#ifdef HAS_SSE3_
+static inline std::complex<float> dotProductConj_cflt_sse(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_sse_(u, v, n, true);
+}
+#endif
+#ifdef HAS_AVX_
+static inline std::complex<float> dotProductConj_cflt_avx(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_avx_(u, v, n, true);
+}
+#endif
+#ifdef HAS_FMA_
+static inline std::complex<float> dotProductConj_cflt_fma(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+  return dotProduct_cflt_fma_(u, v, n, true);
+}
+#endif
+
+
+#endif // DOTP_CFLT_H
@@ -0,0 +1,248 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_FLTUI8_H
+#define DOTP_FLTUI8_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX2, FMA
+#endif
+
+// SIMD optimization options
+#ifndef DOTPFU8_SIZE_MULTIPLE
+  #define DOTPFU8_SIZE_MULTIPLE 0   // 32, 16, 8, 4 (0: no optim)
+#endif
+#if defined DOTPFU8_256_ALIGNED   // float vector alignment
+  #define DOTPFU8_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPFU8_LOAD_256(x) _mm256_load_ps(x)
+  #endif
+#elif defined DOTPFU8_128_ALIGNED
+  #define DOTPFU8_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPFU8_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#else
+  #define DOTPFU8_LOAD_128(x) _mm_loadu_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPFU8_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#endif
+
+// Float query against uint8 stored vector: uint8 values are widened to float
+// in register (no dequantized copy). A per-vector scale is applied once
+// on the result by the caller: scale * dotProduct(q, v, n).
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline float dotProduct_fltui8_scalarforced(float const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  float res = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<n; ++i)
+    res += u[i] * (float)v[i];
+
+  return res;
+}
+
+//
+static inline float dotProduct_fltui8_scalar(float const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  float res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += u[i] * (float)v[i];
+
+  return res;
+}
+
+//
+static inline float dotProduct_fltui8_sse(float const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  float res;
+  size_t count = n >> 4;
+  const __m128i zero = _mm_setzero_si128();
+
+  // Accumulators
+  __m128 accu0 = _mm_setzero_ps();
+  __m128 accu1 = _mm_setzero_ps();
+
+  // Unroll x4
+  while (count--)
+  {
+    __m128i v_16, v_lo, v_hi;
+    __m128 v0_4, v1_4, v2_4, v3_4;
+
+    // Widen 16 x uint8 to 4 x (4 x float)
+    v_16 = _mm_loadu_si128((__m128i const*)(v));
+    v_lo = _mm_unpacklo_epi8(v_16, zero);
+    v_hi = _mm_unpackhi_epi8(v_16, zero);
+    v0_4 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v_lo, zero));
+    v1_4 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v_lo, zero));
+    v2_4 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v_hi, zero));
+    v3_4 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v_hi, zero));
+
+    // Sum
+    accu0 = _mm_add_ps(accu0, _mm_mul_ps(DOTPFU8_LOAD_128(u),      v0_4));
+    accu1 = _mm_add_ps(accu1, _mm_mul_ps(DOTPFU8_LOAD_128(u + 4),  v1_4));
+    accu0 = _mm_add_ps(accu0, _mm_mul_ps(DOTPFU8_LOAD_128(u + 8),  v2_4));
+    accu1 = _mm_add_ps(accu1, _mm_mul_ps(DOTPFU8_LOAD_128(u + 12), v3_4));
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+
+#if DOTPFU8_SIZE_MULTIPLE < 16
+  // Remaining x2
+  if (n & 8)
+  {
+    __m128i v_lo;
+    __m128 v0_4, v1_4;
+
+    v_lo = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i const*)(v)), zero);
+    v0_4 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v_lo, zero));
+    v1_4 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v_lo, zero));
+
+    accu0 = _mm_add_ps(accu0, _mm_mul_ps(DOTPFU8_LOAD_128(u),     v0_4));
+    accu1 = _mm_add_ps(accu1, _mm_mul_ps(DOTPFU8_LOAD_128(u + 4), v1_4));
+
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 16
+
+#if DOTPFU8_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    int32_t v4;
+    __m128 v_4;
+
+    memcpy(&v4, v + n, sizeof(v4));
+    v_4 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v4), zero), zero));
+
+    accu0 = _mm_add_ps(accu0, _mm_mul_ps(DOTPFU8_LOAD_128(u + n), v_4));
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accu0 = _mm_add_ps(accu0, accu1);
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPFU8_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: res += u[2] * (float)v[2];
+    case 2: res += u[1] * (float)v[1];
+    case 1: res += u[0] * (float)v[0];
+    default: break;
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 4
+
+  return res;
+}
+
+//
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+static inline float dotProduct_fltui8_fma(float const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  float res;
+  size_t count = n >> 5;
+
+  // Accumulators (hide FMA latency)
+  __m256 accu0 = _mm256_setzero_ps();
+  __m256 accu1 = _mm256_setzero_ps();
+  __m256 accu2 = _mm256_setzero_ps();
+  __m256 accu3 = _mm256_setzero_ps();
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256 v0_8, v1_8, v2_8, v3_8;
+
+    // Widen 8 x uint8 to 8 x float (vpmovzxbd from memory)
+    v0_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v))));
+    v1_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v + 8))));
+    v2_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v + 16))));
+    v3_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v + 24))));
+
+    accu0 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u),      v0_8, accu0);
+    accu1 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u + 8),  v1_8, accu1);
+    accu2 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u + 16), v2_8, accu2);
+    accu3 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u + 24), v3_8, accu3);
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+
+  // Sum accumulators
+  accu0 = _mm256_add_ps(accu0, accu2);
+  accu1 = _mm256_add_ps(accu1, accu3);
+
+#if DOTPFU8_SIZE_MULTIPLE < 32
+  // Remaining x2
+  if (n & 16)
+  {
+    __m256 v0_8, v1_8;
+
+    v0_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v))));
+    v1_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v + 8))));
+
+    accu0 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u),     v0_8, accu0);
+    accu1 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u + 8), v1_8, accu1);
+
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 32
+
+#if DOTPFU8_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    __m256 v_8;
+
+    v_8 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(v + n))));
+
+    accu0 = _mm256_fmadd_ps(DOTPFU8_LOAD_256(u + n), v_8, accu0);
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 16
+
+  // Sum accumulators
+  accu0 = _mm256_add_ps(accu0, accu1);
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPFU8_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case 7: res += u[6] * (float)v[6];
+    case 6: res += u[5] * (float)v[5];
+    case 5: res += u[4] * (float)v[4];
+    case 4: res += u[3] * (float)v[3];
+    case 3: res += u[2] * (float)v[2];
+    case 2: res += u[1] * (float)v[1];
+    case 1: res += u[0] * (float)v[0];
+    default: break;
+  }
+#endif // DOTPFU8_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_AVX2_ && HAS_FMA_
+
+
+#endif // DOTP_FLTUI8_H
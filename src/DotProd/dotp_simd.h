@@ -19,12 +19,18 @@
 //#define DOTP88_SIZE_MULTIPLE    64
 //#define DOTP88_128_ALIGNED
 //#define DOTP88_256_ALIGNED
+//#define DOTPU8_SIZE_MULTIPLE    64
+//#define DOTPU8_128_ALIGNED
+//#define DOTPU8_256_ALIGNED
 //#define DOTP168_SIZE_MULTIPLE   64
 //#define DOTP168_128_ALIGNED
 //#define DOTP168_256_ALIGNED
 //#define DOTP16_SIZE_MULTIPLE    64
 //#define DOTP16_128_ALIGNED
 //#define DOTP16_256_ALIGNED
+//#define DOTPU16_SIZE_MULTIPLE   32
+//#define DOTPU16_128_ALIGNED
+//#define DOTPU16_256_ALIGNED
 //#define DOTP3216_SIZE_MULTIPLE  32
 //#define DOTP3216_128_ALIGNED
 //#define DOTP3216_256_ALIGNED
@@ -34,19 +40,49 @@
 //#define DOTPFLT_SIZE_MULTIPLE   32
 //#define DOTPFLT_128_ALIGNED
 //#define DOTPFLT_256_ALIGNED
+//#define DOTPFI8_SIZE_MULTIPLE   32
+//#define DOTPFI8_128_ALIGNED
+//#define DOTPFI8_256_ALIGNED
+//#define DOTPFU8_SIZE_MULTIPLE   32
+//#define DOTPFU8_128_ALIGNED
+//#define DOTPFU8_256_ALIGNED
+//#define DOTPFI16_SIZE_MULTIPLE  32
+//#define DOTPFI16_128_ALIGNED
+//#define DOTPFI16_256_ALIGNED
 //#define DOTPDBL_SIZE_MULTIPLE   16
 //#define DOTPDBL_128_ALIGNED
 //#define DOTPDBL_256_ALIGNED
+//#define DOTPCFLT_SIZE_MULTIPLE  16
+//#define DOTPCFLT_128_ALIGNED
+//#define DOTPCFLT_256_ALIGNED
+//#define DOTPCDBL_SIZE_MULTIPLE  8
+//#define DOTPCDBL_128_ALIGNED
+//#define DOTPCDBL_256_ALIGNED
+//#define DOTPWFLT_SIZE_MULTIPLE  32
+//#define DOTPWFLT_128_ALIGNED
+//#define DOTPWFLT_256_ALIGNED
+//#define DOTPWDBL_SIZE_MULTIPLE  16
+//#define DOTPWDBL_128_ALIGNED
+//#define DOTPWDBL_256_ALIGNED
 
 //
 #include "dotp_i8.h"
 #include "dotp_i8ui8.h"
+#include "dotp_ui8.h"
 #include "dotp_i16i8.h"
 #include "dotp_i16.h"
+#include "dotp_ui16.h"
 #include "dotp_i32i16.h"
 #include "dotp_i32.h"
 #include "dotp_flt.h"
+#include "dotp_flti8.h"
+#include "dotp_fltui8.h"
+#include "dotp_flti16.h"
 #include "dotp_dbl.h"
+#include "dotp_cflt.h"
+#include "dotp_cdbl.h"
+#include "dotp_wflt.h"
+#include "dotp_wdbl.h"
 
 
 // int8 x int8
@@ -69,6 +105,18 @@ static inline int32_t dotProduct(int8_t const* __restrict u, uint8_t const* __re
 #endif
 }
 
+// uint8 x uint8
+static inline uint32_t dotProduct(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+#if defined(HAS_AVX512VNNI_) && defined(HAS_AVX512VL_)
+  return dotProduct_ui8_vnni(u, v, n);
+#elif defined HAS_AVX2_
+  return dotProduct_ui8_avx2(u, v, n);
+#else
+  return dotProduct_ui8_sse(u, v, n);
+#endif
+}
+
 // int16 x int8
 static inline int32_t dotProduct(int16_t const* __restrict u, int8_t const* __restrict v, size_t n)
 {
@@ -89,6 +137,16 @@ static inline int32_t dotProduct(int16_t const* __restrict u, int16_t const* __r
 #endif
 }
 
+// uint16 x uint16
+static inline uint64_t dotProduct(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  return dotProduct_ui16_avx2(u, v, n);
+#else
+  return dotProduct_ui16_sse(u, v, n);
+#endif
+}
+
 // int32 x int16
 static inline int32_t dotProduct(int32_t const* __restrict u, int16_t const* __restrict v, size_t n)
 {
@@ -121,6 +179,36 @@ static inline float dotProduct(float const* __restrict u, float const* __restric
 #endif
 }
 
+// float x int8
+static inline float dotProduct(float const* __restrict u, int8_t const* __restrict v, size_t n)
+{
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  return dotProduct_flti8_fma(u, v, n);
+#else
+  return dotProduct_flti8_sse(u, v, n);
+#endif
+}
+
+// float x uint8
+static inline float dotProduct(float const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  return dotProduct_fltui8_fma(u, v, n);
+#else
+  return dotProduct_fltui8_sse(u, v, n);
+#endif
+}
+
+// float x int16
+static inline float dotProduct(float const* __restrict u, int16_t const* __restrict v, size_t n)
+{
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  return dotProduct_flti16_fma(u, v, n);
+#else
+  return dotProduct_flti16_sse(u, v, n);
+#endif
+}
+
 // double x double
 static inline double dotProduct(double const* __restrict u, double const* __restrict v, size_t n)
 {
@@ -133,5 +221,109 @@ static inline double dotProduct(double const* __restrict u, double const* __rest
 #endif
 }
 
+// complex float x complex float
+static inline std::complex<float> dotProduct(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProduct_cflt_fma(u, v, n);
+#elif defined HAS_AVX_
+  return dotProduct_cflt_avx(u, v, n);
+#elif defined HAS_SSE3_
+  return dotProduct_cflt_sse(u, v, n);
+#else
+  return dotProduct_cflt_scalar(u, v, n);
+#endif
+}
+
+// conj(complex float) x complex float
+static inline std::complex<float> dotProductConj(std::complex<float> const* __restrict u, std::complex<float> const* __restrict v, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProductConj_cflt_fma(u, v, n);
+#elif defined HAS_AVX_
+  return dotProductConj_cflt_avx(u, v, n);
+#elif defined HAS_SSE3_
+  return dotProductConj_cflt_sse(u, v, n);
+#else
+  return dotProductConj_cflt_scalar(u, v, n);
+#endif
+}
+
+// complex double x complex double
+static inline std::complex<double> dotProduct(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProduct_cdbl_fma(u, v, n);
+#elif defined HAS_AVX_
+  return dotProduct_cdbl_avx(u, v, n);
+#elif defined HAS_SSE3_
+  return dotProduct_cdbl_sse(u, v, n);
+#else
+  return dotProduct_cdbl_scalar(u, v, n);
+#endif
+}
+
+// conj(complex double) x complex double
+static inline std::complex<double> dotProductConj(std::complex<double> const* __restrict u, std::complex<double> const* __restrict v, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProductConj_cdbl_fma(u, v, n);
+#elif defined HAS_AVX_
+  return dotProductConj_cdbl_avx(u, v, n);
+#elif defined HAS_SSE3_
+  return dotProductConj_cdbl_sse(u, v, n);
+#else
+  return dotProductConj_cdbl_scalar(u, v, n);
+#endif
+}
+
+// w x float x float
+static inline float dotProductWeighted(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProductWeighted_flt_fma(u, v, w, n);
+#elif defined HAS_AVX_
+  return dotProductWeighted_flt_avx(u, v, w, n);
+#else
+  return dotProductWeighted_flt_sse(u, v, w, n);
+#endif
+}
+
+// w x double x double
+static inline double dotProductWeighted(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+#ifdef HAS_FMA_
+  return dotProductWeighted_dbl_fma(u, v, w, n);
+#elif defined HAS_AVX_
+  return dotProductWeighted_dbl_avx(u, v, w, n);
+#else
+  return dotProductWeighted_dbl_sse(u, v, w, n);
+#endif
+}
+
+// float x float (bitmask)
+static inline float dotProductMasked(float const* __restrict u, float const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+#ifdef HAS_AVX512F_
+  return dotProductMasked_flt_avx512(u, v, mask, n);
+#elif defined HAS_AVX2_
+  return dotProductMasked_flt_avx2(u, v, mask, n);
+#else
+  return dotProductMasked_flt_scalar(u, v, mask, n);
+#endif
+}
+
+// double x double (bitmask)
+static inline double dotProductMasked(double const* __restrict u, double const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+#ifdef HAS_AVX512F_
+  return dotProductMasked_dbl_avx512(u, v, mask, n);
+#elif defined HAS_AVX2_
+  return dotProductMasked_dbl_avx2(u, v, mask, n);
+#else
+  return dotProductMasked_dbl_scalar(u, v, mask, n);
+#endif
+}
+
 
 #endif // DOTP_SIMD_H
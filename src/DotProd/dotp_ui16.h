@@ -0,0 +1,279 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_UI16_H
+#define DOTP_UI16_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// SIMD optimization options
+#ifndef DOTPU16_SIZE_MULTIPLE
+  #define DOTPU16_SIZE_MULTIPLE 0   // 32, 16, 8, 4 (0: no optim)
+#endif
+#if defined DOTPU16_256_ALIGNED
+  #define DOTPU16_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU16_LOAD_128(x) _mm_load_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU16_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+  #endif
+#elif defined(DOTPU16_128_ALIGNED)
+  #define DOTPU16_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU16_LOAD_128(x) _mm_load_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU16_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+  #endif
+#else
+  #define DOTPU16_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU16_LOAD_128(x) _mm_loadu_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU16_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+  #endif
+#endif
+
+// Products (up to 2^32 - 1) don't fit in madd signed pairs: full 32-bit products
+// are rebuilt from mullo/mulhi_epu16 and accumulated in 64-bit lanes (exact result)
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline uint64_t dotProduct_ui16_scalarforced(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t res = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline uint64_t dotProduct_ui16_scalar(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+// Accumulate 4 uint32 products into 2 uint64 lanes
+static inline __m128i dotp_ui16_accu(__m128i accu, const __m128i prod, const __m128i lo32)
+{
+  accu = _mm_add_epi64(accu, _mm_and_si128(prod, lo32));
+  return _mm_add_epi64(accu, _mm_srli_epi64(prod, 32));
+}
+
+//
+static inline uint64_t dotProduct_ui16_sse(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t res;
+  size_t count = n >> 4;
+  const __m128i lo32 = _mm_set1_epi64x(0xFFFFFFFF);
+
+  // Accumulators
+  __m128i accu0 = _mm_setzero_si128();
+  __m128i accu1 = _mm_setzero_si128();
+
+  // Unroll x2
+  while (count--)
+  {
+    __m128i u_8, v_8, lo, hi;
+
+    // 0
+    u_8 = DOTPU16_LOAD_128(u);
+    v_8 = DOTPU16_LOAD_128(v);
+    lo  = _mm_mullo_epi16(u_8, v_8);
+    hi  = _mm_mulhi_epu16(u_8, v_8);
+
+    accu0 = dotp_ui16_accu(accu0, _mm_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm_unpackhi_epi16(lo, hi), lo32);
+
+    // 1
+    u_8 = DOTPU16_LOAD_128(u + 8);
+    v_8 = DOTPU16_LOAD_128(v + 8);
+    lo  = _mm_mullo_epi16(u_8, v_8);
+    hi  = _mm_mulhi_epu16(u_8, v_8);
+
+    accu0 = dotp_ui16_accu(accu0, _mm_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm_unpackhi_epi16(lo, hi), lo32);
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+
+#if DOTPU16_SIZE_MULTIPLE < 16
+  // Remaining x8
+  if (n & 8)
+  {
+    __m128i u_8, v_8, lo, hi;
+
+    u_8 = DOTPU16_LOAD_128(u);
+    v_8 = DOTPU16_LOAD_128(v);
+    lo  = _mm_mullo_epi16(u_8, v_8);
+    hi  = _mm_mulhi_epu16(u_8, v_8);
+
+    accu0 = dotp_ui16_accu(accu0, _mm_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm_unpackhi_epi16(lo, hi), lo32);
+
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 16
+
+#if DOTPU16_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    __m128i u_4, v_4, lo, hi;
+
+    u_4 = DOTPU16_LOAD_64(u + n);
+    v_4 = DOTPU16_LOAD_64(v + n);
+    lo  = _mm_mullo_epi16(u_4, v_4);
+    hi  = _mm_mulhi_epu16(u_4, v_4);
+
+    accu0 = dotp_ui16_accu(accu0, _mm_unpacklo_epi16(lo, hi), lo32);
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accu0 = _mm_add_epi64(accu0, accu1);
+  accu0 = _mm_add_epi64(accu0, _mm_unpackhi_epi64(accu0, accu0));
+  _mm_storel_epi64((__m128i*)&res, accu0);
+
+#if DOTPU16_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: res += (uint32_t)u[2] * v[2];
+    case 2: res += (uint32_t)u[1] * v[1];
+    case 1: res += (uint32_t)u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 4
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX2_
+// Accumulate 8 uint32 products into 4 uint64 lanes
+static inline __m256i dotp_ui16_accu(__m256i accu, const __m256i prod, const __m256i lo32)
+{
+  accu = _mm256_add_epi64(accu, _mm256_and_si256(prod, lo32));
+  return _mm256_add_epi64(accu, _mm256_srli_epi64(prod, 32));
+}
+
+static inline uint64_t dotProduct_ui16_avx2(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t res;
+  size_t count = n >> 5;
+  const __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFF);
+
+  // Accumulators
+  __m256i accu0 = _mm256_setzero_si256();
+  __m256i accu1 = _mm256_setzero_si256();
+
+  // Unroll x2
+  while (count--)
+  {
+    __m256i u_16, v_16, lo, hi;
+
+    // 0
+    u_16 = DOTPU16_LOAD_256(u);
+    v_16 = DOTPU16_LOAD_256(v);
+    lo   = _mm256_mullo_epi16(u_16, v_16);
+    hi   = _mm256_mulhi_epu16(u_16, v_16);
+
+    accu0 = dotp_ui16_accu(accu0, _mm256_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm256_unpackhi_epi16(lo, hi), lo32);
+
+    // 1
+    u_16 = DOTPU16_LOAD_256(u + 16);
+    v_16 = DOTPU16_LOAD_256(v + 16);
+    lo   = _mm256_mullo_epi16(u_16, v_16);
+    hi   = _mm256_mulhi_epu16(u_16, v_16);
+
+    accu0 = dotp_ui16_accu(accu0, _mm256_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm256_unpackhi_epi16(lo, hi), lo32);
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+
+#if DOTPU16_SIZE_MULTIPLE < 32
+  // Remaining x16
+  if (n & 16)
+  {
+    __m256i u_16, v_16, lo, hi;
+
+    u_16 = DOTPU16_LOAD_256(u);
+    v_16 = DOTPU16_LOAD_256(v);
+    lo   = _mm256_mullo_epi16(u_16, v_16);
+    hi   = _mm256_mulhi_epu16(u_16, v_16);
+
+    accu0 = dotp_ui16_accu(accu0, _mm256_unpacklo_epi16(lo, hi), lo32);
+    accu1 = dotp_ui16_accu(accu1, _mm256_unpackhi_epi16(lo, hi), lo32);
+
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 32
+
+  // Sum accumulators
+  accu0 = _mm256_add_epi64(accu0, accu1);
+  __m128i accu = _mm_add_epi64(_mm256_castsi256_si128(accu0), _mm256_extracti128_si256(accu0, 1));
+
+#if DOTPU16_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    __m128i u_8, v_8, lo, hi;
+    const __m128i lo32_128 = _mm256_castsi256_si128(lo32);
+
+    u_8 = DOTPU16_LOAD_128(u + n);
+    v_8 = DOTPU16_LOAD_128(v + n);
+    lo  = _mm_mullo_epi16(u_8, v_8);
+    hi  = _mm_mulhi_epu16(u_8, v_8);
+
+    accu = dotp_ui16_accu(accu, _mm_unpacklo_epi16(lo, hi), lo32_128);
+    accu = dotp_ui16_accu(accu, _mm_unpackhi_epi16(lo, hi), lo32_128);
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 16
+
+  accu = _mm_add_epi64(accu, _mm_unpackhi_epi64(accu, accu));
+  _mm_storel_epi64((__m128i*)&res, accu);
+
+#if DOTPU16_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case 7: res += (uint32_t)u[6] * v[6];
+    case 6: res += (uint32_t)u[5] * v[5];
+    case 5: res += (uint32_t)u[4] * v[4];
+    case 4: res += (uint32_t)u[3] * v[3];
+    case 3: res += (uint32_t)u[2] * v[2];
+    case 2: res += (uint32_t)u[1] * v[1];
+    case 1: res += (uint32_t)u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPU16_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_AVX2_
+
+
+#endif // DOTP_UI16_H
@@ -0,0 +1,393 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_UI8_H
+#define DOTP_UI8_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512 VNNI
+#endif
+
+// SIMD optimization options
+#ifndef DOTPU8_SIZE_MULTIPLE
+  #define DOTPU8_SIZE_MULTIPLE 0   // 64, 32, 16, 8 (0: no optim)
+#endif
+//#define DOTPU8_ACCU_3   // Use 3/4 accumulators (depend on HW/vectors size)
+//#define DOTPU8_ACCU_4
+#if defined(DOTPU8_ACCU_4) && !defined(DOTPU8_ACCU_3)
+  #define DOTPU8_ACCU_3
+#endif
+#if defined DOTPU8_256_ALIGNED
+  #define DOTPU8_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU8_LOAD_128(x) _mm_load_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU8_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+  #endif
+#elif defined(DOTPU8_128_ALIGNED)
+  #define DOTPU8_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU8_LOAD_128(x) _mm_load_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU8_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+  #endif
+#else
+  #define DOTPU8_LOAD_64(x)  _mm_loadl_epi64((__m128i const*)(x))
+  #define DOTPU8_LOAD_128(x) _mm_loadu_si128((__m128i const*)(x))
+  #ifdef HAS_AVX2_
+    #define DOTPU8_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+  #endif
+#endif
+
+// Result is modulo 2^32 (exact up to 66051 elements)
+// u and v are zero-extended the same way (in-lane unpack): order doesn't matter for the sum
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline uint32_t dotProduct_ui8_scalarforced(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline uint32_t dotProduct_ui8_scalar(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline uint32_t dotProduct_ui8_sse(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res;
+  size_t count = n >> 5;
+  const __m128i zero = _mm_setzero_si128();
+
+  // Accumulators
+  __m128i accu0 = _mm_setzero_si128();
+  __m128i accu1 = _mm_setzero_si128();
+#ifdef DOTPU8_ACCU_3
+  __m128i accu2 = _mm_setzero_si128();
+  #ifdef DOTPU8_ACCU_4
+    __m128i accu3 = _mm_setzero_si128();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m128i madd0, madd1, madd2, madd3;
+
+    // 0
+    __m128i u0_16 = DOTPU8_LOAD_128(u);
+    __m128i v0_16 = DOTPU8_LOAD_128(v);
+
+    madd0 = _mm_madd_epi16(_mm_unpacklo_epi8(u0_16, zero), _mm_unpacklo_epi8(v0_16, zero));
+
+    // 1
+    madd1 = _mm_madd_epi16(_mm_unpackhi_epi8(u0_16, zero), _mm_unpackhi_epi8(v0_16, zero));
+
+    // 2
+    __m128i u1_16 = DOTPU8_LOAD_128(u + 16);
+    __m128i v1_16 = DOTPU8_LOAD_128(v + 16);
+
+    madd2 = _mm_madd_epi16(_mm_unpacklo_epi8(u1_16, zero), _mm_unpacklo_epi8(v1_16, zero));
+
+    // 3
+    madd3 = _mm_madd_epi16(_mm_unpackhi_epi8(u1_16, zero), _mm_unpackhi_epi8(v1_16, zero));
+
+    // Sum
+    accu0 = _mm_add_epi32(accu0, madd0);
+    accu1 = _mm_add_epi32(accu1, madd1);
+    accu2 = _mm_add_epi32(accu2, madd2);
+    accu3 = _mm_add_epi32(accu3, madd3);
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+#ifdef DOTPU8_ACCU_4
+  // Sum accumulators
+  accu2 = _mm_add_epi32(accu2, accu3);
+#else
+  #ifdef DOTPU8_ACCU_3
+  accu1 = _mm_add_epi32(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPU8_SIZE_MULTIPLE < 32
+  // Unroll remaining x2
+  if (n & 16)
+  {
+    __m128i madd0, madd1;
+    __m128i u_16 = DOTPU8_LOAD_128(u);
+    __m128i v_16 = DOTPU8_LOAD_128(v);
+
+    // 0
+    madd0 = _mm_madd_epi16(_mm_unpacklo_epi8(u_16, zero), _mm_unpacklo_epi8(v_16, zero));
+
+    // 1
+    madd1 = _mm_madd_epi16(_mm_unpackhi_epi8(u_16, zero), _mm_unpackhi_epi8(v_16, zero));
+
+    // Sum
+    accu0 = _mm_add_epi32(accu0, madd0);
+    accu1 = _mm_add_epi32(accu1, madd1);
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 32
+#ifdef DOTPU8_ACCU_4
+  // Sum accumulators
+  accu1 = _mm_add_epi32(accu1, accu2);
+#endif
+
+#if DOTPU8_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    __m128i madd;
+
+    madd  = _mm_madd_epi16(_mm_unpacklo_epi8(DOTPU8_LOAD_64(u + n), zero),
+                           _mm_unpacklo_epi8(DOTPU8_LOAD_64(v + n), zero));
+    accu0 = _mm_add_epi32(accu0, madd);
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 16
+
+  // Sum accumulators
+  accu0 = _mm_add_epi32(accu0, accu1);
+  res = (uint32_t)horizontal_sum_epi32(accu0);
+
+#if DOTPU8_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case 7: res += (uint32_t)u[6] * v[6];
+    case 6: res += (uint32_t)u[5] * v[5];
+    case 5: res += (uint32_t)u[4] * v[4];
+    case 4: res += (uint32_t)u[3] * v[3];
+    case 3: res += (uint32_t)u[2] * v[2];
+    case 2: res += (uint32_t)u[1] * v[1];
+    case 1: res += (uint32_t)u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 8
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX2_
+static inline uint32_t dotProduct_ui8_avx2(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res;
+  size_t count = n >> 6;
+  const __m256i zero = _mm256_setzero_si256();
+
+  // Accumulators
+  __m256i accu0 = _mm256_setzero_si256();
+  __m256i accu1 = _mm256_setzero_si256();
+#ifdef DOTPU8_ACCU_3
+  __m256i accu2 = _mm256_setzero_si256();
+  #ifdef DOTPU8_ACCU_4
+    __m256i accu3 = _mm256_setzero_si256();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256i madd0, madd1, madd2, madd3;
+
+    // 0
+    __m256i u0_32 = DOTPU8_LOAD_256(u);
+    __m256i v0_32 = DOTPU8_LOAD_256(v);
+
+    madd0 = _mm256_madd_epi16(_mm256_unpacklo_epi8(u0_32, zero), _mm256_unpacklo_epi8(v0_32, zero));
+
+    // 1
+    madd1 = _mm256_madd_epi16(_mm256_unpackhi_epi8(u0_32, zero), _mm256_unpackhi_epi8(v0_32, zero));
+
+    // 2
+    __m256i u1_32 = DOTPU8_LOAD_256(u + 32);
+    __m256i v1_32 = DOTPU8_LOAD_256(v + 32);
+
+    madd2 = _mm256_madd_epi16(_mm256_unpacklo_epi8(u1_32, zero), _mm256_unpacklo_epi8(v1_32, zero));
+
+    // 3
+    madd3 = _mm256_madd_epi16(_mm256_unpackhi_epi8(u1_32, zero), _mm256_unpackhi_epi8(v1_32, zero));
+
+    // Sum
+    accu0 = _mm256_add_epi32(accu0, madd0);
+    accu1 = _mm256_add_epi32(accu1, madd1);
+    accu2 = _mm256_add_epi32(accu2, madd2);
+    accu3 = _mm256_add_epi32(accu3, madd3);
+
+    // Next
+    u += 64;
+    v += 64;
+  }
+#ifdef DOTPU8_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_epi32(accu2, accu3);
+#else
+  #ifdef DOTPU8_ACCU_3
+  accu1 = _mm256_add_epi32(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPU8_SIZE_MULTIPLE < 64
+  // Unroll remaining x2
+  if (n & 32)
+  {
+    __m256i madd0, madd1;
+    __m256i u_32 = DOTPU8_LOAD_256(u);
+    __m256i v_32 = DOTPU8_LOAD_256(v);
+
+    // 0
+    madd0 = _mm256_madd_epi16(_mm256_unpacklo_epi8(u_32, zero), _mm256_unpacklo_epi8(v_32, zero));
+
+    // 1
+    madd1 = _mm256_madd_epi16(_mm256_unpackhi_epi8(u_32, zero), _mm256_unpackhi_epi8(v_32, zero));
+
+    // Sum
+    accu0 = _mm256_add_epi32(accu0, madd0);
+    accu1 = _mm256_add_epi32(accu1, madd1);
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 64
+#ifdef DOTPU8_ACCU_4
+  // Sum accumulators
+  accu1 = _mm256_add_epi32(accu1, accu2);
+#endif
+
+#if DOTPU8_SIZE_MULTIPLE < 32
+  // Remaining > 16
+  if (n & 16)
+  {
+    n &= 15;
+    __m256i madd;
+
+    madd  = _mm256_madd_epi16(_mm256_cvtepu8_epi16(DOTPU8_LOAD_128(u + n)),
+                              _mm256_cvtepu8_epi16(DOTPU8_LOAD_128(v + n)));
+    accu0 = _mm256_add_epi32(accu0, madd);
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 32
+
+  // Sum accumulators
+  accu0 = _mm256_add_epi32(accu0, accu1);
+  res = (uint32_t)horizontal_sum_epi32(accu0);
+
+#if DOTPU8_SIZE_MULTIPLE < 16
+  // Remaining < 16
+  switch (n & 15)
+  {
+    case 15: res += (uint32_t)u[14] * v[14];
+    case 14: res += (uint32_t)u[13] * v[13];
+    case 13: res += (uint32_t)u[12] * v[12];
+    case 12: res += (uint32_t)u[11] * v[11];
+    case 11: res += (uint32_t)u[10] * v[10];
+    case 10: res += (uint32_t)u[ 9] * v[ 9];
+    case  9: res += (uint32_t)u[ 8] * v[ 8];
+    case  8: res += (uint32_t)u[ 7] * v[ 7];
+    case  7: res += (uint32_t)u[ 6] * v[ 6];
+    case  6: res += (uint32_t)u[ 5] * v[ 5];
+    case  5: res += (uint32_t)u[ 4] * v[ 4];
+    case  4: res += (uint32_t)u[ 3] * v[ 3];
+    case  3: res += (uint32_t)u[ 2] * v[ 2];
+    case  2: res += (uint32_t)u[ 1] * v[ 1];
+    case  1: res += (uint32_t)u[ 0] * v[ 0];
+    default: break;
+  }
+#endif // DOTPU8_SIZE_MULTIPLE < 16
+
+  return res;
+}
+#endif // HAS_AVX2_
+
+// vpdpbusd multiplies unsigned x signed bytes: v is biased to signed (v - 128)
+// and corrected with 128 * Sum(u), Sum(u) being computed with psadbw
+#if defined(HAS_AVX512VNNI_) && defined(HAS_AVX512VL_)
+static inline uint32_t dotProduct_ui8_vnni(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res;
+  size_t count = n >> 6;
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i bias = _mm256_set1_epi8((char)0x80);
+
+  // Accumulators
+  __m256i accu0 = _mm256_setzero_si256();
+  __m256i accu1 = _mm256_setzero_si256();
+  __m256i usum  = _mm256_setzero_si256();
+
+  // Unroll x2
+  while (count--)
+  {
+    __m256i u0_32 = DOTPU8_LOAD_256(u);
+    __m256i u1_32 = DOTPU8_LOAD_256(u + 32);
+
+    // 0
+    accu0 = _mm256_dpbusd_epi32(accu0, u0_32, _mm256_xor_si256(DOTPU8_LOAD_256(v), bias));
+    usum  = _mm256_add_epi64(usum, _mm256_sad_epu8(u0_32, zero));
+
+    // 1
+    accu1 = _mm256_dpbusd_epi32(accu1, u1_32, _mm256_xor_si256(DOTPU8_LOAD_256(v + 32), bias));
+    usum  = _mm256_add_epi64(usum, _mm256_sad_epu8(u1_32, zero));
+
+    // Next
+    u += 64;
+    v += 64;
+  }
+
+  // Sum accumulators and bias correction
+  accu0 = _mm256_add_epi32(accu0, accu1);
+  usum  = _mm256_add_epi64(usum, _mm256_shuffle_epi32(usum, _MM_SHUFFLE(1, 0, 3, 2)));
+  res   = (uint32_t)horizontal_sum_epi32(accu0)
+        + ((uint32_t)_mm256_extract_epi32(usum, 0) + (uint32_t)_mm256_extract_epi32(usum, 4)) * 128u;
+
+#if DOTPU8_SIZE_MULTIPLE < 64
+  // Remaining < 64
+  res += dotProduct_ui8_avx2(u, v, n & 63);
+#endif
+
+  return res;
+}
+#endif // HAS_AVX512VNNI_ && HAS_AVX512VL_
+
+#ifdef accu2
+  #undef accu2
+#endif
+#ifdef accu3
+  #undef accu3
+#endif
+
+#endif // DOTP_UI8_H
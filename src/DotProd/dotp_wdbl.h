@@ -0,0 +1,610 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_WDBL_H
+#define DOTP_WDBL_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_SSSE3_
+  #include <pmmintrin.h>  // SSE3
+#endif
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX2, FMA, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef DOTPWDBL_SIZE_MULTIPLE
+  #define DOTPWDBL_SIZE_MULTIPLE 0   // 16, 8, 4, 2 (0: no optim)
+#endif
+//#define DOTPWDBL_ACCU_3   // Use 3/4 accumulators (depend on HW/vectors size)
+//#define DOTPWDBL_ACCU_4
+#if defined(DOTPWDBL_ACCU_4) && !defined(DOTPWDBL_ACCU_3)
+  #define DOTPWDBL_ACCU_3
+#endif
+#if defined DOTPWDBL_256_ALIGNED
+  #define DOTPWDBL_LOAD_128(x) _mm_load_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPWDBL_LOAD_256(x) _mm256_load_pd(x)
+  #endif
+#elif defined DOTPWDBL_128_ALIGNED
+  #define DOTPWDBL_LOAD_128(x) _mm_load_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPWDBL_LOAD_256(x) _mm256_loadu_pd(x)
+  #endif
+#else
+  #define DOTPWDBL_LOAD_128(x) _mm_loadu_pd(x)
+  #ifdef HAS_AVX_
+    #define DOTPWDBL_LOAD_256(x) _mm256_loadu_pd(x)
+  #endif
+#endif
+
+// Weighted:  Sum(w[i] * u[i] * v[i])
+// Masked:    Sum(u[i] * v[i]) for i with bit (i&7) of mask[i>>3] set (LSB first)
+//            Masked out lanes are zeroed after product/on load (NaN/Inf safe)
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline double dotProductWeighted_dbl_scalarforced(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  double res = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<n; ++i)
+    res += w[i] * u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline double dotProductWeighted_dbl_scalar(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  double res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += w[i] * u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline double dotProductWeighted_dbl_sse(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  double res;
+  size_t count = n >> 3;
+
+  // Accumulators
+  __m128d accu0 = _mm_setzero_pd();
+  __m128d accu1 = _mm_setzero_pd();
+#ifdef DOTPWDBL_ACCU_3
+  __m128d accu2 = _mm_setzero_pd();
+  #ifdef DOTPWDBL_ACCU_4
+    __m128d accu3 = _mm_setzero_pd();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m128d mult0, mult1, mult2, mult3;
+
+    // 0
+    mult0 = _mm_mul_pd(DOTPWDBL_LOAD_128(u), DOTPWDBL_LOAD_128(v));
+    mult0 = _mm_mul_pd(mult0, DOTPWDBL_LOAD_128(w));
+
+    // 1
+    mult1 = _mm_mul_pd(DOTPWDBL_LOAD_128(u + 2), DOTPWDBL_LOAD_128(v + 2));
+    mult1 = _mm_mul_pd(mult1, DOTPWDBL_LOAD_128(w + 2));
+
+    // 2
+    mult2 = _mm_mul_pd(DOTPWDBL_LOAD_128(u + 4), DOTPWDBL_LOAD_128(v + 4));
+    mult2 = _mm_mul_pd(mult2, DOTPWDBL_LOAD_128(w + 4));
+
+    // 3
+    mult3 = _mm_mul_pd(DOTPWDBL_LOAD_128(u + 6), DOTPWDBL_LOAD_128(v + 6));
+    mult3 = _mm_mul_pd(mult3, DOTPWDBL_LOAD_128(w + 6));
+
+    // Sum
+    accu0 = _mm_add_pd(accu0, mult0);
+    accu1 = _mm_add_pd(accu1, mult1);
+    accu2 = _mm_add_pd(accu2, mult2);
+    accu3 = _mm_add_pd(accu3, mult3);
+
+    // Next
+    u += 8;
+    v += 8;
+    w += 8;
+  }
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu2 = _mm_add_pd(accu2, accu3);
+#else
+  #ifdef DOTPWDBL_ACCU_3
+  accu1 = _mm_add_pd(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 8
+  // Unroll remaining x2
+  if (n & 4)
+  {
+    __m128d mult0, mult1;
+
+    // 0
+    mult0 = _mm_mul_pd(DOTPWDBL_LOAD_128(u), DOTPWDBL_LOAD_128(v));
+    mult0 = _mm_mul_pd(mult0, DOTPWDBL_LOAD_128(w));
+
+    // 1
+    mult1 = _mm_mul_pd(DOTPWDBL_LOAD_128(u + 2), DOTPWDBL_LOAD_128(v + 2));
+    mult1 = _mm_mul_pd(mult1, DOTPWDBL_LOAD_128(w + 2));
+
+    // Sum
+    accu0 = _mm_add_pd(accu0, mult0);
+    accu1 = _mm_add_pd(accu1, mult1);
+
+    // Next
+    u += 4;
+    v += 4;
+    w += 4;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 8
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu1 = _mm_add_pd(accu1, accu2);
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 4
+  // Remaining > 2
+  if (n & 2)
+  {
+    n &= 1;
+    __m128d mult;
+
+    mult  = _mm_mul_pd(DOTPWDBL_LOAD_128(u + n), DOTPWDBL_LOAD_128(v + n));
+    mult  = _mm_mul_pd(mult, DOTPWDBL_LOAD_128(w + n));
+    accu0 = _mm_add_pd(accu0, mult);
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 4
+
+  // Sum accumulators
+  accu0 = _mm_add_pd(accu0, accu1);
+  res = horizontal_sum_pd(accu0);
+
+#if DOTPWDBL_SIZE_MULTIPLE < 2
+  // Remaining < 2
+  if (n & 1)
+    res += w[0] * u[0] * v[0];
+#endif // DOTPWDBL_SIZE_MULTIPLE < 2
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX_
+static inline double dotProductWeighted_dbl_avx(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  double res;
+  size_t count = n >> 4;
+
+  // Accumulators
+  __m256d accu0 = _mm256_setzero_pd();
+  __m256d accu1 = _mm256_setzero_pd();
+#ifdef DOTPWDBL_ACCU_3
+  __m256d accu2 = _mm256_setzero_pd();
+  #ifdef DOTPWDBL_ACCU_4
+    __m256d accu3 = _mm256_setzero_pd();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256d mult0, mult1, mult2, mult3;
+
+    // 0
+    mult0 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u), DOTPWDBL_LOAD_256(v));
+    mult0 = _mm256_mul_pd(mult0, DOTPWDBL_LOAD_256(w));
+
+    // 1
+    mult1 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 4), DOTPWDBL_LOAD_256(v + 4));
+    mult1 = _mm256_mul_pd(mult1, DOTPWDBL_LOAD_256(w + 4));
+
+    // 2
+    mult2 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 8), DOTPWDBL_LOAD_256(v + 8));
+    mult2 = _mm256_mul_pd(mult2, DOTPWDBL_LOAD_256(w + 8));
+
+    // 3
+    mult3 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 12), DOTPWDBL_LOAD_256(v + 12));
+    mult3 = _mm256_mul_pd(mult3, DOTPWDBL_LOAD_256(w + 12));
+
+    // Sum
+    accu0 = _mm256_add_pd(accu0, mult0);
+    accu1 = _mm256_add_pd(accu1, mult1);
+    accu2 = _mm256_add_pd(accu2, mult2);
+    accu3 = _mm256_add_pd(accu3, mult3);
+
+    // Next
+    u += 16;
+    v += 16;
+    w += 16;
+  }
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_pd(accu2, accu3);
+#else
+  #ifdef DOTPWDBL_ACCU_3
+  accu1 = _mm256_add_pd(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 16
+  // Unroll remaining x2
+  if (n & 8)
+  {
+    __m256d mult0, mult1;
+
+    // 0
+    mult0 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u), DOTPWDBL_LOAD_256(v));
+    mult0 = _mm256_mul_pd(mult0, DOTPWDBL_LOAD_256(w));
+
+    // 1
+    mult1 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 4), DOTPWDBL_LOAD_256(v + 4));
+    mult1 = _mm256_mul_pd(mult1, DOTPWDBL_LOAD_256(w + 4));
+
+    // Sum
+    accu0 = _mm256_add_pd(accu0, mult0);
+    accu1 = _mm256_add_pd(accu1, mult1);
+
+    // Next
+    u += 8;
+    v += 8;
+    w += 8;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 16
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu1 = _mm256_add_pd(accu1, accu2);
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    __m256d mult;
+
+    mult  = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + n), DOTPWDBL_LOAD_256(v + n));
+    mult  = _mm256_mul_pd(mult, DOTPWDBL_LOAD_256(w + n));
+    accu0 = _mm256_add_pd(accu0, mult);
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accu0 = _mm256_add_pd(accu0, accu1);
+  res = horizontal_sum_pd(accu0);
+
+#if DOTPWDBL_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: res += w[2] * u[2] * v[2];
+    case 2: res += w[1] * u[1] * v[1];
+    case 1: res += w[0] * u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 4
+
+  return res;
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_FMA_
+static inline double dotProductWeighted_dbl_fma(double const* __restrict u, double const* __restrict v, double const* __restrict w, size_t n)
+{
+  double res;
+  size_t count = n >> 4;
+
+  // Accumulators
+  __m256d accu0 = _mm256_setzero_pd();
+  __m256d accu1 = _mm256_setzero_pd();
+#ifdef DOTPWDBL_ACCU_3
+  __m256d accu2 = _mm256_setzero_pd();
+  #ifdef DOTPWDBL_ACCU_4
+    __m256d accu3 = _mm256_setzero_pd();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256d wu0_4, wu1_4, wu2_4, wu3_4;
+
+    // 0
+    wu0_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w), DOTPWDBL_LOAD_256(u));
+    accu0 = _mm256_fmadd_pd(wu0_4, DOTPWDBL_LOAD_256(v), accu0);
+
+    // 1
+    wu1_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w + 4), DOTPWDBL_LOAD_256(u + 4));
+    accu1 = _mm256_fmadd_pd(wu1_4, DOTPWDBL_LOAD_256(v + 4), accu1);
+
+    // 2
+    wu2_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w + 8), DOTPWDBL_LOAD_256(u + 8));
+    accu2 = _mm256_fmadd_pd(wu2_4, DOTPWDBL_LOAD_256(v + 8), accu2);
+
+    // 3
+    wu3_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w + 12), DOTPWDBL_LOAD_256(u + 12));
+    accu3 = _mm256_fmadd_pd(wu3_4, DOTPWDBL_LOAD_256(v + 12), accu3);
+
+    // Next
+    u += 16;
+    v += 16;
+    w += 16;
+  }
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_pd(accu2, accu3);
+#else
+  #ifdef DOTPWDBL_ACCU_3
+  accu1 = _mm256_add_pd(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 16
+  // Unroll remaining x2
+  if (n & 8)
+  {
+    __m256d wu0_4, wu1_4;
+
+    // 0
+    wu0_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w), DOTPWDBL_LOAD_256(u));
+    accu0 = _mm256_fmadd_pd(wu0_4, DOTPWDBL_LOAD_256(v), accu0);
+
+    // 1
+    wu1_4 = _mm256_mul_pd(DOTPWDBL_LOAD_256(w + 4), DOTPWDBL_LOAD_256(u + 4));
+    accu1 = _mm256_fmadd_pd(wu1_4, DOTPWDBL_LOAD_256(v + 4), accu1);
+
+    // Next
+    u += 8;
+    v += 8;
+    w += 8;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 16
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu1 = _mm256_add_pd(accu1, accu2);
+#endif
+
+#if DOTPWDBL_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    __m256d wu_4;
+
+    wu_4  = _mm256_mul_pd(DOTPWDBL_LOAD_256(w + n), DOTPWDBL_LOAD_256(u + n));
+    accu0 = _mm256_fmadd_pd(wu_4, DOTPWDBL_LOAD_256(v + n), accu0);
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accu0 = _mm256_add_pd(accu0, accu1);
+  res = horizontal_sum_pd(accu0);
+
+#if DOTPWDBL_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: res += w[2] * u[2] * v[2];
+    case 2: res += w[1] * u[1] * v[1];
+    case 1: res += w[0] * u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 4
+
+  return res;
+}
+#endif // HAS_FMA_
+
+//
+static inline double dotProductMasked_dbl_scalar(double const* __restrict u, double const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  double res = 0;
+  for (size_t i=0; i<n; ++i)
+    if ((mask[i >> 3] >> (i & 7)) & 1)
+      res += u[i] * v[i];
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX2_
+static inline double dotProductMasked_dbl_avx2(double const* __restrict u, double const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  double res;
+  size_t count = n >> 4;
+
+  // Lanes bits (element i <-> bit i of 16-bit mask word)
+  const __m256i bits0 = _mm256_setr_epi64x(1<<0, 1<<1, 1<<2, 1<<3);
+  const __m256i bits1 = _mm256_slli_epi64(bits0, 4);
+  const __m256i bits2 = _mm256_slli_epi64(bits0, 8);
+  const __m256i bits3 = _mm256_slli_epi64(bits0, 12);
+
+  // Accumulators
+  __m256d accu0 = _mm256_setzero_pd();
+  __m256d accu1 = _mm256_setzero_pd();
+#ifdef DOTPWDBL_ACCU_3
+  __m256d accu2 = _mm256_setzero_pd();
+  #ifdef DOTPWDBL_ACCU_4
+    __m256d accu3 = _mm256_setzero_pd();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256d mult0, mult1, mult2, mult3;
+    __m256i m_4;
+    uint16_t m16;
+
+    memcpy(&m16, mask, sizeof(m16));
+    m_4 = _mm256_set1_epi64x(m16);
+
+    // 0
+    mult0 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u), DOTPWDBL_LOAD_256(v));
+    mult0 = _mm256_and_pd(mult0, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits0), bits0)));
+
+    // 1
+    mult1 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 4), DOTPWDBL_LOAD_256(v + 4));
+    mult1 = _mm256_and_pd(mult1, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits1), bits1)));
+
+    // 2
+    mult2 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 8), DOTPWDBL_LOAD_256(v + 8));
+    mult2 = _mm256_and_pd(mult2, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits2), bits2)));
+
+    // 3
+    mult3 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 12), DOTPWDBL_LOAD_256(v + 12));
+    mult3 = _mm256_and_pd(mult3, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits3), bits3)));
+
+    // Sum
+    accu0 = _mm256_add_pd(accu0, mult0);
+    accu1 = _mm256_add_pd(accu1, mult1);
+    accu2 = _mm256_add_pd(accu2, mult2);
+    accu3 = _mm256_add_pd(accu3, mult3);
+
+    // Next
+    u += 16;
+    v += 16;
+    mask += 2;
+  }
+#ifdef DOTPWDBL_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_pd(accu2, accu3);
+#endif
+#ifdef DOTPWDBL_ACCU_3
+  accu1 = _mm256_add_pd(accu1, accu2);
+#endif
+  accu0 = _mm256_add_pd(accu0, accu1);
+
+#if DOTPWDBL_SIZE_MULTIPLE < 16
+  // Remaining x8 (one mask byte)
+  if (n & 8)
+  {
+    __m256d mult0, mult1;
+    __m256i m_4 = _mm256_set1_epi64x(*mask);
+
+    mult0 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u), DOTPWDBL_LOAD_256(v));
+    mult0 = _mm256_and_pd(mult0, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits0), bits0)));
+    mult1 = _mm256_mul_pd(DOTPWDBL_LOAD_256(u + 4), DOTPWDBL_LOAD_256(v + 4));
+    mult1 = _mm256_and_pd(mult1, _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m_4, bits1), bits1)));
+
+    accu0 = _mm256_add_pd(accu0, _mm256_add_pd(mult0, mult1));
+
+    u += 8;
+    v += 8;
+    ++mask;
+  }
+#endif // DOTPWDBL_SIZE_MULTIPLE < 16
+
+  res = horizontal_sum_pd(accu0);
+
+#if DOTPWDBL_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  for (size_t i=0; i<(n & 7); ++i)
+    if ((*mask >> i) & 1)
+      res += u[i] * v[i];
+#endif // DOTPWDBL_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+static inline double dotProductMasked_dbl_avx512(double const* __restrict u, double const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  size_t count = n >> 5;
+
+  // Accumulators
+  __m512d accuA = _mm512_setzero_pd();
+  __m512d accuB = _mm512_setzero_pd();
+  __m512d accuC = _mm512_setzero_pd();
+  __m512d accuD = _mm512_setzero_pd();
+
+  // Unroll x4 (masked out lanes zeroed on load, one mask byte each)
+  while (count--)
+  {
+    // 0
+    accuA = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask[0], u),      _mm512_maskz_loadu_pd(mask[0], v),      accuA);
+
+    // 1
+    accuB = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask[1], u + 8),  _mm512_maskz_loadu_pd(mask[1], v + 8),  accuB);
+
+    // 2
+    accuC = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask[2], u + 16), _mm512_maskz_loadu_pd(mask[2], v + 16), accuC);
+
+    // 3
+    accuD = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask[3], u + 24), _mm512_maskz_loadu_pd(mask[3], v + 24), accuD);
+
+    // Next
+    u += 32;
+    v += 32;
+    mask += 4;
+  }
+  // Sum accumulators
+  accuA = _mm512_add_pd(accuA, accuB);
+  accuC = _mm512_add_pd(accuC, accuD);
+  accuA = _mm512_add_pd(accuA, accuC);
+
+  // Remaining (tail folded into the mask, no scalar loop)
+  n &= 31;
+  while (n)
+  {
+    const size_t len = (n < 8) ? n : 8;
+    __mmask8 k = (__mmask8)(*mask & ((1u << len) - 1));
+
+    accuA = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, u), _mm512_maskz_loadu_pd(k, v), accuA);
+
+    u += len;
+    v += len;
+    ++mask;
+    n -= len;
+  }
+
+  return _mm512_reduce_add_pd(accuA);
+}
+#endif // HAS_AVX512F_
+
+#ifdef accu2
+  #undef accu2
+#endif
+#ifdef accu3
+  #undef accu3
+#endif
+
+#endif // DOTP_WDBL_H
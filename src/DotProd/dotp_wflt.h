@@ -0,0 +1,631 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_WFLT_H
+#define DOTP_WFLT_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_SSSE3_
+  #include <pmmintrin.h>  // SSE3
+#endif
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX2, FMA, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef DOTPWFLT_SIZE_MULTIPLE
+  #define DOTPWFLT_SIZE_MULTIPLE 0   // 32, 16, 8, 4 (0: no optim)
+#endif
+//#define DOTPWFLT_ACCU_3   // Use 3/4 accumulators (depend on HW/vectors size)
+//#define DOTPWFLT_ACCU_4
+#if defined(DOTPWFLT_ACCU_4) && !defined(DOTPWFLT_ACCU_3)
+  #define DOTPWFLT_ACCU_3
+#endif
+#if defined DOTPWFLT_256_ALIGNED
+  #define DOTPWFLT_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPWFLT_LOAD_256(x) _mm256_load_ps(x)
+  #endif
+#elif defined DOTPWFLT_128_ALIGNED
+  #define DOTPWFLT_LOAD_128(x) _mm_load_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPWFLT_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#else
+  #define DOTPWFLT_LOAD_128(x) _mm_loadu_ps(x)
+  #ifdef HAS_AVX_
+    #define DOTPWFLT_LOAD_256(x) _mm256_loadu_ps(x)
+  #endif
+#endif
+
+// Weighted:  Sum(w[i] * u[i] * v[i])
+// Masked:    Sum(u[i] * v[i]) for i with bit (i&7) of mask[i>>3] set (LSB first)
+//            Masked out lanes are zeroed after product/on load (NaN/Inf safe)
+
+
+//
+DISABLE_FUNC_VECTORIZATION_
+static inline float dotProductWeighted_flt_scalarforced(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  float res = 0;
+  DISABLE_LOOP_VECTORIZATION_
+  for (size_t i=0; i<n; ++i)
+    res += w[i] * u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline float dotProductWeighted_flt_scalar(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  float res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += w[i] * u[i] * v[i];
+
+  return res;
+}
+
+//
+static inline float dotProductWeighted_flt_sse(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  float res;
+  size_t count = n >> 4;
+
+  // Accumulators
+  __m128 accu0 = _mm_setzero_ps();
+  __m128 accu1 = _mm_setzero_ps();
+#ifdef DOTPWFLT_ACCU_3
+  __m128 accu2 = _mm_setzero_ps();
+  #ifdef DOTPWFLT_ACCU_4
+    __m128 accu3 = _mm_setzero_ps();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m128 mult0, mult1, mult2, mult3;
+
+    // 0
+    mult0 = _mm_mul_ps(DOTPWFLT_LOAD_128(u), DOTPWFLT_LOAD_128(v));
+    mult0 = _mm_mul_ps(mult0, DOTPWFLT_LOAD_128(w));
+
+    // 1
+    mult1 = _mm_mul_ps(DOTPWFLT_LOAD_128(u + 4), DOTPWFLT_LOAD_128(v + 4));
+    mult1 = _mm_mul_ps(mult1, DOTPWFLT_LOAD_128(w + 4));
+
+    // 2
+    mult2 = _mm_mul_ps(DOTPWFLT_LOAD_128(u + 8), DOTPWFLT_LOAD_128(v + 8));
+    mult2 = _mm_mul_ps(mult2, DOTPWFLT_LOAD_128(w + 8));
+
+    // 3
+    mult3 = _mm_mul_ps(DOTPWFLT_LOAD_128(u + 12), DOTPWFLT_LOAD_128(v + 12));
+    mult3 = _mm_mul_ps(mult3, DOTPWFLT_LOAD_128(w + 12));
+
+    // Sum
+    accu0 = _mm_add_ps(accu0, mult0);
+    accu1 = _mm_add_ps(accu1, mult1);
+    accu2 = _mm_add_ps(accu2, mult2);
+    accu3 = _mm_add_ps(accu3, mult3);
+
+    // Next
+    u += 16;
+    v += 16;
+    w += 16;
+  }
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu2 = _mm_add_ps(accu2, accu3);
+#else
+  #ifdef DOTPWFLT_ACCU_3
+  accu1 = _mm_add_ps(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 16
+  // Unroll remaining x2
+  if (n & 8)
+  {
+    __m128 mult0, mult1;
+
+    // 0
+    mult0 = _mm_mul_ps(DOTPWFLT_LOAD_128(u), DOTPWFLT_LOAD_128(v));
+    mult0 = _mm_mul_ps(mult0, DOTPWFLT_LOAD_128(w));
+
+    // 1
+    mult1 = _mm_mul_ps(DOTPWFLT_LOAD_128(u + 4), DOTPWFLT_LOAD_128(v + 4));
+    mult1 = _mm_mul_ps(mult1, DOTPWFLT_LOAD_128(w + 4));
+
+    // Sum
+    accu0 = _mm_add_ps(accu0, mult0);
+    accu1 = _mm_add_ps(accu1, mult1);
+
+    // Next
+    u += 8;
+    v += 8;
+    w += 8;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 16
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu1 = _mm_add_ps(accu1, accu2);
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    __m128 mult;
+
+    mult  = _mm_mul_ps(DOTPWFLT_LOAD_128(u + n), DOTPWFLT_LOAD_128(v + n));
+    mult  = _mm_mul_ps(mult, DOTPWFLT_LOAD_128(w + n));
+    accu0 = _mm_add_ps(accu0, mult);
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 8
+
+  // Sum accumulators
+  accu0 = _mm_add_ps(accu0, accu1);
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPWFLT_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: res += w[2] * u[2] * v[2];
+    case 2: res += w[1] * u[1] * v[1];
+    case 1: res += w[0] * u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 4
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX_
+static inline float dotProductWeighted_flt_avx(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  float res;
+  size_t count = n >> 5;
+
+  // Accumulators
+  __m256 accu0 = _mm256_setzero_ps();
+  __m256 accu1 = _mm256_setzero_ps();
+#ifdef DOTPWFLT_ACCU_3
+  __m256 accu2 = _mm256_setzero_ps();
+  #ifdef DOTPWFLT_ACCU_4
+    __m256 accu3 = _mm256_setzero_ps();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256 mult0, mult1, mult2, mult3;
+
+    // 0
+    mult0 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u), DOTPWFLT_LOAD_256(v));
+    mult0 = _mm256_mul_ps(mult0, DOTPWFLT_LOAD_256(w));
+
+    // 1
+    mult1 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 8), DOTPWFLT_LOAD_256(v + 8));
+    mult1 = _mm256_mul_ps(mult1, DOTPWFLT_LOAD_256(w + 8));
+
+    // 2
+    mult2 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 16), DOTPWFLT_LOAD_256(v + 16));
+    mult2 = _mm256_mul_ps(mult2, DOTPWFLT_LOAD_256(w + 16));
+
+    // 3
+    mult3 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 24), DOTPWFLT_LOAD_256(v + 24));
+    mult3 = _mm256_mul_ps(mult3, DOTPWFLT_LOAD_256(w + 24));
+
+    // Sum
+    accu0 = _mm256_add_ps(accu0, mult0);
+    accu1 = _mm256_add_ps(accu1, mult1);
+    accu2 = _mm256_add_ps(accu2, mult2);
+    accu3 = _mm256_add_ps(accu3, mult3);
+
+    // Next
+    u += 32;
+    v += 32;
+    w += 32;
+  }
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_ps(accu2, accu3);
+#else
+  #ifdef DOTPWFLT_ACCU_3
+  accu1 = _mm256_add_ps(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 32
+  // Unroll remaining x2
+  if (n & 16)
+  {
+    __m256 mult0, mult1;
+
+    // 0
+    mult0 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u), DOTPWFLT_LOAD_256(v));
+    mult0 = _mm256_mul_ps(mult0, DOTPWFLT_LOAD_256(w));
+
+    // 1
+    mult1 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 8), DOTPWFLT_LOAD_256(v + 8));
+    mult1 = _mm256_mul_ps(mult1, DOTPWFLT_LOAD_256(w + 8));
+
+    // Sum
+    accu0 = _mm256_add_ps(accu0, mult0);
+    accu1 = _mm256_add_ps(accu1, mult1);
+
+    // Next
+    u += 16;
+    v += 16;
+    w += 16;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 32
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu1 = _mm256_add_ps(accu1, accu2);
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    __m256 mult;
+
+    mult  = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + n), DOTPWFLT_LOAD_256(v + n));
+    mult  = _mm256_mul_ps(mult, DOTPWFLT_LOAD_256(w + n));
+    accu0 = _mm256_add_ps(accu0, mult);
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 16
+
+  // Sum accumulators
+  accu0 = _mm256_add_ps(accu0, accu1);
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPWFLT_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case  7: res += w[6] * u[6] * v[6];
+    case  6: res += w[5] * u[5] * v[5];
+    case  5: res += w[4] * u[4] * v[4];
+    case  4: res += w[3] * u[3] * v[3];
+    case  3: res += w[2] * u[2] * v[2];
+    case  2: res += w[1] * u[1] * v[1];
+    case  1: res += w[0] * u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_FMA_
+static inline float dotProductWeighted_flt_fma(float const* __restrict u, float const* __restrict v, float const* __restrict w, size_t n)
+{
+  float res;
+  size_t count = n >> 5;
+
+  // Accumulators
+  __m256 accu0 = _mm256_setzero_ps();
+  __m256 accu1 = _mm256_setzero_ps();
+#ifdef DOTPWFLT_ACCU_3
+  __m256 accu2 = _mm256_setzero_ps();
+  #ifdef DOTPWFLT_ACCU_4
+    __m256 accu3 = _mm256_setzero_ps();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256 wu0_8, wu1_8, wu2_8, wu3_8;
+
+    // 0
+    wu0_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w), DOTPWFLT_LOAD_256(u));
+    accu0 = _mm256_fmadd_ps(wu0_8, DOTPWFLT_LOAD_256(v), accu0);
+
+    // 1
+    wu1_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w + 8), DOTPWFLT_LOAD_256(u + 8));
+    accu1 = _mm256_fmadd_ps(wu1_8, DOTPWFLT_LOAD_256(v + 8), accu1);
+
+    // 2
+    wu2_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w + 16), DOTPWFLT_LOAD_256(u + 16));
+    accu2 = _mm256_fmadd_ps(wu2_8, DOTPWFLT_LOAD_256(v + 16), accu2);
+
+    // 3
+    wu3_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w + 24), DOTPWFLT_LOAD_256(u + 24));
+    accu3 = _mm256_fmadd_ps(wu3_8, DOTPWFLT_LOAD_256(v + 24), accu3);
+
+    // Next
+    u += 32;
+    v += 32;
+    w += 32;
+  }
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_ps(accu2, accu3);
+#else
+  #ifdef DOTPWFLT_ACCU_3
+  accu1 = _mm256_add_ps(accu1, accu2);
+  #endif
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 32
+  // Unroll remaining x2
+  if (n & 16)
+  {
+    __m256 wu0_8, wu1_8;
+
+    // 0
+    wu0_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w), DOTPWFLT_LOAD_256(u));
+    accu0 = _mm256_fmadd_ps(wu0_8, DOTPWFLT_LOAD_256(v), accu0);
+
+    // 1
+    wu1_8 = _mm256_mul_ps(DOTPWFLT_LOAD_256(w + 8), DOTPWFLT_LOAD_256(u + 8));
+    accu1 = _mm256_fmadd_ps(wu1_8, DOTPWFLT_LOAD_256(v + 8), accu1);
+
+    // Next
+    u += 16;
+    v += 16;
+    w += 16;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 32
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu1 = _mm256_add_ps(accu1, accu2);
+#endif
+
+#if DOTPWFLT_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    __m256 wu_8;
+
+    wu_8  = _mm256_mul_ps(DOTPWFLT_LOAD_256(w + n), DOTPWFLT_LOAD_256(u + n));
+    accu0 = _mm256_fmadd_ps(wu_8, DOTPWFLT_LOAD_256(v + n), accu0);
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 16
+
+  // Sum accumulators
+  accu0 = _mm256_add_ps(accu0, accu1);
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPWFLT_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case  7: res += w[6] * u[6] * v[6];
+    case  6: res += w[5] * u[5] * v[5];
+    case  5: res += w[4] * u[4] * v[4];
+    case  4: res += w[3] * u[3] * v[3];
+    case  3: res += w[2] * u[2] * v[2];
+    case  2: res += w[1] * u[1] * v[1];
+    case  1: res += w[0] * u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_FMA_
+
+//
+static inline float dotProductMasked_flt_scalar(float const* __restrict u, float const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  float res = 0;
+  for (size_t i=0; i<n; ++i)
+    if ((mask[i >> 3] >> (i & 7)) & 1)
+      res += u[i] * v[i];
+
+  return res;
+}
+
+//
+#ifdef HAS_AVX2_
+static inline float dotProductMasked_flt_avx2(float const* __restrict u, float const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  float res;
+  size_t count = n >> 5;
+
+  // Lanes bits (element i <-> bit i of 32-bit mask word)
+  const __m256i bits0 = _mm256_setr_epi32(1<<0,  1<<1,  1<<2,  1<<3,  1<<4,  1<<5,  1<<6,  1<<7);
+  const __m256i bits1 = _mm256_slli_epi32(bits0, 8);
+  const __m256i bits2 = _mm256_slli_epi32(bits0, 16);
+  const __m256i bits3 = _mm256_slli_epi32(bits0, 24);
+
+  // Accumulators
+  __m256 accu0 = _mm256_setzero_ps();
+  __m256 accu1 = _mm256_setzero_ps();
+#ifdef DOTPWFLT_ACCU_3
+  __m256 accu2 = _mm256_setzero_ps();
+  #ifdef DOTPWFLT_ACCU_4
+    __m256 accu3 = _mm256_setzero_ps();
+  #else
+    #define accu3 accu0
+  #endif
+#else
+  #define accu2 accu0
+  #define accu3 accu1
+#endif
+
+  // Unroll x4
+  while (count--)
+  {
+    __m256 mult0, mult1, mult2, mult3;
+    __m256i m_8;
+    uint32_t m32;
+
+    memcpy(&m32, mask, sizeof(m32));
+    m_8 = _mm256_set1_epi32((int32_t)m32);
+
+    // 0
+    mult0 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u), DOTPWFLT_LOAD_256(v));
+    mult0 = _mm256_and_ps(mult0, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m_8, bits0), bits0)));
+
+    // 1
+    mult1 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 8), DOTPWFLT_LOAD_256(v + 8));
+    mult1 = _mm256_and_ps(mult1, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m_8, bits1), bits1)));
+
+    // 2
+    mult2 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 16), DOTPWFLT_LOAD_256(v + 16));
+    mult2 = _mm256_and_ps(mult2, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m_8, bits2), bits2)));
+
+    // 3
+    mult3 = _mm256_mul_ps(DOTPWFLT_LOAD_256(u + 24), DOTPWFLT_LOAD_256(v + 24));
+    mult3 = _mm256_and_ps(mult3, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m_8, bits3), bits3)));
+
+    // Sum
+    accu0 = _mm256_add_ps(accu0, mult0);
+    accu1 = _mm256_add_ps(accu1, mult1);
+    accu2 = _mm256_add_ps(accu2, mult2);
+    accu3 = _mm256_add_ps(accu3, mult3);
+
+    // Next
+    u += 32;
+    v += 32;
+    mask += 4;
+  }
+#ifdef DOTPWFLT_ACCU_4
+  // Sum accumulators
+  accu2 = _mm256_add_ps(accu2, accu3);
+#endif
+#ifdef DOTPWFLT_ACCU_3
+  accu1 = _mm256_add_ps(accu1, accu2);
+#endif
+  accu0 = _mm256_add_ps(accu0, accu1);
+
+#if DOTPWFLT_SIZE_MULTIPLE < 32
+  // Remaining x8 (one mask byte each)
+  count = (n & 31) >> 3;
+  while (count--)
+  {
+    __m256 mult;
+    __m256i m_8 = _mm256_set1_epi32(*mask);
+
+    mult  = _mm256_mul_ps(DOTPWFLT_LOAD_256(u), DOTPWFLT_LOAD_256(v));
+    mult  = _mm256_and_ps(mult, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m_8, bits0), bits0)));
+    accu0 = _mm256_add_ps(accu0, mult);
+
+    u += 8;
+    v += 8;
+    ++mask;
+  }
+#endif // DOTPWFLT_SIZE_MULTIPLE < 32
+
+  res = horizontal_sum_ps(accu0);
+
+#if DOTPWFLT_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  for (size_t i=0; i<(n & 7); ++i)
+    if ((*mask >> i) & 1)
+      res += u[i] * v[i];
+#endif // DOTPWFLT_SIZE_MULTIPLE < 8
+
+  return res;
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+static inline float dotProductMasked_flt_avx512(float const* __restrict u, float const* __restrict v, uint8_t const* __restrict mask, size_t n)
+{
+  size_t count = n >> 6;
+
+  // Accumulators
+  __m512 accuA = _mm512_setzero_ps();
+  __m512 accuB = _mm512_setzero_ps();
+  __m512 accuC = _mm512_setzero_ps();
+  __m512 accuD = _mm512_setzero_ps();
+
+  // Unroll x4 (masked out lanes zeroed on load)
+  while (count--)
+  {
+    uint64_t m64;
+    memcpy(&m64, mask, sizeof(m64));
+
+    // 0
+    __mmask16 k0 = (__mmask16)m64;
+    accuA = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k0, u), _mm512_maskz_loadu_ps(k0, v), accuA);
+
+    // 1
+    __mmask16 k1 = (__mmask16)(m64 >> 16);
+    accuB = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k1, u + 16), _mm512_maskz_loadu_ps(k1, v + 16), accuB);
+
+    // 2
+    __mmask16 k2 = (__mmask16)(m64 >> 32);
+    accuC = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k2, u + 32), _mm512_maskz_loadu_ps(k2, v + 32), accuC);
+
+    // 3
+    __mmask16 k3 = (__mmask16)(m64 >> 48);
+    accuD = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k3, u + 48), _mm512_maskz_loadu_ps(k3, v + 48), accuD);
+
+    // Next
+    u += 64;
+    v += 64;
+    mask += 8;
+  }
+  // Sum accumulators
+  accuA = _mm512_add_ps(accuA, accuB);
+  accuC = _mm512_add_ps(accuC, accuD);
+  accuA = _mm512_add_ps(accuA, accuC);
+
+  // Remaining (tail folded into the mask, no scalar loop)
+  n &= 63;
+  while (n)
+  {
+    const size_t len = (n < 16) ? n : 16;
+    uint16_t m16 = mask[0];
+    if (len > 8)
+      m16 |= (uint16_t)(mask[1] << 8);
+    __mmask16 k = (__mmask16)(m16 & (uint16_t)((1u << len) - 1));
+
+    accuA = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k, u), _mm512_maskz_loadu_ps(k, v), accuA);
+
+    u += len;
+    v += len;
+    mask += 2;
+    n -= len;
+  }
+
+  return _mm512_reduce_add_ps(accuA);
+}
+#endif // HAS_AVX512F_
+
+#ifdef accu2
+  #undef accu2
+#endif
+#ifdef accu3
+  #undef accu3
+#endif
+
+#endif // DOTP_WFLT_H
@@ -0,0 +1,206 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef XCORR_FLT_H
+#define XCORR_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+#include "dotp_flt.h"
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, FMA
+#endif
+
+// Sliding correlation: out[i] = Sum(k[j] * x[i+j]), for i in [0, nx-nk]
+// Several outputs are computed per pass: each tap is broadcast once and
+// multiplied against consecutive shifted signal vectors x(i+j), accumulating
+// directly into the outputs (no horizontal reduction).
+// Remaining outputs: one vector of outputs per pass, then scalar (independent
+// of the DOTPFLT_* size and alignment options).
+
+
+//
+static inline size_t xcorr_flt_out_size(size_t nx, size_t nk)
+{
+  return (nk == 0 || nx < nk) ? 0 : nx - nk + 1;
+}
+
+//
+static inline void correlate_flt_scalar(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  const size_t nout = xcorr_flt_out_size(nx, nk);
+  for (size_t i=0; i<nout; ++i)
+    out[i] = dotProduct_flt_scalar(x + i, k, nk);
+}
+
+//
+static inline void correlate_flt_sse(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  const size_t nout = xcorr_flt_out_size(nx, nk);
+  size_t i = 0;
+
+  // 16 outputs per pass
+  for (; i+16 <= nout; i+=16)
+  {
+    float const* xi = x + i;
+
+    // Accumulators
+    __m128 accu0 = _mm_setzero_ps();
+    __m128 accu1 = _mm_setzero_ps();
+    __m128 accu2 = _mm_setzero_ps();
+    __m128 accu3 = _mm_setzero_ps();
+
+    for (size_t j=0; j<nk; ++j)
+    {
+      const __m128 tap = _mm_set1_ps(k[j]);
+
+      accu0 = _mm_add_ps(accu0, _mm_mul_ps(_mm_loadu_ps(xi + j),      tap));
+      accu1 = _mm_add_ps(accu1, _mm_mul_ps(_mm_loadu_ps(xi + j + 4),  tap));
+      accu2 = _mm_add_ps(accu2, _mm_mul_ps(_mm_loadu_ps(xi + j + 8),  tap));
+      accu3 = _mm_add_ps(accu3, _mm_mul_ps(_mm_loadu_ps(xi + j + 12), tap));
+    }
+
+    // Store
+    _mm_storeu_ps(out + i,      accu0);
+    _mm_storeu_ps(out + i + 4,  accu1);
+    _mm_storeu_ps(out + i + 8,  accu2);
+    _mm_storeu_ps(out + i + 12, accu3);
+  }
+
+  // Remaining outputs
+  for (; i+4 <= nout; i+=4)
+  {
+    __m128 accu = _mm_setzero_ps();
+    for (size_t j=0; j<nk; ++j)
+      accu = _mm_add_ps(accu, _mm_mul_ps(_mm_loadu_ps(x + i + j), _mm_set1_ps(k[j])));
+    _mm_storeu_ps(out + i, accu);
+  }
+  for (; i<nout; ++i)
+    out[i] = dotProduct_flt_scalar(x + i, k, nk);
+}
+
+//
+#ifdef HAS_AVX_
+static inline void correlate_flt_avx(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  const size_t nout = xcorr_flt_out_size(nx, nk);
+  size_t i = 0;
+
+  // 32 outputs per pass
+  for (; i+32 <= nout; i+=32)
+  {
+    float const* xi = x + i;
+
+    // Accumulators
+    __m256 accu0 = _mm256_setzero_ps();
+    __m256 accu1 = _mm256_setzero_ps();
+    __m256 accu2 = _mm256_setzero_ps();
+    __m256 accu3 = _mm256_setzero_ps();
+
+    for (size_t j=0; j<nk; ++j)
+    {
+      const __m256 tap = _mm256_broadcast_ss(k + j);
+
+      accu0 = _mm256_add_ps(accu0, _mm256_mul_ps(_mm256_loadu_ps(xi + j),      tap));
+      accu1 = _mm256_add_ps(accu1, _mm256_mul_ps(_mm256_loadu_ps(xi + j + 8),  tap));
+      accu2 = _mm256_add_ps(accu2, _mm256_mul_ps(_mm256_loadu_ps(xi + j + 16), tap));
+      accu3 = _mm256_add_ps(accu3, _mm256_mul_ps(_mm256_loadu_ps(xi + j + 24), tap));
+    }
+
+    // Store
+    _mm256_storeu_ps(out + i,      accu0);
+    _mm256_storeu_ps(out + i + 8,  accu1);
+    _mm256_storeu_ps(out + i + 16, accu2);
+    _mm256_storeu_ps(out + i + 24, accu3);
+  }
+
+  // Remaining outputs
+  for (; i+8 <= nout; i+=8)
+  {
+    __m256 accu = _mm256_setzero_ps();
+    for (size_t j=0; j<nk; ++j)
+      accu = _mm256_add_ps(accu, _mm256_mul_ps(_mm256_loadu_ps(x + i + j), _mm256_broadcast_ss(k + j)));
+    _mm256_storeu_ps(out + i, accu);
+  }
+  for (; i<nout; ++i)
+    out[i] = dotProduct_flt_scalar(x + i, k, nk);
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_FMA_
+static inline void correlate_flt_fma(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  const size_t nout = xcorr_flt_out_size(nx, nk);
+  size_t i = 0;
+
+  // 32 outputs per pass
+  for (; i+32 <= nout; i+=32)
+  {
+    float const* xi = x + i;
+
+    // Accumulators
+    __m256 accu0 = _mm256_setzero_ps();
+    __m256 accu1 = _mm256_setzero_ps();
+    __m256 accu2 = _mm256_setzero_ps();
+    __m256 accu3 = _mm256_setzero_ps();
+
+    for (size_t j=0; j<nk; ++j)
+    {
+      const __m256 tap = _mm256_broadcast_ss(k + j);
+
+      accu0 = _mm256_fmadd_ps(_mm256_loadu_ps(xi + j),      tap, accu0);
+      accu1 = _mm256_fmadd_ps(_mm256_loadu_ps(xi + j + 8),  tap, accu1);
+      accu2 = _mm256_fmadd_ps(_mm256_loadu_ps(xi + j + 16), tap, accu2);
+      accu3 = _mm256_fmadd_ps(_mm256_loadu_ps(xi + j + 24), tap, accu3);
+    }
+
+    // Store
+    _mm256_storeu_ps(out + i,      accu0);
+    _mm256_storeu_ps(out + i + 8,  accu1);
+    _mm256_storeu_ps(out + i + 16, accu2);
+    _mm256_storeu_ps(out + i + 24, accu3);
+  }
+
+  // Remaining outputs
+  for (; i+8 <= nout; i+=8)
+  {
+    __m256 accu = _mm256_setzero_ps();
+    for (size_t j=0; j<nk; ++j)
+      accu = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + j), _mm256_broadcast_ss(k + j), accu);
+    _mm256_storeu_ps(out + i, accu);
+  }
+  for (; i<nout; ++i)
+    out[i] = dotProduct_flt_scalar(x + i, k, nk);
+}
+#endif // HAS_FMA_
+
+//
+static inline void correlate_flt(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+#if defined(HAS_FMA_)
+  correlate_flt_fma(x, nx, k, nk, out);
+#elif defined(HAS_AVX_)
+  correlate_flt_avx(x, nx, k, nk, out);
+#else
+  correlate_flt_sse(x, nx, k, nk, out);
+#endif
+}
+
+// Convolution: correlation with reversed kernel
+static inline void convolve_flt(float const* __restrict x, size_t nx, float const* __restrict k, size_t nk, float* __restrict out)
+{
+  std::vector<float> rk(k, k + nk);
+  std::reverse(rk.begin(), rk.end());
+  correlate_flt(x, nx, rk.data(), nk, out);
+}
+
+
+#endif // XCORR_FLT_H
@@ -0,0 +1,210 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef XCORR_I16_H
+#define XCORR_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+#include "dotp_i16.h"
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// SIMD optimization options
+#ifndef XCORR16_CHUNK
+  #define XCORR16_CHUNK 1024  // Outputs per chunk (multiple of 32, sized to keep pairs buffer in L1)
+#endif
+
+// Sliding correlation: out[i] = Sum(k[j] * x[i+j]), for i in [0, nx-nk]
+// Signal is first interleaved by chunk into [x(m), x(m+1)] pairs, so that for
+// each pair of taps (broadcast once) a single load + madd updates 8 outputs:
+// no shuffle in the inner loop and no horizontal reduction per output.
+// Remaining outputs (less than a pass) use the scalar kernel (independent of
+// the DOTP16_* size and alignment options).
+
+
+//
+static inline size_t xcorr_i16_out_size(size_t nx, size_t nk)
+{
+  return (nk == 0 || nx < nk) ? 0 : nx - nk + 1;
+}
+
+// Interleave y[t] = [x(m0+t), x(m0+t+1)], t in [0, len)  (zero past the end)
+static inline void xcorr_i16_pairs(int16_t const* __restrict x, size_t nx, size_t m0, size_t len, int32_t* __restrict y)
+{
+  size_t t = 0;
+  for (; t+8 <= len && m0+t+9 <= nx; t+=8)
+  {
+    __m128i x0_8 = _mm_loadu_si128((__m128i const*)(x + m0 + t));
+    __m128i x1_8 = _mm_loadu_si128((__m128i const*)(x + m0 + t + 1));
+    _mm_storeu_si128((__m128i*)(y + t),     _mm_unpacklo_epi16(x0_8, x1_8));
+    _mm_storeu_si128((__m128i*)(y + t + 4), _mm_unpackhi_epi16(x0_8, x1_8));
+  }
+  for (; t<len; ++t)
+  {
+    const size_t m = m0 + t;
+    const uint16_t next = (m+1 < nx) ? (uint16_t)x[m+1] : 0;
+    y[t] = (int32_t)(((uint32_t)next << 16) | (uint16_t)x[m]);
+  }
+}
+
+//
+static inline void correlate_i16_scalar(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+  const size_t nout = xcorr_i16_out_size(nx, nk);
+  for (size_t i=0; i<nout; ++i)
+    out[i] = dotProduct_i16_scalar(x + i, k, nk);
+}
+
+//
+static inline void correlate_i16_sse(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+  const size_t nout = xcorr_i16_out_size(nx, nk);
+  const size_t nblk = nout & ~(size_t)15;
+  size_t i = 0;
+
+  if (nblk)
+  {
+    // Taps pairs (last one zero padded)
+    const size_t np = (nk + 1) / 2;
+    std::vector<int32_t> taps(np);
+    for (size_t j=0; j<np; ++j)
+    {
+      const uint16_t next = (2*j+1 < nk) ? (uint16_t)k[2*j+1] : 0;
+      taps[j] = (int32_t)(((uint32_t)next << 16) | (uint16_t)k[2*j]);
+    }
+    std::vector<int32_t> pairs(std::min(nblk, (size_t)XCORR16_CHUNK) + nk);
+
+    for (size_t c=0; c<nblk; c+=XCORR16_CHUNK)
+    {
+      const size_t cn = std::min(nblk - c, (size_t)XCORR16_CHUNK);
+      xcorr_i16_pairs(x, nx, c, cn + nk - 1, pairs.data());
+
+      // 16 outputs per pass
+      for (size_t o=0; o<cn; o+=16)
+      {
+        int32_t const* yo = pairs.data() + o;
+
+        // Accumulators
+        __m128i accu0 = _mm_setzero_si128();
+        __m128i accu1 = _mm_setzero_si128();
+        __m128i accu2 = _mm_setzero_si128();
+        __m128i accu3 = _mm_setzero_si128();
+
+        for (size_t j=0; j<np; ++j)
+        {
+          const __m128i tap = _mm_set1_epi32(taps[j]);
+          int32_t const* yj = yo + 2*j;
+
+          accu0 = _mm_add_epi32(accu0, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)(yj)),      tap));
+          accu1 = _mm_add_epi32(accu1, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)(yj + 4)),  tap));
+          accu2 = _mm_add_epi32(accu2, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)(yj + 8)),  tap));
+          accu3 = _mm_add_epi32(accu3, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)(yj + 12)), tap));
+        }
+
+        // Store
+        _mm_storeu_si128((__m128i*)(out + c + o),      accu0);
+        _mm_storeu_si128((__m128i*)(out + c + o + 4),  accu1);
+        _mm_storeu_si128((__m128i*)(out + c + o + 8),  accu2);
+        _mm_storeu_si128((__m128i*)(out + c + o + 12), accu3);
+      }
+    }
+    i = nblk;
+  }
+
+  // Remaining outputs
+  for (; i<nout; ++i)
+    out[i] = dotProduct_i16_scalar(x + i, k, nk);
+}
+
+//
+#ifdef HAS_AVX2_
+static inline void correlate_i16_avx2(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+  const size_t nout = xcorr_i16_out_size(nx, nk);
+  const size_t nblk = nout & ~(size_t)31;
+  size_t i = 0;
+
+  if (nblk)
+  {
+    // Taps pairs (last one zero padded)
+    const size_t np = (nk + 1) / 2;
+    std::vector<int32_t> taps(np);
+    for (size_t j=0; j<np; ++j)
+    {
+      const uint16_t next = (2*j+1 < nk) ? (uint16_t)k[2*j+1] : 0;
+      taps[j] = (int32_t)(((uint32_t)next << 16) | (uint16_t)k[2*j]);
+    }
+    std::vector<int32_t> pairs(std::min(nblk, (size_t)XCORR16_CHUNK) + nk);
+
+    for (size_t c=0; c<nblk; c+=XCORR16_CHUNK)
+    {
+      const size_t cn = std::min(nblk - c, (size_t)XCORR16_CHUNK);
+      xcorr_i16_pairs(x, nx, c, cn + nk - 1, pairs.data());
+
+      // 32 outputs per pass
+      for (size_t o=0; o<cn; o+=32)
+      {
+        int32_t const* yo = pairs.data() + o;
+
+        // Accumulators
+        __m256i accu0 = _mm256_setzero_si256();
+        __m256i accu1 = _mm256_setzero_si256();
+        __m256i accu2 = _mm256_setzero_si256();
+        __m256i accu3 = _mm256_setzero_si256();
+
+        for (size_t j=0; j<np; ++j)
+        {
+          const __m256i tap = _mm256_set1_epi32(taps[j]);
+          int32_t const* yj = yo + 2*j;
+
+          accu0 = _mm256_add_epi32(accu0, _mm256_madd_epi16(_mm256_loadu_si256((__m256i const*)(yj)),      tap));
+          accu1 = _mm256_add_epi32(accu1, _mm256_madd_epi16(_mm256_loadu_si256((__m256i const*)(yj + 8)),  tap));
+          accu2 = _mm256_add_epi32(accu2, _mm256_madd_epi16(_mm256_loadu_si256((__m256i const*)(yj + 16)), tap));
+          accu3 = _mm256_add_epi32(accu3, _mm256_madd_epi16(_mm256_loadu_si256((__m256i const*)(yj + 24)), tap));
+        }
+
+        // Store
+        _mm256_storeu_si256((__m256i*)(out + c + o),      accu0);
+        _mm256_storeu_si256((__m256i*)(out + c + o + 8),  accu1);
+        _mm256_storeu_si256((__m256i*)(out + c + o + 16), accu2);
+        _mm256_storeu_si256((__m256i*)(out + c + o + 24), accu3);
+      }
+    }
+    i = nblk;
+  }
+
+  // Remaining outputs
+  for (; i<nout; ++i)
+    out[i] = dotProduct_i16_scalar(x + i, k, nk);
+}
+#endif // HAS_AVX2_
+
+//
+static inline void correlate_i16(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+#ifdef HAS_AVX2_
+  correlate_i16_avx2(x, nx, k, nk, out);
+#else
+  correlate_i16_sse(x, nx, k, nk, out);
+#endif
+}
+
+// Convolution: correlation with reversed kernel
+static inline void convolve_i16(int16_t const* __restrict x, size_t nx, int16_t const* __restrict k, size_t nk, int32_t* __restrict out)
+{
+  std::vector<int16_t> rk(k, k + nk);
+  std::reverse(rk.begin(), rk.end());
+  correlate_i16(x, nx, rk.data(), nk, out);
+}
+
+
+#endif // XCORR_I16_H
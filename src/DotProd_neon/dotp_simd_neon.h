@@ -14,16 +14,20 @@
 
 // Data size optimizations
 //#define DOTP8_NEON_SIZE_MULTIPLE    16
+//#define DOTPU8_NEON_SIZE_MULTIPLE   32
 //#define DOTP168_NEON_SIZE_MULTIPLE  16
 //#define DOTP16_NEON_SIZE_MULTIPLE   32
+//#define DOTPU16_NEON_SIZE_MULTIPLE  16
 //#define DotP3216_NEON_SIZE_MULTIPLE 16
 //#define DOTP32_NEON_SIZE_MULTIPLE   16
 //#define DOTPFLT_NEON_SIZE_MULTIPLE  16
 
 //
 #include "dotp_i8_neon.h"
+#include "dotp_ui8_neon.h"
 #include "dotp_i16i8_neon.h"
 #include "dotp_i16_neon.h"
+#include "dotp_ui16_neon.h"
 #include "dotp_i32i16_neon.h"
 #include "dotp_i32_neon.h"
 #include "dotp_flt_neon.h"
@@ -35,6 +39,12 @@ static inline int32_t dotProduct(int8_t const* __restrict u, int8_t const* __res
   return dotProduct_i8_neon(u, v, n);
 }
 
+// uint8 x uint8
+static inline uint32_t dotProduct(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  return dotProduct_ui8_neon(u, v, n);
+}
+
 // int16 x int8
 static inline int32_t dotProduct(int16_t const* __restrict u, int8_t const* __restrict v, size_t n)
 {
@@ -47,6 +57,12 @@ static inline int32_t dotProduct(int16_t const* __restrict u, int16_t const* __r
   return dotProduct_i16_neon(u, v, n);
 }
 
+// uint16 x uint16
+static inline uint64_t dotProduct(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  return dotProduct_ui16_neon(u, v, n);
+}
+
 // int32 x int16
 static inline int32_t dotProduct(int32_t const* __restrict u, int16_t const* __restrict v, size_t n)
 {
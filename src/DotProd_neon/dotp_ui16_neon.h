@@ -0,0 +1,130 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_UI16_NEON_H
+#define DOTP_UI16_NEON_H
+
+#include <stdint.h>
+#include <arm_neon.h>   // NEON
+
+// SIMD optimization options
+#ifndef DOTPU16_NEON_SIZE_MULTIPLE
+  #define DOTPU16_NEON_SIZE_MULTIPLE 0  // 16, 8, 4 (0: no optim)
+#endif
+#define DOTPU16_NEON_ACCU_2             // Use 2 accumulators (depend on HW/vectors size)
+
+// 32-bit products accumulated in 64-bit lanes (exact result)
+
+
+//
+static inline uint64_t dotProduct_ui16_neon_scalar(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+// 
+static inline uint64_t dotProduct_ui16_neon(uint16_t const* __restrict u, uint16_t const* __restrict v, size_t n)
+{
+  uint64_t result;
+  size_t count = n >> 4;
+
+  // Accumulators
+  uint64x2_t result0_2 = vdupq_n_u64(0);
+#ifdef DOTPU16_NEON_ACCU_2
+  uint64x2_t result1_2 = vdupq_n_u64(0);
+#else
+  #define result1_2 result0_2
+#endif
+
+  // Unroll x2 (widening multiply, pairwise add-accumulate)
+#if DOTPU16_NEON_SIZE_MULTIPLE >= 16
+  do
+#else
+  while (count--)
+#endif
+  {
+    uint16x8_t u0_8, v0_8;
+    uint16x8_t u1_8, v1_8;
+
+    // 0
+    u0_8 = vld1q_u16(u);
+    v0_8 = vld1q_u16(v);
+
+    result0_2 = vpadalq_u32(result0_2, vmull_u16(vget_low_u16( u0_8), vget_low_u16( v0_8)));
+    result1_2 = vpadalq_u32(result1_2, vmull_u16(vget_high_u16(u0_8), vget_high_u16(v0_8)));
+
+    // 1
+    u1_8 = vld1q_u16(u + 8);
+    v1_8 = vld1q_u16(v + 8);
+
+    result0_2 = vpadalq_u32(result0_2, vmull_u16(vget_low_u16( u1_8), vget_low_u16( v1_8)));
+    result1_2 = vpadalq_u32(result1_2, vmull_u16(vget_high_u16(u1_8), vget_high_u16(v1_8)));
+
+    // Next
+    u += 16;
+    v += 16;
+  }
+#if DOTPU16_NEON_SIZE_MULTIPLE >= 16
+  while (--count);
+#endif
+
+#if DOTPU16_NEON_SIZE_MULTIPLE < 16
+  // Remaining x8
+  if (n & 8)
+  {
+    uint16x8_t u_8, v_8;
+
+    u_8 = vld1q_u16(u);
+    v_8 = vld1q_u16(v);
+
+    result0_2 = vpadalq_u32(result0_2, vmull_u16(vget_low_u16( u_8), vget_low_u16( v_8)));
+    result1_2 = vpadalq_u32(result1_2, vmull_u16(vget_high_u16(u_8), vget_high_u16(v_8)));
+
+    u += 8;
+    v += 8;
+  }
+#endif // DOTPU16_NEON_SIZE_MULTIPLE < 16
+
+#if DOTPU16_NEON_SIZE_MULTIPLE < 8
+  // Remaining > 4
+  if (n & 4)
+  {
+    n &= 3;
+    result0_2 = vpadalq_u32(result0_2, vmull_u16(vld1_u16(u + n), vld1_u16(v + n)));
+  }
+#endif // DOTPU16_NEON_SIZE_MULTIPLE < 8
+#ifdef DOTPU16_NEON_ACCU_2
+  // Sum accumulators
+  result0_2 = vaddq_u64(result0_2, result1_2);
+#endif
+
+  // Horizontal sum
+  uint64x1_t tmp = vadd_u64(vget_high_u64(result0_2), vget_low_u64(result0_2));
+  result = vget_lane_u64(tmp, 0);
+
+#if DOTPU16_NEON_SIZE_MULTIPLE < 4
+  // Remaining < 4
+  switch (n & 3)
+  {
+    case 3: result += (uint32_t)u[2] * v[2];
+    case 2: result += (uint32_t)u[1] * v[1];
+    case 1: result += (uint32_t)u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPU16_NEON_SIZE_MULTIPLE < 4
+
+  return result;
+}
+
+#ifdef result1_2
+  #undef result1_2
+#endif
+
+
+#endif // DOTP_UI16_NEON_H
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef DOTP_UI8_NEON_H
+#define DOTP_UI8_NEON_H
+
+#include <stdint.h>
+#include <arm_neon.h>   // NEON
+
+// SIMD optimization options
+#ifndef DOTPU8_NEON_SIZE_MULTIPLE
+  #define DOTPU8_NEON_SIZE_MULTIPLE 0  // 32, 16, 8 (0: no optim)
+#endif
+#define DOTPU8_NEON_ACCU_2             // Use 2 accumulators (depend on HW/vectors size)
+
+// Result is modulo 2^32 (exact up to 66051 elements)
+
+
+//
+static inline uint32_t dotProduct_ui8_neon_scalar(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t res = 0;
+  for (size_t i=0; i<n; ++i)
+    res += (uint32_t)u[i] * v[i];
+
+  return res;
+}
+
+// 
+static inline uint32_t dotProduct_ui8_neon(uint8_t const* __restrict u, uint8_t const* __restrict v, size_t n)
+{
+  uint32_t result;
+  size_t count = n >> 5;
+
+  // Accumulators
+  uint32x4_t result0_4 = vdupq_n_u32(0);
+#ifdef DOTPU8_NEON_ACCU_2
+  uint32x4_t result1_4 = vdupq_n_u32(0);
+#else
+  #define result1_4 result0_4
+#endif
+
+  // Unroll x2 (widening multiply, pairwise add-accumulate)
+#if DOTPU8_NEON_SIZE_MULTIPLE >= 32
+  do
+#else
+  while (count--)
+#endif
+  {
+    uint8x16_t u0_16, v0_16;
+    uint8x16_t u1_16, v1_16;
+
+    // 0
+    u0_16 = vld1q_u8(u);
+    v0_16 = vld1q_u8(v);
+
+    result0_4 = vpadalq_u16(result0_4, vmull_u8(vget_low_u8( u0_16), vget_low_u8( v0_16)));
+    result1_4 = vpadalq_u16(result1_4, vmull_u8(vget_high_u8(u0_16), vget_high_u8(v0_16)));
+
+    // 1
+    u1_16 = vld1q_u8(u + 16);
+    v1_16 = vld1q_u8(v + 16);
+
+    result0_4 = vpadalq_u16(result0_4, vmull_u8(vget_low_u8( u1_16), vget_low_u8( v1_16)));
+    result1_4 = vpadalq_u16(result1_4, vmull_u8(vget_high_u8(u1_16), vget_high_u8(v1_16)));
+
+    // Next
+    u += 32;
+    v += 32;
+  }
+#if DOTPU8_NEON_SIZE_MULTIPLE >= 32
+  while (--count);
+#endif
+
+#if DOTPU8_NEON_SIZE_MULTIPLE < 32
+  // Remaining x16
+  if (n & 16)
+  {
+    uint8x16_t u_16, v_16;
+
+    u_16 = vld1q_u8(u);
+    v_16 = vld1q_u8(v);
+
+    result0_4 = vpadalq_u16(result0_4, vmull_u8(vget_low_u8( u_16), vget_low_u8( v_16)));
+    result1_4 = vpadalq_u16(result1_4, vmull_u8(vget_high_u8(u_16), vget_high_u8(v_16)));
+
+    u += 16;
+    v += 16;
+  }
+#endif // DOTPU8_NEON_SIZE_MULTIPLE < 32
+
+#if DOTPU8_NEON_SIZE_MULTIPLE < 16
+  // Remaining > 8
+  if (n & 8)
+  {
+    n &= 7;
+    result0_4 = vpadalq_u16(result0_4, vmull_u8(vld1_u8(u + n), vld1_u8(v + n)));
+  }
+#endif // DOTPU8_NEON_SIZE_MULTIPLE < 16
+#ifdef DOTPU8_NEON_ACCU_2
+  // Sum accumulators
+  result0_4 = vaddq_u32(result0_4, result1_4);
+#endif
+
+  // Horizontal sum
+  uint64x2_t tmp0 = vpaddlq_u32(result0_4);
+  uint64x1_t tmp1 = vadd_u64(vget_high_u64(tmp0), vget_low_u64(tmp0));
+  result = (uint32_t)vget_lane_u64(tmp1, 0);
+
+#if DOTPU8_NEON_SIZE_MULTIPLE < 8
+  // Remaining < 8
+  switch (n & 7)
+  {
+    case 7: result += (uint32_t)u[6] * v[6];
+    case 6: result += (uint32_t)u[5] * v[5];
+    case 5: result += (uint32_t)u[4] * v[4];
+    case 4: result += (uint32_t)u[3] * v[3];
+    case 3: result += (uint32_t)u[2] * v[2];
+    case 2: result += (uint32_t)u[1] * v[1];
+    case 1: result += (uint32_t)u[0] * v[0];
+    default: break;
+  }
+#endif // DOTPU8_NEON_SIZE_MULTIPLE < 8
+
+  return result;
+}
+
+#ifdef result1_4
+  #undef result1_4
+#endif
+
+
+#endif // DOTP_UI8_NEON_H
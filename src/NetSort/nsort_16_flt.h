@@ -0,0 +1,64 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_16_FLT_H
+#define NSORT_16_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_flt.h"        // cmpfunc_flt
+#include "nsort_bitonic_flt.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_16_FLT_256_ALIGNED
+  #define NSORT_16_FLT_LOAD_256(x) _mm256_load_ps(x)
+#else
+  #define NSORT_16_FLT_LOAD_256(x) _mm256_loadu_ps(x)
+#endif
+
+
+//
+static inline void netsort_16_flt_qsort(float* __restrict v)
+{
+  qsort(v, 16, sizeof(float), cmpfunc_flt);
+}
+
+// Bitonic network across 2 registers
+#ifdef HAS_AVX_
+static inline void netsort_16_flt_avx(float* __restrict v)
+{
+  // Load -> 2 x 8
+  __m256 r[2];
+  r[0] = NSORT_16_FLT_LOAD_256(v);
+  r[1] = NSORT_16_FLT_LOAD_256(v+8);
+
+  // Sort
+  bitonic_sort_16_flt_avx(r);
+
+  // Store
+  _mm256_storeu_ps(v, r[0]);
+  _mm256_storeu_ps(v+8, r[1]);
+}
+#endif // HAS_AVX_
+
+// Bitonic network in 1 register (AVX-512)
+#ifdef HAS_AVX512F_
+static inline void netsort_16_flt_avx512(float* __restrict v)
+{
+  // Load -> 1 x 16
+  __m512 in = _mm512_loadu_ps(v);
+
+  // Sort
+  in = bitonic_sort_16_flt_avx512(in);
+
+  // Store
+  _mm512_storeu_ps(v, in);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_16_FLT_H
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_16_I16_H
+#define NSORT_16_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i16.h"        // cmpfunc_i16
+#include "nsort_bitonic_i16.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_16_I16_256_ALIGNED
+  #define NSORT_16_I16_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_16_I16_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_16_i16_qsort(int16_t* __restrict v)
+{
+  qsort(v, 16, sizeof(int16_t), cmpfunc_i16);
+}
+
+// Bitonic network in a single register
+#ifdef HAS_AVX2_
+static inline void netsort_16_i16_avx2(int16_t* __restrict v)
+{
+  // Load
+  __m256i in = NSORT_16_I16_LOAD_256(v);
+
+  // Sort
+  in = bitonic_sort_16_i16_avx2(in);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)(v), in);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_16_I16_H
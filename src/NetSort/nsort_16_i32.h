@@ -0,0 +1,64 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_16_I32_H
+#define NSORT_16_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i32.h"        // cmpfunc_i32
+#include "nsort_bitonic_i32.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_16_I32_256_ALIGNED
+  #define NSORT_16_I32_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_16_I32_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_16_i32_qsort(int32_t* __restrict v)
+{
+  qsort(v, 16, sizeof(int32_t), cmpfunc_i32);
+}
+
+// Bitonic network across 2 registers
+#ifdef HAS_AVX2_
+static inline void netsort_16_i32_avx2(int32_t* __restrict v)
+{
+  // Load -> 2 x 8
+  __m256i r[2];
+  r[0] = NSORT_16_I32_LOAD_256(v);
+  r[1] = NSORT_16_I32_LOAD_256(v+8);
+
+  // Sort
+  bitonic_sort_16_i32_avx2(r);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)(v), r[0]);
+  _mm256_storeu_si256((__m256i*)(v+8), r[1]);
+}
+#endif // HAS_AVX2_
+
+// Bitonic network in 1 register (AVX-512)
+#ifdef HAS_AVX512F_
+static inline void netsort_16_i32_avx512(int32_t* __restrict v)
+{
+  // Load -> 1 x 16
+  __m512i in = _mm512_loadu_si512((void const*)(v));
+
+  // Sort
+  in = bitonic_sort_16_i32_avx512(in);
+
+  // Store
+  _mm512_storeu_si512((void*)(v), in);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_16_I32_H
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_16_I8_H
+#define NSORT_16_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"        // cmpfunc_i8
+#include "nsort_bitonic_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_16_I8_128_ALIGNED
+  #define NSORT_16_I8_LOAD_128(x) _mm_load_si128((__m128i const*)(x))
+#else
+  #define NSORT_16_I8_LOAD_128(x) _mm_loadu_si128((__m128i const*)(x))
+#endif
+
+
+//
+static inline void netsort_16_i8_qsort(int8_t* __restrict v)
+{
+  qsort(v, 16, sizeof(int8_t), cmpfunc_i8);
+}
+
+// Bitonic network in a single register (10 stages)
+#ifdef HAS_SSE4_1_
+static inline void netsort_16_i8_sse(int8_t* __restrict v)
+{
+  // Load
+  __m128i in = NSORT_16_I8_LOAD_128(v);
+
+  // Sort
+  in = bitonic_sort_16_i8_sse(in);
+
+  // Store
+  _mm_storeu_si128((__m128i*)(v), in);
+}
+#endif // HAS_SSE4_1_
+
+
+#endif // NSORT_16_I8_H
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_32_FLT_H
+#define NSORT_32_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_flt.h"        // cmpfunc_flt
+#include "nsort_bitonic_flt.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_32_FLT_256_ALIGNED
+  #define NSORT_32_FLT_LOAD_256(x) _mm256_load_ps(x)
+#else
+  #define NSORT_32_FLT_LOAD_256(x) _mm256_loadu_ps(x)
+#endif
+
+
+//
+static inline void netsort_32_flt_qsort(float* __restrict v)
+{
+  qsort(v, 32, sizeof(float), cmpfunc_flt);
+}
+
+// Bitonic network across 4 registers
+#ifdef HAS_AVX_
+static inline void netsort_32_flt_avx(float* __restrict v)
+{
+  // Load -> 4 x 8
+  __m256 r[4];
+  for (size_t i=0; i<4; ++i)
+    r[i] = NSORT_32_FLT_LOAD_256(v + 8*i);
+
+  // Sort
+  bitonic_sort_32_flt_avx(r);
+
+  // Store
+  for (size_t i=0; i<4; ++i)
+    _mm256_storeu_ps(v + 8*i, r[i]);
+}
+#endif // HAS_AVX_
+
+// Bitonic network across 2 registers (AVX-512)
+#ifdef HAS_AVX512F_
+static inline void netsort_32_flt_avx512(float* __restrict v)
+{
+  // Load -> 2 x 16
+  __m512 r[2];
+  for (size_t i=0; i<2; ++i)
+    r[i] = _mm512_loadu_ps(v + 16*i);
+
+  // Sort
+  bitonic_sort_32_flt_avx512(r);
+
+  // Store
+  for (size_t i=0; i<2; ++i)
+    _mm512_storeu_ps(v + 16*i, r[i]);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_32_FLT_H
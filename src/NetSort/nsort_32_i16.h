@@ -0,0 +1,49 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_32_I16_H
+#define NSORT_32_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i16.h"        // cmpfunc_i16
+#include "nsort_bitonic_i16.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_32_I16_256_ALIGNED
+  #define NSORT_32_I16_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_32_I16_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_32_i16_qsort(int16_t* __restrict v)
+{
+  qsort(v, 32, sizeof(int16_t), cmpfunc_i16);
+}
+
+// Bitonic network across 2 registers
+#ifdef HAS_AVX2_
+static inline void netsort_32_i16_avx2(int16_t* __restrict v)
+{
+  // Load -> 2 x 16
+  __m256i r[2];
+  r[0] = NSORT_32_I16_LOAD_256(v);
+  r[1] = NSORT_32_I16_LOAD_256(v+16);
+
+  // Sort
+  bitonic_sort_32_i16_avx2(r);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)(v), r[0]);
+  _mm256_storeu_si256((__m256i*)(v+16), r[1]);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_32_I16_H
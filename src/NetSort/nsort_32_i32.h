@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_32_I32_H
+#define NSORT_32_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i32.h"        // cmpfunc_i32
+#include "nsort_bitonic_i32.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_32_I32_256_ALIGNED
+  #define NSORT_32_I32_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_32_I32_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_32_i32_qsort(int32_t* __restrict v)
+{
+  qsort(v, 32, sizeof(int32_t), cmpfunc_i32);
+}
+
+// Bitonic network across 4 registers
+#ifdef HAS_AVX2_
+static inline void netsort_32_i32_avx2(int32_t* __restrict v)
+{
+  // Load -> 4 x 8
+  __m256i r[4];
+  for (size_t i=0; i<4; ++i)
+    r[i] = NSORT_32_I32_LOAD_256(v + 8*i);
+
+  // Sort
+  bitonic_sort_32_i32_avx2(r);
+
+  // Store
+  for (size_t i=0; i<4; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 8*i), r[i]);
+}
+#endif // HAS_AVX2_
+
+// Bitonic network across 2 registers (AVX-512)
+#ifdef HAS_AVX512F_
+static inline void netsort_32_i32_avx512(int32_t* __restrict v)
+{
+  // Load -> 2 x 16
+  __m512i r[2];
+  for (size_t i=0; i<2; ++i)
+    r[i] = _mm512_loadu_si512((void const*)(v + 16*i));
+
+  // Sort
+  bitonic_sort_32_i32_avx512(r);
+
+  // Store
+  for (size_t i=0; i<2; ++i)
+    _mm512_storeu_si512((void*)(v + 16*i), r[i]);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_32_I32_H
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_32_I8_H
+#define NSORT_32_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"        // cmpfunc_i8
+#include "nsort_bitonic_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_32_I8_256_ALIGNED
+  #define NSORT_32_I8_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_32_I8_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_32_i8_qsort(int8_t* __restrict v)
+{
+  qsort(v, 32, sizeof(int8_t), cmpfunc_i8);
+}
+
+// Bitonic network in a single register
+#ifdef HAS_AVX2_
+static inline void netsort_32_i8_avx2(int8_t* __restrict v)
+{
+  // Load
+  __m256i in = NSORT_32_I8_LOAD_256(v);
+
+  // Sort
+  in = bitonic_sort_32_i8_avx2(in);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)(v), in);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_32_I8_H
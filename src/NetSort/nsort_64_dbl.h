@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_64_DBL_H
+#define NSORT_64_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_dbl.h"        // cmpfunc_dbl
+#include "nsort_bitonic_dbl.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_64_DBL_256_ALIGNED
+  #define NSORT_64_DBL_LOAD_256(x) _mm256_load_pd(x)
+#else
+  #define NSORT_64_DBL_LOAD_256(x) _mm256_loadu_pd(x)
+#endif
+
+
+//
+static inline void netsort_64_dbl_qsort(double* __restrict v)
+{
+  qsort(v, 64, sizeof(double), cmpfunc_dbl);
+}
+
+// Bitonic network across 16 registers
+#ifdef HAS_AVX_
+static inline void netsort_64_dbl_avx(double* __restrict v)
+{
+  // Load -> 16 x 4
+  __m256d r[16];
+  for (size_t i=0; i<16; ++i)
+    r[i] = NSORT_64_DBL_LOAD_256(v + 4*i);
+
+  // Sort
+  bitonic_sort_64_dbl_avx(r);
+
+  // Store
+  for (size_t i=0; i<16; ++i)
+    _mm256_storeu_pd(v + 4*i, r[i]);
+}
+#endif // HAS_AVX_
+
+// Bitonic network across 8 registers (AVX-512)
+#ifdef HAS_AVX512F_
+static inline void netsort_64_dbl_avx512(double* __restrict v)
+{
+  // Load -> 8 x 8
+  __m512d r[8];
+  for (size_t i=0; i<8; ++i)
+    r[i] = _mm512_loadu_pd(v + 8*i);
+
+  // Sort
+  bitonic_sort_64_dbl_avx512(r);
+
+  // Store
+  for (size_t i=0; i<8; ++i)
+    _mm512_storeu_pd(v + 8*i, r[i]);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_64_DBL_H
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_64_I16_H
+#define NSORT_64_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i16.h"        // cmpfunc_i16
+#include "nsort_bitonic_i16.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_64_I16_256_ALIGNED
+  #define NSORT_64_I16_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_64_I16_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_64_i16_qsort(int16_t* __restrict v)
+{
+  qsort(v, 64, sizeof(int16_t), cmpfunc_i16);
+}
+
+// Bitonic network across 4 registers
+#ifdef HAS_AVX2_
+static inline void netsort_64_i16_avx2(int16_t* __restrict v)
+{
+  // Load -> 4 x 16
+  __m256i r[4];
+  for (size_t i=0; i<4; ++i)
+    r[i] = NSORT_64_I16_LOAD_256(v + 16*i);
+
+  // Sort
+  bitonic_sort_64_i16_avx2(r);
+
+  // Store
+  for (size_t i=0; i<4; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 16*i), r[i]);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_64_I16_H
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_64_I8_H
+#define NSORT_64_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"        // cmpfunc_i8
+#include "nsort_bitonic_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// SIMD optimization options
+#if defined NSORT_64_I8_256_ALIGNED
+  #define NSORT_64_I8_LOAD_256(x) _mm256_load_si256((__m256i const*)(x))
+#else
+  #define NSORT_64_I8_LOAD_256(x) _mm256_loadu_si256((__m256i const*)(x))
+#endif
+
+
+//
+static inline void netsort_64_i8_qsort(int8_t* __restrict v)
+{
+  qsort(v, 64, sizeof(int8_t), cmpfunc_i8);
+}
+
+// Bitonic network across 2 registers
+#ifdef HAS_AVX2_
+static inline void netsort_64_i8_avx2(int8_t* __restrict v)
+{
+  // Load -> 2 x 32
+  __m256i r[2];
+  r[0] = NSORT_64_I8_LOAD_256(v);
+  r[1] = NSORT_64_I8_LOAD_256(v+32);
+
+  // Sort
+  bitonic_sort_64_i8_avx2(r);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)(v), r[0]);
+  _mm256_storeu_si256((__m256i*)(v+32), r[1]);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_64_I8_H
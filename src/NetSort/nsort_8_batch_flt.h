@@ -0,0 +1,155 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_8_BATCH_FLT_H
+#define NSORT_8_BATCH_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_flt.h"
+#include "nsort_bitonic_flt.h"  // bitonic_minmax_flt_avx/avx512
+#include "nsort_8_batch_i32.h"  // netsort_8_batch_transpose_i32_avx512
+
+#include <stdint.h>
+#include <stdlib.h>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX-512
+#endif
+
+// Same transposed batch sort as nsort_8_batch_i32.h (AVX-512 transpose is
+// shared, as bits only move)
+
+
+//
+static inline void netsort_8_batch_flt_qsort(float* __restrict v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_flt_qsort(v + 8*g);
+}
+
+//
+#ifdef HAS_AVX_
+// 8 x 8 transpose (its own inverse)
+static inline void netsort_8_batch_transpose_flt_avx(__m256* r)
+{
+  __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+  __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+  __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+  __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+  __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+  __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+  __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+  __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+  __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+  __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+  __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+  __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+  __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1,0,1,0));
+  __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3,2,3,2));
+  __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1,0,1,0));
+  __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3,2,3,2));
+
+  r[0] = _mm256_permute2f128_ps(u0, u4, 0x20); // inter-lane
+  r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+  r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+  r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+  r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+  r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+  r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+  r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+}
+
+// Optimal network (19 comparators, depth 6), one group per lane
+static inline void netsort_8_batch_net_flt_avx(__m256* r)
+{
+  bitonic_minmax_flt_avx(r[0], r[2]); bitonic_minmax_flt_avx(r[1], r[3]);
+  bitonic_minmax_flt_avx(r[4], r[6]); bitonic_minmax_flt_avx(r[5], r[7]);
+  bitonic_minmax_flt_avx(r[0], r[4]); bitonic_minmax_flt_avx(r[1], r[5]);
+  bitonic_minmax_flt_avx(r[2], r[6]); bitonic_minmax_flt_avx(r[3], r[7]);
+  bitonic_minmax_flt_avx(r[0], r[1]); bitonic_minmax_flt_avx(r[2], r[3]);
+  bitonic_minmax_flt_avx(r[4], r[5]); bitonic_minmax_flt_avx(r[6], r[7]);
+  bitonic_minmax_flt_avx(r[2], r[4]); bitonic_minmax_flt_avx(r[3], r[5]);
+  bitonic_minmax_flt_avx(r[1], r[4]); bitonic_minmax_flt_avx(r[3], r[6]);
+  bitonic_minmax_flt_avx(r[1], r[2]); bitonic_minmax_flt_avx(r[3], r[4]);
+  bitonic_minmax_flt_avx(r[5], r[6]);
+}
+
+//
+static inline void netsort_8_batch_flt_avx(float* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8)
+  {
+    float* p = v + 8*g;
+    __m256 r[8];
+    for (size_t i=0; i<8; ++i)
+      r[i] = _mm256_loadu_ps(p + 8*i);
+
+    netsort_8_batch_transpose_flt_avx(r);
+    netsort_8_batch_net_flt_avx(r);
+    netsort_8_batch_transpose_flt_avx(r);
+
+    for (size_t i=0; i<8; ++i)
+      _mm256_storeu_ps(p + 8*i, r[i]);
+  }
+
+  // Remaining groups
+  for (; g < groups; ++g)
+    netsort_8_flt_avx(v + 8*g);
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_AVX512F_
+// Same network, one group per lane
+static inline void netsort_8_batch_net_flt_avx512(__m512* r)
+{
+  bitonic_minmax_flt_avx512(r[0], r[2]); bitonic_minmax_flt_avx512(r[1], r[3]);
+  bitonic_minmax_flt_avx512(r[4], r[6]); bitonic_minmax_flt_avx512(r[5], r[7]);
+  bitonic_minmax_flt_avx512(r[0], r[4]); bitonic_minmax_flt_avx512(r[1], r[5]);
+  bitonic_minmax_flt_avx512(r[2], r[6]); bitonic_minmax_flt_avx512(r[3], r[7]);
+  bitonic_minmax_flt_avx512(r[0], r[1]); bitonic_minmax_flt_avx512(r[2], r[3]);
+  bitonic_minmax_flt_avx512(r[4], r[5]); bitonic_minmax_flt_avx512(r[6], r[7]);
+  bitonic_minmax_flt_avx512(r[2], r[4]); bitonic_minmax_flt_avx512(r[3], r[5]);
+  bitonic_minmax_flt_avx512(r[1], r[4]); bitonic_minmax_flt_avx512(r[3], r[6]);
+  bitonic_minmax_flt_avx512(r[1], r[2]); bitonic_minmax_flt_avx512(r[3], r[4]);
+  bitonic_minmax_flt_avx512(r[5], r[6]);
+}
+
+// Register i holds groups i and i+8 (lower/upper 256 bits)
+static inline void netsort_8_batch_flt_avx512(float* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 16 <= groups; g += 16)
+  {
+    float* p = v + 8*g;
+    __m512i t[8];
+    __m512 r[8];
+    for (size_t i=0; i<8; ++i)
+      t[i] = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_loadu_si256((__m256i const*)(p + 8*i))),
+                                _mm256_loadu_si256((__m256i const*)(p + 64 + 8*i)), 1);
+
+    netsort_8_batch_transpose_i32_avx512(t);
+    for (size_t i=0; i<8; ++i)
+      r[i] = _mm512_castsi512_ps(t[i]);
+    netsort_8_batch_net_flt_avx512(r);
+    for (size_t i=0; i<8; ++i)
+      t[i] = _mm512_castps_si512(r[i]);
+    netsort_8_batch_transpose_i32_avx512(t);
+
+    for (size_t i=0; i<8; ++i)
+    {
+      _mm256_storeu_si256((__m256i*)(p + 8*i), _mm512_castsi512_si256(t[i]));
+      _mm256_storeu_si256((__m256i*)(p + 64 + 8*i), _mm512_extracti64x4_epi64(t[i], 1));
+    }
+  }
+
+  // Remaining groups
+  netsort_8_batch_flt_avx(v + 8*g, groups - g);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_8_BATCH_FLT_H
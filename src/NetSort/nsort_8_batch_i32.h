@@ -0,0 +1,186 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_8_BATCH_I32_H
+#define NSORT_8_BATCH_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i32.h"
+#include "nsort_bitonic_i32.h"  // bitonic_minmax_i32_avx2/avx512
+
+#include <stdint.h>
+#include <stdlib.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// Sort many independent groups of 8 values (v holds groups x 8 values)
+// 8 groups (16 with AVX-512) are loaded and transposed so that register j holds
+// value j of every group (one group per lane). The optimal 19 comparators
+// network is then only vertical min/max (no shuffle, no blend), and registers
+// are transposed back before store. Remaining groups are sorted one by one.
+
+
+//
+static inline void netsort_8_batch_i32_qsort(int32_t* __restrict v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_i32_qsort(v + 8*g);
+}
+
+//
+#ifdef HAS_AVX2_
+// 8 x 8 transpose (its own inverse)
+static inline void netsort_8_batch_transpose_i32_avx2(__m256i* r)
+{
+  __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+  __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+  __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+  __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+  __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+  __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+  __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+  __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+  __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  r[0] = _mm256_permute2x128_si256(u0, u4, 0x20); // inter-lane
+  r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+// Optimal network (19 comparators, depth 6), one group per lane
+static inline void netsort_8_batch_net_i32_avx2(__m256i* r)
+{
+  bitonic_minmax_i32_avx2(r[0], r[2]); bitonic_minmax_i32_avx2(r[1], r[3]);
+  bitonic_minmax_i32_avx2(r[4], r[6]); bitonic_minmax_i32_avx2(r[5], r[7]);
+  bitonic_minmax_i32_avx2(r[0], r[4]); bitonic_minmax_i32_avx2(r[1], r[5]);
+  bitonic_minmax_i32_avx2(r[2], r[6]); bitonic_minmax_i32_avx2(r[3], r[7]);
+  bitonic_minmax_i32_avx2(r[0], r[1]); bitonic_minmax_i32_avx2(r[2], r[3]);
+  bitonic_minmax_i32_avx2(r[4], r[5]); bitonic_minmax_i32_avx2(r[6], r[7]);
+  bitonic_minmax_i32_avx2(r[2], r[4]); bitonic_minmax_i32_avx2(r[3], r[5]);
+  bitonic_minmax_i32_avx2(r[1], r[4]); bitonic_minmax_i32_avx2(r[3], r[6]);
+  bitonic_minmax_i32_avx2(r[1], r[2]); bitonic_minmax_i32_avx2(r[3], r[4]);
+  bitonic_minmax_i32_avx2(r[5], r[6]);
+}
+
+//
+static inline void netsort_8_batch_i32_avx2(int32_t* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8)
+  {
+    int32_t* p = v + 8*g;
+    __m256i r[8];
+    for (size_t i=0; i<8; ++i)
+      r[i] = _mm256_loadu_si256((__m256i const*)(p + 8*i));
+
+    netsort_8_batch_transpose_i32_avx2(r);
+    netsort_8_batch_net_i32_avx2(r);
+    netsort_8_batch_transpose_i32_avx2(r);
+
+    for (size_t i=0; i<8; ++i)
+      _mm256_storeu_si256((__m256i*)(p + 8*i), r[i]);
+  }
+
+  // Remaining groups
+  for (; g < groups; ++g)
+    netsort_8_i32_avx2(v + 8*g);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// 2 x (8 x 8) transpose, one per 256-bit half (its own inverse)
+static inline void netsort_8_batch_transpose_i32_avx512(__m512i* r)
+{
+  const __m512i lo = _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13);
+  const __m512i hi = _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15);
+
+  __m512i t0 = _mm512_unpacklo_epi32(r[0], r[1]);
+  __m512i t1 = _mm512_unpackhi_epi32(r[0], r[1]);
+  __m512i t2 = _mm512_unpacklo_epi32(r[2], r[3]);
+  __m512i t3 = _mm512_unpackhi_epi32(r[2], r[3]);
+  __m512i t4 = _mm512_unpacklo_epi32(r[4], r[5]);
+  __m512i t5 = _mm512_unpackhi_epi32(r[4], r[5]);
+  __m512i t6 = _mm512_unpacklo_epi32(r[6], r[7]);
+  __m512i t7 = _mm512_unpackhi_epi32(r[6], r[7]);
+
+  __m512i u0 = _mm512_unpacklo_epi64(t0, t2);
+  __m512i u1 = _mm512_unpackhi_epi64(t0, t2);
+  __m512i u2 = _mm512_unpacklo_epi64(t1, t3);
+  __m512i u3 = _mm512_unpackhi_epi64(t1, t3);
+  __m512i u4 = _mm512_unpacklo_epi64(t4, t6);
+  __m512i u5 = _mm512_unpackhi_epi64(t4, t6);
+  __m512i u6 = _mm512_unpacklo_epi64(t5, t7);
+  __m512i u7 = _mm512_unpackhi_epi64(t5, t7);
+
+  r[0] = _mm512_permutex2var_epi64(u0, lo, u4);
+  r[1] = _mm512_permutex2var_epi64(u1, lo, u5);
+  r[2] = _mm512_permutex2var_epi64(u2, lo, u6);
+  r[3] = _mm512_permutex2var_epi64(u3, lo, u7);
+  r[4] = _mm512_permutex2var_epi64(u0, hi, u4);
+  r[5] = _mm512_permutex2var_epi64(u1, hi, u5);
+  r[6] = _mm512_permutex2var_epi64(u2, hi, u6);
+  r[7] = _mm512_permutex2var_epi64(u3, hi, u7);
+}
+
+// Same network, one group per lane
+static inline void netsort_8_batch_net_i32_avx512(__m512i* r)
+{
+  bitonic_minmax_i32_avx512(r[0], r[2]); bitonic_minmax_i32_avx512(r[1], r[3]);
+  bitonic_minmax_i32_avx512(r[4], r[6]); bitonic_minmax_i32_avx512(r[5], r[7]);
+  bitonic_minmax_i32_avx512(r[0], r[4]); bitonic_minmax_i32_avx512(r[1], r[5]);
+  bitonic_minmax_i32_avx512(r[2], r[6]); bitonic_minmax_i32_avx512(r[3], r[7]);
+  bitonic_minmax_i32_avx512(r[0], r[1]); bitonic_minmax_i32_avx512(r[2], r[3]);
+  bitonic_minmax_i32_avx512(r[4], r[5]); bitonic_minmax_i32_avx512(r[6], r[7]);
+  bitonic_minmax_i32_avx512(r[2], r[4]); bitonic_minmax_i32_avx512(r[3], r[5]);
+  bitonic_minmax_i32_avx512(r[1], r[4]); bitonic_minmax_i32_avx512(r[3], r[6]);
+  bitonic_minmax_i32_avx512(r[1], r[2]); bitonic_minmax_i32_avx512(r[3], r[4]);
+  bitonic_minmax_i32_avx512(r[5], r[6]);
+}
+
+// Register i holds groups i and i+8 (lower/upper 256 bits)
+static inline void netsort_8_batch_i32_avx512(int32_t* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 16 <= groups; g += 16)
+  {
+    int32_t* p = v + 8*g;
+    __m512i r[8];
+    for (size_t i=0; i<8; ++i)
+      r[i] = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_loadu_si256((__m256i const*)(p + 8*i))),
+                                _mm256_loadu_si256((__m256i const*)(p + 64 + 8*i)), 1);
+
+    netsort_8_batch_transpose_i32_avx512(r);
+    netsort_8_batch_net_i32_avx512(r);
+    netsort_8_batch_transpose_i32_avx512(r);
+
+    for (size_t i=0; i<8; ++i)
+    {
+      _mm256_storeu_si256((__m256i*)(p + 8*i), _mm512_castsi512_si256(r[i]));
+      _mm256_storeu_si256((__m256i*)(p + 64 + 8*i), _mm512_extracti64x4_epi64(r[i], 1));
+    }
+  }
+
+  // Remaining groups
+  netsort_8_batch_i32_avx2(v + 8*g, groups - g);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_8_BATCH_I32_H
@@ -0,0 +1,231 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_8_BATCH_I8_H
+#define NSORT_8_BATCH_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#ifdef HAS_SSE4_1_
+  #include <smmintrin.h>  // SSE4.1
+#endif
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// Sort many independent groups of 8 values (v holds groups x 8 values)
+// netsort_8_i8_sse network, one group per 64-bit half of each 128-bit lane:
+// 2 (SSE4.1), 4 (AVX2) or 8 (AVX-512BW) groups are sorted for the cost of one.
+// Odd bytes blend with a byte mask, byte pairs and quads with a word blend.
+// Remaining groups are sorted by the narrower version.
+
+
+//
+static inline void netsort_8_batch_i8_qsort(int8_t* __restrict v, size_t groups)
+{
+  for (size_t g=0; g<groups; ++g)
+    netsort_8_i8_qsort(v + 8*g);
+}
+
+//
+#ifdef HAS_SSE4_1_
+// Sort 2 groups of 8 values in register (lower/upper 8 bytes)
+static inline __m128i netsort_8x2_i8_sse(const __m128i in)
+{
+  const __m128i oddB = _mm_set1_epi16((int16_t)0xFF00);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  const __m128i shfA = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  __m128i tmp0 = _mm_shuffle_epi8(in, shfA);
+  __m128i min = _mm_min_epi8(in, tmp0);
+  __m128i max = _mm_max_epi8(in, tmp0);
+  tmp0 = _mm_blendv_epi8(min, max, oddB);
+
+  //////// [0,3] [1,2] [4,7] [5,6]
+  __m128i shfl = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  __m128i tmp1 = _mm_shuffle_epi8(tmp0, shfl);
+  min = _mm_min_epi8(tmp0, tmp1);
+  max = _mm_max_epi8(tmp0, tmp1);
+  tmp0 = _mm_blend_epi16(min, max, 0xAA);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm_shuffle_epi8(tmp0, shfA);
+  min = _mm_min_epi8(tmp0, tmp1);
+  max = _mm_max_epi8(tmp0, tmp1);
+  tmp0 = _mm_blendv_epi8(min, max, oddB);
+
+  //////// [0,7] [1,6] [2,5] [3,4]
+  shfl = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  tmp1 = _mm_shuffle_epi8(tmp0, shfl);
+  min = _mm_min_epi8(tmp0, tmp1);
+  max = _mm_max_epi8(tmp0, tmp1);
+  tmp1 = _mm_blend_epi16(min, max, 0xCC);
+
+  //////// [0,2] [1,3] [4,6] [5,7]
+  shfl = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  tmp0 = _mm_shuffle_epi8(tmp1, shfl);
+  min = _mm_min_epi8(tmp0, tmp1);
+  max = _mm_max_epi8(tmp0, tmp1);
+  tmp0 = _mm_blend_epi16(min, max, 0xAA);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm_shuffle_epi8(tmp0, shfA);
+  min = _mm_min_epi8(tmp0, tmp1);
+  max = _mm_max_epi8(tmp0, tmp1);
+  return _mm_blendv_epi8(min, max, oddB);
+}
+
+//
+static inline void netsort_8_batch_i8_sse(int8_t* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 2 <= groups; g += 2)
+  {
+    __m128i r = _mm_loadu_si128((__m128i const*)(v + 8*g));
+    r = netsort_8x2_i8_sse(r);
+    _mm_storeu_si128((__m128i*)(v + 8*g), r);
+  }
+
+  // Remaining group
+  if (g < groups)
+    netsort_8_i8_sse(v + 8*g);
+}
+#endif // HAS_SSE4_1_
+
+//
+#ifdef HAS_AVX2_
+// Sort 4 groups of 8 values in register (one per 64-bit lane)
+static inline __m256i netsort_8x4_i8_avx2(const __m256i in)
+{
+  const __m256i oddB = _mm256_set1_epi16((int16_t)0xFF00);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  const __m256i shfA = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  __m256i tmp0 = _mm256_shuffle_epi8(in, shfA);
+  __m256i min = _mm256_min_epi8(in, tmp0);
+  __m256i max = _mm256_max_epi8(in, tmp0);
+  tmp0 = _mm256_blendv_epi8(min, max, oddB);
+
+  //////// [0,3] [1,2] [4,7] [5,6]
+  __m256i shfl = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  __m256i tmp1 = _mm256_shuffle_epi8(tmp0, shfl);
+  min = _mm256_min_epi8(tmp0, tmp1);
+  max = _mm256_max_epi8(tmp0, tmp1);
+  tmp0 = _mm256_blend_epi16(min, max, 0xAA);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm256_shuffle_epi8(tmp0, shfA);
+  min = _mm256_min_epi8(tmp0, tmp1);
+  max = _mm256_max_epi8(tmp0, tmp1);
+  tmp0 = _mm256_blendv_epi8(min, max, oddB);
+
+  //////// [0,7] [1,6] [2,5] [3,4]
+  shfl = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                          7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  tmp1 = _mm256_shuffle_epi8(tmp0, shfl);
+  min = _mm256_min_epi8(tmp0, tmp1);
+  max = _mm256_max_epi8(tmp0, tmp1);
+  tmp1 = _mm256_blend_epi16(min, max, 0xCC);
+
+  //////// [0,2] [1,3] [4,6] [5,7]
+  shfl = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  tmp0 = _mm256_shuffle_epi8(tmp1, shfl);
+  min = _mm256_min_epi8(tmp0, tmp1);
+  max = _mm256_max_epi8(tmp0, tmp1);
+  tmp0 = _mm256_blend_epi16(min, max, 0xAA);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm256_shuffle_epi8(tmp0, shfA);
+  min = _mm256_min_epi8(tmp0, tmp1);
+  max = _mm256_max_epi8(tmp0, tmp1);
+  return _mm256_blendv_epi8(min, max, oddB);
+}
+
+//
+static inline void netsort_8_batch_i8_avx2(int8_t* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4)
+  {
+    __m256i r = _mm256_loadu_si256((__m256i const*)(v + 8*g));
+    r = netsort_8x4_i8_avx2(r);
+    _mm256_storeu_si256((__m256i*)(v + 8*g), r);
+  }
+
+  // Remaining groups
+  netsort_8_batch_i8_sse(v + 8*g, groups - g);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512BW_
+// Sort 8 groups of 8 values in register (one per 64-bit lane)
+static inline __m512i netsort_8x8_i8_avx512(const __m512i in)
+{
+  //////// [0,1] [2,3] [4,5] [6,7]
+  const __m512i shfA = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+  __m512i tmp0 = _mm512_shuffle_epi8(in, shfA);
+  __m512i min = _mm512_min_epi8(in, tmp0);
+  __m512i max = _mm512_max_epi8(in, tmp0);
+  tmp0 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAAull, min, max);
+
+  //////// [0,3] [1,2] [4,7] [5,6]
+  __m512i shfl = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+  __m512i tmp1 = _mm512_shuffle_epi8(tmp0, shfl);
+  min = _mm512_min_epi8(tmp0, tmp1);
+  max = _mm512_max_epi8(tmp0, tmp1);
+  tmp0 = _mm512_mask_blend_epi8(0xCCCCCCCCCCCCCCCCull, min, max);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm512_shuffle_epi8(tmp0, shfA);
+  min = _mm512_min_epi8(tmp0, tmp1);
+  max = _mm512_max_epi8(tmp0, tmp1);
+  tmp0 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAAull, min, max);
+
+  //////// [0,7] [1,6] [2,5] [3,4]
+  shfl = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+  tmp1 = _mm512_shuffle_epi8(tmp0, shfl);
+  min = _mm512_min_epi8(tmp0, tmp1);
+  max = _mm512_max_epi8(tmp0, tmp1);
+  tmp1 = _mm512_mask_blend_epi8(0xF0F0F0F0F0F0F0F0ull, min, max);
+
+  //////// [0,2] [1,3] [4,6] [5,7]
+  shfl = _mm512_broadcast_i32x4(_mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+  tmp0 = _mm512_shuffle_epi8(tmp1, shfl);
+  min = _mm512_min_epi8(tmp0, tmp1);
+  max = _mm512_max_epi8(tmp0, tmp1);
+  tmp0 = _mm512_mask_blend_epi8(0xCCCCCCCCCCCCCCCCull, min, max);
+
+  //////// [0,1] [2,3] [4,5] [6,7]
+  tmp1 = _mm512_shuffle_epi8(tmp0, shfA);
+  min = _mm512_min_epi8(tmp0, tmp1);
+  max = _mm512_max_epi8(tmp0, tmp1);
+  return _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAAull, min, max);
+}
+
+//
+static inline void netsort_8_batch_i8_avx512(int8_t* __restrict v, size_t groups)
+{
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8)
+  {
+    __m512i r = _mm512_loadu_si512((void const*)(v + 8*g));
+    r = netsort_8x8_i8_avx512(r);
+    _mm512_storeu_si512((void*)(v + 8*g), r);
+  }
+
+  // Remaining groups
+  netsort_8_batch_i8_avx2(v + 8*g, groups - g);
+}
+#endif // HAS_AVX512BW_
+
+
+#endif // NSORT_8_BATCH_I8_H
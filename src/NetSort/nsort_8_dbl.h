@@ -29,9 +29,9 @@
 #endif
 
 
-//
+// NaN not supported (see netsort_total/netsort_nan_last in nsort_order.h)
 static inline int cmpfunc_dbl(const void* __restrict a, const void* __restrict b) {
-  return ( *(const double*)a > *(const double*)b );
+  return ( *(const double*)a > *(const double*)b ) - ( *(const double*)a < *(const double*)b );
 }
 
 //
@@ -42,14 +42,16 @@ static inline void netsort_8_dbl_qsort(double* __restrict v)
 
 //
 #ifdef HAS_AVX_
-static inline void netsort_8_dbl_avx(double* __restrict v)
+// Sort 8 values held in 2 registers (r[0]: 0..3, r[1]: 4..7)
+static inline void netsort_8_dbl_avx(__m256d* r)
 {
-  // Load -> [[ 7 | 6] | [5 | 4 ]] | [[ 3 | 2] | [1 | 0 ]]
-  __m256d in0 = NSORT_8_DBL_LOAD_256(v);
-  __m256d in1 = NSORT_8_DBL_LOAD_256(v+4);
+  __m256d in0 = r[0];
+  __m256d in1 = r[1];
   
 #ifdef DEBUG_NS8DBL
-  print_vec(v, "\nin AVX"); std::cout << "\n";
+  double v[8];
+  _mm256_storeu_pd(v, in0);
+  _mm256_storeu_pd(v+4, in1);
 #endif
   
   //////// [0,1] [2,3] | [4,5] [6,7]
@@ -182,8 +184,8 @@ static inline void netsort_8_dbl_avx(double* __restrict v)
     std::cout << "\nEarly exit 8xDBL AVX\n";
   done = true;
 #endif
-    _mm256_storeu_pd(v,   tmp2);
-    _mm256_storeu_pd(v+4, tmp3);
+    r[0] = tmp2;
+    r[1] = tmp3;
     return;
   }
 #endif
@@ -239,10 +241,28 @@ static inline void netsort_8_dbl_avx(double* __restrict v)
   max1 = _mm256_max_pd(tmp1, tmp3);
   tmp1 = _mm256_blend_pd(min1, max1, 0x0A);
   
+  r[0] = tmp0;
+  r[1] = tmp1;
+}
+
+//
+static inline void netsort_8_dbl_avx(double* __restrict v)
+{
+  // Load -> [[ 7 | 6] | [5 | 4 ]] | [[ 3 | 2] | [1 | 0 ]]
+  __m256d r[2];
+  r[0] = NSORT_8_DBL_LOAD_256(v);
+  r[1] = NSORT_8_DBL_LOAD_256(v+4);
+  
+#ifdef DEBUG_NS8DBL
+  print_vec(v, "\nin AVX"); std::cout << "\n";
+#endif
+  
+  netsort_8_dbl_avx(r);
+  
   //
   // Store
-  _mm256_storeu_pd(v,   tmp0);
-  _mm256_storeu_pd(v+4, tmp1);
+  _mm256_storeu_pd(v,   r[0]);
+  _mm256_storeu_pd(v+4, r[1]);
   
 #ifdef DEBUG_NS8DBL
   print_vec(v, "sort6"); std::cout << "\n";
@@ -44,9 +44,9 @@
 #endif
 
 
-//
+// NaN not supported (see netsort_total/netsort_nan_last in nsort_order.h)
 static inline int cmpfunc_flt(const void* __restrict a, const void* __restrict b) {
-  return ( *(const float*)a > *(const float*)b );
+  return ( *(const float*)a > *(const float*)b ) - ( *(const float*)a < *(const float*)b );
 }
 
 //
@@ -56,14 +56,16 @@ static inline void netsort_8_flt_qsort(float* __restrict v)
 }
 
 //
-static inline void netsort_8_flt_sse(float* __restrict v)
+// Sort 8 values held in 2 registers (r[0]: 0..3, r[1]: 4..7)
+static inline void netsort_8_flt_sse(__m128* r)
 {
-  // Load -> [ 7 | 6 | 5 | 4 ] | [ 3 | 2 | 1 | 0 ]
-  __m128 in0 = NSORT_8_FLT_LOAD_128(v);
-  __m128 in1 = NSORT_8_FLT_LOAD_128(v+4);
+  __m128 in0 = r[0];
+  __m128 in1 = r[1];
   
 #ifdef DEBUG_NS8FLT
-  print_vec(v, "\nin SSE"); std::cout << "\n";
+  float v[8];
+  _mm_storeu_ps(v, in0);
+  _mm_storeu_ps(v+4, in1);
 #endif
   
   //////// [0,1] [2,3] | [4,5] [6,7]
@@ -182,8 +184,8 @@ static inline void netsort_8_flt_sse(float* __restrict v)
     std::cout << "\nEarly exit 8xFLT SSE\n";
   done = true;
 #endif
-    _mm_storeu_ps(v,   tmp2);
-    _mm_storeu_ps(v+4, tmp3);
+    r[0] = tmp2;
+    r[1] = tmp3;
     return;
   }
 #endif
@@ -234,10 +236,28 @@ static inline void netsort_8_flt_sse(float* __restrict v)
   max1 = _mm_max_ps(tmp1, tmp3);
   tmp1 = blend_ps_0A(min1, max1);
   
+  r[0] = tmp0;
+  r[1] = tmp1;
+}
+
+//
+static inline void netsort_8_flt_sse(float* __restrict v)
+{
+  // Load -> [ 7 | 6 | 5 | 4 ] | [ 3 | 2 | 1 | 0 ]
+  __m128 r[2];
+  r[0] = NSORT_8_FLT_LOAD_128(v);
+  r[1] = NSORT_8_FLT_LOAD_128(v+4);
+  
+#ifdef DEBUG_NS8FLT
+  print_vec(v, "\nin SSE"); std::cout << "\n";
+#endif
+  
+  netsort_8_flt_sse(r);
+  
   //
   // Store
-  _mm_storeu_ps(v,   tmp0);
-  _mm_storeu_ps(v+4, tmp1);
+  _mm_storeu_ps(v,   r[0]);
+  _mm_storeu_ps(v+4, r[1]);
   
 #ifdef DEBUG_NS8FLT
   print_vec(v, "sort6"); std::cout << "\n";
@@ -246,13 +266,12 @@ static inline void netsort_8_flt_sse(float* __restrict v)
 
 //
 #ifdef HAS_AVX_
-static inline void netsort_8_flt_avx(float* __restrict v)
+// Sort 8 values in register
+static inline __m256 netsort_8_flt_avx(const __m256 in)
 {
-  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
-  __m256 in = NSORT_8_FLT_LOAD_256(v);
-  
 #ifdef DEBUG_NS8FLT
-  print_vec(v, "\nin AVX"); std::cout << "\n";
+  float v[8];
+  _mm256_storeu_ps(v, in);
 #endif
   
   //////// [0,1] [2,3] | [4,5] [6,7]
@@ -344,8 +363,7 @@ static inline void netsort_8_flt_avx(float* __restrict v)
     std::cout << "\nEarly exit 8xFLT AVX\n";
   done = true;
 #endif
-    _mm256_storeu_ps(v, tmp1);
-    return;
+    return tmp1;
   }
 #endif
   
@@ -382,9 +400,24 @@ static inline void netsort_8_flt_avx(float* __restrict v)
   max = _mm256_max_ps(tmp0, tmp1);
   tmp0 = _mm256_blend_ps(min, max, 0xAA);
   
+  return tmp0;
+}
+
+//
+static inline void netsort_8_flt_avx(float* __restrict v)
+{
+  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
+  __m256 in = NSORT_8_FLT_LOAD_256(v);
+  
+#ifdef DEBUG_NS8FLT
+  print_vec(v, "\nin AVX"); std::cout << "\n";
+#endif
+  
+  in = netsort_8_flt_avx(in);
+  
   //
   // Store
-  _mm256_storeu_ps(v, tmp0);
+  _mm256_storeu_ps(v, in);
   
 #ifdef DEBUG_NS8FLT
   print_vec(v, "sort6"); std::cout << "\n";
@@ -32,7 +32,7 @@
 
 //
 static inline int cmpfunc_i16(const void* __restrict a, const void* __restrict b) {
-  return ( *(const int16_t*)a > *(const int16_t*)b );
+  return ( *(const int16_t*)a > *(const int16_t*)b ) - ( *(const int16_t*)a < *(const int16_t*)b );
 }
 
 //
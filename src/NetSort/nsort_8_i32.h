@@ -46,7 +46,7 @@
 
 //
 static inline int cmpfunc_i32(const void* __restrict a, const void* __restrict b) {
-  return ( *(const int32_t*)a > *(const int32_t*)b );
+  return ( *(const int32_t*)a > *(const int32_t*)b ) - ( *(const int32_t*)a < *(const int32_t*)b );
 }
 
 //
@@ -57,14 +57,16 @@ static inline void netsort_8_i32_qsort(int32_t* __restrict v)
 
 //
 #ifdef HAS_SSE4_1_
-static inline void netsort_8_i32_sse(int32_t* __restrict v)
+// Sort 8 values held in 2 registers (r[0]: 0..3, r[1]: 4..7)
+static inline void netsort_8_i32_sse(__m128i* r)
 {
-  // Load -> [ 7 | 6 | 5 | 4 ] | [ 3 | 2 | 1 | 0 ]
-  __m128i in0 = NSORT_8_I32_LOAD_128(v);
-  __m128i in1 = NSORT_8_I32_LOAD_128(v+4);
+  __m128i in0 = r[0];
+  __m128i in1 = r[1];
   
 #ifdef DEBUG_NS8I32
-  print_vec(v, "\nin SSE"); std::cout << "\n";
+  int32_t v[8];
+  _mm_storeu_si128((__m128i*)(v), in0);
+  _mm_storeu_si128((__m128i*)(v+4), in1);
 #endif
   
   //////// [0,1] [2,3] | [4,5] [6,7]
@@ -195,8 +197,8 @@ static inline void netsort_8_i32_sse(int32_t* __restrict v)
     std::cout << "\nEarly exit 8xI32 SSE\n";
   done = true;
 #endif
-    _mm_storeu_si128((__m128i*)(v),   tmp2);
-    _mm_storeu_si128((__m128i*)(v+4), tmp3);
+    r[0] = tmp2;
+    r[1] = tmp3;
     return;
   }
 #endif
@@ -247,10 +249,28 @@ static inline void netsort_8_i32_sse(int32_t* __restrict v)
   max1 = _mm_max_epi32(tmp1, tmp3);
   tmp1 = blend_epi32_0A(min1, max1);
   
+  r[0] = tmp0;
+  r[1] = tmp1;
+}
+
+//
+static inline void netsort_8_i32_sse(int32_t* __restrict v)
+{
+  // Load -> [ 7 | 6 | 5 | 4 ] | [ 3 | 2 | 1 | 0 ]
+  __m128i r[2];
+  r[0] = NSORT_8_I32_LOAD_128(v);
+  r[1] = NSORT_8_I32_LOAD_128(v+4);
+  
+#ifdef DEBUG_NS8I32
+  print_vec(v, "\nin SSE"); std::cout << "\n";
+#endif
+  
+  netsort_8_i32_sse(r);
+  
   //
   // Store
-  _mm_storeu_si128((__m128i*)(v),   tmp0);
-  _mm_storeu_si128((__m128i*)(v+4), tmp1);
+  _mm_storeu_si128((__m128i*)(v),   r[0]);
+  _mm_storeu_si128((__m128i*)(v+4), r[1]);
   
 #ifdef DEBUG_NS8I32
   print_vec(v, "sort6"); std::cout << "\n";
@@ -260,13 +280,12 @@ static inline void netsort_8_i32_sse(int32_t* __restrict v)
 
 // TODO: test
 #ifdef HAS_AVX2_
-static inline void netsort_8_i32_avx2(int32_t* __restrict v)
+// Sort 8 values in register
+static inline __m256i netsort_8_i32_avx2(const __m256i in)
 {
-  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
-  __m256i in = NSORT_8_I32_LOAD_256(v);
-  
 #ifdef DEBUG_NS8I32
-  print_vec(v, "\nin AVX2"); std::cout << "\n";
+  int32_t v[8];
+  _mm256_storeu_si256((__m256i*)v, in);
 #endif
   
   //////// [0,1] [2,3] | [4,5] [6,7]
@@ -358,8 +377,7 @@ static inline void netsort_8_i32_avx2(int32_t* __restrict v)
     std::cout << "\nEarly exit 8xI32 AVX2\n";
   done = true;
 #endif
-    _mm256_storeu_si256((__m256i*)v, tmp1);
-    return;
+    return tmp1;
   }
 #endif
   
@@ -396,9 +414,24 @@ static inline void netsort_8_i32_avx2(int32_t* __restrict v)
   max = _mm256_max_epi32(tmp0, tmp1);
   tmp0 = _mm256_blend_epi32(min, max, 0xAA);
   
+  return tmp0;
+}
+
+//
+static inline void netsort_8_i32_avx2(int32_t* __restrict v)
+{
+  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
+  __m256i in = NSORT_8_I32_LOAD_256(v);
+  
+#ifdef DEBUG_NS8I32
+  print_vec(v, "\nin AVX2"); std::cout << "\n";
+#endif
+  
+  in = netsort_8_i32_avx2(in);
+  
   //
   // Store
-  _mm256_storeu_si256((__m256i*)v, tmp0);
+  _mm256_storeu_si256((__m256i*)v, in);
   
 #ifdef DEBUG_NS8I32
   print_vec(v, "sort6"); std::cout << "\n";
@@ -31,7 +31,7 @@
 
 //
 static inline int cmpfunc_i8(const void* __restrict a, const void* __restrict b) {
-  return ( *(const int8_t*)a > *(const int8_t*)b );
+  return ( *(const int8_t*)a > *(const int8_t*)b ) - ( *(const int8_t*)a < *(const int8_t*)b );
 }
 
 //
@@ -42,11 +42,9 @@ static inline void netsort_8_i8_qsort(int8_t* __restrict v)
 
 //
 #ifdef HAS_SSSE3_
-static inline void netsort_8_i8_sse(int8_t* __restrict v)
+// Sort 8 values in register (lower 8 bytes, upper 8 bytes unspecified)
+static inline __m128i netsort_8_i8_sse(const __m128i in)
 {
-  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
-  __m128i in = _mm_loadl_epi64((__m128i const*)(v));
-  
 #ifndef HAS_SSE4_1_
   __m128i tmp0 = extend_lo_epi8(in);
   tmp0 = netsort_8_i16_sse(tmp0);
@@ -54,7 +52,8 @@ static inline void netsort_8_i8_sse(int8_t* __restrict v)
 #else
   
 #ifdef DEBUG_NS8I8
-  print_vec(v, "\nin SSE"); std::cout << "\n";
+  int8_t v[16];
+  _mm_storeu_si128((__m128i*)(v), in);
 #endif
   
   //////// [0,1] [2,3] [4,5] [6,7]
@@ -147,8 +146,7 @@ static inline void netsort_8_i8_sse(int8_t* __restrict v)
     std::cout << "\nEarly exit 8xI8 SSE\n";
   done = true;
 #endif
-    _mm_storel_epi64((__m128i*)(v), tmp1);
-    return;
+    return tmp1;
   }
 #endif
   
@@ -187,9 +185,24 @@ static inline void netsort_8_i8_sse(int8_t* __restrict v)
   tmp0 = blend_epi8_AA(min, max);  
 #endif // HAS_SSE4_1_
   
+  return tmp0;
+}
+
+//
+static inline void netsort_8_i8_sse(int8_t* __restrict v)
+{
+  // Load -> [ 7 | 6 | 5 | 4 | 3 | 2 | 1 | 0 ]
+  __m128i in = _mm_loadl_epi64((__m128i const*)(v));
+  
+#ifdef DEBUG_NS8I8
+  print_vec(v, "\nin SSE"); std::cout << "\n";
+#endif
+  
+  in = netsort_8_i8_sse(in);
+  
   //
   // Store
-  _mm_storel_epi64((__m128i*)(v), tmp0);
+  _mm_storel_epi64((__m128i*)(v), in);
   
 #ifdef DEBUG_NS8I8
   print_vec(v, "sort6"); std::cout << "\n";
@@ -0,0 +1,352 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_DBL_H
+#define NSORT_BITONIC_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX-512
+#endif
+
+// Bitonic building blocks for double networks (4 x double per __m256d)
+// Same scheme as nsort_bitonic_i32.h (step_d / flip_s stages, k registers per run)
+
+
+#ifdef HAS_AVX_
+//
+static inline __m256d bitonic_reverse_dbl_avx(const __m256d v)
+{
+#ifdef HAS_AVX2_
+  return _mm256_permute4x64_pd(v, _MM_SHUFFLE(0,1,2,3));
+#else
+  __m256d tmp = _mm256_permute2f128_pd(v, v, 1); // inv hi/lo (inter-lane penalty)
+  return _mm256_permute_pd(tmp, 0x05);
+#endif
+}
+
+//
+static inline void bitonic_minmax_dbl_avx(__m256d& a, __m256d& b)
+{
+  __m256d min = _mm256_min_pd(a, b);
+  b = _mm256_max_pd(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3]
+static inline __m256d bitonic_step_1_dbl_avx(const __m256d v)
+{
+  __m256d tmp = _mm256_permute_pd(v, 0x05);
+  return _mm256_blend_pd(_mm256_min_pd(v, tmp), _mm256_max_pd(v, tmp), 0x0A);
+}
+
+//////// [0,2] [1,3]
+static inline __m256d bitonic_step_2_dbl_avx(const __m256d v)
+{
+  __m256d tmp = _mm256_permute2f128_pd(v, v, 1); // inter-lane
+  return _mm256_blend_pd(_mm256_min_pd(v, tmp), _mm256_max_pd(v, tmp), 0x0C);
+}
+
+//////// [0,3] [1,2]
+static inline __m256d bitonic_flip_4_dbl_avx(const __m256d v)
+{
+  __m256d tmp = bitonic_reverse_dbl_avx(v);
+  return _mm256_blend_pd(_mm256_min_pd(v, tmp), _mm256_max_pd(v, tmp), 0x0C);
+}
+
+// Sort 4 values in register
+static inline __m256d bitonic_sort_4_dbl_avx(__m256d v)
+{
+  v = bitonic_step_1_dbl_avx(v);
+  v = bitonic_flip_4_dbl_avx(v);
+  return bitonic_step_1_dbl_avx(v);
+}
+
+// Sort 4 bitonic values in register
+static inline __m256d bitonic_clean_4_dbl_avx(__m256d v)
+{
+  v = bitonic_step_2_dbl_avx(v);
+  return bitonic_step_1_dbl_avx(v);
+}
+
+//
+static inline void bitonic_clean_8_dbl_avx(__m256d* r)
+{
+  bitonic_minmax_dbl_avx(r[0], r[1]);
+  r[0] = bitonic_clean_4_dbl_avx(r[0]);
+  r[1] = bitonic_clean_4_dbl_avx(r[1]);
+}
+
+//
+static inline void bitonic_clean_16_dbl_avx(__m256d* r)
+{
+  bitonic_minmax_dbl_avx(r[0], r[2]);
+  bitonic_minmax_dbl_avx(r[1], r[3]);
+  bitonic_clean_8_dbl_avx(r);
+  bitonic_clean_8_dbl_avx(r + 2);
+}
+
+//
+static inline void bitonic_clean_32_dbl_avx(__m256d* r)
+{
+  bitonic_minmax_dbl_avx(r[0], r[4]);
+  bitonic_minmax_dbl_avx(r[1], r[5]);
+  bitonic_minmax_dbl_avx(r[2], r[6]);
+  bitonic_minmax_dbl_avx(r[3], r[7]);
+  bitonic_clean_16_dbl_avx(r);
+  bitonic_clean_16_dbl_avx(r + 4);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_8_dbl_avx(__m256d* r)
+{
+  r[1] = bitonic_reverse_dbl_avx(r[1]);
+  bitonic_clean_8_dbl_avx(r);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_16_dbl_avx(__m256d* r)
+{
+  __m256d b0 = bitonic_reverse_dbl_avx(r[3]);
+  __m256d b1 = bitonic_reverse_dbl_avx(r[2]);
+  r[2] = _mm256_max_pd(r[0], b0);
+  r[3] = _mm256_max_pd(r[1], b1);
+  r[0] = _mm256_min_pd(r[0], b0);
+  r[1] = _mm256_min_pd(r[1], b1);
+  bitonic_clean_8_dbl_avx(r);
+  bitonic_clean_8_dbl_avx(r + 2);
+}
+
+// Merge 2 sorted runs: r[0..3] | r[4..7]
+static inline void bitonic_merge_32_dbl_avx(__m256d* r)
+{
+  __m256d b0 = bitonic_reverse_dbl_avx(r[7]);
+  __m256d b1 = bitonic_reverse_dbl_avx(r[6]);
+  __m256d b2 = bitonic_reverse_dbl_avx(r[5]);
+  __m256d b3 = bitonic_reverse_dbl_avx(r[4]);
+  r[4] = _mm256_max_pd(r[0], b0);
+  r[5] = _mm256_max_pd(r[1], b1);
+  r[6] = _mm256_max_pd(r[2], b2);
+  r[7] = _mm256_max_pd(r[3], b3);
+  r[0] = _mm256_min_pd(r[0], b0);
+  r[1] = _mm256_min_pd(r[1], b1);
+  r[2] = _mm256_min_pd(r[2], b2);
+  r[3] = _mm256_min_pd(r[3], b3);
+  bitonic_clean_16_dbl_avx(r);
+  bitonic_clean_16_dbl_avx(r + 4);
+}
+
+// Merge 2 sorted runs: r[0..7] | r[8..15]
+static inline void bitonic_merge_64_dbl_avx(__m256d* r)
+{
+  __m256d b0 = bitonic_reverse_dbl_avx(r[15]);
+  __m256d b1 = bitonic_reverse_dbl_avx(r[14]);
+  __m256d b2 = bitonic_reverse_dbl_avx(r[13]);
+  __m256d b3 = bitonic_reverse_dbl_avx(r[12]);
+  __m256d b4 = bitonic_reverse_dbl_avx(r[11]);
+  __m256d b5 = bitonic_reverse_dbl_avx(r[10]);
+  __m256d b6 = bitonic_reverse_dbl_avx(r[9]);
+  __m256d b7 = bitonic_reverse_dbl_avx(r[8]);
+  r[8] = _mm256_max_pd(r[0], b0);
+  r[9] = _mm256_max_pd(r[1], b1);
+  r[10] = _mm256_max_pd(r[2], b2);
+  r[11] = _mm256_max_pd(r[3], b3);
+  r[12] = _mm256_max_pd(r[4], b4);
+  r[13] = _mm256_max_pd(r[5], b5);
+  r[14] = _mm256_max_pd(r[6], b6);
+  r[15] = _mm256_max_pd(r[7], b7);
+  r[0] = _mm256_min_pd(r[0], b0);
+  r[1] = _mm256_min_pd(r[1], b1);
+  r[2] = _mm256_min_pd(r[2], b2);
+  r[3] = _mm256_min_pd(r[3], b3);
+  r[4] = _mm256_min_pd(r[4], b4);
+  r[5] = _mm256_min_pd(r[5], b5);
+  r[6] = _mm256_min_pd(r[6], b6);
+  r[7] = _mm256_min_pd(r[7], b7);
+  bitonic_clean_32_dbl_avx(r);
+  bitonic_clean_32_dbl_avx(r + 8);
+}
+
+// Sort 8/16/32/64 values held in 2/4/8/16 registers
+static inline void bitonic_sort_8_dbl_avx(__m256d* r)
+{
+  r[0] = bitonic_sort_4_dbl_avx(r[0]);
+  r[1] = bitonic_sort_4_dbl_avx(r[1]);
+  bitonic_merge_8_dbl_avx(r);
+}
+
+static inline void bitonic_sort_16_dbl_avx(__m256d* r)
+{
+  bitonic_sort_8_dbl_avx(r);
+  bitonic_sort_8_dbl_avx(r + 2);
+  bitonic_merge_16_dbl_avx(r);
+}
+
+static inline void bitonic_sort_32_dbl_avx(__m256d* r)
+{
+  bitonic_sort_16_dbl_avx(r);
+  bitonic_sort_16_dbl_avx(r + 4);
+  bitonic_merge_32_dbl_avx(r);
+}
+
+static inline void bitonic_sort_64_dbl_avx(__m256d* r)
+{
+  bitonic_sort_32_dbl_avx(r);
+  bitonic_sort_32_dbl_avx(r + 8);
+  bitonic_merge_64_dbl_avx(r);
+}
+#endif // HAS_AVX_
+
+
+#ifdef HAS_AVX512F_
+// AVX-512: 8 x double per __m512d (same as int32)
+//
+static inline __m512d bitonic_reverse_dbl_avx512(const __m512d v)
+{
+  return _mm512_permutexvar_pd(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), v);
+}
+
+//
+static inline void bitonic_minmax_dbl_avx512(__m512d& a, __m512d& b)
+{
+  __m512d min = _mm512_min_pd(a, b);
+  b = _mm512_max_pd(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] ...
+static inline __m512d bitonic_step_1_dbl_avx512(const __m512d v)
+{
+  __m512d tmp = _mm512_permute_pd(v, 0x55);
+  return _mm512_mask_mov_pd(_mm512_min_pd(v, tmp), 0xAA, _mm512_max_pd(v, tmp));
+}
+
+//////// [0,2] [1,3] ...
+static inline __m512d bitonic_step_2_dbl_avx512(const __m512d v)
+{
+  __m512d tmp = _mm512_shuffle_f64x2(v, v, _MM_SHUFFLE(2,3,0,1));
+  return _mm512_mask_mov_pd(_mm512_min_pd(v, tmp), 0xCC, _mm512_max_pd(v, tmp));
+}
+
+//////// [0,4] [1,5] [2,6] [3,7]
+static inline __m512d bitonic_step_4_dbl_avx512(const __m512d v)
+{
+  __m512d tmp = _mm512_shuffle_f64x2(v, v, _MM_SHUFFLE(1,0,3,2));
+  return _mm512_mask_mov_pd(_mm512_min_pd(v, tmp), 0xF0, _mm512_max_pd(v, tmp));
+}
+
+// Sort 8 bitonic values in register
+static inline __m512d bitonic_clean_8_dbl_avx512(__m512d v)
+{
+  v = bitonic_step_4_dbl_avx512(v);
+  v = bitonic_step_2_dbl_avx512(v);
+  return bitonic_step_1_dbl_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_16_dbl_avx512(__m512d* r)
+{
+  r[1] = bitonic_reverse_dbl_avx512(r[1]);
+  bitonic_minmax_dbl_avx512(r[0], r[1]);
+  r[0] = bitonic_clean_8_dbl_avx512(r[0]);
+  r[1] = bitonic_clean_8_dbl_avx512(r[1]);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_32_dbl_avx512(__m512d* r)
+{
+  __m512d b0 = bitonic_reverse_dbl_avx512(r[3]);
+  __m512d b1 = bitonic_reverse_dbl_avx512(r[2]);
+  r[2] = _mm512_max_pd(r[0], b0);
+  r[3] = _mm512_max_pd(r[1], b1);
+  r[0] = _mm512_min_pd(r[0], b0);
+  r[1] = _mm512_min_pd(r[1], b1);
+  bitonic_minmax_dbl_avx512(r[0], r[1]);
+  bitonic_minmax_dbl_avx512(r[2], r[3]);
+  r[0] = bitonic_clean_8_dbl_avx512(r[0]);
+  r[1] = bitonic_clean_8_dbl_avx512(r[1]);
+  r[2] = bitonic_clean_8_dbl_avx512(r[2]);
+  r[3] = bitonic_clean_8_dbl_avx512(r[3]);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6]
+static inline __m512d bitonic_flip_4_dbl_avx512(const __m512d v)
+{
+  __m512d tmp = _mm512_permutex_pd(v, _MM_SHUFFLE(0,1,2,3));
+  return _mm512_mask_mov_pd(_mm512_min_pd(v, tmp), 0xCC, _mm512_max_pd(v, tmp));
+}
+
+//////// [0,7] [1,6] [2,5] [3,4]
+static inline __m512d bitonic_flip_8_dbl_avx512(const __m512d v)
+{
+  __m512d tmp = bitonic_reverse_dbl_avx512(v);
+  return _mm512_mask_mov_pd(_mm512_min_pd(v, tmp), 0xF0, _mm512_max_pd(v, tmp));
+}
+
+// Sort 8 values in register
+static inline __m512d bitonic_sort_8_dbl_avx512(__m512d v)
+{
+  v = bitonic_step_1_dbl_avx512(v);
+  v = bitonic_flip_4_dbl_avx512(v);
+  v = bitonic_step_1_dbl_avx512(v);
+  v = bitonic_flip_8_dbl_avx512(v);
+  v = bitonic_step_2_dbl_avx512(v);
+  return bitonic_step_1_dbl_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0..3] | r[4..7]
+static inline void bitonic_merge_64_dbl_avx512(__m512d* r)
+{
+  __m512d b0 = bitonic_reverse_dbl_avx512(r[7]);
+  __m512d b1 = bitonic_reverse_dbl_avx512(r[6]);
+  __m512d b2 = bitonic_reverse_dbl_avx512(r[5]);
+  __m512d b3 = bitonic_reverse_dbl_avx512(r[4]);
+  r[4] = _mm512_max_pd(r[0], b0);
+  r[5] = _mm512_max_pd(r[1], b1);
+  r[6] = _mm512_max_pd(r[2], b2);
+  r[7] = _mm512_max_pd(r[3], b3);
+  r[0] = _mm512_min_pd(r[0], b0);
+  r[1] = _mm512_min_pd(r[1], b1);
+  r[2] = _mm512_min_pd(r[2], b2);
+  r[3] = _mm512_min_pd(r[3], b3);
+  for (size_t h=0; h<8; h+=4)
+  {
+    bitonic_minmax_dbl_avx512(r[h], r[h+2]);
+    bitonic_minmax_dbl_avx512(r[h+1], r[h+3]);
+    bitonic_minmax_dbl_avx512(r[h], r[h+1]);
+    bitonic_minmax_dbl_avx512(r[h+2], r[h+3]);
+    for (size_t i=h; i<h+4; ++i)
+      r[i] = bitonic_clean_8_dbl_avx512(r[i]);
+  }
+}
+
+// Sort 16/32/64 values held in 2/4/8 registers
+static inline void bitonic_sort_16_dbl_avx512(__m512d* r)
+{
+  r[0] = bitonic_sort_8_dbl_avx512(r[0]);
+  r[1] = bitonic_sort_8_dbl_avx512(r[1]);
+  bitonic_merge_16_dbl_avx512(r);
+}
+
+static inline void bitonic_sort_32_dbl_avx512(__m512d* r)
+{
+  bitonic_sort_16_dbl_avx512(r);
+  bitonic_sort_16_dbl_avx512(r + 2);
+  bitonic_merge_32_dbl_avx512(r);
+}
+
+static inline void bitonic_sort_64_dbl_avx512(__m512d* r)
+{
+  bitonic_sort_32_dbl_avx512(r);
+  bitonic_sort_32_dbl_avx512(r + 4);
+  bitonic_merge_64_dbl_avx512(r);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_BITONIC_DBL_H
@@ -0,0 +1,310 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_FLT_H
+#define NSORT_BITONIC_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX-512
+#endif
+
+// Bitonic building blocks for float networks (8 x float per __m256)
+// Same scheme as nsort_bitonic_i32.h (step_d / flip_s stages, k registers per run)
+
+
+#ifdef HAS_AVX_
+//
+static inline __m256 bitonic_reverse_flt_avx(const __m256 v)
+{
+  __m256 tmp = _mm256_permute2f128_ps(v, v, 1); // inv hi/lo (inter-lane penalty)
+  return _mm256_permute_ps(tmp, _MM_SHUFFLE(0,1,2,3));
+}
+
+//
+static inline void bitonic_minmax_flt_avx(__m256& a, __m256& b)
+{
+  __m256 min = _mm256_min_ps(a, b);
+  b = _mm256_max_ps(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7]
+static inline __m256 bitonic_step_1_flt_avx(const __m256 v)
+{
+  __m256 tmp = _mm256_permute_ps(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm256_blend_ps(_mm256_min_ps(v, tmp), _mm256_max_ps(v, tmp), 0xAA);
+}
+
+//////// [0,2] [1,3] [4,6] [5,7]
+static inline __m256 bitonic_step_2_flt_avx(const __m256 v)
+{
+  __m256 tmp = _mm256_permute_ps(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm256_blend_ps(_mm256_min_ps(v, tmp), _mm256_max_ps(v, tmp), 0xCC);
+}
+
+//////// [0,4] [1,5] [2,6] [3,7]
+static inline __m256 bitonic_step_4_flt_avx(const __m256 v)
+{
+  __m256 tmp = _mm256_permute2f128_ps(v, v, 1); // inter-lane
+  return _mm256_blend_ps(_mm256_min_ps(v, tmp), _mm256_max_ps(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6]
+static inline __m256 bitonic_flip_4_flt_avx(const __m256 v)
+{
+  __m256 tmp = _mm256_permute_ps(v, _MM_SHUFFLE(0,1,2,3));
+  return _mm256_blend_ps(_mm256_min_ps(v, tmp), _mm256_max_ps(v, tmp), 0xCC);
+}
+
+//////// [0,7] [1,6] [2,5] [3,4]
+static inline __m256 bitonic_flip_8_flt_avx(const __m256 v)
+{
+  __m256 tmp = bitonic_reverse_flt_avx(v);
+  return _mm256_blend_ps(_mm256_min_ps(v, tmp), _mm256_max_ps(v, tmp), 0xF0);
+}
+
+// Sort 8 values in register
+static inline __m256 bitonic_sort_8_flt_avx(__m256 v)
+{
+  v = bitonic_step_1_flt_avx(v);
+  v = bitonic_flip_4_flt_avx(v);
+  v = bitonic_step_1_flt_avx(v);
+  v = bitonic_flip_8_flt_avx(v);
+  v = bitonic_step_2_flt_avx(v);
+  return bitonic_step_1_flt_avx(v);
+}
+
+// Sort 8 bitonic values in register
+static inline __m256 bitonic_clean_8_flt_avx(__m256 v)
+{
+  v = bitonic_step_4_flt_avx(v);
+  v = bitonic_step_2_flt_avx(v);
+  return bitonic_step_1_flt_avx(v);
+}
+
+//
+static inline void bitonic_clean_16_flt_avx(__m256* r)
+{
+  bitonic_minmax_flt_avx(r[0], r[1]);
+  r[0] = bitonic_clean_8_flt_avx(r[0]);
+  r[1] = bitonic_clean_8_flt_avx(r[1]);
+}
+
+//
+static inline void bitonic_clean_32_flt_avx(__m256* r)
+{
+  bitonic_minmax_flt_avx(r[0], r[2]);
+  bitonic_minmax_flt_avx(r[1], r[3]);
+  bitonic_clean_16_flt_avx(r);
+  bitonic_clean_16_flt_avx(r + 2);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_16_flt_avx(__m256* r)
+{
+  r[1] = bitonic_reverse_flt_avx(r[1]);
+  bitonic_clean_16_flt_avx(r);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_32_flt_avx(__m256* r)
+{
+  __m256 b0 = bitonic_reverse_flt_avx(r[3]);
+  __m256 b1 = bitonic_reverse_flt_avx(r[2]);
+  r[2] = _mm256_max_ps(r[0], b0);
+  r[3] = _mm256_max_ps(r[1], b1);
+  r[0] = _mm256_min_ps(r[0], b0);
+  r[1] = _mm256_min_ps(r[1], b1);
+  bitonic_clean_16_flt_avx(r);
+  bitonic_clean_16_flt_avx(r + 2);
+}
+
+// Merge 2 sorted runs: r[0..3] | r[4..7]
+static inline void bitonic_merge_64_flt_avx(__m256* r)
+{
+  __m256 b0 = bitonic_reverse_flt_avx(r[7]);
+  __m256 b1 = bitonic_reverse_flt_avx(r[6]);
+  __m256 b2 = bitonic_reverse_flt_avx(r[5]);
+  __m256 b3 = bitonic_reverse_flt_avx(r[4]);
+  r[4] = _mm256_max_ps(r[0], b0);
+  r[5] = _mm256_max_ps(r[1], b1);
+  r[6] = _mm256_max_ps(r[2], b2);
+  r[7] = _mm256_max_ps(r[3], b3);
+  r[0] = _mm256_min_ps(r[0], b0);
+  r[1] = _mm256_min_ps(r[1], b1);
+  r[2] = _mm256_min_ps(r[2], b2);
+  r[3] = _mm256_min_ps(r[3], b3);
+  bitonic_clean_32_flt_avx(r);
+  bitonic_clean_32_flt_avx(r + 4);
+}
+
+// Sort 16/32/64 values held in 2/4/8 registers
+static inline void bitonic_sort_16_flt_avx(__m256* r)
+{
+  r[0] = bitonic_sort_8_flt_avx(r[0]);
+  r[1] = bitonic_sort_8_flt_avx(r[1]);
+  bitonic_merge_16_flt_avx(r);
+}
+
+static inline void bitonic_sort_32_flt_avx(__m256* r)
+{
+  bitonic_sort_16_flt_avx(r);
+  bitonic_sort_16_flt_avx(r + 2);
+  bitonic_merge_32_flt_avx(r);
+}
+
+static inline void bitonic_sort_64_flt_avx(__m256* r)
+{
+  bitonic_sort_32_flt_avx(r);
+  bitonic_sort_32_flt_avx(r + 4);
+  bitonic_merge_64_flt_avx(r);
+}
+#endif // HAS_AVX_
+
+
+#ifdef HAS_AVX512F_
+// AVX-512: 16 x float per __m512 (same as int32)
+//
+static inline __m512 bitonic_reverse_flt_avx512(const __m512 v)
+{
+  return _mm512_permutexvar_ps(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+}
+
+//
+static inline void bitonic_minmax_flt_avx512(__m512& a, __m512& b)
+{
+  __m512 min = _mm512_min_ps(a, b);
+  b = _mm512_max_ps(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] ...
+static inline __m512 bitonic_step_1_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_permute_ps(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xAAAA, _mm512_max_ps(v, tmp));
+}
+
+//////// [0,2] [1,3] ...
+static inline __m512 bitonic_step_2_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_permute_ps(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xCCCC, _mm512_max_ps(v, tmp));
+}
+
+//////// [0,4] [1,5] [2,6] [3,7] ...
+static inline __m512 bitonic_step_4_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_shuffle_f32x4(v, v, _MM_SHUFFLE(2,3,0,1));
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xF0F0, _mm512_max_ps(v, tmp));
+}
+
+//////// [0,8] [1,9] ... [7,15]
+static inline __m512 bitonic_step_8_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_shuffle_f32x4(v, v, _MM_SHUFFLE(1,0,3,2));
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xFF00, _mm512_max_ps(v, tmp));
+}
+
+// Sort 16 bitonic values in register
+static inline __m512 bitonic_clean_16_flt_avx512(__m512 v)
+{
+  v = bitonic_step_8_flt_avx512(v);
+  v = bitonic_step_4_flt_avx512(v);
+  v = bitonic_step_2_flt_avx512(v);
+  return bitonic_step_1_flt_avx512(v);
+}
+
+// Merge 2 sorted runs in register: v[0..7] | v[8..15]
+static inline __m512 bitonic_merge_16_flt_avx512(__m512 v)
+{
+  v = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 15, 14, 13, 12, 11, 10, 9, 8), v);
+  return bitonic_clean_16_flt_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_32_flt_avx512(__m512* r)
+{
+  r[1] = bitonic_reverse_flt_avx512(r[1]);
+  bitonic_minmax_flt_avx512(r[0], r[1]);
+  r[0] = bitonic_clean_16_flt_avx512(r[0]);
+  r[1] = bitonic_clean_16_flt_avx512(r[1]);
+}
+
+//////// [0,3] [1,2] ...
+static inline __m512 bitonic_flip_4_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_permute_ps(v, _MM_SHUFFLE(0,1,2,3));
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xCCCC, _mm512_max_ps(v, tmp));
+}
+
+//////// [0,7] [1,6] [2,5] [3,4] ...
+static inline __m512 bitonic_flip_8_flt_avx512(const __m512 v)
+{
+  __m512 tmp = _mm512_permutexvar_ps(_mm512_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8), v);
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xF0F0, _mm512_max_ps(v, tmp));
+}
+
+//////// [0,15] [1,14] ... [7,8]
+static inline __m512 bitonic_flip_16_flt_avx512(const __m512 v)
+{
+  __m512 tmp = bitonic_reverse_flt_avx512(v);
+  return _mm512_mask_mov_ps(_mm512_min_ps(v, tmp), 0xFF00, _mm512_max_ps(v, tmp));
+}
+
+// Sort 16 values in register
+static inline __m512 bitonic_sort_16_flt_avx512(__m512 v)
+{
+  v = bitonic_step_1_flt_avx512(v);
+  v = bitonic_flip_4_flt_avx512(v);
+  v = bitonic_step_1_flt_avx512(v);
+  v = bitonic_flip_8_flt_avx512(v);
+  v = bitonic_step_2_flt_avx512(v);
+  v = bitonic_step_1_flt_avx512(v);
+  v = bitonic_flip_16_flt_avx512(v);
+  v = bitonic_step_4_flt_avx512(v);
+  v = bitonic_step_2_flt_avx512(v);
+  return bitonic_step_1_flt_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_64_flt_avx512(__m512* r)
+{
+  __m512 b0 = bitonic_reverse_flt_avx512(r[3]);
+  __m512 b1 = bitonic_reverse_flt_avx512(r[2]);
+  r[2] = _mm512_max_ps(r[0], b0);
+  r[3] = _mm512_max_ps(r[1], b1);
+  r[0] = _mm512_min_ps(r[0], b0);
+  r[1] = _mm512_min_ps(r[1], b1);
+  bitonic_minmax_flt_avx512(r[0], r[1]);
+  bitonic_minmax_flt_avx512(r[2], r[3]);
+  r[0] = bitonic_clean_16_flt_avx512(r[0]);
+  r[1] = bitonic_clean_16_flt_avx512(r[1]);
+  r[2] = bitonic_clean_16_flt_avx512(r[2]);
+  r[3] = bitonic_clean_16_flt_avx512(r[3]);
+}
+
+// Sort 32/64 values held in 2/4 registers
+static inline void bitonic_sort_32_flt_avx512(__m512* r)
+{
+  r[0] = bitonic_sort_16_flt_avx512(r[0]);
+  r[1] = bitonic_sort_16_flt_avx512(r[1]);
+  bitonic_merge_32_flt_avx512(r);
+}
+
+static inline void bitonic_sort_64_flt_avx512(__m512* r)
+{
+  bitonic_sort_32_flt_avx512(r);
+  bitonic_sort_32_flt_avx512(r + 2);
+  bitonic_merge_64_flt_avx512(r);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_BITONIC_FLT_H
@@ -0,0 +1,164 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_I16_H
+#define NSORT_BITONIC_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Bitonic building blocks for int16 networks (16 x int16 per __m256i)
+// Same scheme as nsort_bitonic_i32.h (step_d / flip_s stages, k registers per run)
+// In-lane partners use pshufb / pshufd, lane 8 partners a 128-bit lane swap.
+
+
+#ifdef HAS_AVX2_
+//
+static inline __m256i bitonic_reverse_i16_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                        14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_shuffle_epi8(tmp, shfl);
+}
+
+//
+static inline void bitonic_minmax_i16_avx2(__m256i& a, __m256i& b)
+{
+  __m256i min = _mm256_min_epi16(a, b);
+  b = _mm256_max_epi16(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7] ...
+static inline __m256i bitonic_step_1_i16_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi16(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xAA);
+}
+
+//////// [0,2] [1,3] [4,6] [5,7] ...
+static inline __m256i bitonic_step_2_i16_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xAA);
+}
+
+//////// [0,4] [1,5] [2,6] [3,7] ...
+static inline __m256i bitonic_step_4_i16_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xCC);
+}
+
+//////// [0,8] [1,9] ... [7,15]
+static inline __m256i bitonic_step_8_i16_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6] ...
+static inline __m256i bitonic_flip_4_i16_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                        6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xAA);
+}
+
+//////// [0,7] [1,6] [2,5] [3,4] ...
+static inline __m256i bitonic_flip_8_i16_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                        14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xCC);
+}
+
+//////// [0,15] [1,14] ... [7,8]
+static inline __m256i bitonic_flip_16_i16_avx2(const __m256i v)
+{
+  __m256i tmp = bitonic_reverse_i16_avx2(v);
+  return _mm256_blend_epi32(_mm256_min_epi16(v, tmp), _mm256_max_epi16(v, tmp), 0xF0);
+}
+
+// Sort 16 values in register
+static inline __m256i bitonic_sort_16_i16_avx2(__m256i v)
+{
+  v = bitonic_step_1_i16_avx2(v);
+  v = bitonic_flip_4_i16_avx2(v);
+  v = bitonic_step_1_i16_avx2(v);
+  v = bitonic_flip_8_i16_avx2(v);
+  v = bitonic_step_2_i16_avx2(v);
+  v = bitonic_step_1_i16_avx2(v);
+  v = bitonic_flip_16_i16_avx2(v);
+  v = bitonic_step_4_i16_avx2(v);
+  v = bitonic_step_2_i16_avx2(v);
+  return bitonic_step_1_i16_avx2(v);
+}
+
+// Sort 16 bitonic values in register
+static inline __m256i bitonic_clean_16_i16_avx2(__m256i v)
+{
+  v = bitonic_step_8_i16_avx2(v);
+  v = bitonic_step_4_i16_avx2(v);
+  v = bitonic_step_2_i16_avx2(v);
+  return bitonic_step_1_i16_avx2(v);
+}
+
+//
+static inline void bitonic_clean_32_i16_avx2(__m256i* r)
+{
+  bitonic_minmax_i16_avx2(r[0], r[1]);
+  r[0] = bitonic_clean_16_i16_avx2(r[0]);
+  r[1] = bitonic_clean_16_i16_avx2(r[1]);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_32_i16_avx2(__m256i* r)
+{
+  r[1] = bitonic_reverse_i16_avx2(r[1]);
+  bitonic_clean_32_i16_avx2(r);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_64_i16_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i16_avx2(r[3]);
+  __m256i b1 = bitonic_reverse_i16_avx2(r[2]);
+  r[2] = _mm256_max_epi16(r[0], b0);
+  r[3] = _mm256_max_epi16(r[1], b1);
+  r[0] = _mm256_min_epi16(r[0], b0);
+  r[1] = _mm256_min_epi16(r[1], b1);
+  bitonic_clean_32_i16_avx2(r);
+  bitonic_clean_32_i16_avx2(r + 2);
+}
+
+// Sort 32/64 values held in 2/4 registers
+static inline void bitonic_sort_32_i16_avx2(__m256i* r)
+{
+  r[0] = bitonic_sort_16_i16_avx2(r[0]);
+  r[1] = bitonic_sort_16_i16_avx2(r[1]);
+  bitonic_merge_32_i16_avx2(r);
+}
+
+static inline void bitonic_sort_64_i16_avx2(__m256i* r)
+{
+  bitonic_sort_32_i16_avx2(r);
+  bitonic_sort_32_i16_avx2(r + 2);
+  bitonic_merge_64_i16_avx2(r);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_BITONIC_I16_H
@@ -0,0 +1,314 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_I32_H
+#define NSORT_BITONIC_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// Bitonic building blocks for int32 networks (8 x int32 per __m256i)
+// Same min/max + blend/shuffle scheme as netsort_8_i32_avx2:
+// - step_d: compare lane i with lane i^d, max kept where (i & d)
+// - flip_s: compare lane i with lane i^(s-1) (mirror in blocks of s), max kept in upper half
+// A sorted run of N = k x 8 values is held in k registers (r[0] lowest).
+// Merging two sorted runs only reverses the second one: both halves of
+// the min/max result are then bitonic and cleaned independently.
+
+
+#ifdef HAS_AVX2_
+//
+static inline __m256i bitonic_reverse_i32_avx2(const __m256i v)
+{
+  return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+//
+static inline void bitonic_minmax_i32_avx2(__m256i& a, __m256i& b)
+{
+  __m256i min = _mm256_min_epi32(a, b);
+  b = _mm256_max_epi32(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7]
+static inline __m256i bitonic_step_1_i32_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm256_blend_epi32(_mm256_min_epi32(v, tmp), _mm256_max_epi32(v, tmp), 0xAA);
+}
+
+//////// [0,2] [1,3] [4,6] [5,7]
+static inline __m256i bitonic_step_2_i32_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm256_blend_epi32(_mm256_min_epi32(v, tmp), _mm256_max_epi32(v, tmp), 0xCC);
+}
+
+//////// [0,4] [1,5] [2,6] [3,7]
+static inline __m256i bitonic_step_4_i32_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_blend_epi32(_mm256_min_epi32(v, tmp), _mm256_max_epi32(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6]
+static inline __m256i bitonic_flip_4_i32_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(0,1,2,3));
+  return _mm256_blend_epi32(_mm256_min_epi32(v, tmp), _mm256_max_epi32(v, tmp), 0xCC);
+}
+
+//////// [0,7] [1,6] [2,5] [3,4]
+static inline __m256i bitonic_flip_8_i32_avx2(const __m256i v)
+{
+  __m256i tmp = bitonic_reverse_i32_avx2(v);
+  return _mm256_blend_epi32(_mm256_min_epi32(v, tmp), _mm256_max_epi32(v, tmp), 0xF0);
+}
+
+// Sort 8 values in register
+static inline __m256i bitonic_sort_8_i32_avx2(__m256i v)
+{
+  v = bitonic_step_1_i32_avx2(v);
+  v = bitonic_flip_4_i32_avx2(v);
+  v = bitonic_step_1_i32_avx2(v);
+  v = bitonic_flip_8_i32_avx2(v);
+  v = bitonic_step_2_i32_avx2(v);
+  return bitonic_step_1_i32_avx2(v);
+}
+
+// Sort 8 bitonic values in register
+static inline __m256i bitonic_clean_8_i32_avx2(__m256i v)
+{
+  v = bitonic_step_4_i32_avx2(v);
+  v = bitonic_step_2_i32_avx2(v);
+  return bitonic_step_1_i32_avx2(v);
+}
+
+//
+static inline void bitonic_clean_16_i32_avx2(__m256i* r)
+{
+  bitonic_minmax_i32_avx2(r[0], r[1]);
+  r[0] = bitonic_clean_8_i32_avx2(r[0]);
+  r[1] = bitonic_clean_8_i32_avx2(r[1]);
+}
+
+//
+static inline void bitonic_clean_32_i32_avx2(__m256i* r)
+{
+  bitonic_minmax_i32_avx2(r[0], r[2]);
+  bitonic_minmax_i32_avx2(r[1], r[3]);
+  bitonic_clean_16_i32_avx2(r);
+  bitonic_clean_16_i32_avx2(r + 2);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_16_i32_avx2(__m256i* r)
+{
+  r[1] = bitonic_reverse_i32_avx2(r[1]);
+  bitonic_clean_16_i32_avx2(r);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_32_i32_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i32_avx2(r[3]);
+  __m256i b1 = bitonic_reverse_i32_avx2(r[2]);
+  r[2] = _mm256_max_epi32(r[0], b0);
+  r[3] = _mm256_max_epi32(r[1], b1);
+  r[0] = _mm256_min_epi32(r[0], b0);
+  r[1] = _mm256_min_epi32(r[1], b1);
+  bitonic_clean_16_i32_avx2(r);
+  bitonic_clean_16_i32_avx2(r + 2);
+}
+
+// Merge 2 sorted runs: r[0..3] | r[4..7]
+static inline void bitonic_merge_64_i32_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i32_avx2(r[7]);
+  __m256i b1 = bitonic_reverse_i32_avx2(r[6]);
+  __m256i b2 = bitonic_reverse_i32_avx2(r[5]);
+  __m256i b3 = bitonic_reverse_i32_avx2(r[4]);
+  r[4] = _mm256_max_epi32(r[0], b0);
+  r[5] = _mm256_max_epi32(r[1], b1);
+  r[6] = _mm256_max_epi32(r[2], b2);
+  r[7] = _mm256_max_epi32(r[3], b3);
+  r[0] = _mm256_min_epi32(r[0], b0);
+  r[1] = _mm256_min_epi32(r[1], b1);
+  r[2] = _mm256_min_epi32(r[2], b2);
+  r[3] = _mm256_min_epi32(r[3], b3);
+  bitonic_clean_32_i32_avx2(r);
+  bitonic_clean_32_i32_avx2(r + 4);
+}
+
+// Sort 16/32/64 values held in 2/4/8 registers
+static inline void bitonic_sort_16_i32_avx2(__m256i* r)
+{
+  r[0] = bitonic_sort_8_i32_avx2(r[0]);
+  r[1] = bitonic_sort_8_i32_avx2(r[1]);
+  bitonic_merge_16_i32_avx2(r);
+}
+
+static inline void bitonic_sort_32_i32_avx2(__m256i* r)
+{
+  bitonic_sort_16_i32_avx2(r);
+  bitonic_sort_16_i32_avx2(r + 2);
+  bitonic_merge_32_i32_avx2(r);
+}
+
+static inline void bitonic_sort_64_i32_avx2(__m256i* r)
+{
+  bitonic_sort_32_i32_avx2(r);
+  bitonic_sort_32_i32_avx2(r + 4);
+  bitonic_merge_64_i32_avx2(r);
+}
+#endif // HAS_AVX2_
+
+
+#ifdef HAS_AVX512F_
+// AVX-512: 16 x int32 per __m512i, max kept with lane masks (same stages)
+//
+static inline __m512i bitonic_reverse_i32_avx512(const __m512i v)
+{
+  return _mm512_permutexvar_epi32(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+}
+
+//
+static inline void bitonic_minmax_i32_avx512(__m512i& a, __m512i& b)
+{
+  __m512i min = _mm512_min_epi32(a, b);
+  b = _mm512_max_epi32(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] ...
+static inline __m512i bitonic_step_1_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_shuffle_epi32(v, _MM_PERM_CDAB);
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xAAAA, _mm512_max_epi32(v, tmp));
+}
+
+//////// [0,2] [1,3] ...
+static inline __m512i bitonic_step_2_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_shuffle_epi32(v, _MM_PERM_BADC);
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xCCCC, _mm512_max_epi32(v, tmp));
+}
+
+//////// [0,4] [1,5] [2,6] [3,7] ...
+static inline __m512i bitonic_step_4_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_shuffle_i32x4(v, v, _MM_SHUFFLE(2,3,0,1));
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xF0F0, _mm512_max_epi32(v, tmp));
+}
+
+//////// [0,8] [1,9] ... [7,15]
+static inline __m512i bitonic_step_8_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_shuffle_i32x4(v, v, _MM_SHUFFLE(1,0,3,2));
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xFF00, _mm512_max_epi32(v, tmp));
+}
+
+// Sort 16 bitonic values in register
+static inline __m512i bitonic_clean_16_i32_avx512(__m512i v)
+{
+  v = bitonic_step_8_i32_avx512(v);
+  v = bitonic_step_4_i32_avx512(v);
+  v = bitonic_step_2_i32_avx512(v);
+  return bitonic_step_1_i32_avx512(v);
+}
+
+// Merge 2 sorted runs in register: v[0..7] | v[8..15]
+static inline __m512i bitonic_merge_16_i32_avx512(__m512i v)
+{
+  v = _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 15, 14, 13, 12, 11, 10, 9, 8), v);
+  return bitonic_clean_16_i32_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_32_i32_avx512(__m512i* r)
+{
+  r[1] = bitonic_reverse_i32_avx512(r[1]);
+  bitonic_minmax_i32_avx512(r[0], r[1]);
+  r[0] = bitonic_clean_16_i32_avx512(r[0]);
+  r[1] = bitonic_clean_16_i32_avx512(r[1]);
+}
+
+//////// [0,3] [1,2] ...
+static inline __m512i bitonic_flip_4_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_shuffle_epi32(v, _MM_PERM_ABCD);
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xCCCC, _mm512_max_epi32(v, tmp));
+}
+
+//////// [0,7] [1,6] [2,5] [3,4] ...
+static inline __m512i bitonic_flip_8_i32_avx512(const __m512i v)
+{
+  __m512i tmp = _mm512_permutexvar_epi32(_mm512_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8), v);
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xF0F0, _mm512_max_epi32(v, tmp));
+}
+
+//////// [0,15] [1,14] ... [7,8]
+static inline __m512i bitonic_flip_16_i32_avx512(const __m512i v)
+{
+  __m512i tmp = bitonic_reverse_i32_avx512(v);
+  return _mm512_mask_mov_epi32(_mm512_min_epi32(v, tmp), 0xFF00, _mm512_max_epi32(v, tmp));
+}
+
+// Sort 16 values in register
+static inline __m512i bitonic_sort_16_i32_avx512(__m512i v)
+{
+  v = bitonic_step_1_i32_avx512(v);
+  v = bitonic_flip_4_i32_avx512(v);
+  v = bitonic_step_1_i32_avx512(v);
+  v = bitonic_flip_8_i32_avx512(v);
+  v = bitonic_step_2_i32_avx512(v);
+  v = bitonic_step_1_i32_avx512(v);
+  v = bitonic_flip_16_i32_avx512(v);
+  v = bitonic_step_4_i32_avx512(v);
+  v = bitonic_step_2_i32_avx512(v);
+  return bitonic_step_1_i32_avx512(v);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_64_i32_avx512(__m512i* r)
+{
+  __m512i b0 = bitonic_reverse_i32_avx512(r[3]);
+  __m512i b1 = bitonic_reverse_i32_avx512(r[2]);
+  r[2] = _mm512_max_epi32(r[0], b0);
+  r[3] = _mm512_max_epi32(r[1], b1);
+  r[0] = _mm512_min_epi32(r[0], b0);
+  r[1] = _mm512_min_epi32(r[1], b1);
+  bitonic_minmax_i32_avx512(r[0], r[1]);
+  bitonic_minmax_i32_avx512(r[2], r[3]);
+  r[0] = bitonic_clean_16_i32_avx512(r[0]);
+  r[1] = bitonic_clean_16_i32_avx512(r[1]);
+  r[2] = bitonic_clean_16_i32_avx512(r[2]);
+  r[3] = bitonic_clean_16_i32_avx512(r[3]);
+}
+
+// Sort 32/64 values held in 2/4 registers
+static inline void bitonic_sort_32_i32_avx512(__m512i* r)
+{
+  r[0] = bitonic_sort_16_i32_avx512(r[0]);
+  r[1] = bitonic_sort_16_i32_avx512(r[1]);
+  bitonic_merge_32_i32_avx512(r);
+}
+
+static inline void bitonic_sort_64_i32_avx512(__m512i* r)
+{
+  bitonic_sort_32_i32_avx512(r);
+  bitonic_sort_32_i32_avx512(r + 2);
+  bitonic_merge_64_i32_avx512(r);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // NSORT_BITONIC_I32_H
@@ -0,0 +1,220 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_I64_H
+#define NSORT_BITONIC_I64_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512VL
+#endif
+
+// Bitonic building blocks for int64 networks (4 x int64 per __m256i)
+// Same scheme as nsort_bitonic_i32.h (step_d / flip_s stages, k registers per run)
+
+
+#ifdef HAS_AVX2_
+//
+static inline __m256i bitonic_min_i64_avx2(const __m256i a, const __m256i b)
+{
+#ifdef HAS_AVX512VL_
+  return _mm256_min_epi64(a, b);
+#else
+  return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+#endif
+}
+
+static inline __m256i bitonic_max_i64_avx2(const __m256i a, const __m256i b)
+{
+#ifdef HAS_AVX512VL_
+  return _mm256_max_epi64(a, b);
+#else
+  return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+#endif
+}
+
+//
+static inline __m256i bitonic_reverse_i64_avx2(const __m256i v)
+{
+  return _mm256_permute4x64_epi64(v, _MM_SHUFFLE(0,1,2,3));
+}
+
+//
+static inline void bitonic_minmax_i64_avx2(__m256i& a, __m256i& b)
+{
+  __m256i min = bitonic_min_i64_avx2(a, b);
+  b = bitonic_max_i64_avx2(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3]
+static inline __m256i bitonic_step_1_i64_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm256_blend_epi32(bitonic_min_i64_avx2(v, tmp), bitonic_max_i64_avx2(v, tmp), 0xCC);
+}
+
+//////// [0,2] [1,3]
+static inline __m256i bitonic_step_2_i64_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_blend_epi32(bitonic_min_i64_avx2(v, tmp), bitonic_max_i64_avx2(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2]
+static inline __m256i bitonic_flip_4_i64_avx2(const __m256i v)
+{
+  __m256i tmp = bitonic_reverse_i64_avx2(v);
+  return _mm256_blend_epi32(bitonic_min_i64_avx2(v, tmp), bitonic_max_i64_avx2(v, tmp), 0xF0);
+}
+
+// Sort 4 values in register
+static inline __m256i bitonic_sort_4_i64_avx2(__m256i v)
+{
+  v = bitonic_step_1_i64_avx2(v);
+  v = bitonic_flip_4_i64_avx2(v);
+  return bitonic_step_1_i64_avx2(v);
+}
+
+// Sort 4 bitonic values in register
+static inline __m256i bitonic_clean_4_i64_avx2(__m256i v)
+{
+  v = bitonic_step_2_i64_avx2(v);
+  return bitonic_step_1_i64_avx2(v);
+}
+
+//
+static inline void bitonic_clean_8_i64_avx2(__m256i* r)
+{
+  bitonic_minmax_i64_avx2(r[0], r[1]);
+  r[0] = bitonic_clean_4_i64_avx2(r[0]);
+  r[1] = bitonic_clean_4_i64_avx2(r[1]);
+}
+
+//
+static inline void bitonic_clean_16_i64_avx2(__m256i* r)
+{
+  bitonic_minmax_i64_avx2(r[0], r[2]);
+  bitonic_minmax_i64_avx2(r[1], r[3]);
+  bitonic_clean_8_i64_avx2(r);
+  bitonic_clean_8_i64_avx2(r + 2);
+}
+
+//
+static inline void bitonic_clean_32_i64_avx2(__m256i* r)
+{
+  bitonic_minmax_i64_avx2(r[0], r[4]);
+  bitonic_minmax_i64_avx2(r[1], r[5]);
+  bitonic_minmax_i64_avx2(r[2], r[6]);
+  bitonic_minmax_i64_avx2(r[3], r[7]);
+  bitonic_clean_16_i64_avx2(r);
+  bitonic_clean_16_i64_avx2(r + 4);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_8_i64_avx2(__m256i* r)
+{
+  r[1] = bitonic_reverse_i64_avx2(r[1]);
+  bitonic_clean_8_i64_avx2(r);
+}
+
+// Merge 2 sorted runs: r[0..1] | r[2..3]
+static inline void bitonic_merge_16_i64_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i64_avx2(r[3]);
+  __m256i b1 = bitonic_reverse_i64_avx2(r[2]);
+  r[2] = bitonic_max_i64_avx2(r[0], b0);
+  r[3] = bitonic_max_i64_avx2(r[1], b1);
+  r[0] = bitonic_min_i64_avx2(r[0], b0);
+  r[1] = bitonic_min_i64_avx2(r[1], b1);
+  bitonic_clean_8_i64_avx2(r);
+  bitonic_clean_8_i64_avx2(r + 2);
+}
+
+// Merge 2 sorted runs: r[0..3] | r[4..7]
+static inline void bitonic_merge_32_i64_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i64_avx2(r[7]);
+  __m256i b1 = bitonic_reverse_i64_avx2(r[6]);
+  __m256i b2 = bitonic_reverse_i64_avx2(r[5]);
+  __m256i b3 = bitonic_reverse_i64_avx2(r[4]);
+  r[4] = bitonic_max_i64_avx2(r[0], b0);
+  r[5] = bitonic_max_i64_avx2(r[1], b1);
+  r[6] = bitonic_max_i64_avx2(r[2], b2);
+  r[7] = bitonic_max_i64_avx2(r[3], b3);
+  r[0] = bitonic_min_i64_avx2(r[0], b0);
+  r[1] = bitonic_min_i64_avx2(r[1], b1);
+  r[2] = bitonic_min_i64_avx2(r[2], b2);
+  r[3] = bitonic_min_i64_avx2(r[3], b3);
+  bitonic_clean_16_i64_avx2(r);
+  bitonic_clean_16_i64_avx2(r + 4);
+}
+
+// Merge 2 sorted runs: r[0..7] | r[8..15]
+static inline void bitonic_merge_64_i64_avx2(__m256i* r)
+{
+  __m256i b0 = bitonic_reverse_i64_avx2(r[15]);
+  __m256i b1 = bitonic_reverse_i64_avx2(r[14]);
+  __m256i b2 = bitonic_reverse_i64_avx2(r[13]);
+  __m256i b3 = bitonic_reverse_i64_avx2(r[12]);
+  __m256i b4 = bitonic_reverse_i64_avx2(r[11]);
+  __m256i b5 = bitonic_reverse_i64_avx2(r[10]);
+  __m256i b6 = bitonic_reverse_i64_avx2(r[9]);
+  __m256i b7 = bitonic_reverse_i64_avx2(r[8]);
+  r[8] = bitonic_max_i64_avx2(r[0], b0);
+  r[9] = bitonic_max_i64_avx2(r[1], b1);
+  r[10] = bitonic_max_i64_avx2(r[2], b2);
+  r[11] = bitonic_max_i64_avx2(r[3], b3);
+  r[12] = bitonic_max_i64_avx2(r[4], b4);
+  r[13] = bitonic_max_i64_avx2(r[5], b5);
+  r[14] = bitonic_max_i64_avx2(r[6], b6);
+  r[15] = bitonic_max_i64_avx2(r[7], b7);
+  r[0] = bitonic_min_i64_avx2(r[0], b0);
+  r[1] = bitonic_min_i64_avx2(r[1], b1);
+  r[2] = bitonic_min_i64_avx2(r[2], b2);
+  r[3] = bitonic_min_i64_avx2(r[3], b3);
+  r[4] = bitonic_min_i64_avx2(r[4], b4);
+  r[5] = bitonic_min_i64_avx2(r[5], b5);
+  r[6] = bitonic_min_i64_avx2(r[6], b6);
+  r[7] = bitonic_min_i64_avx2(r[7], b7);
+  bitonic_clean_32_i64_avx2(r);
+  bitonic_clean_32_i64_avx2(r + 8);
+}
+
+// Sort 8/16/32/64 values held in 2/4/8/16 registers
+static inline void bitonic_sort_8_i64_avx2(__m256i* r)
+{
+  r[0] = bitonic_sort_4_i64_avx2(r[0]);
+  r[1] = bitonic_sort_4_i64_avx2(r[1]);
+  bitonic_merge_8_i64_avx2(r);
+}
+
+static inline void bitonic_sort_16_i64_avx2(__m256i* r)
+{
+  bitonic_sort_8_i64_avx2(r);
+  bitonic_sort_8_i64_avx2(r + 2);
+  bitonic_merge_16_i64_avx2(r);
+}
+
+static inline void bitonic_sort_32_i64_avx2(__m256i* r)
+{
+  bitonic_sort_16_i64_avx2(r);
+  bitonic_sort_16_i64_avx2(r + 4);
+  bitonic_merge_32_i64_avx2(r);
+}
+
+static inline void bitonic_sort_64_i64_avx2(__m256i* r)
+{
+  bitonic_sort_32_i64_avx2(r);
+  bitonic_sort_32_i64_avx2(r + 8);
+  bitonic_merge_64_i64_avx2(r);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_BITONIC_I64_H
@@ -0,0 +1,246 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_BITONIC_I8_H
+#define NSORT_BITONIC_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "Utils/simd_utils.h"
+
+#include <stdint.h>
+#include <emmintrin.h>    // SSE2
+#ifdef HAS_SSE4_1_
+  #include <smmintrin.h>  // SSE4.1
+#endif
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Bitonic building blocks for int8 networks (16 x int8 per __m128i, 32 x int8 per __m256i)
+// Same scheme as nsort_bitonic_i32.h (step_d / flip_s stages, k registers per run)
+// In-lane partners use pshufb / pshufd, lane 16 partners a 128-bit lane swap.
+// Odd bytes (step 1) need a variable blend, other masks map to blendw/blendd.
+
+
+#ifdef HAS_SSE4_1_
+//////// [0,1] [2,3] [4,5] [6,7] ...
+static inline __m128i bitonic_step_1_i8_sse(const __m128i v)
+{
+  const __m128i shfl = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m128i mask = _mm_set1_epi16((short)0xFF00);
+  __m128i tmp = _mm_shuffle_epi8(v, shfl);
+  return _mm_blendv_epi8(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), mask);
+}
+
+//////// [0,2] [1,3] [4,6] [5,7] ...
+static inline __m128i bitonic_step_2_i8_sse(const __m128i v)
+{
+  const __m128i shfl = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  __m128i tmp = _mm_shuffle_epi8(v, shfl);
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,4] [1,5] [2,6] [3,7] ...
+static inline __m128i bitonic_step_4_i8_sse(const __m128i v)
+{
+  __m128i tmp = _mm_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xCC);
+}
+
+//////// [0,8] [1,9] ... [7,15]
+static inline __m128i bitonic_step_8_i8_sse(const __m128i v)
+{
+  __m128i tmp = _mm_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6] ...
+static inline __m128i bitonic_flip_4_i8_sse(const __m128i v)
+{
+  const __m128i shfl = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  __m128i tmp = _mm_shuffle_epi8(v, shfl);
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,7] [1,6] [2,5] [3,4] ...
+static inline __m128i bitonic_flip_8_i8_sse(const __m128i v)
+{
+  const __m128i shfl = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  __m128i tmp = _mm_shuffle_epi8(v, shfl);
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xCC);
+}
+
+//////// [0,15] [1,14] ... [7,8]
+static inline __m128i bitonic_flip_16_i8_sse(const __m128i v)
+{
+  const __m128i shfl = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m128i tmp = _mm_shuffle_epi8(v, shfl);
+  return _mm_blend_epi16(_mm_min_epi8(v, tmp), _mm_max_epi8(v, tmp), 0xF0);
+}
+
+// Sort 16 values in register
+static inline __m128i bitonic_sort_16_i8_sse(__m128i v)
+{
+  v = bitonic_step_1_i8_sse(v);
+  v = bitonic_flip_4_i8_sse(v);
+  v = bitonic_step_1_i8_sse(v);
+  v = bitonic_flip_8_i8_sse(v);
+  v = bitonic_step_2_i8_sse(v);
+  v = bitonic_step_1_i8_sse(v);
+  v = bitonic_flip_16_i8_sse(v);
+  v = bitonic_step_4_i8_sse(v);
+  v = bitonic_step_2_i8_sse(v);
+  return bitonic_step_1_i8_sse(v);
+}
+#endif // HAS_SSE4_1_
+
+//
+#ifdef HAS_AVX2_
+static inline __m256i bitonic_reverse_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_shuffle_epi8(tmp, shfl);
+}
+
+//
+static inline void bitonic_minmax_i8_avx2(__m256i& a, __m256i& b)
+{
+  __m256i min = _mm256_min_epi8(a, b);
+  b = _mm256_max_epi8(a, b);
+  a = min;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7] ...
+static inline __m256i bitonic_step_1_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m256i mask = _mm256_set1_epi16((short)0xFF00);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blendv_epi8(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), mask);
+}
+
+//////// [0,2] [1,3] [4,6] [5,7] ...
+static inline __m256i bitonic_step_2_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi16(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,4] [1,5] [2,6] [3,7] ...
+static inline __m256i bitonic_step_4_i8_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1));
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,8] [1,9] ... [7,15]
+static inline __m256i bitonic_step_8_i8_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2));
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xCC);
+}
+
+//////// [0,16] [1,17] ... [15,31]
+static inline __m256i bitonic_step_16_i8_avx2(const __m256i v)
+{
+  __m256i tmp = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1,0,3,2)); // inter-lane
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xF0);
+}
+
+//////// [0,3] [1,2] [4,7] [5,6] ...
+static inline __m256i bitonic_flip_4_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi16(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,7] [1,6] [2,5] [3,4] ...
+static inline __m256i bitonic_flip_8_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xAA);
+}
+
+//////// [0,15] [1,14] ... [7,8]
+static inline __m256i bitonic_flip_16_i8_avx2(const __m256i v)
+{
+  const __m256i shfl = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i tmp = _mm256_shuffle_epi8(v, shfl);
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xCC);
+}
+
+//////// [0,31] [1,30] ... [15,16]
+static inline __m256i bitonic_flip_32_i8_avx2(const __m256i v)
+{
+  __m256i tmp = bitonic_reverse_i8_avx2(v);
+  return _mm256_blend_epi32(_mm256_min_epi8(v, tmp), _mm256_max_epi8(v, tmp), 0xF0);
+}
+
+// Sort 32 values in register
+static inline __m256i bitonic_sort_32_i8_avx2(__m256i v)
+{
+  v = bitonic_step_1_i8_avx2(v);
+  v = bitonic_flip_4_i8_avx2(v);
+  v = bitonic_step_1_i8_avx2(v);
+  v = bitonic_flip_8_i8_avx2(v);
+  v = bitonic_step_2_i8_avx2(v);
+  v = bitonic_step_1_i8_avx2(v);
+  v = bitonic_flip_16_i8_avx2(v);
+  v = bitonic_step_4_i8_avx2(v);
+  v = bitonic_step_2_i8_avx2(v);
+  v = bitonic_step_1_i8_avx2(v);
+  v = bitonic_flip_32_i8_avx2(v);
+  v = bitonic_step_8_i8_avx2(v);
+  v = bitonic_step_4_i8_avx2(v);
+  v = bitonic_step_2_i8_avx2(v);
+  return bitonic_step_1_i8_avx2(v);
+}
+
+// Sort 32 bitonic values in register
+static inline __m256i bitonic_clean_32_i8_avx2(__m256i v)
+{
+  v = bitonic_step_16_i8_avx2(v);
+  v = bitonic_step_8_i8_avx2(v);
+  v = bitonic_step_4_i8_avx2(v);
+  v = bitonic_step_2_i8_avx2(v);
+  return bitonic_step_1_i8_avx2(v);
+}
+
+//
+static inline void bitonic_clean_64_i8_avx2(__m256i* r)
+{
+  bitonic_minmax_i8_avx2(r[0], r[1]);
+  r[0] = bitonic_clean_32_i8_avx2(r[0]);
+  r[1] = bitonic_clean_32_i8_avx2(r[1]);
+}
+
+// Merge 2 sorted runs: r[0] | r[1]
+static inline void bitonic_merge_64_i8_avx2(__m256i* r)
+{
+  r[1] = bitonic_reverse_i8_avx2(r[1]);
+  bitonic_clean_64_i8_avx2(r);
+}
+
+// Sort 64 values held in 2 registers
+static inline void bitonic_sort_64_i8_avx2(__m256i* r)
+{
+  r[0] = bitonic_sort_32_i8_avx2(r[0]);
+  r[1] = bitonic_sort_32_i8_avx2(r[1]);
+  bitonic_merge_64_i8_avx2(r);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_BITONIC_I8_H
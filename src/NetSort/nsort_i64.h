@@ -0,0 +1,103 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_I64_H
+#define NSORT_I64_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i64.h"
+#include "nsort_small_i64.h"  // cmpfunc_i64
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// int64 networks (4 x int64 per __m256i): vpminsq/vpmaxsq with AVX-512VL,
+// compare + blend emulation otherwise (see bitonic_min_i64_avx2)
+
+//
+static inline void netsort_8_i64_qsort(int64_t* __restrict v)
+{
+  qsort(v, 8, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+static inline void netsort_16_i64_qsort(int64_t* __restrict v)
+{
+  qsort(v, 16, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+static inline void netsort_32_i64_qsort(int64_t* __restrict v)
+{
+  qsort(v, 32, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+static inline void netsort_64_i64_qsort(int64_t* __restrict v)
+{
+  qsort(v, 64, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+#ifdef HAS_AVX2_
+static inline void netsort_8_i64_avx2(int64_t* __restrict v)
+{
+  __m256i r[2];
+  r[0] = _mm256_loadu_si256((__m256i const*)(v));
+  r[1] = _mm256_loadu_si256((__m256i const*)(v + 4));
+
+  bitonic_sort_8_i64_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), r[0]);
+  _mm256_storeu_si256((__m256i*)(v + 4), r[1]);
+}
+
+static inline void netsort_16_i64_avx2(int64_t* __restrict v)
+{
+  __m256i r[4];
+  r[0] = _mm256_loadu_si256((__m256i const*)(v));
+  r[1] = _mm256_loadu_si256((__m256i const*)(v + 4));
+  r[2] = _mm256_loadu_si256((__m256i const*)(v + 8));
+  r[3] = _mm256_loadu_si256((__m256i const*)(v + 12));
+
+  bitonic_sort_16_i64_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), r[0]);
+  _mm256_storeu_si256((__m256i*)(v + 4), r[1]);
+  _mm256_storeu_si256((__m256i*)(v + 8), r[2]);
+  _mm256_storeu_si256((__m256i*)(v + 12), r[3]);
+}
+
+static inline void netsort_32_i64_avx2(int64_t* __restrict v)
+{
+  __m256i r[8];
+  for (size_t i=0; i<8; ++i)
+    r[i] = _mm256_loadu_si256((__m256i const*)(v + 4*i));
+
+  bitonic_sort_32_i64_avx2(r);
+
+  for (size_t i=0; i<8; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), r[i]);
+}
+
+static inline void netsort_64_i64_avx2(int64_t* __restrict v)
+{
+  __m256i r[16];
+  for (size_t i=0; i<16; ++i)
+    r[i] = _mm256_loadu_si256((__m256i const*)(v + 4*i));
+
+  bitonic_sort_64_i64_avx2(r);
+
+  for (size_t i=0; i<16; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), r[i]);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_I64_H
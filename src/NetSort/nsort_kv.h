@@ -0,0 +1,63 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_KV_H
+#define NSORT_KV_H
+
+#include "Utils/compiler_utils.h"
+
+#include "nsort_kv_i32.h"
+#include "nsort_kv_i64.h"
+#include "nsort_kv_flt.h"
+#include "nsort_kv_dbl.h"
+
+#include <stdint.h>
+
+// Argsort n keys: networks for n <= 16 (AVX2), reference 'std::sort' otherwise
+
+
+//
+static inline void netsort_argsort(const int32_t* __restrict k, int32_t* __restrict idx, size_t n)
+{
+#ifdef HAS_AVX2_
+  if (n <= 16)
+    netsort_argsort_i32_avx2(k, idx, n);
+  else
+#endif
+    netsort_argsort_i32_std(k, idx, n);
+}
+
+static inline void netsort_argsort(const float* __restrict k, int32_t* __restrict idx, size_t n)
+{
+#ifdef HAS_AVX2_
+  if (n <= 16)
+    netsort_argsort_flt_avx2(k, idx, n);
+  else
+#endif
+    netsort_argsort_flt_std(k, idx, n);
+}
+
+static inline void netsort_argsort(const int64_t* __restrict k, int64_t* __restrict idx, size_t n)
+{
+#ifdef HAS_AVX2_
+  if (n <= 16)
+    netsort_argsort_i64_avx2(k, idx, n);
+  else
+#endif
+    netsort_argsort_i64_std(k, idx, n);
+}
+
+static inline void netsort_argsort(const double* __restrict k, int64_t* __restrict idx, size_t n)
+{
+#ifdef HAS_AVX2_
+  if (n <= 16)
+    netsort_argsort_dbl_avx2(k, idx, n);
+  else
+#endif
+    netsort_argsort_dbl_std(k, idx, n);
+}
+
+
+#endif // NSORT_KV_H
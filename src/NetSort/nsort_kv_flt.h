@@ -0,0 +1,230 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_KV_FLT_H
+#define NSORT_KV_FLT_H
+
+#include "Utils/compiler_utils.h"
+
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+#include <utility>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Key-value networks: 8/16 float keys, each carrying an int32 payload
+// Same scheme as nsort_kv_i32.h (NaN keys are not supported)
+
+
+// Reference: sort n <= 16 (key, payload) pairs
+static inline void netsort_kv_flt_std(float* __restrict k, int32_t* __restrict p, size_t n)
+{
+  std::pair<float, int32_t> kv[16];
+  for (size_t i=0; i<n; ++i)
+    kv[i] = std::make_pair(k[i], p[i]);
+  std::sort(kv, kv + n, [](const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) { return a.first < b.first; });
+  for (size_t i=0; i<n; ++i)
+  {
+    k[i] = kv[i].first;
+    p[i] = kv[i].second;
+  }
+}
+
+// Reference argsort (any n)
+static inline void netsort_argsort_flt_std(const float* __restrict k, int32_t* __restrict idx, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    idx[i] = (int32_t)i;
+  std::sort(idx, idx + n, [k](const int32_t a, const int32_t b) { return k[a] < k[b]; });
+}
+
+//
+#ifdef HAS_AVX2_
+// Vertical compare-exchange: a <= b
+static inline void bitonic_kv_minmax_flt_avx2(__m256& a, __m256i& pa, __m256& b, __m256i& pb)
+{
+  __m256 min = _mm256_min_ps(a, b);
+  __m256 max = _mm256_max_ps(b, a);
+  __m256i keep = _mm256_cmpeq_epi32(_mm256_castps_si256(min), _mm256_castps_si256(a));
+  __m256i tpa = pa;
+  pa = _mm256_blendv_epi8(pb, pa, keep);
+  pb = _mm256_blendv_epi8(tpa, pb, keep);
+  a = min;
+  b = max;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7]
+static inline void bitonic_kv_step_1_flt_avx2(__m256& k, __m256i& p)
+{
+  __m256 tk = _mm256_permute_ps(k, _MM_SHUFFLE(2,3,0,1));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(2,3,0,1));
+  __m256 nk = _mm256_blend_ps(_mm256_min_ps(k, tk), _mm256_max_ps(k, tk), 0xAA);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(_mm256_castps_si256(nk), _mm256_castps_si256(k)));
+  k = nk;
+}
+
+//////// [0,2] [1,3] [4,6] [5,7]
+static inline void bitonic_kv_step_2_flt_avx2(__m256& k, __m256i& p)
+{
+  __m256 tk = _mm256_permute_ps(k, _MM_SHUFFLE(1,0,3,2));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(1,0,3,2));
+  __m256 nk = _mm256_blend_ps(_mm256_min_ps(k, tk), _mm256_max_ps(k, tk), 0xCC);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(_mm256_castps_si256(nk), _mm256_castps_si256(k)));
+  k = nk;
+}
+
+//////// [0,4] [1,5] [2,6] [3,7]
+static inline void bitonic_kv_step_4_flt_avx2(__m256& k, __m256i& p)
+{
+  __m256 tk = _mm256_permute2f128_ps(k, k, 1);
+  __m256i tp = _mm256_permute4x64_epi64(p, _MM_SHUFFLE(1,0,3,2));
+  __m256 nk = _mm256_blend_ps(_mm256_min_ps(k, tk), _mm256_max_ps(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(_mm256_castps_si256(nk), _mm256_castps_si256(k)));
+  k = nk;
+}
+
+//////// [0,3] [1,2] [4,7] [5,6]
+static inline void bitonic_kv_flip_4_flt_avx2(__m256& k, __m256i& p)
+{
+  __m256 tk = _mm256_permute_ps(k, _MM_SHUFFLE(0,1,2,3));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(0,1,2,3));
+  __m256 nk = _mm256_blend_ps(_mm256_min_ps(k, tk), _mm256_max_ps(k, tk), 0xCC);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(_mm256_castps_si256(nk), _mm256_castps_si256(k)));
+  k = nk;
+}
+
+//////// [0,7] [1,6] [2,5] [3,4]
+static inline void bitonic_kv_flip_8_flt_avx2(__m256& k, __m256i& p)
+{
+  __m256 tk = _mm256_permutevar8x32_ps(k, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  __m256i tp = _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  __m256 nk = _mm256_blend_ps(_mm256_min_ps(k, tk), _mm256_max_ps(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(_mm256_castps_si256(nk), _mm256_castps_si256(k)));
+  k = nk;
+}
+
+// Sort 8 pairs in register
+static inline void bitonic_kv_sort_8_flt_avx2(__m256& k, __m256i& p)
+{
+  bitonic_kv_step_1_flt_avx2(k, p);
+  bitonic_kv_flip_4_flt_avx2(k, p);
+  bitonic_kv_step_1_flt_avx2(k, p);
+  bitonic_kv_flip_8_flt_avx2(k, p);
+  bitonic_kv_step_2_flt_avx2(k, p);
+  bitonic_kv_step_1_flt_avx2(k, p);
+}
+
+// Sort 8 bitonic pairs in register
+static inline void bitonic_kv_clean_8_flt_avx2(__m256& k, __m256i& p)
+{
+  bitonic_kv_step_4_flt_avx2(k, p);
+  bitonic_kv_step_2_flt_avx2(k, p);
+  bitonic_kv_step_1_flt_avx2(k, p);
+}
+
+// Sort 16 pairs in 2 registers
+static inline void bitonic_kv_sort_16_flt_avx2(__m256* k, __m256i* p)
+{
+  bitonic_kv_sort_8_flt_avx2(k[0], p[0]);
+  bitonic_kv_sort_8_flt_avx2(k[1], p[1]);
+  k[1] = _mm256_permutevar8x32_ps(k[1], _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  p[1] = _mm256_permutevar8x32_epi32(p[1], _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  bitonic_kv_minmax_flt_avx2(k[0], p[0], k[1], p[1]);
+  bitonic_kv_clean_8_flt_avx2(k[0], p[0]);
+  bitonic_kv_clean_8_flt_avx2(k[1], p[1]);
+}
+
+// Sort 8 keys k[] and their payload p[]
+static inline void netsort_kv_8_flt_avx2(float* __restrict k, int32_t* __restrict p)
+{
+  __m256 r = _mm256_loadu_ps(k);
+  __m256i q = _mm256_loadu_si256((__m256i const*)(p));
+
+  bitonic_kv_sort_8_flt_avx2(r, q);
+
+  _mm256_storeu_ps(k, r);
+  _mm256_storeu_si256((__m256i*)(p), q);
+}
+
+// Sort 16 keys k[] and their payload p[]
+static inline void netsort_kv_16_flt_avx2(float* __restrict k, int32_t* __restrict p)
+{
+  __m256 r[2];
+  __m256i q[2];
+  r[0] = _mm256_loadu_ps(k);
+  r[1] = _mm256_loadu_ps(k + 8);
+  q[0] = _mm256_loadu_si256((__m256i const*)(p));
+  q[1] = _mm256_loadu_si256((__m256i const*)(p + 8));
+
+  bitonic_kv_sort_16_flt_avx2(r, q);
+
+  _mm256_storeu_ps(k, r[0]);
+  _mm256_storeu_ps(k + 8, r[1]);
+  _mm256_storeu_si256((__m256i*)(p), q[0]);
+  _mm256_storeu_si256((__m256i*)(p + 8), q[1]);
+}
+
+// Argsort n <= 16 keys: idx[i] is the index of the i-th smallest key
+static inline void netsort_argsort_flt_avx2(const float* __restrict k, int32_t* __restrict idx, size_t n)
+{
+  static const int32_t iota[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+  const size_t m = (n <= 8) ? 1 : 2;  // registers
+  const float* src = k;
+  float kb[16];
+  int32_t ib[16];
+  __m256 r[2];
+  __m256i q[2];
+
+  // Full networks read keys in place, other sizes through a padded copy
+  if (n != 8*m)
+  {
+    std::copy(k, k + n, kb);
+    for (size_t i=n; i<16; ++i)
+      kb[i] = INFINITY;
+    src = kb;
+  }
+  for (size_t i=0; i<m; ++i)
+  {
+    r[i] = _mm256_loadu_ps(src + 8*i);
+    q[i] = _mm256_loadu_si256((__m256i const*)(iota + 8*i));
+  }
+
+  // Sort (smallest network that fits)
+  if (m == 1)
+    bitonic_kv_sort_8_flt_avx2(r[0], q[0]);
+  else
+    bitonic_kv_sort_16_flt_avx2(r, q);
+
+  // Store
+  if (n == 8*m)
+  {
+    for (size_t i=0; i<m; ++i)
+      _mm256_storeu_si256((__m256i*)(idx + 8*i), q[i]);
+    return;
+  }
+  for (size_t i=0; i<m; ++i)
+  {
+    _mm256_storeu_ps(kb + 8*i, r[i]);
+    _mm256_storeu_si256((__m256i*)(ib + 8*i), q[i]);
+  }
+
+  // Padding tied with actual keys: keep indices < n only
+  if (n && kb[n-1] == INFINITY)
+  {
+    size_t j = n - 1;
+    while (j > 0 && kb[j-1] == INFINITY)
+      --j;
+    for (size_t i=j; i<8*m; ++i)
+      if (ib[i] < (int32_t)n)
+        ib[j++] = ib[i];
+  }
+  std::copy(ib, ib + n, idx);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_KV_FLT_H
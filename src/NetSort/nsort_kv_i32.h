@@ -0,0 +1,233 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_KV_I32_H
+#define NSORT_KV_I32_H
+
+#include "Utils/compiler_utils.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <utility>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Key-value networks: 8/16 int32 keys, each carrying an int32 payload (e.g. row id)
+// Keys go through the same min/max + blend stages as nsort_bitonic_i32.h, a
+// lane whose key changed takes its partner payload (bitwise compare, blendv).
+// Equal keys are not ordered by payload (not stable).
+// Argsort: keys are sorted along with their index, padding keys (INT32_MAX)
+// carry indices >= n that are filtered out if they tie with actual keys.
+
+
+// Reference: sort n <= 16 (key, payload) pairs
+static inline void netsort_kv_i32_std(int32_t* __restrict k, int32_t* __restrict p, size_t n)
+{
+  std::pair<int32_t, int32_t> kv[16];
+  for (size_t i=0; i<n; ++i)
+    kv[i] = std::make_pair(k[i], p[i]);
+  std::sort(kv, kv + n, [](const std::pair<int32_t, int32_t>& a, const std::pair<int32_t, int32_t>& b) { return a.first < b.first; });
+  for (size_t i=0; i<n; ++i)
+  {
+    k[i] = kv[i].first;
+    p[i] = kv[i].second;
+  }
+}
+
+// Reference argsort (any n)
+static inline void netsort_argsort_i32_std(const int32_t* __restrict k, int32_t* __restrict idx, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    idx[i] = (int32_t)i;
+  std::sort(idx, idx + n, [k](const int32_t a, const int32_t b) { return k[a] < k[b]; });
+}
+
+//
+#ifdef HAS_AVX2_
+// Vertical compare-exchange: a <= b
+static inline void bitonic_kv_minmax_i32_avx2(__m256i& a, __m256i& pa, __m256i& b, __m256i& pb)
+{
+  __m256i min = _mm256_min_epi32(a, b);
+  __m256i max = _mm256_max_epi32(b, a);
+  __m256i keep = _mm256_cmpeq_epi32(min, a);
+  __m256i tpa = pa;
+  pa = _mm256_blendv_epi8(pb, pa, keep);
+  pb = _mm256_blendv_epi8(tpa, pb, keep);
+  a = min;
+  b = max;
+}
+
+//////// [0,1] [2,3] [4,5] [6,7]
+static inline void bitonic_kv_step_1_i32_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_shuffle_epi32(k, _MM_SHUFFLE(2,3,0,1));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(2,3,0,1));
+  __m256i nk = _mm256_blend_epi32(_mm256_min_epi32(k, tk), _mm256_max_epi32(k, tk), 0xAA);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(nk, k));
+  k = nk;
+}
+
+//////// [0,2] [1,3] [4,6] [5,7]
+static inline void bitonic_kv_step_2_i32_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_shuffle_epi32(k, _MM_SHUFFLE(1,0,3,2));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(1,0,3,2));
+  __m256i nk = _mm256_blend_epi32(_mm256_min_epi32(k, tk), _mm256_max_epi32(k, tk), 0xCC);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(nk, k));
+  k = nk;
+}
+
+//////// [0,4] [1,5] [2,6] [3,7]
+static inline void bitonic_kv_step_4_i32_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_permute4x64_epi64(k, _MM_SHUFFLE(1,0,3,2));
+  __m256i tp = _mm256_permute4x64_epi64(p, _MM_SHUFFLE(1,0,3,2));
+  __m256i nk = _mm256_blend_epi32(_mm256_min_epi32(k, tk), _mm256_max_epi32(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(nk, k));
+  k = nk;
+}
+
+//////// [0,3] [1,2] [4,7] [5,6]
+static inline void bitonic_kv_flip_4_i32_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_shuffle_epi32(k, _MM_SHUFFLE(0,1,2,3));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(0,1,2,3));
+  __m256i nk = _mm256_blend_epi32(_mm256_min_epi32(k, tk), _mm256_max_epi32(k, tk), 0xCC);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(nk, k));
+  k = nk;
+}
+
+//////// [0,7] [1,6] [2,5] [3,4]
+static inline void bitonic_kv_flip_8_i32_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_permutevar8x32_epi32(k, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  __m256i tp = _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  __m256i nk = _mm256_blend_epi32(_mm256_min_epi32(k, tk), _mm256_max_epi32(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi32(nk, k));
+  k = nk;
+}
+
+// Sort 8 pairs in register
+static inline void bitonic_kv_sort_8_i32_avx2(__m256i& k, __m256i& p)
+{
+  bitonic_kv_step_1_i32_avx2(k, p);
+  bitonic_kv_flip_4_i32_avx2(k, p);
+  bitonic_kv_step_1_i32_avx2(k, p);
+  bitonic_kv_flip_8_i32_avx2(k, p);
+  bitonic_kv_step_2_i32_avx2(k, p);
+  bitonic_kv_step_1_i32_avx2(k, p);
+}
+
+// Sort 8 bitonic pairs in register
+static inline void bitonic_kv_clean_8_i32_avx2(__m256i& k, __m256i& p)
+{
+  bitonic_kv_step_4_i32_avx2(k, p);
+  bitonic_kv_step_2_i32_avx2(k, p);
+  bitonic_kv_step_1_i32_avx2(k, p);
+}
+
+// Sort 16 pairs in 2 registers
+static inline void bitonic_kv_sort_16_i32_avx2(__m256i* k, __m256i* p)
+{
+  bitonic_kv_sort_8_i32_avx2(k[0], p[0]);
+  bitonic_kv_sort_8_i32_avx2(k[1], p[1]);
+  k[1] = _mm256_permutevar8x32_epi32(k[1], _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  p[1] = _mm256_permutevar8x32_epi32(p[1], _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  bitonic_kv_minmax_i32_avx2(k[0], p[0], k[1], p[1]);
+  bitonic_kv_clean_8_i32_avx2(k[0], p[0]);
+  bitonic_kv_clean_8_i32_avx2(k[1], p[1]);
+}
+
+// Sort 8 keys k[] and their payload p[]
+static inline void netsort_kv_8_i32_avx2(int32_t* __restrict k, int32_t* __restrict p)
+{
+  __m256i r = _mm256_loadu_si256((__m256i const*)(k));
+  __m256i q = _mm256_loadu_si256((__m256i const*)(p));
+
+  bitonic_kv_sort_8_i32_avx2(r, q);
+
+  _mm256_storeu_si256((__m256i*)(k), r);
+  _mm256_storeu_si256((__m256i*)(p), q);
+}
+
+// Sort 16 keys k[] and their payload p[]
+static inline void netsort_kv_16_i32_avx2(int32_t* __restrict k, int32_t* __restrict p)
+{
+  __m256i r[2];
+  __m256i q[2];
+  r[0] = _mm256_loadu_si256((__m256i const*)(k));
+  r[1] = _mm256_loadu_si256((__m256i const*)(k + 8));
+  q[0] = _mm256_loadu_si256((__m256i const*)(p));
+  q[1] = _mm256_loadu_si256((__m256i const*)(p + 8));
+
+  bitonic_kv_sort_16_i32_avx2(r, q);
+
+  _mm256_storeu_si256((__m256i*)(k), r[0]);
+  _mm256_storeu_si256((__m256i*)(k + 8), r[1]);
+  _mm256_storeu_si256((__m256i*)(p), q[0]);
+  _mm256_storeu_si256((__m256i*)(p + 8), q[1]);
+}
+
+// Argsort n <= 16 keys: idx[i] is the index of the i-th smallest key
+static inline void netsort_argsort_i32_avx2(const int32_t* __restrict k, int32_t* __restrict idx, size_t n)
+{
+  static const int32_t iota[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+  const size_t m = (n <= 8) ? 1 : 2;  // registers
+  const int32_t* src = k;
+  int32_t kb[16];
+  int32_t ib[16];
+  __m256i r[2];
+  __m256i q[2];
+
+  // Full networks read keys in place, other sizes through a padded copy
+  if (n != 8*m)
+  {
+    std::copy(k, k + n, kb);
+    for (size_t i=n; i<16; ++i)
+      kb[i] = INT32_MAX;
+    src = kb;
+  }
+  for (size_t i=0; i<m; ++i)
+  {
+    r[i] = _mm256_loadu_si256((__m256i const*)(src + 8*i));
+    q[i] = _mm256_loadu_si256((__m256i const*)(iota + 8*i));
+  }
+
+  // Sort (smallest network that fits)
+  if (m == 1)
+    bitonic_kv_sort_8_i32_avx2(r[0], q[0]);
+  else
+    bitonic_kv_sort_16_i32_avx2(r, q);
+
+  // Store
+  if (n == 8*m)
+  {
+    for (size_t i=0; i<m; ++i)
+      _mm256_storeu_si256((__m256i*)(idx + 8*i), q[i]);
+    return;
+  }
+  for (size_t i=0; i<m; ++i)
+  {
+    _mm256_storeu_si256((__m256i*)(kb + 8*i), r[i]);
+    _mm256_storeu_si256((__m256i*)(ib + 8*i), q[i]);
+  }
+
+  // Padding tied with actual keys: keep indices < n only
+  if (n && kb[n-1] == INT32_MAX)
+  {
+    size_t j = n - 1;
+    while (j > 0 && kb[j-1] == INT32_MAX)
+      --j;
+    for (size_t i=j; i<8*m; ++i)
+      if (ib[i] < (int32_t)n)
+        ib[j++] = ib[i];
+  }
+  std::copy(ib, ib + n, idx);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_KV_I32_H
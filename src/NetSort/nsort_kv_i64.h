@@ -0,0 +1,243 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_KV_I64_H
+#define NSORT_KV_I64_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i64.h"     // bitonic_min/max_i64_avx2
+
+#include <stdint.h>
+#include <algorithm>
+#include <utility>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Key-value networks: 8/16 int64 keys, each carrying an int64 payload
+// Same scheme as nsort_kv_i32.h, 4 x int64 per register
+
+
+// Reference: sort n <= 16 (key, payload) pairs
+static inline void netsort_kv_i64_std(int64_t* __restrict k, int64_t* __restrict p, size_t n)
+{
+  std::pair<int64_t, int64_t> kv[16];
+  for (size_t i=0; i<n; ++i)
+    kv[i] = std::make_pair(k[i], p[i]);
+  std::sort(kv, kv + n, [](const std::pair<int64_t, int64_t>& a, const std::pair<int64_t, int64_t>& b) { return a.first < b.first; });
+  for (size_t i=0; i<n; ++i)
+  {
+    k[i] = kv[i].first;
+    p[i] = kv[i].second;
+  }
+}
+
+// Reference argsort (any n)
+static inline void netsort_argsort_i64_std(const int64_t* __restrict k, int64_t* __restrict idx, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    idx[i] = (int64_t)i;
+  std::sort(idx, idx + n, [k](const int64_t a, const int64_t b) { return k[a] < k[b]; });
+}
+
+//
+#ifdef HAS_AVX2_
+// Vertical compare-exchange: a <= b
+static inline void bitonic_kv_minmax_i64_avx2(__m256i& a, __m256i& pa, __m256i& b, __m256i& pb)
+{
+  __m256i min = bitonic_min_i64_avx2(a, b);
+  __m256i max = bitonic_max_i64_avx2(b, a);
+  __m256i keep = _mm256_cmpeq_epi64(min, a);
+  __m256i tpa = pa;
+  pa = _mm256_blendv_epi8(pb, pa, keep);
+  pb = _mm256_blendv_epi8(tpa, pb, keep);
+  a = min;
+  b = max;
+}
+
+//////// [0,1] [2,3]
+static inline void bitonic_kv_step_1_i64_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_shuffle_epi32(k, _MM_SHUFFLE(1,0,3,2));
+  __m256i tp = _mm256_shuffle_epi32(p, _MM_SHUFFLE(1,0,3,2));
+  __m256i nk = _mm256_blend_epi32(bitonic_min_i64_avx2(k, tk), bitonic_max_i64_avx2(k, tk), 0xCC);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi64(nk, k));
+  k = nk;
+}
+
+//////// [0,2] [1,3]
+static inline void bitonic_kv_step_2_i64_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_permute4x64_epi64(k, _MM_SHUFFLE(1,0,3,2));
+  __m256i tp = _mm256_permute4x64_epi64(p, _MM_SHUFFLE(1,0,3,2));
+  __m256i nk = _mm256_blend_epi32(bitonic_min_i64_avx2(k, tk), bitonic_max_i64_avx2(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi64(nk, k));
+  k = nk;
+}
+
+//////// [0,3] [1,2]
+static inline void bitonic_kv_flip_4_i64_avx2(__m256i& k, __m256i& p)
+{
+  __m256i tk = _mm256_permute4x64_epi64(k, _MM_SHUFFLE(0,1,2,3));
+  __m256i tp = _mm256_permute4x64_epi64(p, _MM_SHUFFLE(0,1,2,3));
+  __m256i nk = _mm256_blend_epi32(bitonic_min_i64_avx2(k, tk), bitonic_max_i64_avx2(k, tk), 0xF0);
+  p = _mm256_blendv_epi8(tp, p, _mm256_cmpeq_epi64(nk, k));
+  k = nk;
+}
+
+// Sort 4 pairs in register
+static inline void bitonic_kv_sort_4_i64_avx2(__m256i& k, __m256i& p)
+{
+  bitonic_kv_step_1_i64_avx2(k, p);
+  bitonic_kv_flip_4_i64_avx2(k, p);
+  bitonic_kv_step_1_i64_avx2(k, p);
+}
+
+// Sort 4 bitonic pairs in register
+static inline void bitonic_kv_clean_4_i64_avx2(__m256i& k, __m256i& p)
+{
+  bitonic_kv_step_2_i64_avx2(k, p);
+  bitonic_kv_step_1_i64_avx2(k, p);
+}
+
+// Sort 8 pairs in 2 registers
+static inline void bitonic_kv_sort_8_i64_avx2(__m256i* k, __m256i* p)
+{
+  bitonic_kv_sort_4_i64_avx2(k[0], p[0]);
+  bitonic_kv_sort_4_i64_avx2(k[1], p[1]);
+  k[1] = _mm256_permute4x64_epi64(k[1], _MM_SHUFFLE(0,1,2,3));
+  p[1] = _mm256_permute4x64_epi64(p[1], _MM_SHUFFLE(0,1,2,3));
+  bitonic_kv_minmax_i64_avx2(k[0], p[0], k[1], p[1]);
+  bitonic_kv_clean_4_i64_avx2(k[0], p[0]);
+  bitonic_kv_clean_4_i64_avx2(k[1], p[1]);
+}
+
+// Sort 16 pairs in 4 registers
+static inline void bitonic_kv_sort_16_i64_avx2(__m256i* k, __m256i* p)
+{
+  bitonic_kv_sort_8_i64_avx2(k, p);
+  bitonic_kv_sort_8_i64_avx2(k + 2, p + 2);
+  __m256i b0 = _mm256_permute4x64_epi64(k[3], _MM_SHUFFLE(0,1,2,3));
+  __m256i b1 = _mm256_permute4x64_epi64(k[2], _MM_SHUFFLE(0,1,2,3));
+  __m256i c0 = _mm256_permute4x64_epi64(p[3], _MM_SHUFFLE(0,1,2,3));
+  __m256i c1 = _mm256_permute4x64_epi64(p[2], _MM_SHUFFLE(0,1,2,3));
+  k[3] = b1; p[3] = c1;
+  k[2] = b0; p[2] = c0;
+  bitonic_kv_minmax_i64_avx2(k[0], p[0], k[2], p[2]);
+  bitonic_kv_minmax_i64_avx2(k[1], p[1], k[3], p[3]);
+  bitonic_kv_minmax_i64_avx2(k[0], p[0], k[1], p[1]);
+  bitonic_kv_minmax_i64_avx2(k[2], p[2], k[3], p[3]);
+  bitonic_kv_clean_4_i64_avx2(k[0], p[0]);
+  bitonic_kv_clean_4_i64_avx2(k[1], p[1]);
+  bitonic_kv_clean_4_i64_avx2(k[2], p[2]);
+  bitonic_kv_clean_4_i64_avx2(k[3], p[3]);
+}
+
+// Sort 8 keys k[] and their payload p[]
+static inline void netsort_kv_8_i64_avx2(int64_t* __restrict k, int64_t* __restrict p)
+{
+  __m256i r[2];
+  __m256i q[2];
+  r[0] = _mm256_loadu_si256((__m256i const*)(k));
+  r[1] = _mm256_loadu_si256((__m256i const*)(k + 4));
+  q[0] = _mm256_loadu_si256((__m256i const*)(p));
+  q[1] = _mm256_loadu_si256((__m256i const*)(p + 4));
+
+  bitonic_kv_sort_8_i64_avx2(r, q);
+
+  _mm256_storeu_si256((__m256i*)(k), r[0]);
+  _mm256_storeu_si256((__m256i*)(k + 4), r[1]);
+  _mm256_storeu_si256((__m256i*)(p), q[0]);
+  _mm256_storeu_si256((__m256i*)(p + 4), q[1]);
+}
+
+// Sort 16 keys k[] and their payload p[]
+static inline void netsort_kv_16_i64_avx2(int64_t* __restrict k, int64_t* __restrict p)
+{
+  __m256i r[4];
+  __m256i q[4];
+  r[0] = _mm256_loadu_si256((__m256i const*)(k));
+  r[1] = _mm256_loadu_si256((__m256i const*)(k + 4));
+  r[2] = _mm256_loadu_si256((__m256i const*)(k + 8));
+  r[3] = _mm256_loadu_si256((__m256i const*)(k + 12));
+  q[0] = _mm256_loadu_si256((__m256i const*)(p));
+  q[1] = _mm256_loadu_si256((__m256i const*)(p + 4));
+  q[2] = _mm256_loadu_si256((__m256i const*)(p + 8));
+  q[3] = _mm256_loadu_si256((__m256i const*)(p + 12));
+
+  bitonic_kv_sort_16_i64_avx2(r, q);
+
+  _mm256_storeu_si256((__m256i*)(k), r[0]);
+  _mm256_storeu_si256((__m256i*)(k + 4), r[1]);
+  _mm256_storeu_si256((__m256i*)(k + 8), r[2]);
+  _mm256_storeu_si256((__m256i*)(k + 12), r[3]);
+  _mm256_storeu_si256((__m256i*)(p), q[0]);
+  _mm256_storeu_si256((__m256i*)(p + 4), q[1]);
+  _mm256_storeu_si256((__m256i*)(p + 8), q[2]);
+  _mm256_storeu_si256((__m256i*)(p + 12), q[3]);
+}
+
+// Argsort n <= 16 keys: idx[i] is the index of the i-th smallest key
+static inline void netsort_argsort_i64_avx2(const int64_t* __restrict k, int64_t* __restrict idx, size_t n)
+{
+  static const int64_t iota[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+  const size_t m = (n <= 8) ? 2 : 4;  // registers
+  int64_t kb[16];
+  int64_t ib[16];
+  __m256i r[4];
+  __m256i q[4];
+
+  // Full networks read keys in place, other sizes through a padded copy
+  if (n == 4*m)
+  {
+    for (size_t i=0; i<m; ++i)
+      r[i] = _mm256_loadu_si256((__m256i const*)(k + 4*i));
+  }
+  else
+  {
+    std::copy(k, k + n, kb);
+    for (size_t i=n; i<16; ++i)
+      kb[i] = INT64_MAX;
+    for (size_t i=0; i<m; ++i)
+      r[i] = _mm256_loadu_si256((__m256i const*)(kb + 4*i));
+  }
+  for (size_t i=0; i<m; ++i)
+    q[i] = _mm256_loadu_si256((__m256i const*)(iota + 4*i));
+
+  // Sort (smallest network that fits)
+  if (m == 2)
+    bitonic_kv_sort_8_i64_avx2(r, q);
+  else
+    bitonic_kv_sort_16_i64_avx2(r, q);
+
+  // Store
+  if (n == 4*m)
+  {
+    for (size_t i=0; i<m; ++i)
+      _mm256_storeu_si256((__m256i*)(idx + 4*i), q[i]);
+    return;
+  }
+  for (size_t i=0; i<m; ++i)
+  {
+    _mm256_storeu_si256((__m256i*)(kb + 4*i), r[i]);
+    _mm256_storeu_si256((__m256i*)(ib + 4*i), q[i]);
+  }
+
+  // Padding tied with actual keys: keep indices < n only
+  if (n && kb[n-1] == INT64_MAX)
+  {
+    size_t j = n - 1;
+    while (j > 0 && kb[j-1] == INT64_MAX)
+      --j;
+    for (size_t i=j; i<4*m; ++i)
+      if (ib[i] < (int64_t)n)
+        ib[j++] = ib[i];
+  }
+  std::copy(ib, ib + n, idx);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_KV_I64_H
@@ -0,0 +1,382 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_ORDER_H
+#define NSORT_ORDER_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i16.h"
+#include "nsort_bitonic_i32.h"
+#include "nsort_bitonic_i64.h"
+#include "nsort_bitonic_flt.h"
+#include "nsort_bitonic_dbl.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX2
+#endif
+
+// Order policies for 8/16/32/64 values networks (template parameter)
+// Keys are transformed in register right after load and before store, so that
+// the unchanged ascending networks sort them in the requested order:
+//  - netsort_asc:  identity (same code as the plain networks)
+//  - netsort_desc: integers ~x (one xor), float/double -x (sign bit xor)
+//  - netsort_abs:  float/double only, ascending |x| (+x before -x on ties, NaN
+//                  last), bits rotated left by one (sign as lowest bit) and
+//                  sorted as unsigned integers (int32/int64 networks, AVX2)
+//  - netsort_total: float/double only, IEEE 754 totalOrder (-NaN < -inf < ...
+//                  < -0 < +0 < ... < +inf < +NaN), negative values get their
+//                  magnitude bits flipped and are sorted as signed integers
+//  - netsort_nan_last: float/double only, same as netsort_total with every NaN
+//                  after +inf (negative NaN keys wrapped above positive ones)
+// Plain float/double networks use min/max, which return their second operand
+// when one is NaN: a NaN input may then be duplicated or lost.
+
+
+//
+struct netsort_asc  {};
+struct netsort_desc {};
+struct netsort_abs  {};
+struct netsort_total    {};
+struct netsort_nan_last {};
+
+// Reference comparisons
+template <typename T>
+static inline bool netsort_order_less(netsort_asc, T a, T b)  { return a < b; }
+template <typename T>
+static inline bool netsort_order_less(netsort_desc, T a, T b) { return b < a; }
+
+static inline bool netsort_order_less(netsort_abs, float a, float b)
+{
+  uint32_t x, y;
+  memcpy(&x, &a, sizeof(x));
+  memcpy(&y, &b, sizeof(y));
+  return ((x << 1) | (x >> 31)) < ((y << 1) | (y >> 31));
+}
+
+static inline bool netsort_order_less(netsort_abs, double a, double b)
+{
+  uint64_t x, y;
+  memcpy(&x, &a, sizeof(x));
+  memcpy(&y, &b, sizeof(y));
+  return ((x << 1) | (x >> 63)) < ((y << 1) | (y >> 63));
+}
+
+// totalOrder keys (signed), NaN-last keys shifted down by the negative NaN count
+static inline int32_t netsort_total_key(float a)
+{
+  int32_t x;
+  memcpy(&x, &a, sizeof(x));
+  return x ^ (int32_t)((uint32_t)(x >> 31) >> 1);
+}
+
+static inline int64_t netsort_total_key(double a)
+{
+  int64_t x;
+  memcpy(&x, &a, sizeof(x));
+  return x ^ (int64_t)((uint64_t)(x >> 63) >> 1);
+}
+
+template <typename T>
+static inline bool netsort_order_less(netsort_total, T a, T b) { return netsort_total_key(a) < netsort_total_key(b); }
+
+static inline bool netsort_order_less(netsort_nan_last, float a, float b)
+{
+  return (int32_t)((uint32_t)netsort_total_key(a) - 0x7FFFFFu) < (int32_t)((uint32_t)netsort_total_key(b) - 0x7FFFFFu);
+}
+
+static inline bool netsort_order_less(netsort_nan_last, double a, double b)
+{
+  const uint64_t n = 0xFFFFFFFFFFFFFull;
+  return (int64_t)((uint64_t)netsort_total_key(a) - n) < (int64_t)((uint64_t)netsort_total_key(b) - n);
+}
+
+// Reference: 'std::sort' with policy comparison
+template <typename Order, typename T>
+static inline void netsort_order_std(T* __restrict v, size_t n)
+{
+  std::sort(v, v + n, [](T a, T b) { return netsort_order_less(Order(), a, b); });
+}
+
+//
+#ifdef HAS_AVX2_
+// Key transforms (enc after load, dec before store)
+static inline __m256i netsort_enc_i16_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_dec_i16_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_enc_i16_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+static inline __m256i netsort_dec_i16_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+
+static inline __m256i netsort_enc_i32_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_dec_i32_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_enc_i32_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+static inline __m256i netsort_dec_i32_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+
+static inline __m256i netsort_enc_i64_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_dec_i64_avx2(netsort_asc, __m256i x)  { return x; }
+static inline __m256i netsort_enc_i64_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+static inline __m256i netsort_dec_i64_avx2(netsort_desc, __m256i x) { return _mm256_xor_si256(x, _mm256_set1_epi32(-1)); }
+
+// Float/double |x| keys: rotate left by one, then flip sign bit (unsigned order)
+static inline __m256i netsort_enc_abs_i32_avx2(__m256i x)
+{
+  x = _mm256_or_si256(_mm256_slli_epi32(x, 1), _mm256_srli_epi32(x, 31));
+  return _mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN));
+}
+
+static inline __m256i netsort_dec_abs_i32_avx2(__m256i x)
+{
+  x = _mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN));
+  return _mm256_or_si256(_mm256_srli_epi32(x, 1), _mm256_slli_epi32(x, 31));
+}
+
+static inline __m256i netsort_enc_abs_i64_avx2(__m256i x)
+{
+  x = _mm256_or_si256(_mm256_slli_epi64(x, 1), _mm256_srli_epi64(x, 63));
+  return _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN));
+}
+
+static inline __m256i netsort_dec_abs_i64_avx2(__m256i x)
+{
+  x = _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN));
+  return _mm256_or_si256(_mm256_srli_epi64(x, 1), _mm256_slli_epi64(x, 63));
+}
+
+// Float/double totalOrder keys: flip magnitude bits of negatives (signed order)
+static inline __m256i netsort_enc_key_i32_avx2(netsort_total, __m256i x)
+{
+  return _mm256_xor_si256(x, _mm256_srli_epi32(_mm256_srai_epi32(x, 31), 1));
+}
+
+static inline __m256i netsort_dec_key_i32_avx2(netsort_total, __m256i x)
+{
+  return _mm256_xor_si256(x, _mm256_srli_epi32(_mm256_srai_epi32(x, 31), 1));
+}
+
+static inline __m256i netsort_enc_key_i64_avx2(netsort_total, __m256i x)
+{
+  const __m256i sgn = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+  return _mm256_xor_si256(x, _mm256_srli_epi64(sgn, 1));
+}
+
+static inline __m256i netsort_dec_key_i64_avx2(netsort_total, __m256i x)
+{
+  const __m256i sgn = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+  return _mm256_xor_si256(x, _mm256_srli_epi64(sgn, 1));
+}
+
+// NaN-last keys: totalOrder keys minus negative NaN count (wrap to the top)
+static inline __m256i netsort_enc_key_i32_avx2(netsort_nan_last, __m256i x)
+{
+  x = netsort_enc_key_i32_avx2(netsort_total(), x);
+  return _mm256_sub_epi32(x, _mm256_set1_epi32(0x7FFFFF));
+}
+
+static inline __m256i netsort_dec_key_i32_avx2(netsort_nan_last, __m256i x)
+{
+  x = _mm256_add_epi32(x, _mm256_set1_epi32(0x7FFFFF));
+  return netsort_dec_key_i32_avx2(netsort_total(), x);
+}
+
+static inline __m256i netsort_enc_key_i64_avx2(netsort_nan_last, __m256i x)
+{
+  x = netsort_enc_key_i64_avx2(netsort_total(), x);
+  return _mm256_sub_epi64(x, _mm256_set1_epi64x(0xFFFFFFFFFFFFFll));
+}
+
+static inline __m256i netsort_dec_key_i64_avx2(netsort_nan_last, __m256i x)
+{
+  x = _mm256_add_epi64(x, _mm256_set1_epi64x(0xFFFFFFFFFFFFFll));
+  return netsort_dec_key_i64_avx2(netsort_total(), x);
+}
+
+static inline __m256i netsort_enc_key_i32_avx2(netsort_abs, __m256i x) { return netsort_enc_abs_i32_avx2(x); }
+static inline __m256i netsort_dec_key_i32_avx2(netsort_abs, __m256i x) { return netsort_dec_abs_i32_avx2(x); }
+static inline __m256i netsort_enc_key_i64_avx2(netsort_abs, __m256i x) { return netsort_enc_abs_i64_avx2(x); }
+static inline __m256i netsort_dec_key_i64_avx2(netsort_abs, __m256i x) { return netsort_dec_abs_i64_avx2(x); }
+
+// Sort k = 16/32/64 x int16 (k constant once inlined)
+template <typename Order>
+static inline void netsort_i16_avx2_ord_k(int16_t* __restrict v, const size_t k)
+{
+  __m256i r[4];
+  for (size_t i=0; i<k/16; ++i)
+    r[i] = netsort_enc_i16_avx2(Order(), _mm256_loadu_si256((__m256i const*)(v + 16*i)));
+
+  switch (k) {
+    case 16: r[0] = bitonic_sort_16_i16_avx2(r[0]); break;
+    case 32: bitonic_sort_32_i16_avx2(r); break;
+    case 64: bitonic_sort_64_i16_avx2(r); break;
+  }
+
+  for (size_t i=0; i<k/16; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 16*i), netsort_dec_i16_avx2(Order(), r[i]));
+}
+
+template <typename Order> static inline void netsort_16_i16_avx2_ord(int16_t* __restrict v) { netsort_i16_avx2_ord_k<Order>(v, 16); }
+template <typename Order> static inline void netsort_32_i16_avx2_ord(int16_t* __restrict v) { netsort_i16_avx2_ord_k<Order>(v, 32); }
+template <typename Order> static inline void netsort_64_i16_avx2_ord(int16_t* __restrict v) { netsort_i16_avx2_ord_k<Order>(v, 64); }
+
+// Sort k = 8/16/32/64 x int32 (k constant once inlined)
+template <typename Order>
+static inline void netsort_i32_avx2_ord_k(int32_t* __restrict v, const size_t k)
+{
+  __m256i r[8];
+  for (size_t i=0; i<k/8; ++i)
+    r[i] = netsort_enc_i32_avx2(Order(), _mm256_loadu_si256((__m256i const*)(v + 8*i)));
+
+  switch (k) {
+    case 8:  r[0] = bitonic_sort_8_i32_avx2(r[0]); break;
+    case 16: bitonic_sort_16_i32_avx2(r); break;
+    case 32: bitonic_sort_32_i32_avx2(r); break;
+    case 64: bitonic_sort_64_i32_avx2(r); break;
+  }
+
+  for (size_t i=0; i<k/8; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 8*i), netsort_dec_i32_avx2(Order(), r[i]));
+}
+
+template <typename Order> static inline void netsort_8_i32_avx2_ord(int32_t* __restrict v)  { netsort_i32_avx2_ord_k<Order>(v, 8); }
+template <typename Order> static inline void netsort_16_i32_avx2_ord(int32_t* __restrict v) { netsort_i32_avx2_ord_k<Order>(v, 16); }
+template <typename Order> static inline void netsort_32_i32_avx2_ord(int32_t* __restrict v) { netsort_i32_avx2_ord_k<Order>(v, 32); }
+template <typename Order> static inline void netsort_64_i32_avx2_ord(int32_t* __restrict v) { netsort_i32_avx2_ord_k<Order>(v, 64); }
+
+// Sort k = 8/16/32/64 x int64 (k constant once inlined)
+template <typename Order>
+static inline void netsort_i64_avx2_ord_k(int64_t* __restrict v, const size_t k)
+{
+  __m256i r[16];
+  for (size_t i=0; i<k/4; ++i)
+    r[i] = netsort_enc_i64_avx2(Order(), _mm256_loadu_si256((__m256i const*)(v + 4*i)));
+
+  switch (k) {
+    case 8:  bitonic_sort_8_i64_avx2(r); break;
+    case 16: bitonic_sort_16_i64_avx2(r); break;
+    case 32: bitonic_sort_32_i64_avx2(r); break;
+    case 64: bitonic_sort_64_i64_avx2(r); break;
+  }
+
+  for (size_t i=0; i<k/4; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), netsort_dec_i64_avx2(Order(), r[i]));
+}
+
+template <typename Order> static inline void netsort_8_i64_avx2_ord(int64_t* __restrict v)  { netsort_i64_avx2_ord_k<Order>(v, 8); }
+template <typename Order> static inline void netsort_16_i64_avx2_ord(int64_t* __restrict v) { netsort_i64_avx2_ord_k<Order>(v, 16); }
+template <typename Order> static inline void netsort_32_i64_avx2_ord(int64_t* __restrict v) { netsort_i64_avx2_ord_k<Order>(v, 32); }
+template <typename Order> static inline void netsort_64_i64_avx2_ord(int64_t* __restrict v) { netsort_i64_avx2_ord_k<Order>(v, 64); }
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX_
+// Key transforms (enc after load, dec before store)
+static inline __m256 netsort_enc_flt_avx(netsort_asc, __m256 x)  { return x; }
+static inline __m256 netsort_dec_flt_avx(netsort_asc, __m256 x)  { return x; }
+static inline __m256 netsort_enc_flt_avx(netsort_desc, __m256 x) { return _mm256_xor_ps(x, _mm256_set1_ps(-0.f)); }
+static inline __m256 netsort_dec_flt_avx(netsort_desc, __m256 x) { return _mm256_xor_ps(x, _mm256_set1_ps(-0.f)); }
+
+static inline __m256d netsort_enc_dbl_avx(netsort_asc, __m256d x)  { return x; }
+static inline __m256d netsort_dec_dbl_avx(netsort_asc, __m256d x)  { return x; }
+static inline __m256d netsort_enc_dbl_avx(netsort_desc, __m256d x) { return _mm256_xor_pd(x, _mm256_set1_pd(-0.)); }
+static inline __m256d netsort_dec_dbl_avx(netsort_desc, __m256d x) { return _mm256_xor_pd(x, _mm256_set1_pd(-0.)); }
+
+// Sort k = 8/16/32/64 x float (k constant once inlined, NaN not supported)
+template <typename Order>
+static inline void netsort_flt_avx_ord_k(float* __restrict v, const size_t k)
+{
+  __m256 r[8];
+  for (size_t i=0; i<k/8; ++i)
+    r[i] = netsort_enc_flt_avx(Order(), _mm256_loadu_ps(v + 8*i));
+
+  switch (k) {
+    case 8:  r[0] = bitonic_sort_8_flt_avx(r[0]); break;
+    case 16: bitonic_sort_16_flt_avx(r); break;
+    case 32: bitonic_sort_32_flt_avx(r); break;
+    case 64: bitonic_sort_64_flt_avx(r); break;
+  }
+
+  for (size_t i=0; i<k/8; ++i)
+    _mm256_storeu_ps(v + 8*i, netsort_dec_flt_avx(Order(), r[i]));
+}
+
+// Sort k = 8/16/32/64 x double (k constant once inlined, NaN not supported)
+template <typename Order>
+static inline void netsort_dbl_avx_ord_k(double* __restrict v, const size_t k)
+{
+  __m256d r[16];
+  for (size_t i=0; i<k/4; ++i)
+    r[i] = netsort_enc_dbl_avx(Order(), _mm256_loadu_pd(v + 4*i));
+
+  switch (k) {
+    case 8:  bitonic_sort_8_dbl_avx(r); break;
+    case 16: bitonic_sort_16_dbl_avx(r); break;
+    case 32: bitonic_sort_32_dbl_avx(r); break;
+    case 64: bitonic_sort_64_dbl_avx(r); break;
+  }
+
+  for (size_t i=0; i<k/4; ++i)
+    _mm256_storeu_pd(v + 4*i, netsort_dec_dbl_avx(Order(), r[i]));
+}
+
+#ifdef HAS_AVX2_
+// Float/double keys sorted by int32/int64 networks (NaN supported)
+template <typename Order>
+static inline void netsort_flt_key_avx2_k(float* __restrict v, const size_t k)
+{
+  __m256i r[8];
+  for (size_t i=0; i<k/8; ++i)
+    r[i] = netsort_enc_key_i32_avx2(Order(), _mm256_loadu_si256((__m256i const*)(v + 8*i)));
+
+  switch (k) {
+    case 8:  r[0] = bitonic_sort_8_i32_avx2(r[0]); break;
+    case 16: bitonic_sort_16_i32_avx2(r); break;
+    case 32: bitonic_sort_32_i32_avx2(r); break;
+    case 64: bitonic_sort_64_i32_avx2(r); break;
+  }
+
+  for (size_t i=0; i<k/8; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 8*i), netsort_dec_key_i32_avx2(Order(), r[i]));
+}
+
+template <typename Order>
+static inline void netsort_dbl_key_avx2_k(double* __restrict v, const size_t k)
+{
+  __m256i r[16];
+  for (size_t i=0; i<k/4; ++i)
+    r[i] = netsort_enc_key_i64_avx2(Order(), _mm256_loadu_si256((__m256i const*)(v + 4*i)));
+
+  switch (k) {
+    case 8:  bitonic_sort_8_i64_avx2(r); break;
+    case 16: bitonic_sort_16_i64_avx2(r); break;
+    case 32: bitonic_sort_32_i64_avx2(r); break;
+    case 64: bitonic_sort_64_i64_avx2(r); break;
+  }
+
+  for (size_t i=0; i<k/4; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), netsort_dec_key_i64_avx2(Order(), r[i]));
+}
+
+template <> inline void netsort_flt_avx_ord_k<netsort_abs>(float* __restrict v, const size_t k)      { netsort_flt_key_avx2_k<netsort_abs>(v, k); }
+template <> inline void netsort_flt_avx_ord_k<netsort_total>(float* __restrict v, const size_t k)    { netsort_flt_key_avx2_k<netsort_total>(v, k); }
+template <> inline void netsort_flt_avx_ord_k<netsort_nan_last>(float* __restrict v, const size_t k) { netsort_flt_key_avx2_k<netsort_nan_last>(v, k); }
+
+template <> inline void netsort_dbl_avx_ord_k<netsort_abs>(double* __restrict v, const size_t k)      { netsort_dbl_key_avx2_k<netsort_abs>(v, k); }
+template <> inline void netsort_dbl_avx_ord_k<netsort_total>(double* __restrict v, const size_t k)    { netsort_dbl_key_avx2_k<netsort_total>(v, k); }
+template <> inline void netsort_dbl_avx_ord_k<netsort_nan_last>(double* __restrict v, const size_t k) { netsort_dbl_key_avx2_k<netsort_nan_last>(v, k); }
+#endif // HAS_AVX2_
+
+template <typename Order> static inline void netsort_8_flt_avx_ord(float* __restrict v)  { netsort_flt_avx_ord_k<Order>(v, 8); }
+template <typename Order> static inline void netsort_16_flt_avx_ord(float* __restrict v) { netsort_flt_avx_ord_k<Order>(v, 16); }
+template <typename Order> static inline void netsort_32_flt_avx_ord(float* __restrict v) { netsort_flt_avx_ord_k<Order>(v, 32); }
+template <typename Order> static inline void netsort_64_flt_avx_ord(float* __restrict v) { netsort_flt_avx_ord_k<Order>(v, 64); }
+
+template <typename Order> static inline void netsort_8_dbl_avx_ord(double* __restrict v)  { netsort_dbl_avx_ord_k<Order>(v, 8); }
+template <typename Order> static inline void netsort_16_dbl_avx_ord(double* __restrict v) { netsort_dbl_avx_ord_k<Order>(v, 16); }
+template <typename Order> static inline void netsort_32_dbl_avx_ord(double* __restrict v) { netsort_dbl_avx_ord_k<Order>(v, 32); }
+template <typename Order> static inline void netsort_64_dbl_avx_ord(double* __restrict v) { netsort_dbl_avx_ord_k<Order>(v, 64); }
+#endif // HAS_AVX_
+
+
+#endif // NSORT_ORDER_H
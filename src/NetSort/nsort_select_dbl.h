@@ -0,0 +1,288 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SELECT_DBL_H
+#define NSORT_SELECT_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_dbl.h"  // bitonic_minmax_dbl_avx
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX
+#endif
+
+// Same selection networks and median filter as nsort_select_i32.h (4 x double per __m256d)
+
+
+//
+static inline double netselect_kth_dbl_std(const double* v, size_t n, size_t k)
+{
+  std::vector<double> tmp(v, v + n);
+  std::nth_element(tmp.begin(), tmp.begin() + k, tmp.end());
+  return tmp[k];
+}
+
+// Median (upper one if w is even) of every window of w values: n - w + 1 outputs
+static inline void netselect_median_filter_dbl_std(const double* v, size_t n, size_t w, double* __restrict out)
+{
+  if (w == 0 || n < w)
+    return;
+
+  std::vector<double> win(w);
+  for (size_t i=0; i + w <= n; ++i)
+  {
+    std::copy(v + i, v + i + w, win.begin());
+    std::nth_element(win.begin(), win.begin() + w/2, win.end());
+    out[i] = win[w/2];
+  }
+}
+
+//
+#ifdef HAS_AVX_
+// Median of 3 (4 min/max)
+static inline __m256d netselect_median_3_dbl_avx(const __m256d* r)
+{
+  __m256d a[3];
+  for (size_t i=0; i<3; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[1]); a[1] = _mm256_min_pd(a[1], a[2]);
+  a[1] = _mm256_max_pd(a[0], a[1]);
+  return a[1];
+}
+
+// Median of 5 (10 min/max)
+static inline __m256d netselect_median_5_dbl_avx(const __m256d* r)
+{
+  __m256d a[5];
+  for (size_t i=0; i<5; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[1]); bitonic_minmax_dbl_avx(a[3], a[4]);
+  a[3] = _mm256_max_pd(a[0], a[3]); a[1] = _mm256_min_pd(a[1], a[4]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); a[2] = _mm256_min_pd(a[2], a[3]);
+  a[2] = _mm256_max_pd(a[1], a[2]);
+  return a[2];
+}
+
+// Median of 7 (20 min/max)
+static inline __m256d netselect_median_7_dbl_avx(const __m256d* r)
+{
+  __m256d a[7];
+  for (size_t i=0; i<7; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[5]); bitonic_minmax_dbl_avx(a[0], a[3]);
+  bitonic_minmax_dbl_avx(a[1], a[6]); bitonic_minmax_dbl_avx(a[2], a[4]);
+  a[1] = _mm256_max_pd(a[0], a[1]); bitonic_minmax_dbl_avx(a[3], a[5]);
+  bitonic_minmax_dbl_avx(a[2], a[6]); a[3] = _mm256_max_pd(a[2], a[3]);
+  a[3] = _mm256_min_pd(a[3], a[6]); a[4] = _mm256_min_pd(a[4], a[5]);
+  bitonic_minmax_dbl_avx(a[1], a[4]); a[3] = _mm256_max_pd(a[1], a[3]);
+  a[3] = _mm256_min_pd(a[3], a[4]);
+  return a[3];
+}
+
+// Median of 9 (30 min/max)
+static inline __m256d netselect_median_9_dbl_avx(const __m256d* r)
+{
+  __m256d a[9];
+  for (size_t i=0; i<9; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[4], a[5]);
+  bitonic_minmax_dbl_avx(a[7], a[8]); bitonic_minmax_dbl_avx(a[0], a[1]);
+  bitonic_minmax_dbl_avx(a[3], a[4]); bitonic_minmax_dbl_avx(a[6], a[7]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[4], a[5]);
+  bitonic_minmax_dbl_avx(a[7], a[8]); a[3] = _mm256_max_pd(a[0], a[3]);
+  a[5] = _mm256_min_pd(a[5], a[8]); bitonic_minmax_dbl_avx(a[4], a[7]);
+  a[6] = _mm256_max_pd(a[3], a[6]); a[4] = _mm256_max_pd(a[1], a[4]);
+  a[2] = _mm256_min_pd(a[2], a[5]); a[4] = _mm256_min_pd(a[4], a[7]);
+  bitonic_minmax_dbl_avx(a[4], a[2]); a[4] = _mm256_max_pd(a[6], a[4]);
+  a[4] = _mm256_min_pd(a[4], a[2]);
+  return a[4];
+}
+
+// Median of 25 (174 min/max)
+static inline __m256d netselect_median_25_dbl_avx(const __m256d* r)
+{
+  __m256d a[25];
+  for (size_t i=0; i<25; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[1]); bitonic_minmax_dbl_avx(a[3], a[4]);
+  bitonic_minmax_dbl_avx(a[2], a[4]); bitonic_minmax_dbl_avx(a[2], a[3]);
+  bitonic_minmax_dbl_avx(a[6], a[7]); bitonic_minmax_dbl_avx(a[5], a[7]);
+  bitonic_minmax_dbl_avx(a[5], a[6]); bitonic_minmax_dbl_avx(a[9], a[10]);
+  bitonic_minmax_dbl_avx(a[8], a[10]); bitonic_minmax_dbl_avx(a[8], a[9]);
+  bitonic_minmax_dbl_avx(a[12], a[13]); bitonic_minmax_dbl_avx(a[11], a[13]);
+  bitonic_minmax_dbl_avx(a[11], a[12]); bitonic_minmax_dbl_avx(a[15], a[16]);
+  bitonic_minmax_dbl_avx(a[14], a[16]); bitonic_minmax_dbl_avx(a[14], a[15]);
+  bitonic_minmax_dbl_avx(a[18], a[19]); bitonic_minmax_dbl_avx(a[17], a[19]);
+  bitonic_minmax_dbl_avx(a[17], a[18]); bitonic_minmax_dbl_avx(a[21], a[22]);
+  bitonic_minmax_dbl_avx(a[20], a[22]); bitonic_minmax_dbl_avx(a[20], a[21]);
+  bitonic_minmax_dbl_avx(a[23], a[24]); bitonic_minmax_dbl_avx(a[2], a[5]);
+  bitonic_minmax_dbl_avx(a[3], a[6]); bitonic_minmax_dbl_avx(a[0], a[6]);
+  bitonic_minmax_dbl_avx(a[0], a[3]); bitonic_minmax_dbl_avx(a[4], a[7]);
+  bitonic_minmax_dbl_avx(a[1], a[7]); bitonic_minmax_dbl_avx(a[1], a[4]);
+  bitonic_minmax_dbl_avx(a[11], a[14]); bitonic_minmax_dbl_avx(a[8], a[14]);
+  bitonic_minmax_dbl_avx(a[8], a[11]); bitonic_minmax_dbl_avx(a[12], a[15]);
+  bitonic_minmax_dbl_avx(a[9], a[15]); bitonic_minmax_dbl_avx(a[9], a[12]);
+  bitonic_minmax_dbl_avx(a[13], a[16]); bitonic_minmax_dbl_avx(a[10], a[16]);
+  bitonic_minmax_dbl_avx(a[10], a[13]); bitonic_minmax_dbl_avx(a[20], a[23]);
+  bitonic_minmax_dbl_avx(a[17], a[23]); bitonic_minmax_dbl_avx(a[17], a[20]);
+  bitonic_minmax_dbl_avx(a[21], a[24]); bitonic_minmax_dbl_avx(a[18], a[24]);
+  bitonic_minmax_dbl_avx(a[18], a[21]); bitonic_minmax_dbl_avx(a[19], a[22]);
+  a[17] = _mm256_max_pd(a[8], a[17]); bitonic_minmax_dbl_avx(a[9], a[18]);
+  bitonic_minmax_dbl_avx(a[0], a[18]); a[9] = _mm256_max_pd(a[0], a[9]);
+  bitonic_minmax_dbl_avx(a[10], a[19]); bitonic_minmax_dbl_avx(a[1], a[19]);
+  bitonic_minmax_dbl_avx(a[1], a[10]); bitonic_minmax_dbl_avx(a[11], a[20]);
+  bitonic_minmax_dbl_avx(a[2], a[20]); a[11] = _mm256_max_pd(a[2], a[11]);
+  bitonic_minmax_dbl_avx(a[12], a[21]); bitonic_minmax_dbl_avx(a[3], a[21]);
+  bitonic_minmax_dbl_avx(a[3], a[12]); bitonic_minmax_dbl_avx(a[13], a[22]);
+  a[4] = _mm256_min_pd(a[4], a[22]); bitonic_minmax_dbl_avx(a[4], a[13]);
+  bitonic_minmax_dbl_avx(a[14], a[23]); bitonic_minmax_dbl_avx(a[5], a[23]);
+  bitonic_minmax_dbl_avx(a[5], a[14]); bitonic_minmax_dbl_avx(a[15], a[24]);
+  a[6] = _mm256_min_pd(a[6], a[24]); bitonic_minmax_dbl_avx(a[6], a[15]);
+  a[7] = _mm256_min_pd(a[7], a[16]); a[7] = _mm256_min_pd(a[7], a[19]);
+  a[13] = _mm256_min_pd(a[13], a[21]); a[15] = _mm256_min_pd(a[15], a[23]);
+  a[7] = _mm256_min_pd(a[7], a[13]); a[7] = _mm256_min_pd(a[7], a[15]);
+  a[9] = _mm256_max_pd(a[1], a[9]); a[11] = _mm256_max_pd(a[3], a[11]);
+  a[17] = _mm256_max_pd(a[5], a[17]); a[17] = _mm256_max_pd(a[11], a[17]);
+  a[17] = _mm256_max_pd(a[9], a[17]); bitonic_minmax_dbl_avx(a[4], a[10]);
+  bitonic_minmax_dbl_avx(a[6], a[12]); bitonic_minmax_dbl_avx(a[7], a[14]);
+  bitonic_minmax_dbl_avx(a[4], a[6]); a[7] = _mm256_max_pd(a[4], a[7]);
+  bitonic_minmax_dbl_avx(a[12], a[14]); a[10] = _mm256_min_pd(a[10], a[14]);
+  bitonic_minmax_dbl_avx(a[6], a[7]); bitonic_minmax_dbl_avx(a[10], a[12]);
+  bitonic_minmax_dbl_avx(a[6], a[10]); a[17] = _mm256_max_pd(a[6], a[17]);
+  bitonic_minmax_dbl_avx(a[12], a[17]); a[7] = _mm256_min_pd(a[7], a[17]);
+  bitonic_minmax_dbl_avx(a[7], a[10]); bitonic_minmax_dbl_avx(a[12], a[18]);
+  a[12] = _mm256_max_pd(a[7], a[12]); a[10] = _mm256_min_pd(a[10], a[18]);
+  bitonic_minmax_dbl_avx(a[12], a[20]); a[10] = _mm256_min_pd(a[10], a[20]);
+  a[12] = _mm256_max_pd(a[10], a[12]);
+  return a[12];
+}
+
+// k-th smallest of 8: optimal network (19 comparators), k constant once inlined
+static inline __m256d netselect_kth_8_dbl_avx(const __m256d* r, const size_t k)
+{
+  __m256d a[8];
+  for (size_t i=0; i<8; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[2]); bitonic_minmax_dbl_avx(a[1], a[3]);
+  bitonic_minmax_dbl_avx(a[4], a[6]); bitonic_minmax_dbl_avx(a[5], a[7]);
+  bitonic_minmax_dbl_avx(a[0], a[4]); bitonic_minmax_dbl_avx(a[1], a[5]);
+  bitonic_minmax_dbl_avx(a[2], a[6]); bitonic_minmax_dbl_avx(a[3], a[7]);
+  bitonic_minmax_dbl_avx(a[0], a[1]); bitonic_minmax_dbl_avx(a[2], a[3]);
+  bitonic_minmax_dbl_avx(a[4], a[5]); bitonic_minmax_dbl_avx(a[6], a[7]);
+  bitonic_minmax_dbl_avx(a[2], a[4]); bitonic_minmax_dbl_avx(a[3], a[5]);
+  bitonic_minmax_dbl_avx(a[1], a[4]); bitonic_minmax_dbl_avx(a[3], a[6]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[3], a[4]);
+  bitonic_minmax_dbl_avx(a[5], a[6]);
+  return a[k];
+}
+
+// k-th smallest of 16: Batcher odd-even merge network (63 comparators)
+static inline __m256d netselect_kth_16_dbl_avx(const __m256d* r, const size_t k)
+{
+  __m256d a[16];
+  for (size_t i=0; i<16; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_dbl_avx(a[0], a[1]); bitonic_minmax_dbl_avx(a[2], a[3]);
+  bitonic_minmax_dbl_avx(a[4], a[5]); bitonic_minmax_dbl_avx(a[6], a[7]);
+  bitonic_minmax_dbl_avx(a[8], a[9]); bitonic_minmax_dbl_avx(a[10], a[11]);
+  bitonic_minmax_dbl_avx(a[12], a[13]); bitonic_minmax_dbl_avx(a[14], a[15]);
+  bitonic_minmax_dbl_avx(a[0], a[2]); bitonic_minmax_dbl_avx(a[1], a[3]);
+  bitonic_minmax_dbl_avx(a[4], a[6]); bitonic_minmax_dbl_avx(a[5], a[7]);
+  bitonic_minmax_dbl_avx(a[8], a[10]); bitonic_minmax_dbl_avx(a[9], a[11]);
+  bitonic_minmax_dbl_avx(a[12], a[14]); bitonic_minmax_dbl_avx(a[13], a[15]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[5], a[6]);
+  bitonic_minmax_dbl_avx(a[9], a[10]); bitonic_minmax_dbl_avx(a[13], a[14]);
+  bitonic_minmax_dbl_avx(a[0], a[4]); bitonic_minmax_dbl_avx(a[1], a[5]);
+  bitonic_minmax_dbl_avx(a[2], a[6]); bitonic_minmax_dbl_avx(a[3], a[7]);
+  bitonic_minmax_dbl_avx(a[8], a[12]); bitonic_minmax_dbl_avx(a[9], a[13]);
+  bitonic_minmax_dbl_avx(a[10], a[14]); bitonic_minmax_dbl_avx(a[11], a[15]);
+  bitonic_minmax_dbl_avx(a[2], a[4]); bitonic_minmax_dbl_avx(a[3], a[5]);
+  bitonic_minmax_dbl_avx(a[10], a[12]); bitonic_minmax_dbl_avx(a[11], a[13]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[3], a[4]);
+  bitonic_minmax_dbl_avx(a[5], a[6]); bitonic_minmax_dbl_avx(a[9], a[10]);
+  bitonic_minmax_dbl_avx(a[11], a[12]); bitonic_minmax_dbl_avx(a[13], a[14]);
+  bitonic_minmax_dbl_avx(a[0], a[8]); bitonic_minmax_dbl_avx(a[1], a[9]);
+  bitonic_minmax_dbl_avx(a[2], a[10]); bitonic_minmax_dbl_avx(a[3], a[11]);
+  bitonic_minmax_dbl_avx(a[4], a[12]); bitonic_minmax_dbl_avx(a[5], a[13]);
+  bitonic_minmax_dbl_avx(a[6], a[14]); bitonic_minmax_dbl_avx(a[7], a[15]);
+  bitonic_minmax_dbl_avx(a[4], a[8]); bitonic_minmax_dbl_avx(a[5], a[9]);
+  bitonic_minmax_dbl_avx(a[6], a[10]); bitonic_minmax_dbl_avx(a[7], a[11]);
+  bitonic_minmax_dbl_avx(a[2], a[4]); bitonic_minmax_dbl_avx(a[3], a[5]);
+  bitonic_minmax_dbl_avx(a[6], a[8]); bitonic_minmax_dbl_avx(a[7], a[9]);
+  bitonic_minmax_dbl_avx(a[10], a[12]); bitonic_minmax_dbl_avx(a[11], a[13]);
+  bitonic_minmax_dbl_avx(a[1], a[2]); bitonic_minmax_dbl_avx(a[3], a[4]);
+  bitonic_minmax_dbl_avx(a[5], a[6]); bitonic_minmax_dbl_avx(a[7], a[8]);
+  bitonic_minmax_dbl_avx(a[9], a[10]); bitonic_minmax_dbl_avx(a[11], a[12]);
+  bitonic_minmax_dbl_avx(a[13], a[14]);
+  return a[k];
+}
+
+// Median of w values held in w registers (w constant once inlined)
+static inline __m256d netselect_median_dbl_avx(const __m256d* r, const size_t w)
+{
+  switch (w)
+  {
+    case 3:  return netselect_median_3_dbl_avx(r);
+    case 5:  return netselect_median_5_dbl_avx(r);
+    case 7:  return netselect_median_7_dbl_avx(r);
+    case 9:  return netselect_median_9_dbl_avx(r);
+    default: return netselect_median_25_dbl_avx(r);
+  }
+}
+
+// 4 windows per step (w constant once inlined, n - w + 1 >= 4)
+static inline void netselect_median_filter_dbl_avx_k(const double* v, size_t n, double* __restrict out, const size_t w)
+{
+  const size_t m = n - w + 1;
+  __m256d r[25];
+
+  for (size_t i=0; ; i+=4)
+  {
+    if (i + 4 > m)
+    {
+      if (i == m) break;
+      i = m - 4;  // last vector overlaps the previous one
+    }
+    for (size_t j=0; j<w; ++j)
+      r[j] = _mm256_loadu_pd(v + i + j);
+    _mm256_storeu_pd(out + i, netselect_median_dbl_avx(r, w));
+  }
+}
+
+static inline void netselect_median_filter_dbl_avx(const double* v, size_t n, size_t w, double* __restrict out)
+{
+  if (w == 0 || n < w)
+    return;
+  if (n - w + 1 < 4)
+  {
+    netselect_median_filter_dbl_std(v, n, w, out);
+    return;
+  }
+
+  switch (w)
+  {
+    case 3:  netselect_median_filter_dbl_avx_k(v, n, out, 3); break;
+    case 5:  netselect_median_filter_dbl_avx_k(v, n, out, 5); break;
+    case 7:  netselect_median_filter_dbl_avx_k(v, n, out, 7); break;
+    case 9:  netselect_median_filter_dbl_avx_k(v, n, out, 9); break;
+    case 25: netselect_median_filter_dbl_avx_k(v, n, out, 25); break;
+    default: netselect_median_filter_dbl_std(v, n, w, out); break;
+  }
+}
+#endif // HAS_AVX_
+
+
+#endif // NSORT_SELECT_DBL_H
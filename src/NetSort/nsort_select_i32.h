@@ -0,0 +1,402 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SELECT_I32_H
+#define NSORT_SELECT_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i32.h"  // bitonic_minmax_i32_avx2
+#include "nsort_8_batch_i32.h"  // netsort_8_batch_transpose_i32_avx2
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Selection networks: median of 3/5/7/9/25 values, k-th smallest of 8/16 values
+// Inputs are held vertically: register j holds value j of every problem (one
+// problem per lane), so a network is only vertical min/max.
+// Median networks are pruned to the comparators the median depends on, and a
+// comparator whose max (resp. min) output is never read is reduced to a single
+// min (resp. max). k-th networks are complete sorting networks: once inlined
+// with a constant k, the compiler drops every unused min/max the same way.
+// Sliding median filter: out[i] = median(v[i..i+w-1]). Lane i of register j is
+// loaded from v[i+j] (unaligned loads), so each lane sees its own window and no
+// transpose is needed. The last vector overlaps the previous one.
+
+
+//
+static inline int32_t netselect_kth_i32_std(const int32_t* v, size_t n, size_t k)
+{
+  std::vector<int32_t> tmp(v, v + n);
+  std::nth_element(tmp.begin(), tmp.begin() + k, tmp.end());
+  return tmp[k];
+}
+
+// Median (upper one if w is even) of every window of w values: n - w + 1 outputs
+static inline void netselect_median_filter_i32_std(const int32_t* v, size_t n, size_t w, int32_t* __restrict out)
+{
+  if (w == 0 || n < w)
+    return;
+
+  std::vector<int32_t> win(w);
+  for (size_t i=0; i + w <= n; ++i)
+  {
+    std::copy(v + i, v + i + w, win.begin());
+    std::nth_element(win.begin(), win.begin() + w/2, win.end());
+    out[i] = win[w/2];
+  }
+}
+
+// k-th smallest of each group of 8/16 values
+static inline void netselect_kth_8_batch_i32_std(const int32_t* v, size_t groups, size_t k, int32_t* __restrict out)
+{
+  int32_t tmp[8];
+  for (size_t g=0; g<groups; ++g)
+  {
+    std::copy(v + 8*g, v + 8*g + 8, tmp);
+    std::nth_element(tmp, tmp + k, tmp + 8);
+    out[g] = tmp[k];
+  }
+}
+
+static inline void netselect_kth_16_batch_i32_std(const int32_t* v, size_t groups, size_t k, int32_t* __restrict out)
+{
+  int32_t tmp[16];
+  for (size_t g=0; g<groups; ++g)
+  {
+    std::copy(v + 16*g, v + 16*g + 16, tmp);
+    std::nth_element(tmp, tmp + k, tmp + 16);
+    out[g] = tmp[k];
+  }
+}
+
+//
+#ifdef HAS_AVX2_
+// Median of 3 (4 min/max)
+static inline __m256i netselect_median_3_i32_avx2(const __m256i* r)
+{
+  __m256i a[3];
+  for (size_t i=0; i<3; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[1]); a[1] = _mm256_min_epi32(a[1], a[2]);
+  a[1] = _mm256_max_epi32(a[0], a[1]);
+  return a[1];
+}
+
+// Median of 5 (10 min/max)
+static inline __m256i netselect_median_5_i32_avx2(const __m256i* r)
+{
+  __m256i a[5];
+  for (size_t i=0; i<5; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[1]); bitonic_minmax_i32_avx2(a[3], a[4]);
+  a[3] = _mm256_max_epi32(a[0], a[3]); a[1] = _mm256_min_epi32(a[1], a[4]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); a[2] = _mm256_min_epi32(a[2], a[3]);
+  a[2] = _mm256_max_epi32(a[1], a[2]);
+  return a[2];
+}
+
+// Median of 7 (20 min/max)
+static inline __m256i netselect_median_7_i32_avx2(const __m256i* r)
+{
+  __m256i a[7];
+  for (size_t i=0; i<7; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[5]); bitonic_minmax_i32_avx2(a[0], a[3]);
+  bitonic_minmax_i32_avx2(a[1], a[6]); bitonic_minmax_i32_avx2(a[2], a[4]);
+  a[1] = _mm256_max_epi32(a[0], a[1]); bitonic_minmax_i32_avx2(a[3], a[5]);
+  bitonic_minmax_i32_avx2(a[2], a[6]); a[3] = _mm256_max_epi32(a[2], a[3]);
+  a[3] = _mm256_min_epi32(a[3], a[6]); a[4] = _mm256_min_epi32(a[4], a[5]);
+  bitonic_minmax_i32_avx2(a[1], a[4]); a[3] = _mm256_max_epi32(a[1], a[3]);
+  a[3] = _mm256_min_epi32(a[3], a[4]);
+  return a[3];
+}
+
+// Median of 9: Paeth's network (30 min/max once pruned)
+static inline __m256i netselect_median_9_i32_avx2(const __m256i* r)
+{
+  __m256i a[9];
+  for (size_t i=0; i<9; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[4], a[5]);
+  bitonic_minmax_i32_avx2(a[7], a[8]); bitonic_minmax_i32_avx2(a[0], a[1]);
+  bitonic_minmax_i32_avx2(a[3], a[4]); bitonic_minmax_i32_avx2(a[6], a[7]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[4], a[5]);
+  bitonic_minmax_i32_avx2(a[7], a[8]); a[3] = _mm256_max_epi32(a[0], a[3]);
+  a[5] = _mm256_min_epi32(a[5], a[8]); bitonic_minmax_i32_avx2(a[4], a[7]);
+  a[6] = _mm256_max_epi32(a[3], a[6]); a[4] = _mm256_max_epi32(a[1], a[4]);
+  a[2] = _mm256_min_epi32(a[2], a[5]); a[4] = _mm256_min_epi32(a[4], a[7]);
+  bitonic_minmax_i32_avx2(a[4], a[2]); a[4] = _mm256_max_epi32(a[6], a[4]);
+  a[4] = _mm256_min_epi32(a[4], a[2]);
+  return a[4];
+}
+
+// Median of 25: Smith's network (174 min/max once pruned)
+static inline __m256i netselect_median_25_i32_avx2(const __m256i* r)
+{
+  __m256i a[25];
+  for (size_t i=0; i<25; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[1]); bitonic_minmax_i32_avx2(a[3], a[4]);
+  bitonic_minmax_i32_avx2(a[2], a[4]); bitonic_minmax_i32_avx2(a[2], a[3]);
+  bitonic_minmax_i32_avx2(a[6], a[7]); bitonic_minmax_i32_avx2(a[5], a[7]);
+  bitonic_minmax_i32_avx2(a[5], a[6]); bitonic_minmax_i32_avx2(a[9], a[10]);
+  bitonic_minmax_i32_avx2(a[8], a[10]); bitonic_minmax_i32_avx2(a[8], a[9]);
+  bitonic_minmax_i32_avx2(a[12], a[13]); bitonic_minmax_i32_avx2(a[11], a[13]);
+  bitonic_minmax_i32_avx2(a[11], a[12]); bitonic_minmax_i32_avx2(a[15], a[16]);
+  bitonic_minmax_i32_avx2(a[14], a[16]); bitonic_minmax_i32_avx2(a[14], a[15]);
+  bitonic_minmax_i32_avx2(a[18], a[19]); bitonic_minmax_i32_avx2(a[17], a[19]);
+  bitonic_minmax_i32_avx2(a[17], a[18]); bitonic_minmax_i32_avx2(a[21], a[22]);
+  bitonic_minmax_i32_avx2(a[20], a[22]); bitonic_minmax_i32_avx2(a[20], a[21]);
+  bitonic_minmax_i32_avx2(a[23], a[24]); bitonic_minmax_i32_avx2(a[2], a[5]);
+  bitonic_minmax_i32_avx2(a[3], a[6]); bitonic_minmax_i32_avx2(a[0], a[6]);
+  bitonic_minmax_i32_avx2(a[0], a[3]); bitonic_minmax_i32_avx2(a[4], a[7]);
+  bitonic_minmax_i32_avx2(a[1], a[7]); bitonic_minmax_i32_avx2(a[1], a[4]);
+  bitonic_minmax_i32_avx2(a[11], a[14]); bitonic_minmax_i32_avx2(a[8], a[14]);
+  bitonic_minmax_i32_avx2(a[8], a[11]); bitonic_minmax_i32_avx2(a[12], a[15]);
+  bitonic_minmax_i32_avx2(a[9], a[15]); bitonic_minmax_i32_avx2(a[9], a[12]);
+  bitonic_minmax_i32_avx2(a[13], a[16]); bitonic_minmax_i32_avx2(a[10], a[16]);
+  bitonic_minmax_i32_avx2(a[10], a[13]); bitonic_minmax_i32_avx2(a[20], a[23]);
+  bitonic_minmax_i32_avx2(a[17], a[23]); bitonic_minmax_i32_avx2(a[17], a[20]);
+  bitonic_minmax_i32_avx2(a[21], a[24]); bitonic_minmax_i32_avx2(a[18], a[24]);
+  bitonic_minmax_i32_avx2(a[18], a[21]); bitonic_minmax_i32_avx2(a[19], a[22]);
+  a[17] = _mm256_max_epi32(a[8], a[17]); bitonic_minmax_i32_avx2(a[9], a[18]);
+  bitonic_minmax_i32_avx2(a[0], a[18]); a[9] = _mm256_max_epi32(a[0], a[9]);
+  bitonic_minmax_i32_avx2(a[10], a[19]); bitonic_minmax_i32_avx2(a[1], a[19]);
+  bitonic_minmax_i32_avx2(a[1], a[10]); bitonic_minmax_i32_avx2(a[11], a[20]);
+  bitonic_minmax_i32_avx2(a[2], a[20]); a[11] = _mm256_max_epi32(a[2], a[11]);
+  bitonic_minmax_i32_avx2(a[12], a[21]); bitonic_minmax_i32_avx2(a[3], a[21]);
+  bitonic_minmax_i32_avx2(a[3], a[12]); bitonic_minmax_i32_avx2(a[13], a[22]);
+  a[4] = _mm256_min_epi32(a[4], a[22]); bitonic_minmax_i32_avx2(a[4], a[13]);
+  bitonic_minmax_i32_avx2(a[14], a[23]); bitonic_minmax_i32_avx2(a[5], a[23]);
+  bitonic_minmax_i32_avx2(a[5], a[14]); bitonic_minmax_i32_avx2(a[15], a[24]);
+  a[6] = _mm256_min_epi32(a[6], a[24]); bitonic_minmax_i32_avx2(a[6], a[15]);
+  a[7] = _mm256_min_epi32(a[7], a[16]); a[7] = _mm256_min_epi32(a[7], a[19]);
+  a[13] = _mm256_min_epi32(a[13], a[21]); a[15] = _mm256_min_epi32(a[15], a[23]);
+  a[7] = _mm256_min_epi32(a[7], a[13]); a[7] = _mm256_min_epi32(a[7], a[15]);
+  a[9] = _mm256_max_epi32(a[1], a[9]); a[11] = _mm256_max_epi32(a[3], a[11]);
+  a[17] = _mm256_max_epi32(a[5], a[17]); a[17] = _mm256_max_epi32(a[11], a[17]);
+  a[17] = _mm256_max_epi32(a[9], a[17]); bitonic_minmax_i32_avx2(a[4], a[10]);
+  bitonic_minmax_i32_avx2(a[6], a[12]); bitonic_minmax_i32_avx2(a[7], a[14]);
+  bitonic_minmax_i32_avx2(a[4], a[6]); a[7] = _mm256_max_epi32(a[4], a[7]);
+  bitonic_minmax_i32_avx2(a[12], a[14]); a[10] = _mm256_min_epi32(a[10], a[14]);
+  bitonic_minmax_i32_avx2(a[6], a[7]); bitonic_minmax_i32_avx2(a[10], a[12]);
+  bitonic_minmax_i32_avx2(a[6], a[10]); a[17] = _mm256_max_epi32(a[6], a[17]);
+  bitonic_minmax_i32_avx2(a[12], a[17]); a[7] = _mm256_min_epi32(a[7], a[17]);
+  bitonic_minmax_i32_avx2(a[7], a[10]); bitonic_minmax_i32_avx2(a[12], a[18]);
+  a[12] = _mm256_max_epi32(a[7], a[12]); a[10] = _mm256_min_epi32(a[10], a[18]);
+  bitonic_minmax_i32_avx2(a[12], a[20]); a[10] = _mm256_min_epi32(a[10], a[20]);
+  a[12] = _mm256_max_epi32(a[10], a[12]);
+  return a[12];
+}
+
+// k-th smallest of 8: optimal network (19 comparators), k constant once inlined
+static inline __m256i netselect_kth_8_i32_avx2(const __m256i* r, const size_t k)
+{
+  __m256i a[8];
+  for (size_t i=0; i<8; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[2]); bitonic_minmax_i32_avx2(a[1], a[3]);
+  bitonic_minmax_i32_avx2(a[4], a[6]); bitonic_minmax_i32_avx2(a[5], a[7]);
+  bitonic_minmax_i32_avx2(a[0], a[4]); bitonic_minmax_i32_avx2(a[1], a[5]);
+  bitonic_minmax_i32_avx2(a[2], a[6]); bitonic_minmax_i32_avx2(a[3], a[7]);
+  bitonic_minmax_i32_avx2(a[0], a[1]); bitonic_minmax_i32_avx2(a[2], a[3]);
+  bitonic_minmax_i32_avx2(a[4], a[5]); bitonic_minmax_i32_avx2(a[6], a[7]);
+  bitonic_minmax_i32_avx2(a[2], a[4]); bitonic_minmax_i32_avx2(a[3], a[5]);
+  bitonic_minmax_i32_avx2(a[1], a[4]); bitonic_minmax_i32_avx2(a[3], a[6]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[3], a[4]);
+  bitonic_minmax_i32_avx2(a[5], a[6]);
+  return a[k];
+}
+
+// k-th smallest of 16: Batcher odd-even merge network (63 comparators)
+static inline __m256i netselect_kth_16_i32_avx2(const __m256i* r, const size_t k)
+{
+  __m256i a[16];
+  for (size_t i=0; i<16; ++i)
+    a[i] = r[i];
+
+  bitonic_minmax_i32_avx2(a[0], a[1]); bitonic_minmax_i32_avx2(a[2], a[3]);
+  bitonic_minmax_i32_avx2(a[4], a[5]); bitonic_minmax_i32_avx2(a[6], a[7]);
+  bitonic_minmax_i32_avx2(a[8], a[9]); bitonic_minmax_i32_avx2(a[10], a[11]);
+  bitonic_minmax_i32_avx2(a[12], a[13]); bitonic_minmax_i32_avx2(a[14], a[15]);
+  bitonic_minmax_i32_avx2(a[0], a[2]); bitonic_minmax_i32_avx2(a[1], a[3]);
+  bitonic_minmax_i32_avx2(a[4], a[6]); bitonic_minmax_i32_avx2(a[5], a[7]);
+  bitonic_minmax_i32_avx2(a[8], a[10]); bitonic_minmax_i32_avx2(a[9], a[11]);
+  bitonic_minmax_i32_avx2(a[12], a[14]); bitonic_minmax_i32_avx2(a[13], a[15]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[5], a[6]);
+  bitonic_minmax_i32_avx2(a[9], a[10]); bitonic_minmax_i32_avx2(a[13], a[14]);
+  bitonic_minmax_i32_avx2(a[0], a[4]); bitonic_minmax_i32_avx2(a[1], a[5]);
+  bitonic_minmax_i32_avx2(a[2], a[6]); bitonic_minmax_i32_avx2(a[3], a[7]);
+  bitonic_minmax_i32_avx2(a[8], a[12]); bitonic_minmax_i32_avx2(a[9], a[13]);
+  bitonic_minmax_i32_avx2(a[10], a[14]); bitonic_minmax_i32_avx2(a[11], a[15]);
+  bitonic_minmax_i32_avx2(a[2], a[4]); bitonic_minmax_i32_avx2(a[3], a[5]);
+  bitonic_minmax_i32_avx2(a[10], a[12]); bitonic_minmax_i32_avx2(a[11], a[13]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[3], a[4]);
+  bitonic_minmax_i32_avx2(a[5], a[6]); bitonic_minmax_i32_avx2(a[9], a[10]);
+  bitonic_minmax_i32_avx2(a[11], a[12]); bitonic_minmax_i32_avx2(a[13], a[14]);
+  bitonic_minmax_i32_avx2(a[0], a[8]); bitonic_minmax_i32_avx2(a[1], a[9]);
+  bitonic_minmax_i32_avx2(a[2], a[10]); bitonic_minmax_i32_avx2(a[3], a[11]);
+  bitonic_minmax_i32_avx2(a[4], a[12]); bitonic_minmax_i32_avx2(a[5], a[13]);
+  bitonic_minmax_i32_avx2(a[6], a[14]); bitonic_minmax_i32_avx2(a[7], a[15]);
+  bitonic_minmax_i32_avx2(a[4], a[8]); bitonic_minmax_i32_avx2(a[5], a[9]);
+  bitonic_minmax_i32_avx2(a[6], a[10]); bitonic_minmax_i32_avx2(a[7], a[11]);
+  bitonic_minmax_i32_avx2(a[2], a[4]); bitonic_minmax_i32_avx2(a[3], a[5]);
+  bitonic_minmax_i32_avx2(a[6], a[8]); bitonic_minmax_i32_avx2(a[7], a[9]);
+  bitonic_minmax_i32_avx2(a[10], a[12]); bitonic_minmax_i32_avx2(a[11], a[13]);
+  bitonic_minmax_i32_avx2(a[1], a[2]); bitonic_minmax_i32_avx2(a[3], a[4]);
+  bitonic_minmax_i32_avx2(a[5], a[6]); bitonic_minmax_i32_avx2(a[7], a[8]);
+  bitonic_minmax_i32_avx2(a[9], a[10]); bitonic_minmax_i32_avx2(a[11], a[12]);
+  bitonic_minmax_i32_avx2(a[13], a[14]);
+  return a[k];
+}
+
+// Median of w values held in w registers (w constant once inlined)
+static inline __m256i netselect_median_i32_avx2(const __m256i* r, const size_t w)
+{
+  switch (w)
+  {
+    case 3:  return netselect_median_3_i32_avx2(r);
+    case 5:  return netselect_median_5_i32_avx2(r);
+    case 7:  return netselect_median_7_i32_avx2(r);
+    case 9:  return netselect_median_9_i32_avx2(r);
+    default: return netselect_median_25_i32_avx2(r);
+  }
+}
+
+// 8 windows per step (w constant once inlined, n - w + 1 >= 8)
+static inline void netselect_median_filter_i32_avx2_k(const int32_t* v, size_t n, int32_t* __restrict out, const size_t w)
+{
+  const size_t m = n - w + 1;
+  __m256i r[25];
+
+  for (size_t i=0; ; i+=8)
+  {
+    if (i + 8 > m)
+    {
+      if (i == m) break;
+      i = m - 8;  // last vector overlaps the previous one
+    }
+    for (size_t j=0; j<w; ++j)
+      r[j] = _mm256_loadu_si256((__m256i const*)(v + i + j));
+    _mm256_storeu_si256((__m256i*)(out + i), netselect_median_i32_avx2(r, w));
+  }
+}
+
+static inline void netselect_median_filter_i32_avx2(const int32_t* v, size_t n, size_t w, int32_t* __restrict out)
+{
+  if (w == 0 || n < w)
+    return;
+  if (n - w + 1 < 8)
+  {
+    netselect_median_filter_i32_std(v, n, w, out);
+    return;
+  }
+
+  switch (w)
+  {
+    case 3:  netselect_median_filter_i32_avx2_k(v, n, out, 3); break;
+    case 5:  netselect_median_filter_i32_avx2_k(v, n, out, 5); break;
+    case 7:  netselect_median_filter_i32_avx2_k(v, n, out, 7); break;
+    case 9:  netselect_median_filter_i32_avx2_k(v, n, out, 9); break;
+    case 25: netselect_median_filter_i32_avx2_k(v, n, out, 25); break;
+    default: netselect_median_filter_i32_std(v, n, w, out); break;
+  }
+}
+
+// 8 groups per step: groups are transposed (one group per lane) and the
+// selected register is stored as is (k constant once inlined)
+static inline void netselect_kth_8_batch_i32_avx2_k(const int32_t* v, size_t groups, int32_t* __restrict out, const size_t k)
+{
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8)
+  {
+    const int32_t* p = v + 8*g;
+    __m256i r[8];
+    for (size_t i=0; i<8; ++i)
+      r[i] = _mm256_loadu_si256((__m256i const*)(p + 8*i));
+
+    netsort_8_batch_transpose_i32_avx2(r);
+    _mm256_storeu_si256((__m256i*)(out + g), netselect_kth_8_i32_avx2(r, k));
+  }
+
+  // Remaining groups
+  netselect_kth_8_batch_i32_std(v + 8*g, groups - g, k, out + g);
+}
+
+// 8 groups per step: lower and upper halves are transposed separately
+static inline void netselect_kth_16_batch_i32_avx2_k(const int32_t* v, size_t groups, int32_t* __restrict out, const size_t k)
+{
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8)
+  {
+    const int32_t* p = v + 16*g;
+    __m256i r[16];
+    for (size_t i=0; i<8; ++i)
+    {
+      r[i]     = _mm256_loadu_si256((__m256i const*)(p + 16*i));
+      r[i + 8] = _mm256_loadu_si256((__m256i const*)(p + 16*i + 8));
+    }
+
+    netsort_8_batch_transpose_i32_avx2(r);
+    netsort_8_batch_transpose_i32_avx2(r + 8);
+    _mm256_storeu_si256((__m256i*)(out + g), netselect_kth_16_i32_avx2(r, k));
+  }
+
+  // Remaining groups
+  netselect_kth_16_batch_i32_std(v + 16*g, groups - g, k, out + g);
+}
+
+static inline void netselect_kth_8_batch_i32_avx2(const int32_t* v, size_t groups, size_t k, int32_t* __restrict out)
+{
+  switch (k)
+  {
+    case 0:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 0); break;
+    case 1:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 1); break;
+    case 2:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 2); break;
+    case 3:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 3); break;
+    case 4:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 4); break;
+    case 5:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 5); break;
+    case 6:  netselect_kth_8_batch_i32_avx2_k(v, groups, out, 6); break;
+    default: netselect_kth_8_batch_i32_avx2_k(v, groups, out, 7); break;
+  }
+}
+
+static inline void netselect_kth_16_batch_i32_avx2(const int32_t* v, size_t groups, size_t k, int32_t* __restrict out)
+{
+  switch (k)
+  {
+    case 0:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 0); break;
+    case 1:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 1); break;
+    case 2:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 2); break;
+    case 3:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 3); break;
+    case 4:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 4); break;
+    case 5:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 5); break;
+    case 6:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 6); break;
+    case 7:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 7); break;
+    case 8:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 8); break;
+    case 9:  netselect_kth_16_batch_i32_avx2_k(v, groups, out, 9); break;
+    case 10: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 10); break;
+    case 11: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 11); break;
+    case 12: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 12); break;
+    case 13: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 13); break;
+    case 14: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 14); break;
+    default: netselect_kth_16_batch_i32_avx2_k(v, groups, out, 15); break;
+  }
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SELECT_I32_H
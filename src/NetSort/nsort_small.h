@@ -0,0 +1,119 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_H
+#define NSORT_SMALL_H
+
+#include "Utils/compiler_utils.h"
+
+#include "nsort_small_i8.h"
+#include "nsort_small_i16.h"
+#include "nsort_small_i32.h"
+#include "nsort_small_i64.h"
+#include "nsort_small_flt.h"
+#include "nsort_small_dbl.h"
+#include "nsort_u8.h"
+#include "nsort_u16.h"
+#include "nsort_u32.h"
+#include "nsort_u64.h"
+
+#include <stdint.h>
+
+// Sort n <= 64 values (best available version, reference 'qsort' otherwise)
+
+
+//
+static inline void netsort_small(int8_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_i8_avx2(v, n);
+#else
+  netsort_small_i8_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(int16_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_i16_avx2(v, n);
+#else
+  netsort_small_i16_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(int32_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_i32_avx2(v, n);
+#else
+  netsort_small_i32_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(int64_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_i64_avx2(v, n);
+#else
+  netsort_small_i64_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(float* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_flt_avx2(v, n);
+#else
+  netsort_small_flt_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(double* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_dbl_avx2(v, n);
+#else
+  netsort_small_dbl_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(uint8_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_u8_avx2(v, n);
+#else
+  netsort_small_u8_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(uint16_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_u16_avx2(v, n);
+#else
+  netsort_small_u16_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(uint32_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_u32_avx2(v, n);
+#else
+  netsort_small_u32_qsort(v, n);
+#endif
+}
+
+static inline void netsort_small(uint64_t* __restrict v, size_t n)
+{
+#ifdef HAS_AVX2_
+  netsort_small_u64_avx2(v, n);
+#else
+  netsort_small_u64_qsort(v, n);
+#endif
+}
+
+
+#endif // NSORT_SMALL_H
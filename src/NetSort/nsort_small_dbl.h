@@ -0,0 +1,105 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_DBL_H
+#define NSORT_SMALL_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_dbl.h"        // cmpfunc_dbl
+#include "nsort_bitonic_dbl.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Sort 0..64 values: the smallest network that fits (4/8/16/32/64) is used,
+// missing lanes are padded with +inf (padding ends up in the upper
+// lanes, never written back).
+// Partial vector is read with an overlapping access ending at v+n: lanes
+// already held by previous vector are replaced by padding (a network doesn't
+// care about input order). Sorted tail is rotated in place and written back
+// the same way. Masked load/store are avoided: they don't forward stores,
+// which stalls when sorting consecutive buckets.
+
+
+//
+static inline void netsort_small_dbl_qsort(double* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(double), cmpfunc_dbl);
+}
+
+//
+#ifdef HAS_AVX2_
+// 4 to 64 values in k registers (k constant once inlined)
+static inline void netsort_small_dbl_avx2_k(double* __restrict v, size_t n, const size_t k)
+{
+  const __m256i iota = _mm256_setr_epi64x(0, 1, 2, 3);
+  const __m256d pad  = _mm256_set1_pd(INFINITY);
+  const size_t full = n >> 2;
+  const int32_t s   = (int32_t)(n & 3);
+  __m256d r[16];
+
+  // Load
+  for (size_t i=0; i<k; ++i)
+    r[i] = (i < full) ? _mm256_loadu_pd(v + 4*i) : pad;
+  if (s)
+  {
+    // lane j <- v[n-4+j], already loaded for j < 4 - s
+    __m256d tail = _mm256_loadu_pd(v + n - 4);
+    r[full] = _mm256_blendv_pd(tail, pad, _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_set1_epi64x(4 - s), iota)));
+  }
+
+  // Sort
+  switch (k)
+  {
+    case 1:  r[0] = bitonic_sort_4_dbl_avx(r[0]); break;
+    case 2:  bitonic_sort_8_dbl_avx(r); break;
+    case 4:  bitonic_sort_16_dbl_avx(r); break;
+    case 8:  bitonic_sort_32_dbl_avx(r); break;
+    default: bitonic_sort_64_dbl_avx(r); break;
+  }
+
+  // Store
+  for (size_t i=0; i<k; ++i)
+    if (i < full)
+      _mm256_storeu_pd(v + 4*i, r[i]);
+  if (s)
+  {
+    // tail[j] <- value at v+n-4+j, from last full register for j < 4 - s
+    // (rotation by s doubles = 2*s floats)
+    __m256i idx = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(2*s));
+    __m256d lo  = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(r[full-1]), idx));
+    __m256d hi  = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(r[full]), idx));
+    __m256d tail = _mm256_blendv_pd(lo, hi, _mm256_castsi256_pd(_mm256_cmpgt_epi64(iota, _mm256_set1_epi64x(3 - s))));
+    _mm256_storeu_pd(v + n - 4, tail);
+  }
+}
+
+static inline void netsort_small_dbl_avx2(double* __restrict v, size_t n)
+{
+  if (n < 4)
+  {
+    // Scalar compare-exchange
+    double a, b;
+    if (n < 2) return;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+    a = v[0]; b = v[1]; v[0] = (a < b) ? a : b; v[1] = (a < b) ? b : a;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+  }
+  else if (n <= 4)
+    netsort_small_dbl_avx2_k(v, n, 1);
+  else if (n <= 8)
+    netsort_small_dbl_avx2_k(v, n, 2);
+  else if (n <= 16)
+    netsort_small_dbl_avx2_k(v, n, 4);
+  else if (n <= 32)
+    netsort_small_dbl_avx2_k(v, n, 8);
+  else
+    netsort_small_dbl_avx2_k(v, n, 16);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SMALL_DBL_H
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_I16_H
+#define NSORT_SMALL_I16_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i16.h"        // cmpfunc_i16
+#include "nsort_bitonic_i16.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Sort 0..64 values: the smallest network that fits (16/32/64) is used,
+// missing lanes are padded with INT16_MAX (padding ends up in the upper
+// lanes, never written back).
+// Partial vector is read with an overlapping access ending at v+n: lanes
+// already held by previous vector are replaced by padding (a network doesn't
+// care about input order). Sorted tail is written back through a stack copy
+// (no variable cross-lane word shift in AVX2).
+
+
+//
+static inline void netsort_small_i16_qsort(int16_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int16_t), cmpfunc_i16);
+}
+
+//
+#ifdef HAS_AVX2_
+// 4 to 15 values: 2 overlapping halves in a single register
+static inline void netsort_small_16_i16_avx2(int16_t* __restrict v, size_t n)
+{
+  const __m256i iota = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m256i pad  = _mm256_set1_epi16(INT16_MAX);
+  int16_t buf[16];
+  __m128i lo, hi;
+  __m256i r, dup;
+
+  // Load -> [ pad | v[n-4..n-1] | v[0..3] ] or [ v[n-8..n-1] | v[0..7] ]
+  if (n < 8)
+  {
+    lo  = _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i const*)(v)), _mm_loadl_epi64((__m128i const*)(v + n - 4)));
+    r   = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), _mm256_castsi256_si128(pad), 1);
+    dup = _mm256_cmpgt_epi16(_mm256_set1_epi16((int16_t)(12 - n)), iota);
+  }
+  else
+  {
+    lo  = _mm_loadu_si128((__m128i const*)(v));
+    hi  = _mm_loadu_si128((__m128i const*)(v + n - 8));
+    r   = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    dup = _mm256_cmpgt_epi16(_mm256_set1_epi16((int16_t)(24 - n)), iota);
+  }
+  dup = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(n < 8 ? 4 : 8), iota), dup);
+  r   = _mm256_blendv_epi8(r, pad, dup);
+
+  // Sort
+  r = bitonic_sort_16_i16_avx2(r);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)buf, r);
+  if (n < 8)
+  {
+    _mm_storel_epi64((__m128i*)(v), _mm256_castsi256_si128(r));
+    _mm_storel_epi64((__m128i*)(v + n - 4), _mm_loadl_epi64((__m128i const*)(buf + n - 4)));
+  }
+  else
+  {
+    _mm_storeu_si128((__m128i*)(v), _mm256_castsi256_si128(r));
+    _mm_storeu_si128((__m128i*)(v + n - 8), _mm_loadu_si128((__m128i const*)(buf + n - 8)));
+  }
+}
+
+// 16 to 64 values in k registers (k constant once inlined)
+static inline void netsort_small_i16_avx2_k(int16_t* __restrict v, size_t n, const size_t k)
+{
+  const __m256i iota = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m256i pad  = _mm256_set1_epi16(INT16_MAX);
+  const size_t full = n >> 4;
+  const size_t s    = n & 15;
+  __m256i r[4];
+
+  // Load
+  for (size_t i=0; i<k; ++i)
+    r[i] = (i < full) ? _mm256_loadu_si256((__m256i const*)(v + 16*i)) : pad;
+  if (s)
+  {
+    // lane j <- v[n-16+j], already loaded for j < 16 - s
+    __m256i tail = _mm256_loadu_si256((__m256i const*)(v + n - 16));
+    r[full] = _mm256_blendv_epi8(tail, pad, _mm256_cmpgt_epi16(_mm256_set1_epi16((int16_t)(16 - s)), iota));
+  }
+
+  // Sort
+  switch (k)
+  {
+    case 1:  r[0] = bitonic_sort_16_i16_avx2(r[0]); break;
+    case 2:  bitonic_sort_32_i16_avx2(r); break;
+    default: bitonic_sort_64_i16_avx2(r); break;
+  }
+
+  // Store
+  for (size_t i=0; i<k; ++i)
+    if (i < full)
+      _mm256_storeu_si256((__m256i*)(v + 16*i), r[i]);
+  if (s)
+  {
+    int16_t buf[32];
+    _mm256_storeu_si256((__m256i*)(buf), r[full-1]);
+    _mm256_storeu_si256((__m256i*)(buf + 16), r[full]);
+    _mm256_storeu_si256((__m256i*)(v + n - 16), _mm256_loadu_si256((__m256i const*)(buf + s)));
+  }
+}
+
+static inline void netsort_small_i16_avx2(int16_t* __restrict v, size_t n)
+{
+  if (n < 4)
+  {
+    // Scalar compare-exchange
+    int16_t a, b;
+    if (n < 2) return;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+    a = v[0]; b = v[1]; v[0] = (a < b) ? a : b; v[1] = (a < b) ? b : a;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+  }
+  else if (n < 16)
+    netsort_small_16_i16_avx2(v, n);
+  else if (n <= 16)
+    netsort_small_i16_avx2_k(v, n, 1);
+  else if (n <= 32)
+    netsort_small_i16_avx2_k(v, n, 2);
+  else
+    netsort_small_i16_avx2_k(v, n, 4);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SMALL_I16_H
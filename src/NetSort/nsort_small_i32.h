@@ -0,0 +1,123 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_I32_H
+#define NSORT_SMALL_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i32.h"        // cmpfunc_i32
+#include "nsort_bitonic_i32.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Sort 0..64 values: the smallest network that fits (8/16/32/64) is used,
+// missing lanes are padded with INT32_MAX (padding ends up in the upper
+// lanes, never written back).
+// Partial vector is read with an overlapping access ending at v+n: lanes
+// already held by previous vector are replaced by padding (a network doesn't
+// care about input order). Sorted tail is rotated in place and written back
+// the same way. Masked load/store are avoided: they don't forward stores,
+// which stalls when sorting consecutive buckets.
+
+
+//
+static inline void netsort_small_i32_qsort(int32_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int32_t), cmpfunc_i32);
+}
+
+//
+#ifdef HAS_AVX2_
+// 4 to 7 values: 2 overlapping halves in a single register
+static inline void netsort_small_8_i32_avx2(int32_t* __restrict v, size_t n)
+{
+  const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+  // Load -> [ v[n-4..n-1] | v[0..3] ]
+  __m256i r = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const*)(v))),
+                                      _mm_loadu_si128((__m128i const*)(v + n - 4)), 1);
+  __m256i dup = _mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)(12 - n)), iota);
+  dup = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), iota), dup);
+  r = _mm256_blendv_epi8(r, _mm256_set1_epi32(INT32_MAX), dup);
+
+  // Sort
+  r = bitonic_sort_8_i32_avx2(r);
+
+  // Store both halves (overlap holds the same values)
+  __m256i hi = _mm256_permutevar8x32_epi32(r, _mm256_add_epi32(iota, _mm256_set1_epi32((int32_t)(n - 4))));
+  _mm_storeu_si128((__m128i*)(v), _mm256_castsi256_si128(r));
+  _mm_storeu_si128((__m128i*)(v + n - 4), _mm256_castsi256_si128(hi));
+}
+
+// 8 to 64 values in k registers (k constant once inlined)
+static inline void netsort_small_i32_avx2_k(int32_t* __restrict v, size_t n, const size_t k)
+{
+  const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i pad  = _mm256_set1_epi32(INT32_MAX);
+  const size_t full = n >> 3;
+  const int32_t s   = (int32_t)(n & 7);
+  __m256i r[8];
+
+  // Load
+  for (size_t i=0; i<k; ++i)
+    r[i] = (i < full) ? _mm256_loadu_si256((__m256i const*)(v + 8*i)) : pad;
+  if (s)
+  {
+    // lane j <- v[n-8+j], already loaded for j < 8 - s
+    __m256i tail = _mm256_loadu_si256((__m256i const*)(v + n - 8));
+    r[full] = _mm256_blendv_epi8(tail, pad, _mm256_cmpgt_epi32(_mm256_set1_epi32(8 - s), iota));
+  }
+
+  // Sort
+  switch (k)
+  {
+    case 1:  r[0] = bitonic_sort_8_i32_avx2(r[0]); break;
+    case 2:  bitonic_sort_16_i32_avx2(r); break;
+    case 4:  bitonic_sort_32_i32_avx2(r); break;
+    default: bitonic_sort_64_i32_avx2(r); break;
+  }
+
+  // Store
+  for (size_t i=0; i<k; ++i)
+    if (i < full)
+      _mm256_storeu_si256((__m256i*)(v + 8*i), r[i]);
+  if (s)
+  {
+    // tail[j] <- value at v+n-8+j, from last full register for j < 8 - s
+    __m256i idx  = _mm256_add_epi32(iota, _mm256_set1_epi32(s));
+    __m256i tail = _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(r[full-1], idx),
+                                      _mm256_permutevar8x32_epi32(r[full], idx),
+                                      _mm256_cmpgt_epi32(iota, _mm256_set1_epi32(7 - s)));
+    _mm256_storeu_si256((__m256i*)(v + n - 8), tail);
+  }
+}
+
+static inline void netsort_small_i32_avx2(int32_t* __restrict v, size_t n)
+{
+  if (n < 4)
+  {
+    // Scalar compare-exchange
+    int32_t a, b;
+    if (n < 2) return;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+    a = v[0]; b = v[1]; v[0] = (a < b) ? a : b; v[1] = (a < b) ? b : a;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+  }
+  else if (n < 8)
+    netsort_small_8_i32_avx2(v, n);
+  else if (n == 8)
+    netsort_small_i32_avx2_k(v, n, 1);
+  else if (n <= 16)
+    netsort_small_i32_avx2_k(v, n, 2);
+  else if (n <= 32)
+    netsort_small_i32_avx2_k(v, n, 4);
+  else
+    netsort_small_i32_avx2_k(v, n, 8);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SMALL_I32_H
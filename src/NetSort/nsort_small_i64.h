@@ -0,0 +1,108 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_I64_H
+#define NSORT_SMALL_I64_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i64.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Sort 0..64 values: the smallest network that fits (4/8/16/32/64) is used,
+// missing lanes are padded with INT64_MAX (padding ends up in the upper
+// lanes, never written back).
+// Partial vector is read with an overlapping access ending at v+n: lanes
+// already held by previous vector are replaced by padding (a network doesn't
+// care about input order). Sorted tail is rotated in place and written back
+// the same way. Masked load/store are avoided: they don't forward stores,
+// which stalls when sorting consecutive buckets.
+
+
+//
+static inline int cmpfunc_i64(const void* __restrict a, const void* __restrict b) {
+  return ( *(const int64_t*)a > *(const int64_t*)b ) - ( *(const int64_t*)a < *(const int64_t*)b );
+}
+
+//
+static inline void netsort_small_i64_qsort(int64_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+#ifdef HAS_AVX2_
+// 4 to 64 values in k registers (k constant once inlined)
+static inline void netsort_small_i64_avx2_k(int64_t* __restrict v, size_t n, const size_t k)
+{
+  const __m256i iota = _mm256_setr_epi64x(0, 1, 2, 3);
+  const __m256i pad  = _mm256_set1_epi64x(INT64_MAX);
+  const size_t full = n >> 2;
+  const int32_t s   = (int32_t)(n & 3);
+  __m256i r[16];
+
+  // Load
+  for (size_t i=0; i<k; ++i)
+    r[i] = (i < full) ? _mm256_loadu_si256((__m256i const*)(v + 4*i)) : pad;
+  if (s)
+  {
+    // lane j <- v[n-4+j], already loaded for j < 4 - s
+    __m256i tail = _mm256_loadu_si256((__m256i const*)(v + n - 4));
+    r[full] = _mm256_blendv_epi8(tail, pad, _mm256_cmpgt_epi64(_mm256_set1_epi64x(4 - s), iota));
+  }
+
+  // Sort
+  switch (k)
+  {
+    case 1:  r[0] = bitonic_sort_4_i64_avx2(r[0]); break;
+    case 2:  bitonic_sort_8_i64_avx2(r); break;
+    case 4:  bitonic_sort_16_i64_avx2(r); break;
+    case 8:  bitonic_sort_32_i64_avx2(r); break;
+    default: bitonic_sort_64_i64_avx2(r); break;
+  }
+
+  // Store
+  for (size_t i=0; i<k; ++i)
+    if (i < full)
+      _mm256_storeu_si256((__m256i*)(v + 4*i), r[i]);
+  if (s)
+  {
+    // tail[j] <- value at v+n-4+j, from last full register for j < 4 - s
+    // (rotation by s int64 = 2*s int32)
+    __m256i idx = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(2*s));
+    __m256i lo  = _mm256_permutevar8x32_epi32(r[full-1], idx);
+    __m256i hi  = _mm256_permutevar8x32_epi32(r[full], idx);
+    __m256i tail = _mm256_blendv_epi8(lo, hi, _mm256_cmpgt_epi64(iota, _mm256_set1_epi64x(3 - s)));
+    _mm256_storeu_si256((__m256i*)(v + n - 4), tail);
+  }
+}
+
+static inline void netsort_small_i64_avx2(int64_t* __restrict v, size_t n)
+{
+  if (n < 4)
+  {
+    // Scalar compare-exchange
+    int64_t a, b;
+    if (n < 2) return;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+    a = v[0]; b = v[1]; v[0] = (a < b) ? a : b; v[1] = (a < b) ? b : a;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+  }
+  else if (n <= 4)
+    netsort_small_i64_avx2_k(v, n, 1);
+  else if (n <= 8)
+    netsort_small_i64_avx2_k(v, n, 2);
+  else if (n <= 16)
+    netsort_small_i64_avx2_k(v, n, 4);
+  else if (n <= 32)
+    netsort_small_i64_avx2_k(v, n, 8);
+  else
+    netsort_small_i64_avx2_k(v, n, 16);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SMALL_I64_H
@@ -0,0 +1,163 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SMALL_I8_H
+#define NSORT_SMALL_I8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"         // cmpfunc_i8
+#include "nsort_bitonic_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Sort 0..64 values: the smallest network that fits (16/32/64) is used,
+// missing lanes are padded with INT8_MAX (padding ends up in the upper
+// lanes, never written back).
+// Partial vector is read with overlapping accesses ending at v+n: lanes
+// already held by previous vector are replaced by padding. Sorted tail is
+// written back through a stack copy.
+
+
+//
+static inline void netsort_small_i8_qsort(int8_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int8_t), cmpfunc_i8);
+}
+
+//
+#ifdef HAS_AVX2_
+// 4 to 15 values: 2 overlapping halves in a single 128-bit register
+static inline void netsort_small_16_i8_sse(int8_t* __restrict v, size_t n)
+{
+  const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i pad  = _mm_set1_epi8(INT8_MAX);
+  int8_t buf[16];
+  __m128i r, dup;
+
+  // Load -> [ pad | v[n-4..n-1] | v[0..3] ] or [ v[n-8..n-1] | v[0..7] ]
+  if (n < 8)
+  {
+    int32_t lo, hi;
+    memcpy(&lo, v, sizeof(lo));
+    memcpy(&hi, v + n - 4, sizeof(hi));
+    r   = _mm_unpacklo_epi64(_mm_unpacklo_epi32(_mm_cvtsi32_si128(lo), _mm_cvtsi32_si128(hi)), pad);
+    dup = _mm_cmplt_epi8(iota, _mm_set1_epi8((int8_t)(12 - n)));
+    dup = _mm_andnot_si128(_mm_cmplt_epi8(iota, _mm_set1_epi8(4)), dup);
+  }
+  else
+  {
+    r   = _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i const*)(v)), _mm_loadl_epi64((__m128i const*)(v + n - 8)));
+    dup = _mm_cmplt_epi8(iota, _mm_set1_epi8((int8_t)(24 - n)));
+    dup = _mm_andnot_si128(_mm_cmplt_epi8(iota, _mm_set1_epi8(8)), dup);
+  }
+  r = _mm_blendv_epi8(r, pad, dup);
+
+  // Sort
+  r = bitonic_sort_16_i8_sse(r);
+
+  // Store
+  _mm_storeu_si128((__m128i*)buf, r);
+  if (n < 8)
+  {
+    memcpy(v, buf, 4);
+    memcpy(v + n - 4, buf + n - 4, 4);
+  }
+  else
+  {
+    _mm_storel_epi64((__m128i*)(v), r);
+    _mm_storel_epi64((__m128i*)(v + n - 8), _mm_loadl_epi64((__m128i const*)(buf + n - 8)));
+  }
+}
+
+// 16 to 31 values: 2 overlapping halves in a single register
+static inline void netsort_small_32_i8_avx2(int8_t* __restrict v, size_t n)
+{
+  const __m256i iota = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+  const __m256i pad  = _mm256_set1_epi8(INT8_MAX);
+  int8_t buf[32];
+  __m256i r, dup;
+
+  // Load -> [ v[n-16..n-1] | v[0..15] ]
+  r   = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const*)(v))),
+                                _mm_loadu_si128((__m128i const*)(v + n - 16)), 1);
+  dup = _mm256_cmpgt_epi8(_mm256_set1_epi8((int8_t)(48 - n)), iota);
+  dup = _mm256_andnot_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(16), iota), dup);
+  r   = _mm256_blendv_epi8(r, pad, dup);
+
+  // Sort
+  r = bitonic_sort_32_i8_avx2(r);
+
+  // Store
+  _mm256_storeu_si256((__m256i*)buf, r);
+  _mm_storeu_si128((__m128i*)(v), _mm256_castsi256_si128(r));
+  _mm_storeu_si128((__m128i*)(v + n - 16), _mm_loadu_si128((__m128i const*)(buf + n - 16)));
+}
+
+// 32 to 64 values in k registers (k constant once inlined)
+static inline void netsort_small_i8_avx2_k(int8_t* __restrict v, size_t n, const size_t k)
+{
+  const __m256i iota = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+  const __m256i pad  = _mm256_set1_epi8(INT8_MAX);
+  const size_t full = n >> 5;
+  const size_t s    = n & 31;
+  __m256i r[2];
+
+  // Load
+  for (size_t i=0; i<k; ++i)
+    r[i] = (i < full) ? _mm256_loadu_si256((__m256i const*)(v + 32*i)) : pad;
+  if (s)
+  {
+    // lane j <- v[n-32+j], already loaded for j < 32 - s
+    __m256i tail = _mm256_loadu_si256((__m256i const*)(v + n - 32));
+    r[full] = _mm256_blendv_epi8(tail, pad, _mm256_cmpgt_epi8(_mm256_set1_epi8((int8_t)(32 - s)), iota));
+  }
+
+  // Sort
+  if (k == 1)
+    r[0] = bitonic_sort_32_i8_avx2(r[0]);
+  else
+    bitonic_sort_64_i8_avx2(r);
+
+  // Store
+  for (size_t i=0; i<k; ++i)
+    if (i < full)
+      _mm256_storeu_si256((__m256i*)(v + 32*i), r[i]);
+  if (s)
+  {
+    int8_t buf[64];
+    _mm256_storeu_si256((__m256i*)(buf), r[full-1]);
+    _mm256_storeu_si256((__m256i*)(buf + 32), r[full]);
+    _mm256_storeu_si256((__m256i*)(v + n - 32), _mm256_loadu_si256((__m256i const*)(buf + s)));
+  }
+}
+
+static inline void netsort_small_i8_avx2(int8_t* __restrict v, size_t n)
+{
+  if (n < 4)
+  {
+    // Scalar compare-exchange
+    int8_t a, b;
+    if (n < 2) return;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+    a = v[0]; b = v[1]; v[0] = (a < b) ? a : b; v[1] = (a < b) ? b : a;
+    if (n == 3) { a = v[1]; b = v[2]; v[1] = (a < b) ? a : b; v[2] = (a < b) ? b : a; }
+  }
+  else if (n < 16)
+    netsort_small_16_i8_sse(v, n);
+  else if (n < 32)
+    netsort_small_32_i8_avx2(v, n);
+  else if (n == 32)
+    netsort_small_i8_avx2_k(v, n, 1);
+  else
+    netsort_small_i8_avx2_k(v, n, 2);
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_SMALL_I8_H
@@ -0,0 +1,196 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_SORTED_H
+#define NSORT_SORTED_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_small.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Sorted input checks and adaptive small sorts:
+// - 'netsort_is_sorted' (non-decreasing) and 'netsort_is_sorted_desc'
+//   (non-increasing) for n values of any length: each vector is compared with
+//   the same vector shifted by one value (second unaligned load), 2 vectors
+//   per iteration with early exit, scalar tail
+//   unsigned: sign bit flipped, float/double: ordered compares (pairs with a
+//   NaN do not break the order, as with 'std::is_sorted')
+// - 'netsort_adaptive' (n <= 64): sorted inputs are returned as is, reversed
+//   ones are reversed, 'netsort_small' otherwise (random inputs usually fail
+//   both checks on the first vector)
+
+
+// Reference
+template <typename T>
+static inline bool netsort_is_sorted_std(const T* v, size_t n)      { return std::is_sorted(v, v + n); }
+template <typename T>
+static inline bool netsort_is_sorted_desc_std(const T* v, size_t n) { return std::is_sorted(v, v + n, [](T a, T b) { return b < a; }); }
+
+//
+#ifdef HAS_AVX2_
+// Out of order pairs (p[i], p[i+1]) of one vector, as a movemask
+template <bool Desc>
+static inline int netsort_unordered_avx2(const int8_t* p)
+{
+  __m256i a = _mm256_loadu_si256((__m256i const*)(p));
+  __m256i b = _mm256_loadu_si256((__m256i const*)(p + 1));
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi8(b, a) : _mm256_cmpgt_epi8(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const uint8_t* p)
+{
+  const __m256i sign = _mm256_set1_epi8((char)0x80);
+  __m256i a = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p)), sign);
+  __m256i b = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p + 1)), sign);
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi8(b, a) : _mm256_cmpgt_epi8(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const int16_t* p)
+{
+  __m256i a = _mm256_loadu_si256((__m256i const*)(p));
+  __m256i b = _mm256_loadu_si256((__m256i const*)(p + 1));
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi16(b, a) : _mm256_cmpgt_epi16(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const uint16_t* p)
+{
+  const __m256i sign = _mm256_set1_epi16((short)0x8000);
+  __m256i a = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p)), sign);
+  __m256i b = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p + 1)), sign);
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi16(b, a) : _mm256_cmpgt_epi16(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const int32_t* p)
+{
+  __m256i a = _mm256_loadu_si256((__m256i const*)(p));
+  __m256i b = _mm256_loadu_si256((__m256i const*)(p + 1));
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi32(b, a) : _mm256_cmpgt_epi32(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const uint32_t* p)
+{
+  const __m256i sign = _mm256_set1_epi32((int)0x80000000);
+  __m256i a = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p)), sign);
+  __m256i b = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p + 1)), sign);
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi32(b, a) : _mm256_cmpgt_epi32(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const int64_t* p)
+{
+  __m256i a = _mm256_loadu_si256((__m256i const*)(p));
+  __m256i b = _mm256_loadu_si256((__m256i const*)(p + 1));
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi64(b, a) : _mm256_cmpgt_epi64(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const uint64_t* p)
+{
+  const __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+  __m256i a = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p)), sign);
+  __m256i b = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(p + 1)), sign);
+  return _mm256_movemask_epi8(Desc ? _mm256_cmpgt_epi64(b, a) : _mm256_cmpgt_epi64(a, b));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const float* p)
+{
+  __m256 a = _mm256_loadu_ps(p);
+  __m256 b = _mm256_loadu_ps(p + 1);
+  return _mm256_movemask_ps(Desc ? _mm256_cmp_ps(b, a, _CMP_GT_OQ) : _mm256_cmp_ps(a, b, _CMP_GT_OQ));
+}
+
+template <bool Desc>
+static inline int netsort_unordered_avx2(const double* p)
+{
+  __m256d a = _mm256_loadu_pd(p);
+  __m256d b = _mm256_loadu_pd(p + 1);
+  return _mm256_movemask_pd(Desc ? _mm256_cmp_pd(b, a, _CMP_GT_OQ) : _mm256_cmp_pd(a, b, _CMP_GT_OQ));
+}
+
+// Check pairs (v[i], v[i+1]) for i < n-1 (vector loads stay below v + n)
+template <typename T, bool Desc>
+static inline bool netsort_is_sorted_k_avx2(const T* v, size_t n)
+{
+  const size_t L = 32 / sizeof(T);
+  size_t i = 0;
+  for (; i + 2*L < n; i += 2*L)
+    if (netsort_unordered_avx2<Desc>(v + i) | netsort_unordered_avx2<Desc>(v + i + L))
+      return false;
+  if (i + L < n)
+  {
+    if (netsort_unordered_avx2<Desc>(v + i))
+      return false;
+    i += L;
+  }
+  for (; i + 1 < n; ++i)
+    if (Desc ? (v[i] < v[i+1]) : (v[i+1] < v[i]))
+      return false;
+  return true;
+}
+
+template <typename T>
+static inline bool netsort_is_sorted_avx2(const T* v, size_t n)      { return netsort_is_sorted_k_avx2<T, false>(v, n); }
+template <typename T>
+static inline bool netsort_is_sorted_desc_avx2(const T* v, size_t n) { return netsort_is_sorted_k_avx2<T, true>(v, n); }
+#endif // HAS_AVX2_
+
+
+// Best available version (reference for other types)
+template <typename T>
+static inline bool netsort_is_sorted(const T* v, size_t n)      { return netsort_is_sorted_std(v, n); }
+template <typename T>
+static inline bool netsort_is_sorted_desc(const T* v, size_t n) { return netsort_is_sorted_desc_std(v, n); }
+
+#ifdef HAS_AVX2_
+static inline bool netsort_is_sorted(const int8_t* v, size_t n)        { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const uint8_t* v, size_t n)       { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const int16_t* v, size_t n)       { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const uint16_t* v, size_t n)      { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const int32_t* v, size_t n)       { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const uint32_t* v, size_t n)      { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const int64_t* v, size_t n)       { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const uint64_t* v, size_t n)      { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const float* v, size_t n)         { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted(const double* v, size_t n)        { return netsort_is_sorted_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const int8_t* v, size_t n)   { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const uint8_t* v, size_t n)  { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const int16_t* v, size_t n)  { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const uint16_t* v, size_t n) { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const int32_t* v, size_t n)  { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const uint32_t* v, size_t n) { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const int64_t* v, size_t n)  { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const uint64_t* v, size_t n) { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const float* v, size_t n)    { return netsort_is_sorted_desc_avx2(v, n); }
+static inline bool netsort_is_sorted_desc(const double* v, size_t n)   { return netsort_is_sorted_desc_avx2(v, n); }
+#endif // HAS_AVX2_
+
+// Sort n <= 64 values, sorted and reversed inputs detected first
+template <typename T>
+static inline void netsort_adaptive(T* __restrict v, size_t n)
+{
+  if (netsort_is_sorted(v, n))
+    return;
+  if (netsort_is_sorted_desc(v, n))
+  {
+    std::reverse(v, v + n);
+    return;
+  }
+  netsort_small(v, n);
+}
+
+
+#endif // NSORT_SORTED_H
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_U16_H
+#define NSORT_U16_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i16.h"
+#include "nsort_bitonic_i16.h"
+#include "nsort_small_i16.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// uint16 networks: same sign bit flip as nsort_u8.h, around the int16 networks
+
+//
+static inline int cmpfunc_u16(const void* __restrict a, const void* __restrict b) {
+  return ( *(const uint16_t*)a > *(const uint16_t*)b ) - ( *(const uint16_t*)a < *(const uint16_t*)b );
+}
+
+//
+static inline void netsort_8_u16_qsort(uint16_t* __restrict v)
+{
+  qsort(v, 8, sizeof(uint16_t), cmpfunc_u16);
+}
+
+//
+static inline void netsort_16_u16_qsort(uint16_t* __restrict v)
+{
+  qsort(v, 16, sizeof(uint16_t), cmpfunc_u16);
+}
+
+//
+static inline void netsort_32_u16_qsort(uint16_t* __restrict v)
+{
+  qsort(v, 32, sizeof(uint16_t), cmpfunc_u16);
+}
+
+//
+static inline void netsort_64_u16_qsort(uint16_t* __restrict v)
+{
+  qsort(v, 64, sizeof(uint16_t), cmpfunc_u16);
+}
+
+//
+static inline void netsort_small_u16_qsort(uint16_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(uint16_t), cmpfunc_u16);
+}
+
+//
+#ifdef HAS_SSSE3_
+static inline void netsort_8_u16_sse(uint16_t* __restrict v)
+{
+  const __m128i sign = _mm_set1_epi16(INT16_MIN);
+  __m128i r = _mm_xor_si128(_mm_loadu_si128((__m128i const*)(v)), sign);
+
+  r = netsort_8_i16_sse(r);
+
+  _mm_storeu_si128((__m128i*)(v), _mm_xor_si128(r, sign));
+}
+#endif // HAS_SSSE3_
+
+//
+#ifdef HAS_AVX2_
+static inline void netsort_16_u16_avx2(uint16_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi16(INT16_MIN);
+  __m256i r = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+
+  r = bitonic_sort_16_i16_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r, sign));
+}
+
+static inline void netsort_32_u16_avx2(uint16_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi16(INT16_MIN);
+  __m256i r[2];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 16)), sign);
+
+  bitonic_sort_32_i16_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 16), _mm256_xor_si256(r[1], sign));
+}
+
+static inline void netsort_64_u16_avx2(uint16_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi16(INT16_MIN);
+  __m256i r[4];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 16)), sign);
+  r[2] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 32)), sign);
+  r[3] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 48)), sign);
+
+  bitonic_sort_64_i16_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 16), _mm256_xor_si256(r[1], sign));
+  _mm256_storeu_si256((__m256i*)(v + 32), _mm256_xor_si256(r[2], sign));
+  _mm256_storeu_si256((__m256i*)(v + 48), _mm256_xor_si256(r[3], sign));
+}
+
+// Sign bit flipped in place around the signed network (at most 64 values)
+static inline void netsort_small_u16_avx2(uint16_t* __restrict v, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x8000u;
+  netsort_small_i16_avx2((int16_t*)v, n);
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x8000u;
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_U16_H
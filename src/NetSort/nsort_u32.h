@@ -0,0 +1,136 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_U32_H
+#define NSORT_U32_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_bitonic_i32.h"
+#include "nsort_small_i32.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// uint32 networks: same sign bit flip as nsort_u8.h, around the int32 bitonic networks
+
+//
+static inline int cmpfunc_u32(const void* __restrict a, const void* __restrict b) {
+  return ( *(const uint32_t*)a > *(const uint32_t*)b ) - ( *(const uint32_t*)a < *(const uint32_t*)b );
+}
+
+//
+static inline void netsort_8_u32_qsort(uint32_t* __restrict v)
+{
+  qsort(v, 8, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+static inline void netsort_16_u32_qsort(uint32_t* __restrict v)
+{
+  qsort(v, 16, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+static inline void netsort_32_u32_qsort(uint32_t* __restrict v)
+{
+  qsort(v, 32, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+static inline void netsort_64_u32_qsort(uint32_t* __restrict v)
+{
+  qsort(v, 64, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+static inline void netsort_small_u32_qsort(uint32_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+#ifdef HAS_AVX2_
+static inline void netsort_8_u32_avx2(uint32_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  __m256i r = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+
+  r = bitonic_sort_8_i32_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r, sign));
+}
+
+static inline void netsort_16_u32_avx2(uint32_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  __m256i r[2];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 8)), sign);
+
+  bitonic_sort_16_i32_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 8), _mm256_xor_si256(r[1], sign));
+}
+
+static inline void netsort_32_u32_avx2(uint32_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  __m256i r[4];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 8)), sign);
+  r[2] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 16)), sign);
+  r[3] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 24)), sign);
+
+  bitonic_sort_32_i32_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 8), _mm256_xor_si256(r[1], sign));
+  _mm256_storeu_si256((__m256i*)(v + 16), _mm256_xor_si256(r[2], sign));
+  _mm256_storeu_si256((__m256i*)(v + 24), _mm256_xor_si256(r[3], sign));
+}
+
+static inline void netsort_64_u32_avx2(uint32_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  __m256i r[8];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 8)), sign);
+  r[2] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 16)), sign);
+  r[3] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 24)), sign);
+  r[4] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 32)), sign);
+  r[5] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 40)), sign);
+  r[6] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 48)), sign);
+  r[7] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 56)), sign);
+
+  bitonic_sort_64_i32_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 8), _mm256_xor_si256(r[1], sign));
+  _mm256_storeu_si256((__m256i*)(v + 16), _mm256_xor_si256(r[2], sign));
+  _mm256_storeu_si256((__m256i*)(v + 24), _mm256_xor_si256(r[3], sign));
+  _mm256_storeu_si256((__m256i*)(v + 32), _mm256_xor_si256(r[4], sign));
+  _mm256_storeu_si256((__m256i*)(v + 40), _mm256_xor_si256(r[5], sign));
+  _mm256_storeu_si256((__m256i*)(v + 48), _mm256_xor_si256(r[6], sign));
+  _mm256_storeu_si256((__m256i*)(v + 56), _mm256_xor_si256(r[7], sign));
+}
+
+// Sign bit flipped in place around the signed network (at most 64 values)
+static inline void netsort_small_u32_avx2(uint32_t* __restrict v, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x80000000u;
+  netsort_small_i32_avx2((int32_t*)v, n);
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x80000000u;
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_U32_H
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_U64_H
+#define NSORT_U64_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_i64.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// uint64 networks: same sign bit flip as nsort_u8.h, around the int64 networks
+
+//
+static inline int cmpfunc_u64(const void* __restrict a, const void* __restrict b) {
+  return ( *(const uint64_t*)a > *(const uint64_t*)b ) - ( *(const uint64_t*)a < *(const uint64_t*)b );
+}
+
+//
+static inline void netsort_8_u64_qsort(uint64_t* __restrict v)
+{
+  qsort(v, 8, sizeof(uint64_t), cmpfunc_u64);
+}
+
+//
+static inline void netsort_16_u64_qsort(uint64_t* __restrict v)
+{
+  qsort(v, 16, sizeof(uint64_t), cmpfunc_u64);
+}
+
+//
+static inline void netsort_32_u64_qsort(uint64_t* __restrict v)
+{
+  qsort(v, 32, sizeof(uint64_t), cmpfunc_u64);
+}
+
+//
+static inline void netsort_64_u64_qsort(uint64_t* __restrict v)
+{
+  qsort(v, 64, sizeof(uint64_t), cmpfunc_u64);
+}
+
+//
+static inline void netsort_small_u64_qsort(uint64_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(uint64_t), cmpfunc_u64);
+}
+
+//
+#ifdef HAS_AVX2_
+static inline void netsort_8_u64_avx2(uint64_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+  __m256i r[2];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 4)), sign);
+
+  bitonic_sort_8_i64_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 4), _mm256_xor_si256(r[1], sign));
+}
+
+static inline void netsort_16_u64_avx2(uint64_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+  __m256i r[4];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 4)), sign);
+  r[2] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 8)), sign);
+  r[3] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 12)), sign);
+
+  bitonic_sort_16_i64_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 4), _mm256_xor_si256(r[1], sign));
+  _mm256_storeu_si256((__m256i*)(v + 8), _mm256_xor_si256(r[2], sign));
+  _mm256_storeu_si256((__m256i*)(v + 12), _mm256_xor_si256(r[3], sign));
+}
+
+static inline void netsort_32_u64_avx2(uint64_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+  __m256i r[8];
+  for (size_t i=0; i<8; ++i)
+    r[i] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 4*i)), sign);
+
+  bitonic_sort_32_i64_avx2(r);
+
+  for (size_t i=0; i<8; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), _mm256_xor_si256(r[i], sign));
+}
+
+static inline void netsort_64_u64_avx2(uint64_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+  __m256i r[16];
+  for (size_t i=0; i<16; ++i)
+    r[i] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 4*i)), sign);
+
+  bitonic_sort_64_i64_avx2(r);
+
+  for (size_t i=0; i<16; ++i)
+    _mm256_storeu_si256((__m256i*)(v + 4*i), _mm256_xor_si256(r[i], sign));
+}
+
+// Sign bit flipped in place around the signed network (at most 64 values)
+static inline void netsort_small_u64_avx2(uint64_t* __restrict v, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x8000000000000000ull;
+  netsort_small_i64_avx2((int64_t*)v, n);
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x8000000000000000ull;
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_U64_H
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef NSORT_U8_H
+#define NSORT_U8_H
+
+#include "Utils/compiler_utils.h"
+#include "nsort_8_i8.h"
+#include "nsort_bitonic_i8.h"
+#include "nsort_small_i8.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// uint8 networks: values are sorted as int8 after flipping the sign bit (order
+// preserving bijection), in register around the int8 networks (one xor per
+// register before and after). 8 values and any length up to 64 are flipped in
+// memory, around netsort_8_i8_sse and netsort_small_i8_avx2.
+
+//
+static inline int cmpfunc_u8(const void* __restrict a, const void* __restrict b) {
+  return ( *(const uint8_t*)a > *(const uint8_t*)b ) - ( *(const uint8_t*)a < *(const uint8_t*)b );
+}
+
+//
+static inline void netsort_8_u8_qsort(uint8_t* __restrict v)
+{
+  qsort(v, 8, sizeof(uint8_t), cmpfunc_u8);
+}
+
+//
+static inline void netsort_16_u8_qsort(uint8_t* __restrict v)
+{
+  qsort(v, 16, sizeof(uint8_t), cmpfunc_u8);
+}
+
+//
+static inline void netsort_32_u8_qsort(uint8_t* __restrict v)
+{
+  qsort(v, 32, sizeof(uint8_t), cmpfunc_u8);
+}
+
+//
+static inline void netsort_64_u8_qsort(uint8_t* __restrict v)
+{
+  qsort(v, 64, sizeof(uint8_t), cmpfunc_u8);
+}
+
+//
+static inline void netsort_small_u8_qsort(uint8_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(uint8_t), cmpfunc_u8);
+}
+
+//
+#ifdef HAS_SSSE3_
+static inline void netsort_8_u8_sse(uint8_t* __restrict v)
+{
+  uint64_t x;
+  memcpy(&x, v, sizeof(x));
+  x ^= 0x8080808080808080ull;
+  memcpy(v, &x, sizeof(x));
+  netsort_8_i8_sse((int8_t*)v);
+  memcpy(&x, v, sizeof(x));
+  x ^= 0x8080808080808080ull;
+  memcpy(v, &x, sizeof(x));
+}
+#endif // HAS_SSSE3_
+
+//
+#ifdef HAS_SSE4_1_
+static inline void netsort_16_u8_sse(uint8_t* __restrict v)
+{
+  const __m128i sign = _mm_set1_epi8(INT8_MIN);
+  __m128i r = _mm_xor_si128(_mm_loadu_si128((__m128i const*)(v)), sign);
+
+  r = bitonic_sort_16_i8_sse(r);
+
+  _mm_storeu_si128((__m128i*)(v), _mm_xor_si128(r, sign));
+}
+#endif // HAS_SSE4_1_
+
+//
+#ifdef HAS_AVX2_
+static inline void netsort_32_u8_avx2(uint8_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi8(INT8_MIN);
+  __m256i r = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+
+  r = bitonic_sort_32_i8_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r, sign));
+}
+
+static inline void netsort_64_u8_avx2(uint8_t* __restrict v)
+{
+  const __m256i sign = _mm256_set1_epi8(INT8_MIN);
+  __m256i r[2];
+  r[0] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v)), sign);
+  r[1] = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(v + 32)), sign);
+
+  bitonic_sort_64_i8_avx2(r);
+
+  _mm256_storeu_si256((__m256i*)(v), _mm256_xor_si256(r[0], sign));
+  _mm256_storeu_si256((__m256i*)(v + 32), _mm256_xor_si256(r[1], sign));
+}
+
+// Sign bit flipped in place around the signed network (at most 64 values)
+static inline void netsort_small_u8_avx2(uint8_t* __restrict v, size_t n)
+{
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x80u;
+  netsort_small_i8_avx2((int8_t*)v, n);
+  for (size_t i=0; i<n; ++i)
+    v[i] ^= 0x80u;
+}
+#endif // HAS_AVX2_
+
+
+#endif // NSORT_U8_H
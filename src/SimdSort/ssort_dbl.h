@@ -0,0 +1,286 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_DBL_H
+#define SSORT_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_dbl.h"
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+#include "ssort_partition.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_DBL_BASE
+  #define SSORT_DBL_BASE 64   // base case size (netsort_small, 32 to 64)
+#endif
+
+// Same quicksort as ssort_i32.h, 4 x double per AVX2 vector (LUT of 32-bit
+// index pairs), 8 per AVX-512 vector
+// NaNs are first moved to the end (one 'simdpartition_if' pass, unordered):
+// the min/max networks of the base case would lose or duplicate them
+
+
+//
+static inline void simdsort_dbl_std(double* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+//
+static inline void simdsort_dbl_qsort(double* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(double), cmpfunc_dbl);
+}
+
+//
+static inline double simdsort_pivot_dbl(double const* __restrict v, size_t n)
+{
+  size_t s = n >> 3;
+  double a = simdsort_med3(v[s],     v[2*s],   v[3*s]);
+  double b = simdsort_med3(v[3*s+1], v[4*s],   v[5*s]);
+  double c = simdsort_med3(v[5*s+1], v[6*s],   v[7*s]);
+  return simdsort_med3(a, b, c);
+}
+
+//
+#ifdef HAS_AVX2_
+// Partition n >= 8 values, return number of values < pivot
+static inline size_t simdsort_partition_dbl_avx2(double* __restrict v, size_t n, double pivot)
+{
+  const __m256d p = _mm256_set1_pd(pivot);
+  double* l_w = v;
+  double* r_w = v + n;
+  double* l_r = v + 4;
+  double* r_r = v + n - 4;
+  __m256d vl = _mm256_loadu_pd(v);
+  __m256d vr = _mm256_loadu_pd(v + n - 4);
+
+  while (r_r - l_r >= 4)
+  {
+    __m256d x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm256_loadu_pd(l_r);
+      l_r += 4;
+    }
+    else
+    {
+      r_r -= 4;
+      x = _mm256_loadu_pd(r_r);
+    }
+
+    int m = _mm256_movemask_pd(_mm256_cmp_pd(x, p, _CMP_LT_OQ));
+    int c = _mm_popcnt_u32(m);
+    x = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(x), ssort_perm_idx_avx2(ssort_perm_4[m])));
+    _mm256_storeu_pd(l_w, x);
+    _mm256_storeu_pd(r_w - 4, x);
+    l_w += c;
+    r_w -= 4 - c;
+  }
+
+  // Remaining < 4: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    double e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 8 free slots left)
+  int m = _mm256_movemask_pd(_mm256_cmp_pd(vl, p, _CMP_LT_OQ));
+  int c = _mm_popcnt_u32(m);
+  vl = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(vl), ssort_perm_idx_avx2(ssort_perm_4[m])));
+  _mm256_storeu_pd(l_w, vl);
+  _mm256_storeu_pd(r_w - 4, vl);
+  l_w += c;
+  r_w -= 4 - c;
+
+  m = _mm256_movemask_pd(_mm256_cmp_pd(vr, p, _CMP_LT_OQ));
+  c = _mm_popcnt_u32(m);
+  vr = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(vr), ssort_perm_idx_avx2(ssort_perm_4[m])));
+  _mm256_storeu_pd(l_w, vr);
+  _mm256_storeu_pd(r_w - 4, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_dbl_avx2_rec(double* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_DBL_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    double pivot = simdsort_pivot_dbl(v, n);
+    size_t m = simdsort_partition_dbl_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INFINITY)
+        return;
+      m = simdsort_partition_dbl_avx2(v, n, nextafter(pivot, INFINITY));
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_dbl_avx2_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_dbl_avx2_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_dbl_avx2(v, n);
+}
+
+static inline void simdsort_dbl_avx2(double* __restrict v, size_t n)
+{
+  n = simdpartition_if_avx2(v, n, [](double x) { return x == x; });  // NaNs to the end
+  simdsort_dbl_avx2_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Partition n >= 16 values, return number of values < pivot
+static inline size_t simdsort_partition_dbl_avx512(double* __restrict v, size_t n, double pivot)
+{
+  const __m512d p = _mm512_set1_pd(pivot);
+  double* l_w = v;
+  double* r_w = v + n;
+  double* l_r = v + 8;
+  double* r_r = v + n - 8;
+  __m512d vl = _mm512_loadu_pd(v);
+  __m512d vr = _mm512_loadu_pd(v + n - 8);
+
+  while (r_r - l_r >= 8)
+  {
+    __m512d x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm512_loadu_pd(l_r);
+      l_r += 8;
+    }
+    else
+    {
+      r_r -= 8;
+      x = _mm512_loadu_pd(r_r);
+    }
+
+    __mmask8 m = _mm512_cmp_pd_mask(x, p, _CMP_LT_OQ);
+    int c = _mm_popcnt_u32(m);
+    _mm512_mask_compressstoreu_pd(l_w, m, x);
+    _mm512_mask_compressstoreu_pd(r_w - (8 - c), (__mmask8)~m, x);
+    l_w += c;
+    r_w -= 8 - c;
+  }
+
+  // Remaining < 8: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    double e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 16 free slots left)
+  __mmask8 m = _mm512_cmp_pd_mask(vl, p, _CMP_LT_OQ);
+  int c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_pd(l_w, m, vl);
+  _mm512_mask_compressstoreu_pd(r_w - (8 - c), (__mmask8)~m, vl);
+  l_w += c;
+  r_w -= 8 - c;
+
+  m = _mm512_cmp_pd_mask(vr, p, _CMP_LT_OQ);
+  c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_pd(l_w, m, vr);
+  _mm512_mask_compressstoreu_pd(r_w - (8 - c), (__mmask8)~m, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_dbl_avx512_rec(double* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_DBL_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    double pivot = simdsort_pivot_dbl(v, n);
+    size_t m = simdsort_partition_dbl_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INFINITY)
+        return;
+      m = simdsort_partition_dbl_avx512(v, n, nextafter(pivot, INFINITY));
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_dbl_avx512_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_dbl_avx512_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_dbl_avx2(v, n);
+}
+
+static inline void simdsort_dbl_avx512(double* __restrict v, size_t n)
+{
+  n = simdpartition_if_avx512(v, n, [](double x) { return x == x; });  // NaNs to the end
+  simdsort_dbl_avx512_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_DBL_H
@@ -0,0 +1,286 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_FLT_H
+#define SSORT_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_flt.h"
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+#include "ssort_partition.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_FLT_BASE
+  #define SSORT_FLT_BASE 64   // base case size (netsort_small, 32 to 64)
+#endif
+
+// Same quicksort as ssort_i32.h, equal values are split off with the next
+// float above the pivot
+// NaNs are first moved to the end (one 'simdpartition_if' pass, unordered):
+// the min/max networks of the base case would lose or duplicate them
+
+
+//
+static inline void simdsort_flt_std(float* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+//
+static inline void simdsort_flt_qsort(float* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(float), cmpfunc_flt);
+}
+
+//
+static inline float simdsort_pivot_flt(float const* __restrict v, size_t n)
+{
+  size_t s = n >> 3;
+  float a = simdsort_med3(v[s],     v[2*s],   v[3*s]);
+  float b = simdsort_med3(v[3*s+1], v[4*s],   v[5*s]);
+  float c = simdsort_med3(v[5*s+1], v[6*s],   v[7*s]);
+  return simdsort_med3(a, b, c);
+}
+
+//
+#ifdef HAS_AVX2_
+// Partition n >= 16 values, return number of values < pivot
+static inline size_t simdsort_partition_flt_avx2(float* __restrict v, size_t n, float pivot)
+{
+  const __m256 p = _mm256_set1_ps(pivot);
+  float* l_w = v;
+  float* r_w = v + n;
+  float* l_r = v + 8;
+  float* r_r = v + n - 8;
+  __m256 vl = _mm256_loadu_ps(v);
+  __m256 vr = _mm256_loadu_ps(v + n - 8);
+
+  while (r_r - l_r >= 8)
+  {
+    __m256 x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm256_loadu_ps(l_r);
+      l_r += 8;
+    }
+    else
+    {
+      r_r -= 8;
+      x = _mm256_loadu_ps(r_r);
+    }
+
+    int m = _mm256_movemask_ps(_mm256_cmp_ps(x, p, _CMP_LT_OQ));
+    int c = _mm_popcnt_u32(m);
+    x = _mm256_permutevar8x32_ps(x, ssort_perm_idx_avx2(ssort_perm_8[m]));
+    _mm256_storeu_ps(l_w, x);
+    _mm256_storeu_ps(r_w - 8, x);
+    l_w += c;
+    r_w -= 8 - c;
+  }
+
+  // Remaining < 8: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    float e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 16 free slots left)
+  int m = _mm256_movemask_ps(_mm256_cmp_ps(vl, p, _CMP_LT_OQ));
+  int c = _mm_popcnt_u32(m);
+  vl = _mm256_permutevar8x32_ps(vl, ssort_perm_idx_avx2(ssort_perm_8[m]));
+  _mm256_storeu_ps(l_w, vl);
+  _mm256_storeu_ps(r_w - 8, vl);
+  l_w += c;
+  r_w -= 8 - c;
+
+  m = _mm256_movemask_ps(_mm256_cmp_ps(vr, p, _CMP_LT_OQ));
+  c = _mm_popcnt_u32(m);
+  vr = _mm256_permutevar8x32_ps(vr, ssort_perm_idx_avx2(ssort_perm_8[m]));
+  _mm256_storeu_ps(l_w, vr);
+  _mm256_storeu_ps(r_w - 8, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_flt_avx2_rec(float* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_FLT_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    float pivot = simdsort_pivot_flt(v, n);
+    size_t m = simdsort_partition_flt_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INFINITY)
+        return;
+      m = simdsort_partition_flt_avx2(v, n, nextafterf(pivot, INFINITY));
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_flt_avx2_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_flt_avx2_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_flt_avx2(v, n);
+}
+
+static inline void simdsort_flt_avx2(float* __restrict v, size_t n)
+{
+  n = simdpartition_if_avx2(v, n, [](float x) { return x == x; });  // NaNs to the end
+  simdsort_flt_avx2_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Partition n >= 32 values, return number of values < pivot
+static inline size_t simdsort_partition_flt_avx512(float* __restrict v, size_t n, float pivot)
+{
+  const __m512 p = _mm512_set1_ps(pivot);
+  float* l_w = v;
+  float* r_w = v + n;
+  float* l_r = v + 16;
+  float* r_r = v + n - 16;
+  __m512 vl = _mm512_loadu_ps(v);
+  __m512 vr = _mm512_loadu_ps(v + n - 16);
+
+  while (r_r - l_r >= 16)
+  {
+    __m512 x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm512_loadu_ps(l_r);
+      l_r += 16;
+    }
+    else
+    {
+      r_r -= 16;
+      x = _mm512_loadu_ps(r_r);
+    }
+
+    __mmask16 m = _mm512_cmp_ps_mask(x, p, _CMP_LT_OQ);
+    int c = _mm_popcnt_u32(m);
+    _mm512_mask_compressstoreu_ps(l_w, m, x);
+    _mm512_mask_compressstoreu_ps(r_w - (16 - c), (__mmask16)~m, x);
+    l_w += c;
+    r_w -= 16 - c;
+  }
+
+  // Remaining < 16: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    float e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 32 free slots left)
+  __mmask16 m = _mm512_cmp_ps_mask(vl, p, _CMP_LT_OQ);
+  int c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_ps(l_w, m, vl);
+  _mm512_mask_compressstoreu_ps(r_w - (16 - c), (__mmask16)~m, vl);
+  l_w += c;
+  r_w -= 16 - c;
+
+  m = _mm512_cmp_ps_mask(vr, p, _CMP_LT_OQ);
+  c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_ps(l_w, m, vr);
+  _mm512_mask_compressstoreu_ps(r_w - (16 - c), (__mmask16)~m, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_flt_avx512_rec(float* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_FLT_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    float pivot = simdsort_pivot_flt(v, n);
+    size_t m = simdsort_partition_flt_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INFINITY)
+        return;
+      m = simdsort_partition_flt_avx512(v, n, nextafterf(pivot, INFINITY));
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_flt_avx512_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_flt_avx512_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_flt_avx2(v, n);
+}
+
+static inline void simdsort_flt_avx512(float* __restrict v, size_t n)
+{
+  n = simdpartition_if_avx512(v, n, [](float x) { return x == x; });  // NaNs to the end
+  simdsort_flt_avx512_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_FLT_H
@@ -0,0 +1,273 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_HYBRID_H
+#define SSORT_HYBRID_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small.h"
+#include "NetSort/nsort_sorted.h"
+#include "ssort_utils.h"
+#include "ssort_partition.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_HYBRID_BASE
+  #define SSORT_HYBRID_BASE 32  // base case size (netsort_small, 8 to 64)
+#endif
+#ifndef SSORT_HYBRID_BLOCK
+  #define SSORT_HYBRID_BLOCK 64 // partition block size (up to 256)
+#endif
+
+// Drop-in introsort for contiguous ranges of arithmetic values:
+// - scalar partitioning (any type), branchless on blocks of values
+// - sorted and reversed inputs are detected upfront (netsort_is_sorted)
+// - pivot is a ninther, equal values are split off when the pivot is the
+//   minimum, and degenerated recursions fall back to std::sort
+// - partitions up to SSORT_HYBRID_BASE values are sorted with netsort_small
+//   (padded to the 8/16/32 network) for (u)int8..(u)int64, float and double
+//   (AVX2), with insertion sort otherwise
+// - float/double: NaNs are first moved to the end (unordered, 'simdpartition_if'
+//   from the first NaN found), the other values are sorted: no value lost or
+//   duplicated by the networks, inputs without NaN left untouched
+
+
+// Base case: insertion sort (other types, or no AVX2)
+template <typename T>
+static inline void simdsort_hybrid_base(T* __restrict v, size_t n)
+{
+  for (size_t i=1; i<n; ++i)
+  {
+    T x = v[i];
+    size_t j = i;
+    for (; j>0 && x < v[j-1]; --j)
+      v[j] = v[j-1];
+    v[j] = x;
+  }
+}
+
+#ifdef HAS_AVX2_
+// Base case: network sorts
+static inline void simdsort_hybrid_base(int8_t* __restrict v, size_t n)   { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(int16_t* __restrict v, size_t n)  { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(int32_t* __restrict v, size_t n)  { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(int64_t* __restrict v, size_t n)  { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(uint8_t* __restrict v, size_t n)  { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(uint16_t* __restrict v, size_t n) { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(uint32_t* __restrict v, size_t n) { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(uint64_t* __restrict v, size_t n) { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(float* __restrict v, size_t n)    { netsort_small(v, n); }
+static inline void simdsort_hybrid_base(double* __restrict v, size_t n)   { netsort_small(v, n); }
+#endif
+
+//
+template <typename T>
+static inline T simdsort_hybrid_pivot(T const* __restrict v, size_t n)
+{
+  size_t s = n >> 3;
+  T a = simdsort_med3(v[s],     v[2*s],   v[3*s]);
+  T b = simdsort_med3(v[3*s+1], v[4*s],   v[5*s]);
+  T c = simdsort_med3(v[5*s+1], v[6*s],   v[7*s]);
+  return simdsort_med3(a, b, c);
+}
+
+// Partition [<= pivot | > pivot], returns left size
+template <typename T>
+static inline size_t simdsort_hybrid_partition_le(T* __restrict v, size_t n, T pivot)
+{
+  size_t i = 0, j = n;
+  for (;;)
+  {
+    while (i < j && !(pivot < v[i])) ++i;
+    while (i < j && pivot < v[j-1])  --j;
+    if (i >= j)
+      return i;
+    std::swap(v[i++], v[--j]);
+  }
+}
+
+// Partition [< pivot | >= pivot], returns left size
+// Blocks of SSORT_HYBRID_BLOCK values are scanned from both ends without
+// branches (offsets of misplaced values), then swapped pairwise
+template <typename T>
+static inline size_t simdsort_hybrid_partition(T* __restrict v, size_t n, T pivot)
+{
+  const size_t B = SSORT_HYBRID_BLOCK;
+  uint8_t offl[SSORT_HYBRID_BLOCK], offr[SSORT_HYBRID_BLOCK];
+  size_t first = 0, last = n;     // [first, last) not partitioned yet
+  size_t nl = 0, nr = 0, sl = 0, sr = 0;
+
+  while (last - first >= 2*B)
+  {
+    if (nl == 0)
+    {
+      sl = 0;
+      for (size_t i=0; i<B; ++i) {
+        offl[nl] = (uint8_t)i;
+        nl += !(v[first + i] < pivot);
+      }
+    }
+    if (nr == 0)
+    {
+      sr = 0;
+      for (size_t i=0; i<B; ++i) {
+        offr[nr] = (uint8_t)i;
+        nr += (v[last - 1 - i] < pivot);
+      }
+    }
+
+    size_t k = std::min(nl, nr);
+    for (size_t i=0; i<k; ++i)
+      std::swap(v[first + offl[sl + i]], v[last - 1 - offr[sr + i]]);
+    nl -= k; sl += k;
+    nr -= k; sr += k;
+    if (nl == 0) first += B;
+    if (nr == 0) last -= B;
+  }
+
+  // Remaining values (including a block with pending offsets)
+  size_t i = first, j = last;
+  for (;;)
+  {
+    while (i < j && v[i] < pivot)      ++i;
+    while (i < j && !(v[j-1] < pivot)) --j;
+    if (i >= j)
+      return i;
+    std::swap(v[i++], v[--j]);
+  }
+}
+
+//
+template <typename T>
+static inline void simdsort_hybrid_rec(T* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_HYBRID_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    T pivot = simdsort_hybrid_pivot(v, n);
+    size_t m = simdsort_hybrid_partition(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      m = simdsort_hybrid_partition_le(v, n, pivot);
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_hybrid_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_hybrid_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  simdsort_hybrid_base(v, n);
+}
+
+// Index of the first NaN (n if none)
+static inline size_t simdsort_hybrid_find_nan(const float* v, size_t n)
+{
+  size_t i = 0;
+#ifdef HAS_AVX2_
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m256 x = _mm256_loadu_ps(v + i);
+    const uint32_t m = (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+    if (m)
+      return i + simdsort_ctz(m);
+  }
+#endif
+  while (i < n && v[i] == v[i])
+    ++i;
+  return i;
+}
+
+static inline size_t simdsort_hybrid_find_nan(const double* v, size_t n)
+{
+  size_t i = 0;
+#ifdef HAS_AVX2_
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m256d x = _mm256_loadu_pd(v + i);
+    const uint32_t m = (uint32_t)_mm256_movemask_pd(_mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+    if (m)
+      return i + simdsort_ctz(m);
+  }
+#endif
+  while (i < n && v[i] == v[i])
+    ++i;
+  return i;
+}
+
+// NaNs to the end, returns the number of other values
+template <typename T>
+static inline size_t simdsort_hybrid_nan(T* __restrict, size_t n) { return n; }
+
+static inline size_t simdsort_hybrid_nan(float* __restrict v, size_t n)
+{
+  const size_t i = simdsort_hybrid_find_nan(v, n);
+  return (i == n) ? n : i + simdpartition_if(v + i, n - i, [](float x) { return x == x; });
+}
+
+static inline size_t simdsort_hybrid_nan(double* __restrict v, size_t n)
+{
+  const size_t i = simdsort_hybrid_find_nan(v, n);
+  return (i == n) ? n : i + simdpartition_if(v + i, n - i, [](double x) { return x == x; });
+}
+
+//
+template <typename T>
+static inline void simdsort_hybrid(T* __restrict v, size_t n)
+{
+  static_assert(std::is_arithmetic<T>::value, "simdsort_hybrid: arithmetic values only");
+  n = simdsort_hybrid_nan(v, n);
+
+  // Already sorted or reversed input (first unordered pair found early otherwise)
+  if (netsort_is_sorted(v, n))
+    return;
+  if (netsort_is_sorted_desc(v, n))
+  {
+    std::reverse(v, v + n);
+    return;
+  }
+
+  simdsort_hybrid_rec(v, n, 2 * simdsort_log2(n));
+}
+
+// Iterator interface (contiguous ranges: pointers, std::vector/std::array iterators)
+template <typename It>
+static inline void simd_sort(It begin, It end)
+{
+  if (end - begin < 2)
+    return;
+  simdsort_hybrid(&*begin, (size_t)(end - begin));
+}
+
+
+#endif // SSORT_HYBRID_H
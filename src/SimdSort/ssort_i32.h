@@ -0,0 +1,288 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_I32_H
+#define SSORT_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_i32.h"
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_I32_BASE
+  #define SSORT_I32_BASE 64   // base case size (netsort_small, 32 to 64)
+#endif
+
+// Quicksort with vectorized in-place partitioning (no extra buffer):
+// - first and last vectors are kept in register to make room, then vectors are
+//   read from the side with less free space, so that both sides always have
+//   room for a full vector store
+// - each vector is compressed [< pivot | >= pivot] and stored twice (left part
+//   at the left write position, right part ending at the right write position)
+//   AVX2: permutation from movemask LUT, AVX-512: compress store
+// - pivot is a ninther, partitions smaller than SSORT_I32_BASE are sorted with
+//   netsort_small, equal values are split off when the pivot is the minimum,
+//   and degenerated recursions fall back to std::sort
+
+
+//
+static inline void simdsort_i32_std(int32_t* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+//
+static inline void simdsort_i32_qsort(int32_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int32_t), cmpfunc_i32);
+}
+
+//
+static inline int32_t simdsort_pivot_i32(int32_t const* __restrict v, size_t n)
+{
+  size_t s = n >> 3;
+  int32_t a = simdsort_med3(v[s],     v[2*s],   v[3*s]);
+  int32_t b = simdsort_med3(v[3*s+1], v[4*s],   v[5*s]);
+  int32_t c = simdsort_med3(v[5*s+1], v[6*s],   v[7*s]);
+  return simdsort_med3(a, b, c);
+}
+
+//
+#ifdef HAS_AVX2_
+// Partition n >= 16 values, return number of values < pivot
+static inline size_t simdsort_partition_i32_avx2(int32_t* __restrict v, size_t n, int32_t pivot)
+{
+  const __m256i p = _mm256_set1_epi32(pivot);
+  int32_t* l_w = v;
+  int32_t* r_w = v + n;
+  int32_t* l_r = v + 8;
+  int32_t* r_r = v + n - 8;
+  __m256i vl = _mm256_loadu_si256((__m256i const*)(v));
+  __m256i vr = _mm256_loadu_si256((__m256i const*)(v + n - 8));
+
+  while (r_r - l_r >= 8)
+  {
+    __m256i x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm256_loadu_si256((__m256i const*)(l_r));
+      l_r += 8;
+    }
+    else
+    {
+      r_r -= 8;
+      x = _mm256_loadu_si256((__m256i const*)(r_r));
+    }
+
+    int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, x)));
+    int c = _mm_popcnt_u32(m);
+    x = _mm256_permutevar8x32_epi32(x, ssort_perm_idx_avx2(ssort_perm_8[m]));
+    _mm256_storeu_si256((__m256i*)(l_w), x);
+    _mm256_storeu_si256((__m256i*)(r_w - 8), x);
+    l_w += c;
+    r_w -= 8 - c;
+  }
+
+  // Remaining < 8: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    int32_t e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 16 free slots left)
+  int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, vl)));
+  int c = _mm_popcnt_u32(m);
+  vl = _mm256_permutevar8x32_epi32(vl, ssort_perm_idx_avx2(ssort_perm_8[m]));
+  _mm256_storeu_si256((__m256i*)(l_w), vl);
+  _mm256_storeu_si256((__m256i*)(r_w - 8), vl);
+  l_w += c;
+  r_w -= 8 - c;
+
+  m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, vr)));
+  c = _mm_popcnt_u32(m);
+  vr = _mm256_permutevar8x32_epi32(vr, ssort_perm_idx_avx2(ssort_perm_8[m]));
+  _mm256_storeu_si256((__m256i*)(l_w), vr);
+  _mm256_storeu_si256((__m256i*)(r_w - 8), vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_i32_avx2_rec(int32_t* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_I32_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    int32_t pivot = simdsort_pivot_i32(v, n);
+    size_t m = simdsort_partition_i32_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INT32_MAX)
+        return;
+      m = simdsort_partition_i32_avx2(v, n, pivot + 1);
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_i32_avx2_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_i32_avx2_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_i32_avx2(v, n);
+}
+
+static inline void simdsort_i32_avx2(int32_t* __restrict v, size_t n)
+{
+  simdsort_i32_avx2_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Partition n >= 32 values, return number of values < pivot
+static inline size_t simdsort_partition_i32_avx512(int32_t* __restrict v, size_t n, int32_t pivot)
+{
+  const __m512i p = _mm512_set1_epi32(pivot);
+  int32_t* l_w = v;
+  int32_t* r_w = v + n;
+  int32_t* l_r = v + 16;
+  int32_t* r_r = v + n - 16;
+  __m512i vl = _mm512_loadu_si512(v);
+  __m512i vr = _mm512_loadu_si512(v + n - 16);
+
+  while (r_r - l_r >= 16)
+  {
+    __m512i x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm512_loadu_si512(l_r);
+      l_r += 16;
+    }
+    else
+    {
+      r_r -= 16;
+      x = _mm512_loadu_si512(r_r);
+    }
+
+    __mmask16 m = _mm512_cmplt_epi32_mask(x, p);
+    int c = _mm_popcnt_u32(m);
+    _mm512_mask_compressstoreu_epi32(l_w, m, x);
+    _mm512_mask_compressstoreu_epi32(r_w - (16 - c), (__mmask16)~m, x);
+    l_w += c;
+    r_w -= 16 - c;
+  }
+
+  // Remaining < 16: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    int32_t e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 32 free slots left)
+  __mmask16 m = _mm512_cmplt_epi32_mask(vl, p);
+  int c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_epi32(l_w, m, vl);
+  _mm512_mask_compressstoreu_epi32(r_w - (16 - c), (__mmask16)~m, vl);
+  l_w += c;
+  r_w -= 16 - c;
+
+  m = _mm512_cmplt_epi32_mask(vr, p);
+  c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_epi32(l_w, m, vr);
+  _mm512_mask_compressstoreu_epi32(r_w - (16 - c), (__mmask16)~m, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_i32_avx512_rec(int32_t* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_I32_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    int32_t pivot = simdsort_pivot_i32(v, n);
+    size_t m = simdsort_partition_i32_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INT32_MAX)
+        return;
+      m = simdsort_partition_i32_avx512(v, n, pivot + 1);
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_i32_avx512_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_i32_avx512_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_i32_avx2(v, n);
+}
+
+static inline void simdsort_i32_avx512(int32_t* __restrict v, size_t n)
+{
+  simdsort_i32_avx512_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_I32_H
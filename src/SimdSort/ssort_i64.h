@@ -0,0 +1,280 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_I64_H
+#define SSORT_I64_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_i64.h"
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_I64_BASE
+  #define SSORT_I64_BASE 64   // base case size (netsort_small, 32 to 64)
+#endif
+
+// Same quicksort as ssort_i32.h, 4 x int64 per AVX2 vector (LUT of 32-bit
+// index pairs), 8 per AVX-512 vector
+
+
+//
+static inline void simdsort_i64_std(int64_t* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+//
+static inline void simdsort_i64_qsort(int64_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(int64_t), cmpfunc_i64);
+}
+
+//
+static inline int64_t simdsort_pivot_i64(int64_t const* __restrict v, size_t n)
+{
+  size_t s = n >> 3;
+  int64_t a = simdsort_med3(v[s],     v[2*s],   v[3*s]);
+  int64_t b = simdsort_med3(v[3*s+1], v[4*s],   v[5*s]);
+  int64_t c = simdsort_med3(v[5*s+1], v[6*s],   v[7*s]);
+  return simdsort_med3(a, b, c);
+}
+
+//
+#ifdef HAS_AVX2_
+// Partition n >= 8 values, return number of values < pivot
+static inline size_t simdsort_partition_i64_avx2(int64_t* __restrict v, size_t n, int64_t pivot)
+{
+  const __m256i p = _mm256_set1_epi64x(pivot);
+  int64_t* l_w = v;
+  int64_t* r_w = v + n;
+  int64_t* l_r = v + 4;
+  int64_t* r_r = v + n - 4;
+  __m256i vl = _mm256_loadu_si256((__m256i const*)(v));
+  __m256i vr = _mm256_loadu_si256((__m256i const*)(v + n - 4));
+
+  while (r_r - l_r >= 4)
+  {
+    __m256i x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm256_loadu_si256((__m256i const*)(l_r));
+      l_r += 4;
+    }
+    else
+    {
+      r_r -= 4;
+      x = _mm256_loadu_si256((__m256i const*)(r_r));
+    }
+
+    int m = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p, x)));
+    int c = _mm_popcnt_u32(m);
+    x = _mm256_permutevar8x32_epi32(x, ssort_perm_idx_avx2(ssort_perm_4[m]));
+    _mm256_storeu_si256((__m256i*)(l_w), x);
+    _mm256_storeu_si256((__m256i*)(r_w - 4), x);
+    l_w += c;
+    r_w -= 4 - c;
+  }
+
+  // Remaining < 4: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    int64_t e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 8 free slots left)
+  int m = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p, vl)));
+  int c = _mm_popcnt_u32(m);
+  vl = _mm256_permutevar8x32_epi32(vl, ssort_perm_idx_avx2(ssort_perm_4[m]));
+  _mm256_storeu_si256((__m256i*)(l_w), vl);
+  _mm256_storeu_si256((__m256i*)(r_w - 4), vl);
+  l_w += c;
+  r_w -= 4 - c;
+
+  m = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p, vr)));
+  c = _mm_popcnt_u32(m);
+  vr = _mm256_permutevar8x32_epi32(vr, ssort_perm_idx_avx2(ssort_perm_4[m]));
+  _mm256_storeu_si256((__m256i*)(l_w), vr);
+  _mm256_storeu_si256((__m256i*)(r_w - 4), vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_i64_avx2_rec(int64_t* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_I64_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    int64_t pivot = simdsort_pivot_i64(v, n);
+    size_t m = simdsort_partition_i64_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INT64_MAX)
+        return;
+      m = simdsort_partition_i64_avx2(v, n, pivot + 1);
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_i64_avx2_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_i64_avx2_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_i64_avx2(v, n);
+}
+
+static inline void simdsort_i64_avx2(int64_t* __restrict v, size_t n)
+{
+  simdsort_i64_avx2_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Partition n >= 16 values, return number of values < pivot
+static inline size_t simdsort_partition_i64_avx512(int64_t* __restrict v, size_t n, int64_t pivot)
+{
+  const __m512i p = _mm512_set1_epi64(pivot);
+  int64_t* l_w = v;
+  int64_t* r_w = v + n;
+  int64_t* l_r = v + 8;
+  int64_t* r_r = v + n - 8;
+  __m512i vl = _mm512_loadu_si512(v);
+  __m512i vr = _mm512_loadu_si512(v + n - 8);
+
+  while (r_r - l_r >= 8)
+  {
+    __m512i x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = _mm512_loadu_si512(l_r);
+      l_r += 8;
+    }
+    else
+    {
+      r_r -= 8;
+      x = _mm512_loadu_si512(r_r);
+    }
+
+    __mmask8 m = _mm512_cmplt_epi64_mask(x, p);
+    int c = _mm_popcnt_u32(m);
+    _mm512_mask_compressstoreu_epi64(l_w, m, x);
+    _mm512_mask_compressstoreu_epi64(r_w - (8 - c), (__mmask8)~m, x);
+    l_w += c;
+    r_w -= 8 - c;
+  }
+
+  // Remaining < 8: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    int64_t e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (e < pivot)
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 16 free slots left)
+  __mmask8 m = _mm512_cmplt_epi64_mask(vl, p);
+  int c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_epi64(l_w, m, vl);
+  _mm512_mask_compressstoreu_epi64(r_w - (8 - c), (__mmask8)~m, vl);
+  l_w += c;
+  r_w -= 8 - c;
+
+  m = _mm512_cmplt_epi64_mask(vr, p);
+  c = _mm_popcnt_u32(m);
+  _mm512_mask_compressstoreu_epi64(l_w, m, vr);
+  _mm512_mask_compressstoreu_epi64(r_w - (8 - c), (__mmask8)~m, vr);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+//
+static inline void simdsort_i64_avx512_rec(int64_t* __restrict v, size_t n, size_t depth)
+{
+  while (n > SSORT_I64_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::sort(v, v + n);
+      return;
+    }
+
+    // Partition [< pivot | >= pivot]
+    int64_t pivot = simdsort_pivot_i64(v, n);
+    size_t m = simdsort_partition_i64_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off (nothing to sort there)
+      if (pivot == INT64_MAX)
+        return;
+      m = simdsort_partition_i64_avx512(v, n, pivot + 1);
+      v += m;
+      n -= m;
+      continue;
+    }
+
+    // Recurse on smaller part, loop on larger one
+    if (m < n - m)
+    {
+      simdsort_i64_avx512_rec(v, m, depth);
+      v += m;
+      n -= m;
+    }
+    else
+    {
+      simdsort_i64_avx512_rec(v + m, n - m, depth);
+      n = m;
+    }
+  }
+
+  // Base case
+  netsort_small_i64_avx2(v, n);
+}
+
+static inline void simdsort_i64_avx512(int64_t* __restrict v, size_t n)
+{
+  simdsort_i64_avx512_rec(v, n, 2 * simdsort_log2(n));
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_I64_H
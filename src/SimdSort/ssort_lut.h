@@ -0,0 +1,160 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_LUT_H
+#define SSORT_LUT_H
+
+#include "Utils/compiler_utils.h"
+
+#include <stdint.h>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// Compress permutations for AVX2 partitioning (no compress instruction before AVX-512)
+// Entry for a movemask m: 8 x 4-bit lane indices for _mm256_permutevar8x32_epi32,
+// lanes with bit set in m first (in order), then the other ones.
+// - ssort_perm_8: 8 x 32-bit lanes, m on 8 bits
+// - ssort_perm_4: 4 x 64-bit lanes (as pairs of 32-bit indices), m on 4 bits
+// - ssort_perm_b8: 8 x 8-bit byte indices for _mm_shuffle_epi8 (one index per
+//   byte, low byte first), m on 8 bits: compresses 8 x 8-bit lanes (or 8 x
+//   16-bit lanes once indices are doubled, see ssort_perm_w8_avx2)
+
+
+//
+static const uint32_t ssort_perm_8[256] = {
+  0x76543210, 0x76543210, 0x76543201, 0x76543210, 0x76543102, 0x76543120, 0x76543021, 0x76543210,
+  0x76542103, 0x76542130, 0x76542031, 0x76542310, 0x76541032, 0x76541320, 0x76540321, 0x76543210,
+  0x76532104, 0x76532140, 0x76532041, 0x76532410, 0x76531042, 0x76531420, 0x76530421, 0x76534210,
+  0x76521043, 0x76521430, 0x76520431, 0x76524310, 0x76510432, 0x76514320, 0x76504321, 0x76543210,
+  0x76432105, 0x76432150, 0x76432051, 0x76432510, 0x76431052, 0x76431520, 0x76430521, 0x76435210,
+  0x76421053, 0x76421530, 0x76420531, 0x76425310, 0x76410532, 0x76415320, 0x76405321, 0x76453210,
+  0x76321054, 0x76321540, 0x76320541, 0x76325410, 0x76310542, 0x76315420, 0x76305421, 0x76354210,
+  0x76210543, 0x76215430, 0x76205431, 0x76254310, 0x76105432, 0x76154320, 0x76054321, 0x76543210,
+  0x75432106, 0x75432160, 0x75432061, 0x75432610, 0x75431062, 0x75431620, 0x75430621, 0x75436210,
+  0x75421063, 0x75421630, 0x75420631, 0x75426310, 0x75410632, 0x75416320, 0x75406321, 0x75463210,
+  0x75321064, 0x75321640, 0x75320641, 0x75326410, 0x75310642, 0x75316420, 0x75306421, 0x75364210,
+  0x75210643, 0x75216430, 0x75206431, 0x75264310, 0x75106432, 0x75164320, 0x75064321, 0x75643210,
+  0x74321065, 0x74321650, 0x74320651, 0x74326510, 0x74310652, 0x74316520, 0x74306521, 0x74365210,
+  0x74210653, 0x74216530, 0x74206531, 0x74265310, 0x74106532, 0x74165320, 0x74065321, 0x74653210,
+  0x73210654, 0x73216540, 0x73206541, 0x73265410, 0x73106542, 0x73165420, 0x73065421, 0x73654210,
+  0x72106543, 0x72165430, 0x72065431, 0x72654310, 0x71065432, 0x71654320, 0x70654321, 0x76543210,
+  0x65432107, 0x65432170, 0x65432071, 0x65432710, 0x65431072, 0x65431720, 0x65430721, 0x65437210,
+  0x65421073, 0x65421730, 0x65420731, 0x65427310, 0x65410732, 0x65417320, 0x65407321, 0x65473210,
+  0x65321074, 0x65321740, 0x65320741, 0x65327410, 0x65310742, 0x65317420, 0x65307421, 0x65374210,
+  0x65210743, 0x65217430, 0x65207431, 0x65274310, 0x65107432, 0x65174320, 0x65074321, 0x65743210,
+  0x64321075, 0x64321750, 0x64320751, 0x64327510, 0x64310752, 0x64317520, 0x64307521, 0x64375210,
+  0x64210753, 0x64217530, 0x64207531, 0x64275310, 0x64107532, 0x64175320, 0x64075321, 0x64753210,
+  0x63210754, 0x63217540, 0x63207541, 0x63275410, 0x63107542, 0x63175420, 0x63075421, 0x63754210,
+  0x62107543, 0x62175430, 0x62075431, 0x62754310, 0x61075432, 0x61754320, 0x60754321, 0x67543210,
+  0x54321076, 0x54321760, 0x54320761, 0x54327610, 0x54310762, 0x54317620, 0x54307621, 0x54376210,
+  0x54210763, 0x54217630, 0x54207631, 0x54276310, 0x54107632, 0x54176320, 0x54076321, 0x54763210,
+  0x53210764, 0x53217640, 0x53207641, 0x53276410, 0x53107642, 0x53176420, 0x53076421, 0x53764210,
+  0x52107643, 0x52176430, 0x52076431, 0x52764310, 0x51076432, 0x51764320, 0x50764321, 0x57643210,
+  0x43210765, 0x43217650, 0x43207651, 0x43276510, 0x43107652, 0x43176520, 0x43076521, 0x43765210,
+  0x42107653, 0x42176530, 0x42076531, 0x42765310, 0x41076532, 0x41765320, 0x40765321, 0x47653210,
+  0x32107654, 0x32176540, 0x32076541, 0x32765410, 0x31076542, 0x31765420, 0x30765421, 0x37654210,
+  0x21076543, 0x21765430, 0x20765431, 0x27654310, 0x10765432, 0x17654320, 0x07654321, 0x76543210
+};
+
+//
+static const uint32_t ssort_perm_4[16] = {
+  0x76543210, 0x76543210, 0x76541032, 0x76543210, 0x76321054, 0x76325410, 0x76105432, 0x76543210,
+  0x54321076, 0x54327610, 0x54107632, 0x54763210, 0x32107654, 0x32765410, 0x10765432, 0x76543210
+};
+
+//
+static const uint64_t ssort_perm_b8[256] = {
+  0x0706050403020100ull, 0x0706050403020100ull, 0x0706050403020001ull, 0x0706050403020100ull,
+  0x0706050403010002ull, 0x0706050403010200ull, 0x0706050403000201ull, 0x0706050403020100ull,
+  0x0706050402010003ull, 0x0706050402010300ull, 0x0706050402000301ull, 0x0706050402030100ull,
+  0x0706050401000302ull, 0x0706050401030200ull, 0x0706050400030201ull, 0x0706050403020100ull,
+  0x0706050302010004ull, 0x0706050302010400ull, 0x0706050302000401ull, 0x0706050302040100ull,
+  0x0706050301000402ull, 0x0706050301040200ull, 0x0706050300040201ull, 0x0706050304020100ull,
+  0x0706050201000403ull, 0x0706050201040300ull, 0x0706050200040301ull, 0x0706050204030100ull,
+  0x0706050100040302ull, 0x0706050104030200ull, 0x0706050004030201ull, 0x0706050403020100ull,
+  0x0706040302010005ull, 0x0706040302010500ull, 0x0706040302000501ull, 0x0706040302050100ull,
+  0x0706040301000502ull, 0x0706040301050200ull, 0x0706040300050201ull, 0x0706040305020100ull,
+  0x0706040201000503ull, 0x0706040201050300ull, 0x0706040200050301ull, 0x0706040205030100ull,
+  0x0706040100050302ull, 0x0706040105030200ull, 0x0706040005030201ull, 0x0706040503020100ull,
+  0x0706030201000504ull, 0x0706030201050400ull, 0x0706030200050401ull, 0x0706030205040100ull,
+  0x0706030100050402ull, 0x0706030105040200ull, 0x0706030005040201ull, 0x0706030504020100ull,
+  0x0706020100050403ull, 0x0706020105040300ull, 0x0706020005040301ull, 0x0706020504030100ull,
+  0x0706010005040302ull, 0x0706010504030200ull, 0x0706000504030201ull, 0x0706050403020100ull,
+  0x0705040302010006ull, 0x0705040302010600ull, 0x0705040302000601ull, 0x0705040302060100ull,
+  0x0705040301000602ull, 0x0705040301060200ull, 0x0705040300060201ull, 0x0705040306020100ull,
+  0x0705040201000603ull, 0x0705040201060300ull, 0x0705040200060301ull, 0x0705040206030100ull,
+  0x0705040100060302ull, 0x0705040106030200ull, 0x0705040006030201ull, 0x0705040603020100ull,
+  0x0705030201000604ull, 0x0705030201060400ull, 0x0705030200060401ull, 0x0705030206040100ull,
+  0x0705030100060402ull, 0x0705030106040200ull, 0x0705030006040201ull, 0x0705030604020100ull,
+  0x0705020100060403ull, 0x0705020106040300ull, 0x0705020006040301ull, 0x0705020604030100ull,
+  0x0705010006040302ull, 0x0705010604030200ull, 0x0705000604030201ull, 0x0705060403020100ull,
+  0x0704030201000605ull, 0x0704030201060500ull, 0x0704030200060501ull, 0x0704030206050100ull,
+  0x0704030100060502ull, 0x0704030106050200ull, 0x0704030006050201ull, 0x0704030605020100ull,
+  0x0704020100060503ull, 0x0704020106050300ull, 0x0704020006050301ull, 0x0704020605030100ull,
+  0x0704010006050302ull, 0x0704010605030200ull, 0x0704000605030201ull, 0x0704060503020100ull,
+  0x0703020100060504ull, 0x0703020106050400ull, 0x0703020006050401ull, 0x0703020605040100ull,
+  0x0703010006050402ull, 0x0703010605040200ull, 0x0703000605040201ull, 0x0703060504020100ull,
+  0x0702010006050403ull, 0x0702010605040300ull, 0x0702000605040301ull, 0x0702060504030100ull,
+  0x0701000605040302ull, 0x0701060504030200ull, 0x0700060504030201ull, 0x0706050403020100ull,
+  0x0605040302010007ull, 0x0605040302010700ull, 0x0605040302000701ull, 0x0605040302070100ull,
+  0x0605040301000702ull, 0x0605040301070200ull, 0x0605040300070201ull, 0x0605040307020100ull,
+  0x0605040201000703ull, 0x0605040201070300ull, 0x0605040200070301ull, 0x0605040207030100ull,
+  0x0605040100070302ull, 0x0605040107030200ull, 0x0605040007030201ull, 0x0605040703020100ull,
+  0x0605030201000704ull, 0x0605030201070400ull, 0x0605030200070401ull, 0x0605030207040100ull,
+  0x0605030100070402ull, 0x0605030107040200ull, 0x0605030007040201ull, 0x0605030704020100ull,
+  0x0605020100070403ull, 0x0605020107040300ull, 0x0605020007040301ull, 0x0605020704030100ull,
+  0x0605010007040302ull, 0x0605010704030200ull, 0x0605000704030201ull, 0x0605070403020100ull,
+  0x0604030201000705ull, 0x0604030201070500ull, 0x0604030200070501ull, 0x0604030207050100ull,
+  0x0604030100070502ull, 0x0604030107050200ull, 0x0604030007050201ull, 0x0604030705020100ull,
+  0x0604020100070503ull, 0x0604020107050300ull, 0x0604020007050301ull, 0x0604020705030100ull,
+  0x0604010007050302ull, 0x0604010705030200ull, 0x0604000705030201ull, 0x0604070503020100ull,
+  0x0603020100070504ull, 0x0603020107050400ull, 0x0603020007050401ull, 0x0603020705040100ull,
+  0x0603010007050402ull, 0x0603010705040200ull, 0x0603000705040201ull, 0x0603070504020100ull,
+  0x0602010007050403ull, 0x0602010705040300ull, 0x0602000705040301ull, 0x0602070504030100ull,
+  0x0601000705040302ull, 0x0601070504030200ull, 0x0600070504030201ull, 0x0607050403020100ull,
+  0x0504030201000706ull, 0x0504030201070600ull, 0x0504030200070601ull, 0x0504030207060100ull,
+  0x0504030100070602ull, 0x0504030107060200ull, 0x0504030007060201ull, 0x0504030706020100ull,
+  0x0504020100070603ull, 0x0504020107060300ull, 0x0504020007060301ull, 0x0504020706030100ull,
+  0x0504010007060302ull, 0x0504010706030200ull, 0x0504000706030201ull, 0x0504070603020100ull,
+  0x0503020100070604ull, 0x0503020107060400ull, 0x0503020007060401ull, 0x0503020706040100ull,
+  0x0503010007060402ull, 0x0503010706040200ull, 0x0503000706040201ull, 0x0503070604020100ull,
+  0x0502010007060403ull, 0x0502010706040300ull, 0x0502000706040301ull, 0x0502070604030100ull,
+  0x0501000706040302ull, 0x0501070604030200ull, 0x0500070604030201ull, 0x0507060403020100ull,
+  0x0403020100070605ull, 0x0403020107060500ull, 0x0403020007060501ull, 0x0403020706050100ull,
+  0x0403010007060502ull, 0x0403010706050200ull, 0x0403000706050201ull, 0x0403070605020100ull,
+  0x0402010007060503ull, 0x0402010706050300ull, 0x0402000706050301ull, 0x0402070605030100ull,
+  0x0401000706050302ull, 0x0401070605030200ull, 0x0400070605030201ull, 0x0407060503020100ull,
+  0x0302010007060504ull, 0x0302010706050400ull, 0x0302000706050401ull, 0x0302070605040100ull,
+  0x0301000706050402ull, 0x0301070605040200ull, 0x0300070605040201ull, 0x0307060504020100ull,
+  0x0201000706050403ull, 0x0201070605040300ull, 0x0200070605040301ull, 0x0207060504030100ull,
+  0x0100070605040302ull, 0x0107060504030200ull, 0x0007060504030201ull, 0x0706050403020100ull
+};
+
+//
+#ifdef HAS_AVX2_
+// Unpack 8 x 4-bit indices (permutevar8x32 only reads the low 3 bits)
+static inline __m256i ssort_perm_idx_avx2(const uint32_t entry)
+{
+  return _mm256_srlv_epi32(_mm256_set1_epi32((int32_t)entry), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+}
+
+// Byte shuffle indices compressing 8 x 8-bit lanes (offset: first lane of the group)
+static inline __m128i ssort_perm_b8_avx2(const uint32_t m, const int8_t offset)
+{
+  return _mm_add_epi8(_mm_loadl_epi64((__m128i const*)(ssort_perm_b8 + m)), _mm_set1_epi8(offset));
+}
+
+// Byte shuffle indices compressing 8 x 16-bit lanes (2i, 2i+1 for each index i)
+static inline __m128i ssort_perm_w8_avx2(const uint32_t m)
+{
+  const __m128i b = _mm_loadl_epi64((__m128i const*)(ssort_perm_b8 + m));
+  const __m128i b2 = _mm_add_epi8(b, b);
+  return _mm_unpacklo_epi8(b2, _mm_add_epi8(b2, _mm_set1_epi8(1)));
+}
+#endif // HAS_AVX2_
+
+
+#endif // SSORT_LUT_H
@@ -0,0 +1,190 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_MERGE_DBL_H
+#define SSORT_MERGE_DBL_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_bitonic_dbl.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX-512
+#endif
+
+// Same merge as ssort_merge_i32.h, arrays are padded with +INFINITY (NaN
+// values are not supported)
+
+
+//
+static inline void simdmerge_dbl_std(const double* a, size_t na, const double* b, size_t nb, double* __restrict out)
+{
+  std::merge(a, a + na, b, b + nb, out);
+}
+
+//
+#ifdef HAS_AVX_
+// Load a block of 8 values (r[0..1]), padded past n
+static inline void simdmerge_load_dbl_avx(double const* p, size_t n, __m256d* r)
+{
+  if (n >= 8)
+  {
+    r[0] = _mm256_loadu_pd(p);
+    r[1] = _mm256_loadu_pd(p + 4);
+  }
+  else
+  {
+    double buf[8];
+    memcpy(buf, p, n * sizeof(double));
+    for (size_t i=n; i<8; ++i)
+      buf[i] = INFINITY;
+    r[0] = _mm256_loadu_pd(buf);
+    r[1] = _mm256_loadu_pd(buf + 4);
+  }
+}
+
+// Store a block of 8 values (r[0..1]), truncated to n
+static inline void simdmerge_store_dbl_avx(double* p, size_t n, const __m256d* r)
+{
+  if (n >= 8)
+  {
+    _mm256_storeu_pd(p, r[0]);
+    _mm256_storeu_pd(p + 4, r[1]);
+  }
+  else
+  {
+    double buf[8];
+    _mm256_storeu_pd(buf, r[0]);
+    _mm256_storeu_pd(buf + 4, r[1]);
+    memcpy(p, buf, n * sizeof(double));
+  }
+}
+
+//
+static inline void simdmerge_dbl_avx(const double* a, size_t na, const double* b, size_t nb, double* __restrict out)
+{
+  const size_t n = na + nb;
+  __m256d r[4];  // [ block | carry ]
+  size_t ia = 8, ib = 8, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_dbl_avx(a, na, r);
+  simdmerge_load_dbl_avx(b, nb, r + 2);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_16_dbl_avx(r);
+    simdmerge_store_dbl_avx(out + o, n - o, r);
+    o += 8;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_dbl_avx(a + ia, na - ia, r);
+      ia += 8;
+    }
+    else
+    {
+      simdmerge_load_dbl_avx(b + ib, nb - ib, r);
+      ib += 8;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_16_dbl_avx(r);
+  if (o < n)
+    simdmerge_store_dbl_avx(out + o, n - o, r);
+  if (o + 8 < n)
+    simdmerge_store_dbl_avx(out + o + 8, n - o - 8, r + 2);
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_AVX512F_
+// Load a block of 8 values (r[0]), padded past n
+static inline void simdmerge_load_dbl_avx512(double const* p, size_t n, __m512d* r)
+{
+  if (n >= 8)
+  {
+    r[0] = _mm512_loadu_pd(p);
+  }
+  else
+  {
+    double buf[8];
+    memcpy(buf, p, n * sizeof(double));
+    for (size_t i=n; i<8; ++i)
+      buf[i] = INFINITY;
+    r[0] = _mm512_loadu_pd(buf);
+  }
+}
+
+// Store a block of 8 values (r[0]), truncated to n
+static inline void simdmerge_store_dbl_avx512(double* p, size_t n, const __m512d* r)
+{
+  if (n >= 8)
+  {
+    _mm512_storeu_pd(p, r[0]);
+  }
+  else
+  {
+    double buf[8];
+    _mm512_storeu_pd(buf, r[0]);
+    memcpy(p, buf, n * sizeof(double));
+  }
+}
+
+//
+static inline void simdmerge_dbl_avx512(const double* a, size_t na, const double* b, size_t nb, double* __restrict out)
+{
+  const size_t n = na + nb;
+  __m512d r[2];  // [ block | carry ]
+  size_t ia = 8, ib = 8, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_dbl_avx512(a, na, r);
+  simdmerge_load_dbl_avx512(b, nb, r + 1);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_16_dbl_avx512(r);
+    simdmerge_store_dbl_avx512(out + o, n - o, r);
+    o += 8;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_dbl_avx512(a + ia, na - ia, r);
+      ia += 8;
+    }
+    else
+    {
+      simdmerge_load_dbl_avx512(b + ib, nb - ib, r);
+      ib += 8;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_16_dbl_avx512(r);
+  if (o < n)
+    simdmerge_store_dbl_avx512(out + o, n - o, r);
+  if (o + 8 < n)
+    simdmerge_store_dbl_avx512(out + o + 8, n - o - 8, r + 1);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_MERGE_DBL_H
@@ -0,0 +1,186 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_MERGE_FLT_H
+#define SSORT_MERGE_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_bitonic_flt.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#ifdef HAS_AVX_
+  #include <immintrin.h>  // AVX, AVX-512
+#endif
+
+// Same merge as ssort_merge_i32.h, arrays are padded with +INFINITY (NaN
+// values are not supported)
+
+
+//
+static inline void simdmerge_flt_std(const float* a, size_t na, const float* b, size_t nb, float* __restrict out)
+{
+  std::merge(a, a + na, b, b + nb, out);
+}
+
+//
+#ifdef HAS_AVX_
+// Load a block of 8 values (r[0]), padded past n
+static inline void simdmerge_load_flt_avx(float const* p, size_t n, __m256* r)
+{
+  if (n >= 8)
+  {
+    r[0] = _mm256_loadu_ps(p);
+  }
+  else
+  {
+    float buf[8];
+    memcpy(buf, p, n * sizeof(float));
+    for (size_t i=n; i<8; ++i)
+      buf[i] = INFINITY;
+    r[0] = _mm256_loadu_ps(buf);
+  }
+}
+
+// Store a block of 8 values (r[0]), truncated to n
+static inline void simdmerge_store_flt_avx(float* p, size_t n, const __m256* r)
+{
+  if (n >= 8)
+  {
+    _mm256_storeu_ps(p, r[0]);
+  }
+  else
+  {
+    float buf[8];
+    _mm256_storeu_ps(buf, r[0]);
+    memcpy(p, buf, n * sizeof(float));
+  }
+}
+
+//
+static inline void simdmerge_flt_avx(const float* a, size_t na, const float* b, size_t nb, float* __restrict out)
+{
+  const size_t n = na + nb;
+  __m256 r[2];  // [ block | carry ]
+  size_t ia = 8, ib = 8, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_flt_avx(a, na, r);
+  simdmerge_load_flt_avx(b, nb, r + 1);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_16_flt_avx(r);
+    simdmerge_store_flt_avx(out + o, n - o, r);
+    o += 8;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_flt_avx(a + ia, na - ia, r);
+      ia += 8;
+    }
+    else
+    {
+      simdmerge_load_flt_avx(b + ib, nb - ib, r);
+      ib += 8;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_16_flt_avx(r);
+  if (o < n)
+    simdmerge_store_flt_avx(out + o, n - o, r);
+  if (o + 8 < n)
+    simdmerge_store_flt_avx(out + o + 8, n - o - 8, r + 1);
+}
+#endif // HAS_AVX_
+
+//
+#ifdef HAS_AVX512F_
+// Load a block of 16 values (r[0]), padded past n
+static inline void simdmerge_load_flt_avx512(float const* p, size_t n, __m512* r)
+{
+  if (n >= 16)
+  {
+    r[0] = _mm512_loadu_ps(p);
+  }
+  else
+  {
+    float buf[16];
+    memcpy(buf, p, n * sizeof(float));
+    for (size_t i=n; i<16; ++i)
+      buf[i] = INFINITY;
+    r[0] = _mm512_loadu_ps(buf);
+  }
+}
+
+// Store a block of 16 values (r[0]), truncated to n
+static inline void simdmerge_store_flt_avx512(float* p, size_t n, const __m512* r)
+{
+  if (n >= 16)
+  {
+    _mm512_storeu_ps(p, r[0]);
+  }
+  else
+  {
+    float buf[16];
+    _mm512_storeu_ps(buf, r[0]);
+    memcpy(p, buf, n * sizeof(float));
+  }
+}
+
+//
+static inline void simdmerge_flt_avx512(const float* a, size_t na, const float* b, size_t nb, float* __restrict out)
+{
+  const size_t n = na + nb;
+  __m512 r[2];  // [ block | carry ]
+  size_t ia = 16, ib = 16, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_flt_avx512(a, na, r);
+  simdmerge_load_flt_avx512(b, nb, r + 1);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_32_flt_avx512(r);
+    simdmerge_store_flt_avx512(out + o, n - o, r);
+    o += 16;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_flt_avx512(a + ia, na - ia, r);
+      ia += 16;
+    }
+    else
+    {
+      simdmerge_load_flt_avx512(b + ib, nb - ib, r);
+      ib += 16;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_32_flt_avx512(r);
+  if (o < n)
+    simdmerge_store_flt_avx512(out + o, n - o, r);
+  if (o + 16 < n)
+    simdmerge_store_flt_avx512(out + o + 16, n - o - 16, r + 1);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_MERGE_FLT_H
@@ -0,0 +1,193 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_MERGE_I32_H
+#define SSORT_MERGE_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_bitonic_i32.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// Merge two sorted arrays a (na) and b (nb) into out (na + nb, no overlap):
+// - one block of W values is loaded from each array and merged in register
+//   with the bitonic merge kernel (2 x 8 for AVX2, 2 x 16 for AVX-512)
+// - lower W values are stored, upper W values are kept as the carry, and the
+//   next block is read from the array with the smaller head (all values left
+//   in both arrays are then >= the stored ones)
+// - arrays are virtually padded with INT32_MAX up to a multiple of W: padding
+//   only ends up past na + nb, partial blocks go through a stack copy
+// For arbitrary lengths, simdmerge_path (ssort_utils.h) splits the output into
+// independent chunks.
+
+
+//
+static inline void simdmerge_i32_std(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* __restrict out)
+{
+  std::merge(a, a + na, b, b + nb, out);
+}
+
+//
+#ifdef HAS_AVX2_
+// Load a block of 8 values (r[0]), padded past n
+static inline void simdmerge_load_i32_avx2(int32_t const* p, size_t n, __m256i* r)
+{
+  if (n >= 8)
+  {
+    r[0] = _mm256_loadu_si256((__m256i const*)(p));
+  }
+  else
+  {
+    int32_t buf[8];
+    memcpy(buf, p, n * sizeof(int32_t));
+    for (size_t i=n; i<8; ++i)
+      buf[i] = INT32_MAX;
+    r[0] = _mm256_loadu_si256((__m256i const*)(buf));
+  }
+}
+
+// Store a block of 8 values (r[0]), truncated to n
+static inline void simdmerge_store_i32_avx2(int32_t* p, size_t n, const __m256i* r)
+{
+  if (n >= 8)
+  {
+    _mm256_storeu_si256((__m256i*)(p), r[0]);
+  }
+  else
+  {
+    int32_t buf[8];
+    _mm256_storeu_si256((__m256i*)(buf), r[0]);
+    memcpy(p, buf, n * sizeof(int32_t));
+  }
+}
+
+//
+static inline void simdmerge_i32_avx2(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* __restrict out)
+{
+  const size_t n = na + nb;
+  __m256i r[2];  // [ block | carry ]
+  size_t ia = 8, ib = 8, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_i32_avx2(a, na, r);
+  simdmerge_load_i32_avx2(b, nb, r + 1);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_16_i32_avx2(r);
+    simdmerge_store_i32_avx2(out + o, n - o, r);
+    o += 8;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_i32_avx2(a + ia, na - ia, r);
+      ia += 8;
+    }
+    else
+    {
+      simdmerge_load_i32_avx2(b + ib, nb - ib, r);
+      ib += 8;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_16_i32_avx2(r);
+  if (o < n)
+    simdmerge_store_i32_avx2(out + o, n - o, r);
+  if (o + 8 < n)
+    simdmerge_store_i32_avx2(out + o + 8, n - o - 8, r + 1);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Load a block of 16 values (r[0]), padded past n
+static inline void simdmerge_load_i32_avx512(int32_t const* p, size_t n, __m512i* r)
+{
+  if (n >= 16)
+  {
+    r[0] = _mm512_loadu_si512(p);
+  }
+  else
+  {
+    int32_t buf[16];
+    memcpy(buf, p, n * sizeof(int32_t));
+    for (size_t i=n; i<16; ++i)
+      buf[i] = INT32_MAX;
+    r[0] = _mm512_loadu_si512(buf);
+  }
+}
+
+// Store a block of 16 values (r[0]), truncated to n
+static inline void simdmerge_store_i32_avx512(int32_t* p, size_t n, const __m512i* r)
+{
+  if (n >= 16)
+  {
+    _mm512_storeu_si512(p, r[0]);
+  }
+  else
+  {
+    int32_t buf[16];
+    _mm512_storeu_si512(buf, r[0]);
+    memcpy(p, buf, n * sizeof(int32_t));
+  }
+}
+
+//
+static inline void simdmerge_i32_avx512(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* __restrict out)
+{
+  const size_t n = na + nb;
+  __m512i r[2];  // [ block | carry ]
+  size_t ia = 16, ib = 16, o = 0;
+
+  if (na == 0 || nb == 0)
+  {
+    std::copy(a, a + na, std::copy(b, b + nb, out));
+    return;
+  }
+
+  simdmerge_load_i32_avx512(a, na, r);
+  simdmerge_load_i32_avx512(b, nb, r + 1);
+  while (ia < na || ib < nb)
+  {
+    bitonic_merge_32_i32_avx512(r);
+    simdmerge_store_i32_avx512(out + o, n - o, r);
+    o += 16;
+
+    // Next block from the smaller head (padding once an array is done)
+    if (ib >= nb || (ia < na && a[ia] <= b[ib]))
+    {
+      simdmerge_load_i32_avx512(a + ia, na - ia, r);
+      ia += 16;
+    }
+    else
+    {
+      simdmerge_load_i32_avx512(b + ib, nb - ib, r);
+      ib += 16;
+    }
+  }
+
+  // Last block and carry (padding only past n)
+  bitonic_merge_32_i32_avx512(r);
+  if (o < n)
+    simdmerge_store_i32_avx512(out + o, n - o, r);
+  if (o + 16 < n)
+    simdmerge_store_i32_avx512(out + o + 16, n - o - 16, r + 1);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_MERGE_I32_H
@@ -0,0 +1,158 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_PARALLEL_H
+#define SSORT_PARALLEL_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_i32.h"
+#include "ssort_flt.h"
+#include "ssort_dbl.h"
+#include "ssort_merge_i32.h"
+#include "ssort_merge_flt.h"
+#include "ssort_merge_dbl.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// SIMD optimization options
+#ifndef SSORT_PARALLEL_MIN
+  #define SSORT_PARALLEL_MIN 65536  // minimum values per thread (smaller arrays use less threads)
+#endif
+
+// Parallel merge sort, for int32, float and double:
+// - the array is split into one chunk per thread, each sorted with the SIMD
+//   quicksort (or std::sort for '_std')
+// - sorted runs are merged pairwise in log2(threads) rounds, through a buffer
+//   of n values (ping-pong): each round splits its whole output into equal
+//   ranges, one per thread, and merge path gives every range its independent
+//   inputs (SIMD bitonic merge, or std::merge for '_std')
+// - every phase is a fork-join of std::thread (caller runs the last range):
+//   work is balanced by construction, so there is no task queue to steal from
+// - threads = 0: std::thread::hardware_concurrency()
+// NaN not supported
+
+
+// Run f(0..T-1) concurrently, returns once all done
+template <typename F>
+static inline void simdsort_parallel_for(unsigned T, const F& f)
+{
+  std::vector<std::thread> pool;
+  pool.reserve(T);
+  for (unsigned t=0; t+1<T; ++t)
+    pool.push_back(std::thread(f, t));
+  f(T - 1);
+  for (size_t t=0; t<pool.size(); ++t)
+    pool[t].join();
+}
+
+// Merge output range [d0, d1) of a round: runs 2p and 2p+1 of src (bounds
+// holds runs+1 offsets) are merged into the same span of dst, last odd run
+// is copied
+template <typename T>
+static inline void simdsort_parallel_merge_range(const T* src, T* dst, const size_t* bounds, size_t runs, size_t d0, size_t d1,
+                                                 void (*merge)(const T*, size_t, const T*, size_t, T*))
+{
+  for (size_t p=0; p<runs; p+=2)
+  {
+    const size_t lo = bounds[p];
+    const size_t hi = bounds[std::min(p + 2, runs)];
+    if (hi <= d0 || lo >= d1)
+      continue;
+
+    const size_t e0 = std::max(d0, lo) - lo;
+    const size_t e1 = std::min(d1, hi) - lo;
+    if (p + 1 == runs)
+    {
+      memcpy(dst + lo + e0, src + lo + e0, (e1 - e0) * sizeof(T));
+      continue;
+    }
+
+    const T* a = src + lo;
+    const T* b = src + bounds[p+1];
+    const size_t na = bounds[p+1] - lo;
+    const size_t nb = hi - bounds[p+1];
+    const size_t i0 = simdmerge_path(a, na, b, nb, e0);
+    const size_t i1 = simdmerge_path(a, na, b, nb, e1);
+    merge(a + i0, i1 - i0, b + (e0 - i0), (e1 - i1) - (e0 - i0), dst + lo + e0);
+  }
+}
+
+//
+template <typename T>
+static inline void simdsort_parallel(T* v, size_t n, unsigned threads,
+                                     void (*sort)(T*, size_t),
+                                     void (*merge)(const T*, size_t, const T*, size_t, T*))
+{
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  const unsigned NT = (unsigned)std::max((size_t)1, std::min((size_t)threads, n / SSORT_PARALLEL_MIN));
+  if (NT == 1)
+  {
+    sort(v, n);
+    return;
+  }
+
+  // Sort one chunk per thread
+  std::vector<size_t> bounds(NT + 1), next(NT + 1);
+  for (unsigned t=0; t<=NT; ++t)
+    bounds[t] = (size_t)((uint64_t)n * t / NT);
+  simdsort_parallel_for(NT, [&](unsigned t) { sort(v + bounds[t], bounds[t+1] - bounds[t]); });
+
+  // Merge runs pairwise, all threads on every round
+  std::vector<T> tmp(n);
+  T* src = v;
+  T* dst = tmp.data();
+  size_t runs = NT;
+  while (runs > 1)
+  {
+    simdsort_parallel_for(NT, [&](unsigned t) {
+      simdsort_parallel_merge_range(src, dst, bounds.data(), runs, n * t / NT, n * (t + 1) / NT, merge);
+    });
+
+    size_t r = 0;
+    for (size_t p=0; p<runs; p+=2)
+      next[r++] = bounds[p];
+    next[r] = n;
+    bounds.swap(next);
+    runs = r;
+    std::swap(src, dst);
+  }
+
+  // Back to original buffer
+  if (src != v)
+    simdsort_parallel_for(NT, [&](unsigned t) {
+      const size_t d0 = n * t / NT, d1 = n * (t + 1) / NT;
+      memcpy(v + d0, src + d0, (d1 - d0) * sizeof(T));
+    });
+}
+
+
+// Reference: std::sort per chunk, std::merge
+static inline void simdsort_parallel_i32_std(int32_t* v, size_t n, unsigned threads) { simdsort_parallel<int32_t>(v, n, threads, simdsort_i32_std, simdmerge_i32_std); }
+static inline void simdsort_parallel_flt_std(float* v, size_t n, unsigned threads)   { simdsort_parallel<float>(v, n, threads, simdsort_flt_std, simdmerge_flt_std); }
+static inline void simdsort_parallel_dbl_std(double* v, size_t n, unsigned threads)  { simdsort_parallel<double>(v, n, threads, simdsort_dbl_std, simdmerge_dbl_std); }
+
+//
+#ifdef HAS_AVX2_
+static inline void simdsort_parallel_i32_avx2(int32_t* v, size_t n, unsigned threads) { simdsort_parallel<int32_t>(v, n, threads, simdsort_i32_avx2, simdmerge_i32_avx2); }
+static inline void simdsort_parallel_flt_avx2(float* v, size_t n, unsigned threads)   { simdsort_parallel<float>(v, n, threads, simdsort_flt_avx2, simdmerge_flt_avx); }
+static inline void simdsort_parallel_dbl_avx2(double* v, size_t n, unsigned threads)  { simdsort_parallel<double>(v, n, threads, simdsort_dbl_avx2, simdmerge_dbl_avx); }
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+static inline void simdsort_parallel_i32_avx512(int32_t* v, size_t n, unsigned threads) { simdsort_parallel<int32_t>(v, n, threads, simdsort_i32_avx512, simdmerge_i32_avx512); }
+static inline void simdsort_parallel_flt_avx512(float* v, size_t n, unsigned threads)   { simdsort_parallel<float>(v, n, threads, simdsort_flt_avx512, simdmerge_flt_avx512); }
+static inline void simdsort_parallel_dbl_avx512(double* v, size_t n, unsigned threads)  { simdsort_parallel<double>(v, n, threads, simdsort_dbl_avx512, simdmerge_dbl_avx512); }
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_PARALLEL_H
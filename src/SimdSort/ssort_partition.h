@@ -0,0 +1,529 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_PARTITION_H
+#define SSORT_PARTITION_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_lut.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_PARTITION_KMAX
+  #define SSORT_PARTITION_KMAX 16   // max buckets of the vectorized k-way partition (std version above)
+#endif
+#ifndef SSORT_PARTITION_WC
+  #define SSORT_PARTITION_WC 64     // k-way partition: values buffered per bucket before a flush
+#endif
+
+// Standalone partitions of int32, uint32, float and double arrays:
+// - 'simdpartition(v, n, pivot)': in-place, [< pivot | >= pivot], returns the
+//   size of the left part (same loop as the quicksort partitions: first and
+//   last vectors kept in register, reads from the side with less room, each
+//   vector stored compressed on both sides), order not preserved
+// - 'simdpartition_copy(v, n, pivot, out_t, out_f)': out-of-place and stable,
+//   values < pivot to out_t, others to out_f, returns the size of out_t
+// - '_if' versions take a predicate 'bool pred(T)': its results are gathered
+//   into a lanes mask, values are then moved by the same compressed stores
+// - 'simdpartition_buckets(v, n, splitters, k, out, bounds)': stable k-way
+//   partition on k-1 sorted splitters (bucket of x: number of splitters <= x,
+//   as std::upper_bound), bucket b written to out[bounds[b]..bounds[b+1]).
+//   One counting pass (compare masks popcounts against each splitter), then
+//   each vector is compressed once per bucket (masks of consecutive splitters
+//   combined) into a small buffer per bucket, flushed to out every
+//   SSORT_PARTITION_WC values
+// AVX2: permutation LUTs (ssort_lut.h), AVX-512: compress stores
+// AVX2 copies store full vectors: outputs must hold n values
+// Float/double: ordered compares, NaNs are not below any pivot or splitter
+
+
+// Reference
+template <typename T>
+static inline size_t simdpartition_std(T* v, size_t n, T pivot)
+{
+  return std::partition(v, v + n, [pivot](T x) { return x < pivot; }) - v;
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_if_std(T* v, size_t n, F pred)
+{
+  return std::partition(v, v + n, pred) - v;
+}
+
+template <typename T>
+static inline size_t simdpartition_copy_std(const T* v, size_t n, T pivot, T* __restrict out_t, T* __restrict out_f)
+{
+  return std::partition_copy(v, v + n, out_t, out_f, [pivot](T x) { return x < pivot; }).first - out_t;
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_copy_if_std(const T* v, size_t n, F pred, T* __restrict out_t, T* __restrict out_f)
+{
+  return std::partition_copy(v, v + n, out_t, out_f, pred).first - out_t;
+}
+
+template <typename T>
+static inline void simdpartition_buckets_std(const T* v, size_t n, const T* splitters, size_t k, T* __restrict out, size_t* bounds)
+{
+  std::vector<uint32_t> b(n);
+  std::fill(bounds, bounds + k + 1, 0);
+  for (size_t i=0; i<n; ++i)
+  {
+    b[i] = (uint32_t)(std::upper_bound(splitters, splitters + k - 1, v[i]) - splitters);
+    ++bounds[b[i] + 1];
+  }
+  for (size_t j=0; j<k; ++j)
+    bounds[j+1] += bounds[j];
+
+  std::vector<size_t> pos(bounds, bounds + k);
+  for (size_t i=0; i<n; ++i)
+    out[pos[b[i]]++] = v[i];
+}
+
+//
+#ifdef HAS_AVX2_
+// Lanes mask of a vector: values below pivot
+template <typename T, typename Op>
+struct simdpartition_lt
+{
+  const typename Op::V p;
+  const T pivot;
+  explicit simdpartition_lt(T pivot_) : p(Op::set1(pivot_)), pivot(pivot_) {}
+  inline uint32_t operator()(const typename Op::V x) const { return Op::lt(x, p); }
+  inline bool operator()(const T x) const                  { return x < pivot; }
+};
+
+// Lanes mask of a vector: predicate results (spilled vector)
+template <typename T, typename Op, typename F>
+struct simdpartition_pred
+{
+  const F& f;
+  explicit simdpartition_pred(const F& f_) : f(f_) {}
+  inline uint32_t operator()(const typename Op::V x) const
+  {
+    T b[Op::L];
+    Op::storeu(b, x);
+    uint32_t m = 0;
+    for (size_t j=0; j<Op::L; ++j)
+      m |= (uint32_t)(f(b[j]) ? 1 : 0) << j;
+    return m;
+  }
+  inline bool operator()(const T x) const { return f(x) ? true : false; }
+};
+
+// In-place, n >= 2 vectors (see simdsort_partition_i32_avx2)
+template <typename T, typename Op, typename M>
+static inline size_t simdpartition_k(T* __restrict v, size_t n, const M& mask)
+{
+  const size_t L = Op::L;
+  if (n < 2 * L)
+    return std::partition(v, v + n, [&mask](T x) { return mask(x); }) - v;
+
+  T* l_w = v;
+  T* r_w = v + n;
+  T* l_r = v + L;
+  T* r_r = v + n - L;
+  const typename Op::V vl = Op::load(v);
+  const typename Op::V vr = Op::load(v + n - L);
+
+  while (r_r - l_r >= (ptrdiff_t)L)
+  {
+    typename Op::V x;
+    if ((l_r - l_w) <= (r_w - r_r))
+    {
+      x = Op::load(l_r);
+      l_r += L;
+    }
+    else
+    {
+      r_r -= L;
+      x = Op::load(r_r);
+    }
+
+    const uint32_t m = mask(x);
+    const size_t c = _mm_popcnt_u32(m);
+    Op::store2(l_w, r_w, x, m, c);
+    l_w += c;
+    r_w -= L - c;
+  }
+
+  // Remaining < L: scalar (same side choice keeps room for writes)
+  while (l_r < r_r)
+  {
+    T e = ((l_r - l_w) <= (r_w - r_r)) ? *l_r++ : *--r_r;
+    if (mask(e))
+      *l_w++ = e;
+    else
+      *--r_w = e;
+  }
+
+  // Kept vectors (exactly 2L free slots left)
+  uint32_t m = mask(vl);
+  size_t c = _mm_popcnt_u32(m);
+  Op::store2(l_w, r_w, vl, m, c);
+  l_w += c;
+  r_w -= L - c;
+
+  m = mask(vr);
+  c = _mm_popcnt_u32(m);
+  Op::store2(l_w, r_w, vr, m, c);
+  l_w += c;
+
+  return (size_t)(l_w - v);
+}
+
+// Out-of-place, stable
+template <typename T, typename Op, typename M>
+static inline size_t simdpartition_copy_k(const T* v, size_t n, T* __restrict out_t, T* __restrict out_f, const M& mask)
+{
+  const size_t L = Op::L;
+  size_t i = 0, t = 0, f = 0;
+  for (; i + L <= n; i += L)
+  {
+    const typename Op::V x = Op::load(v + i);
+    const uint32_t m = mask(x);
+    const size_t c = _mm_popcnt_u32(m);
+    Op::compress(out_t + t, x, m);
+    Op::compress(out_f + f, x, m ^ Op::M);
+    t += c;
+    f += L - c;
+  }
+  for (; i<n; ++i)
+  {
+    const T e = v[i];
+    if (mask(e))
+      out_t[t++] = e;
+    else
+      out_f[f++] = e;
+  }
+  return t;
+}
+
+// k-way, stable (2 <= k <= SSORT_PARTITION_KMAX)
+template <typename T, typename Op>
+static inline void simdpartition_buckets_k(const T* v, size_t n, const T* splitters, size_t k, T* __restrict out, size_t* bounds)
+{
+  const size_t L = Op::L;
+  const size_t W = SSORT_PARTITION_WC;
+  const size_t J = k - 1;
+  typename Op::V s[SSORT_PARTITION_KMAX];
+  for (size_t j=0; j<J; ++j)
+    s[j] = Op::set1(splitters[j]);
+
+  // Values below each splitter
+  size_t below[SSORT_PARTITION_KMAX] = { 0 };
+  size_t i = 0;
+  for (; i + L <= n; i += L)
+  {
+    const typename Op::V x = Op::load(v + i);
+    for (size_t j=0; j<J; ++j)
+      below[j] += _mm_popcnt_u32(Op::lt(x, s[j]));
+  }
+  for (; i<n; ++i)
+    for (size_t j=0; j<J; ++j)
+      below[j] += (v[i] < splitters[j]);
+
+  bounds[0] = 0;
+  for (size_t j=0; j<J; ++j)
+    bounds[j+1] = below[j];
+  bounds[k] = n;
+
+  // Bucket b: below splitter b, not below splitter b-1
+  std::vector<T> buf(k * (W + L));
+  size_t pos[SSORT_PARTITION_KMAX], cnt[SSORT_PARTITION_KMAX];
+  for (size_t b=0; b<k; ++b)
+  {
+    pos[b] = bounds[b];
+    cnt[b] = 0;
+  }
+
+  for (i=0; i + L <= n; i += L)
+  {
+    const typename Op::V x = Op::load(v + i);
+    uint32_t prev = 0;
+    for (size_t b=0; b<k; ++b)
+    {
+      const uint32_t lt = (b < J) ? Op::lt(x, s[b]) : Op::M;
+      const uint32_t m = lt & ~prev;
+      prev = lt;
+
+      T* bb = buf.data() + b * (W + L);
+      Op::compress(bb + cnt[b], x, m);
+      cnt[b] += _mm_popcnt_u32(m);
+      if (cnt[b] >= W)
+      {
+        memcpy(out + pos[b], bb, W * sizeof(T));
+        pos[b] += W;
+        cnt[b] -= W;
+        memcpy(bb, bb + W, cnt[b] * sizeof(T));
+      }
+    }
+  }
+  for (; i<n; ++i)
+  {
+    size_t b = 0;
+    while (b < J && !(v[i] < splitters[b]))
+      ++b;
+    buf[b * (W + L) + cnt[b]++] = v[i];
+  }
+
+  for (size_t b=0; b<k; ++b)
+    if (cnt[b])
+      memcpy(out + pos[b], buf.data() + b * (W + L), cnt[b] * sizeof(T));
+}
+
+// Per type: pivot broadcast, below-pivot lanes mask, compressed stores
+template <typename T> struct simdpartition_op_avx2;
+
+template <size_t S>
+struct simdpartition_vec_avx2
+{
+  typedef __m256i V;
+  static const size_t L = 32 / S;
+  static const uint32_t M = (1u << (32 / S)) - 1;
+  static inline V load(const void* p)           { return _mm256_loadu_si256((__m256i const*)p); }
+  static inline void storeu(void* p, const V x) { _mm256_storeu_si256((__m256i*)p, x); }
+  // Lanes of m first, in order (full vector stored)
+  static inline V perm(const V x, uint32_t m)   { return _mm256_permutevar8x32_epi32(x, ssort_perm_idx_avx2(S == 4 ? ssort_perm_8[m] : ssort_perm_4[m])); }
+  static inline void compress(void* out, const V x, uint32_t m) { storeu(out, perm(x, m)); }
+  // Lanes of m at l_w, others ending at r_w
+  template <typename T>
+  static inline void store2(T* l_w, T* r_w, const V x, uint32_t m, size_t)
+  {
+    const V y = perm(x, m);
+    storeu(l_w, y);
+    storeu(r_w - L, y);
+  }
+};
+
+template <>
+struct simdpartition_op_avx2<int32_t> : simdpartition_vec_avx2<4>
+{
+  static inline V set1(int32_t p)               { return _mm256_set1_epi32(p); }
+  static inline uint32_t lt(const V x, const V p) { return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, x))); }
+};
+
+template <>
+struct simdpartition_op_avx2<uint32_t> : simdpartition_vec_avx2<4>
+{
+  // Sign bit flipped: pivot once, values in lt
+  static inline V set1(uint32_t p)              { return _mm256_set1_epi32((int32_t)(p ^ 0x80000000u)); }
+  static inline uint32_t lt(const V x, const V p)
+  {
+    return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, _mm256_xor_si256(x, _mm256_set1_epi32((int32_t)0x80000000u)))));
+  }
+};
+
+template <>
+struct simdpartition_op_avx2<float> : simdpartition_vec_avx2<4>
+{
+  static inline V set1(float p)                 { return _mm256_castps_si256(_mm256_set1_ps(p)); }
+  static inline uint32_t lt(const V x, const V p) { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(x), _mm256_castsi256_ps(p), _CMP_LT_OQ)); }
+};
+
+template <>
+struct simdpartition_op_avx2<double> : simdpartition_vec_avx2<8>
+{
+  static inline V set1(double p)                { return _mm256_castpd_si256(_mm256_set1_pd(p)); }
+  static inline uint32_t lt(const V x, const V p) { return (uint32_t)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(x), _mm256_castsi256_pd(p), _CMP_LT_OQ)); }
+};
+
+template <typename T>
+static inline size_t simdpartition_avx2(T* v, size_t n, T pivot)
+{
+  return simdpartition_k<T, simdpartition_op_avx2<T>>(v, n, simdpartition_lt<T, simdpartition_op_avx2<T>>(pivot));
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_if_avx2(T* v, size_t n, F pred)
+{
+  return simdpartition_k<T, simdpartition_op_avx2<T>>(v, n, simdpartition_pred<T, simdpartition_op_avx2<T>, F>(pred));
+}
+
+template <typename T>
+static inline size_t simdpartition_copy_avx2(const T* v, size_t n, T pivot, T* __restrict out_t, T* __restrict out_f)
+{
+  return simdpartition_copy_k<T, simdpartition_op_avx2<T>>(v, n, out_t, out_f, simdpartition_lt<T, simdpartition_op_avx2<T>>(pivot));
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_copy_if_avx2(const T* v, size_t n, F pred, T* __restrict out_t, T* __restrict out_f)
+{
+  return simdpartition_copy_k<T, simdpartition_op_avx2<T>>(v, n, out_t, out_f, simdpartition_pred<T, simdpartition_op_avx2<T>, F>(pred));
+}
+
+template <typename T>
+static inline void simdpartition_buckets_avx2(const T* v, size_t n, const T* splitters, size_t k, T* __restrict out, size_t* bounds)
+{
+  if (k < 2 || k > SSORT_PARTITION_KMAX)
+    simdpartition_buckets_std(v, n, splitters, k, out, bounds);
+  else
+    simdpartition_buckets_k<T, simdpartition_op_avx2<T>>(v, n, splitters, k, out, bounds);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+template <typename T> struct simdpartition_op_avx512;
+
+template <size_t S>
+struct simdpartition_vec_avx512
+{
+  typedef __m512i V;
+  static const size_t L = 64 / S;
+  static const uint32_t M = (1u << (64 / S)) - 1;
+  static inline V load(const void* p)           { return _mm512_loadu_si512(p); }
+  static inline void storeu(void* p, const V x) { _mm512_storeu_si512(p, x); }
+  // Lanes of m only, in order
+  static inline void compress(void* out, const V x, uint32_t m)
+  {
+    if (S == 4)
+      _mm512_mask_compressstoreu_epi32(out, (__mmask16)m, x);
+    else
+      _mm512_mask_compressstoreu_epi64(out, (__mmask8)m, x);
+  }
+  // Lanes of m at l_w, others ending at r_w
+  template <typename T>
+  static inline void store2(T* l_w, T* r_w, const V x, uint32_t m, size_t c)
+  {
+    compress(l_w, x, m);
+    compress(r_w - (L - c), x, m ^ M);
+  }
+};
+
+template <>
+struct simdpartition_op_avx512<int32_t> : simdpartition_vec_avx512<4>
+{
+  static inline V set1(int32_t p)                 { return _mm512_set1_epi32(p); }
+  static inline uint32_t lt(const V x, const V p) { return _mm512_cmplt_epi32_mask(x, p); }
+};
+
+template <>
+struct simdpartition_op_avx512<uint32_t> : simdpartition_vec_avx512<4>
+{
+  static inline V set1(uint32_t p)                { return _mm512_set1_epi32((int32_t)p); }
+  static inline uint32_t lt(const V x, const V p) { return _mm512_cmplt_epu32_mask(x, p); }
+};
+
+template <>
+struct simdpartition_op_avx512<float> : simdpartition_vec_avx512<4>
+{
+  static inline V set1(float p)                   { return _mm512_castps_si512(_mm512_set1_ps(p)); }
+  static inline uint32_t lt(const V x, const V p) { return _mm512_cmp_ps_mask(_mm512_castsi512_ps(x), _mm512_castsi512_ps(p), _CMP_LT_OQ); }
+};
+
+template <>
+struct simdpartition_op_avx512<double> : simdpartition_vec_avx512<8>
+{
+  static inline V set1(double p)                  { return _mm512_castpd_si512(_mm512_set1_pd(p)); }
+  static inline uint32_t lt(const V x, const V p) { return _mm512_cmp_pd_mask(_mm512_castsi512_pd(x), _mm512_castsi512_pd(p), _CMP_LT_OQ); }
+};
+
+template <typename T>
+static inline size_t simdpartition_avx512(T* v, size_t n, T pivot)
+{
+  return simdpartition_k<T, simdpartition_op_avx512<T>>(v, n, simdpartition_lt<T, simdpartition_op_avx512<T>>(pivot));
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_if_avx512(T* v, size_t n, F pred)
+{
+  return simdpartition_k<T, simdpartition_op_avx512<T>>(v, n, simdpartition_pred<T, simdpartition_op_avx512<T>, F>(pred));
+}
+
+template <typename T>
+static inline size_t simdpartition_copy_avx512(const T* v, size_t n, T pivot, T* __restrict out_t, T* __restrict out_f)
+{
+  return simdpartition_copy_k<T, simdpartition_op_avx512<T>>(v, n, out_t, out_f, simdpartition_lt<T, simdpartition_op_avx512<T>>(pivot));
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_copy_if_avx512(const T* v, size_t n, F pred, T* __restrict out_t, T* __restrict out_f)
+{
+  return simdpartition_copy_k<T, simdpartition_op_avx512<T>>(v, n, out_t, out_f, simdpartition_pred<T, simdpartition_op_avx512<T>, F>(pred));
+}
+
+template <typename T>
+static inline void simdpartition_buckets_avx512(const T* v, size_t n, const T* splitters, size_t k, T* __restrict out, size_t* bounds)
+{
+  if (k < 2 || k > SSORT_PARTITION_KMAX)
+    simdpartition_buckets_std(v, n, splitters, k, out, bounds);
+  else
+    simdpartition_buckets_k<T, simdpartition_op_avx512<T>>(v, n, splitters, k, out, bounds);
+}
+#endif // HAS_AVX512F_
+
+
+// Best available version (int32, uint32, float, double)
+template <typename T>
+static inline size_t simdpartition(T* v, size_t n, T pivot)
+{
+#if defined(HAS_AVX512F_)
+  return simdpartition_avx512(v, n, pivot);
+#elif defined(HAS_AVX2_)
+  return simdpartition_avx2(v, n, pivot);
+#else
+  return simdpartition_std(v, n, pivot);
+#endif
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_if(T* v, size_t n, F pred)
+{
+#if defined(HAS_AVX512F_)
+  return simdpartition_if_avx512(v, n, pred);
+#elif defined(HAS_AVX2_)
+  return simdpartition_if_avx2(v, n, pred);
+#else
+  return simdpartition_if_std(v, n, pred);
+#endif
+}
+
+template <typename T>
+static inline size_t simdpartition_copy(const T* v, size_t n, T pivot, T* __restrict out_t, T* __restrict out_f)
+{
+#if defined(HAS_AVX512F_)
+  return simdpartition_copy_avx512(v, n, pivot, out_t, out_f);
+#elif defined(HAS_AVX2_)
+  return simdpartition_copy_avx2(v, n, pivot, out_t, out_f);
+#else
+  return simdpartition_copy_std(v, n, pivot, out_t, out_f);
+#endif
+}
+
+template <typename T, typename F>
+static inline size_t simdpartition_copy_if(const T* v, size_t n, F pred, T* __restrict out_t, T* __restrict out_f)
+{
+#if defined(HAS_AVX512F_)
+  return simdpartition_copy_if_avx512(v, n, pred, out_t, out_f);
+#elif defined(HAS_AVX2_)
+  return simdpartition_copy_if_avx2(v, n, pred, out_t, out_f);
+#else
+  return simdpartition_copy_if_std(v, n, pred, out_t, out_f);
+#endif
+}
+
+template <typename T>
+static inline void simdpartition_buckets(const T* v, size_t n, const T* splitters, size_t k, T* __restrict out, size_t* bounds)
+{
+#if defined(HAS_AVX512F_)
+  simdpartition_buckets_avx512(v, n, splitters, k, out, bounds);
+#elif defined(HAS_AVX2_)
+  simdpartition_buckets_avx2(v, n, splitters, k, out, bounds);
+#else
+  simdpartition_buckets_std(v, n, splitters, k, out, bounds);
+#endif
+}
+
+
+#endif // SSORT_PARTITION_H
@@ -0,0 +1,310 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_RADIX_H
+#define SSORT_RADIX_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_hybrid.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_RADIX_WC
+  #define SSORT_RADIX_WC  128   // write-combining buffer bytes per bucket (0: direct scatter)
+#endif
+#ifndef SSORT_RADIX_MIN
+  #define SSORT_RADIX_MIN 2048  // smaller arrays (keys only, x4 for 64 bits) use simdsort_hybrid
+#endif
+
+// LSD radix sort, 8 bits digits (4 passes for 32 bits keys, 8 for 64 bits):
+// - keys are mapped to ordered unsigned integers in register (AVX2): signed
+//   top bit flipped, float/double all bits of negatives flipped (-NaN first,
+//   +NaN last, -0 before +0), and mapped back in the last copy
+// - histograms of every digit are counted in the same read pass (scalar, local
+//   32 bits counters)
+// - passes where every key has the same digit are skipped
+// - scatter goes through one 128 bytes buffer per bucket (32 KB), full buffers
+//   are flushed with a single contiguous copy (fewer cache/TLB misses on large
+//   arrays)
+// - key-value mode moves a payload of the same width (stable, ties keep their
+//   input order), from a buffer alongside the keys one
+// - small arrays (keys only, below SSORT_RADIX_MIN) go to simdsort_hybrid
+//   (float/double: on mapped keys, same order as above)
+// Memory: one buffer of n keys (and n payloads)
+
+
+// Key kinds: 0 unsigned, 1 signed, 2 floating point
+template <typename U, int Kind>
+static inline U simdradix_enc(U x)
+{
+  const U top = (U)1 << (8*sizeof(U) - 1);
+  if (Kind == 0) return x;
+  if (Kind == 1) return x ^ top;
+  return x ^ ((x & top) ? (U)~(U)0 : top);
+}
+
+template <typename U, int Kind>
+static inline U simdradix_dec(U x)
+{
+  const U top = (U)1 << (8*sizeof(U) - 1);
+  if (Kind == 0) return x;
+  if (Kind == 1) return x ^ top;
+  return x ^ ((x & top) ? top : (U)~(U)0);
+}
+
+//
+#ifdef HAS_AVX2_
+template <int Kind>
+static inline __m256i simdradix_enc32_avx2(__m256i x)
+{
+  const __m256i top = _mm256_set1_epi32(INT32_MIN);
+  if (Kind == 0) return x;
+  if (Kind == 1) return _mm256_xor_si256(x, top);
+  return _mm256_xor_si256(x, _mm256_or_si256(_mm256_srai_epi32(x, 31), top));
+}
+
+template <int Kind>
+static inline __m256i simdradix_dec32_avx2(__m256i x)
+{
+  const __m256i top = _mm256_set1_epi32(INT32_MIN);
+  if (Kind == 0) return x;
+  if (Kind == 1) return _mm256_xor_si256(x, top);
+  return _mm256_xor_si256(x, _mm256_or_si256(_mm256_srai_epi32(_mm256_xor_si256(x, top), 31), top));
+}
+
+template <int Kind>
+static inline __m256i simdradix_enc64_avx2(__m256i x)
+{
+  const __m256i top = _mm256_set1_epi64x(INT64_MIN);
+  if (Kind == 0) return x;
+  if (Kind == 1) return _mm256_xor_si256(x, top);
+  return _mm256_xor_si256(x, _mm256_or_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), x), top));
+}
+
+template <int Kind>
+static inline __m256i simdradix_dec64_avx2(__m256i x)
+{
+  const __m256i top = _mm256_set1_epi64x(INT64_MIN);
+  if (Kind == 0) return x;
+  if (Kind == 1) return _mm256_xor_si256(x, top);
+  return _mm256_xor_si256(x, _mm256_or_si256(_mm256_cmpgt_epi64(x, _mm256_set1_epi64x(-1)), top));
+}
+
+template <typename U, int Kind>
+static inline __m256i simdradix_enc_avx2(__m256i x) { return (sizeof(U) == 4) ? simdradix_enc32_avx2<Kind>(x) : simdradix_enc64_avx2<Kind>(x); }
+template <typename U, int Kind>
+static inline __m256i simdradix_dec_avx2(__m256i x) { return (sizeof(U) == 4) ? simdradix_dec32_avx2<Kind>(x) : simdradix_dec64_avx2<Kind>(x); }
+#endif // HAS_AVX2_
+
+// Map keys while copying src to dst (src == dst: in place)
+template <typename U, int Kind>
+static inline void simdradix_encode(const U* src, U* dst, size_t n)
+{
+  size_t i = 0;
+#ifdef HAS_AVX2_
+  const size_t L = 32 / sizeof(U);
+  const size_t m = n - n % L;
+  for (; i<m; i += L)
+    _mm256_storeu_si256((__m256i*)(dst + i), simdradix_enc_avx2<U, Kind>(_mm256_loadu_si256((__m256i const*)(src + i))));
+#endif
+  for (; i<n; ++i)
+    dst[i] = simdradix_enc<U, Kind>(src[i]);
+}
+
+// Map keys (in place) and count every digit
+// Blocks of 1024 keys are mapped (AVX2) then counted once stored, into 32 bits
+// local histograms (no store forwarding stall, no aliasing with hist)
+template <typename U, int Kind>
+static inline void simdradix_encode_hist(U* v, size_t n, size_t (*hist)[256])
+{
+  const unsigned P = sizeof(U);
+  const size_t B = 1024;
+  uint32_t h[8][256];
+  memset(h, 0, sizeof(h));
+
+  for (size_t b=0; b<n; b+=B)
+  {
+    const size_t e = std::min(n, b + B);
+    simdradix_encode<U, Kind>(v + b, v + b, e - b);
+
+    for (size_t i=b; i<e; ++i)
+    {
+      uint64_t k = 0;
+      memcpy(&k, v + i, sizeof(U));  // little-endian
+      ++h[0][k & 0xFF];         ++h[1][(k >> 8) & 0xFF];
+      ++h[2][(k >> 16) & 0xFF]; ++h[3][(k >> 24) & 0xFF];
+      if (P == 8)
+      {
+        ++h[4][(k >> 32) & 0xFF]; ++h[5][(k >> 40) & 0xFF];
+        ++h[6][(k >> 48) & 0xFF]; ++h[7][(k >> 56) & 0xFF];
+      }
+    }
+
+    // Flush before 32 bits counters overflow
+    if ((b & ((1u << 30) - 1)) + B > (1u << 30) || e == n)
+    {
+      for (unsigned p=0; p<P; ++p)
+        for (size_t d=0; d<256; ++d)
+          hist[p][d] += h[p][d];
+      memset(h, 0, sizeof(h));
+    }
+  }
+}
+
+// Map keys back while copying src to dst (src == dst: in place)
+template <typename U, int Kind>
+static inline void simdradix_decode(const U* src, U* dst, size_t n)
+{
+  size_t i = 0;
+#ifdef HAS_AVX2_
+  const size_t L = 32 / sizeof(U);
+  const size_t m = n - n % L;
+  for (; i<m; i += L)
+    _mm256_storeu_si256((__m256i*)(dst + i), simdradix_dec_avx2<U, Kind>(_mm256_loadu_si256((__m256i const*)(src + i))));
+#endif
+  for (; i<n; ++i)
+    dst[i] = simdradix_dec<U, Kind>(src[i]);
+}
+
+// One pass: scatter src to dst by digit (pos: bucket starts)
+// KV: payloads moved too (keys only: no payload buffer on the stack)
+template <typename U, typename P, bool KV>
+static inline void simdradix_scatter(const U* src, U* dst, const P* psrc, P* pdst, size_t n, unsigned shift, size_t* pos)
+{
+#if SSORT_RADIX_WC > 0
+  const size_t W = SSORT_RADIX_WC / sizeof(U);
+  U wk[256 * (SSORT_RADIX_WC / sizeof(U))];
+  P wp[KV ? 256 * (SSORT_RADIX_WC / sizeof(U)) : 1];
+  uint32_t cnt[256] = { 0 };
+
+  for (size_t i=0; i<n; ++i)
+  {
+    U k;
+    memcpy(&k, src + i, sizeof(U));
+    const size_t d = (size_t)((k >> shift) & 0xFF);
+    const uint32_t c = cnt[d]++;
+    wk[d*W + c] = k;
+    if (KV) wp[d*W + c] = psrc[i];
+    if (c == W - 1)
+    {
+      // Full buffer: one contiguous copy
+      memcpy(dst + pos[d], wk + d*W, W * sizeof(U));
+      if (KV) memcpy(pdst + pos[d], wp + d*W, W * sizeof(P));
+      pos[d] += W;
+      cnt[d] = 0;
+    }
+  }
+
+  // Flush partial buffers
+  for (size_t d=0; d<256; ++d)
+  {
+    memcpy(dst + pos[d], wk + d*W, cnt[d] * sizeof(U));
+    if (KV) memcpy(pdst + pos[d], wp + d*W, cnt[d] * sizeof(P));
+  }
+#else
+  for (size_t i=0; i<n; ++i)
+  {
+    U k;
+    memcpy(&k, src + i, sizeof(U));
+    const size_t d = (size_t)((k >> shift) & 0xFF);
+    memcpy(dst + pos[d], &k, sizeof(U));
+    if (KV) pdst[pos[d]] = psrc[i];
+    ++pos[d];
+  }
+#endif
+}
+
+//
+template <typename U, int Kind, typename P>
+static inline void simdradix_sort(U* v, P* pv, size_t n)
+{
+  const unsigned NP = sizeof(U);
+  if (n < 2)
+    return;
+
+  size_t hist[sizeof(U)][256];
+  memset(hist, 0, sizeof(hist));
+  simdradix_encode_hist<U, Kind>(v, n, hist);
+
+  std::vector<U> tmp(n);
+  std::vector<P> ptmp(pv ? n : 0);
+  U* src = v;     U* dst = tmp.data();
+  P* psrc = pv;   P* pdst = ptmp.data();
+
+  for (unsigned p=0; p<NP; ++p)
+  {
+    // Constant digit: nothing to move
+    U k0;
+    memcpy(&k0, v, sizeof(U));
+    if (hist[p][(k0 >> (8*p)) & 0xFF] == n)
+      continue;
+
+    size_t pos[256], s = 0;
+    for (size_t d=0; d<256; ++d)
+    {
+      pos[d] = s;
+      s += hist[p][d];
+    }
+    if (pv)
+      simdradix_scatter<U, P, true>(src, dst, psrc, pdst, n, 8*p, pos);
+    else
+      simdradix_scatter<U, P, false>(src, dst, psrc, pdst, n, 8*p, pos);
+    std::swap(src, dst);
+    std::swap(psrc, pdst);
+  }
+
+  // Back to original order and buffer
+  simdradix_decode<U, Kind>(src, v, n);
+  if (pv && psrc != pv)
+    memcpy(pv, psrc, n * sizeof(P));
+}
+
+// Keys only
+template <typename T, typename U, int Kind>
+static inline void simdradix_sort_keys(T* v, size_t n)
+{
+  if (n < (sizeof(U) == 8 ? 4 : 1) * (size_t)SSORT_RADIX_MIN)
+  {
+    if (Kind == 2)
+    {
+      // NaNs and signed zeros: sort mapped keys as unsigned
+      simdradix_encode<U, Kind>((U*)v, (U*)v, n);
+      simdsort_hybrid((U*)v, n);
+      simdradix_decode<U, Kind>((U*)v, (U*)v, n);
+    }
+    else
+      simdsort_hybrid(v, n);
+    return;
+  }
+  simdradix_sort<U, Kind, U>((U*)v, (U*)NULL, n);
+}
+
+
+//
+static inline void simdsort_radix_u32(uint32_t* v, size_t n) { simdradix_sort_keys<uint32_t, uint32_t, 0>(v, n); }
+static inline void simdsort_radix_i32(int32_t* v, size_t n)  { simdradix_sort_keys<int32_t,  uint32_t, 1>(v, n); }
+static inline void simdsort_radix_flt(float* v, size_t n)    { simdradix_sort_keys<float,    uint32_t, 2>(v, n); }
+static inline void simdsort_radix_u64(uint64_t* v, size_t n) { simdradix_sort_keys<uint64_t, uint64_t, 0>(v, n); }
+static inline void simdsort_radix_i64(int64_t* v, size_t n)  { simdradix_sort_keys<int64_t,  uint64_t, 1>(v, n); }
+static inline void simdsort_radix_dbl(double* v, size_t n)   { simdradix_sort_keys<double,   uint64_t, 2>(v, n); }
+
+// Key-value (payload follows its key, stable)
+static inline void simdsort_radix_kv_u32(uint32_t* k, int32_t* p, size_t n) { simdradix_sort<uint32_t, 0, int32_t>(k, p, n); }
+static inline void simdsort_radix_kv_i32(int32_t* k, int32_t* p, size_t n)  { simdradix_sort<uint32_t, 1, int32_t>((uint32_t*)k, p, n); }
+static inline void simdsort_radix_kv_flt(float* k, int32_t* p, size_t n)    { simdradix_sort<uint32_t, 2, int32_t>((uint32_t*)k, p, n); }
+static inline void simdsort_radix_kv_u64(uint64_t* k, int64_t* p, size_t n) { simdradix_sort<uint64_t, 0, int64_t>(k, p, n); }
+static inline void simdsort_radix_kv_i64(int64_t* k, int64_t* p, size_t n)  { simdradix_sort<uint64_t, 1, int64_t>((uint64_t*)k, p, n); }
+static inline void simdsort_radix_kv_dbl(double* k, int64_t* p, size_t n)   { simdradix_sort<uint64_t, 2, int64_t>((uint64_t*)k, p, n); }
+
+
+#endif // SSORT_RADIX_H
@@ -0,0 +1,176 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_RECORDS_H
+#define SSORT_RECORDS_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_radix.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#else
+  #include <xmmintrin.h>  // prefetch
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_RECORDS_MIN
+  #define SSORT_RECORDS_MIN 2048      // smaller arrays skip the radix sort
+#endif
+#ifndef SSORT_RECORDS_PREFETCH
+  #define SSORT_RECORDS_PREFETCH 16   // permutation: records fetched ahead
+#endif
+
+// Stable sort of an array of trivially copyable records by one key field
+// (uint32, int32, float, uint64, int64, double), 'simdsort_records(v, n, &Rec::key)':
+// - keys are gathered with the record stride (AVX2 gathers, 8 x 32 bits or
+//   4 x 64 bits keys per instruction), indices are 32 bits up to 2^32 records
+// - (key, index) pairs are sorted by the radix key-value sort (ssort_radix.h,
+//   ordered key maps in register); below SSORT_RECORDS_MIN, 32 bits keys and
+//   indices are packed into 64 bits values for simdsort_hybrid (networks base
+//   case), 64 bits keys go through std::sort of pairs
+// - records are then permuted through a buffer: sequential writes, reads
+//   prefetched SSORT_RECORDS_PREFETCH indices ahead, one copy back
+// Float/double order as simdsort_radix (-NaN first, +NaN last, -0 before +0)
+// Memory: n keys, n indices and n records (plus the radix sort buffers)
+
+
+// Key bits and kind (see simdradix_enc)
+template <typename K> struct simdrecords_key;
+template <> struct simdrecords_key<uint32_t> { typedef uint32_t U; static const int Kind = 0; };
+template <> struct simdrecords_key<int32_t>  { typedef uint32_t U; static const int Kind = 1; };
+template <> struct simdrecords_key<float>    { typedef uint32_t U; static const int Kind = 2; };
+template <> struct simdrecords_key<uint64_t> { typedef uint64_t U; static const int Kind = 0; };
+template <> struct simdrecords_key<int64_t>  { typedef uint64_t U; static const int Kind = 1; };
+template <> struct simdrecords_key<double>   { typedef uint64_t U; static const int Kind = 2; };
+
+// Gather n keys with byte stride s, and their indices
+template <typename U, typename P>
+static inline void simdrecords_gather(const char* base, size_t n, size_t s, U* __restrict k, P* __restrict p)
+{
+  size_t i = 0;
+#ifdef HAS_AVX2_
+  if (7 * s <= INT32_MAX)
+  {
+    if (sizeof(U) == 4)
+    {
+      const __m256i offs = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)s));
+      for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i*)(k + i), _mm256_i32gather_epi32((int const*)(base + i*s), offs, 1));
+    }
+    else
+    {
+      const __m128i offs = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)s));
+      for (; i + 4 <= n; i += 4)
+        _mm256_storeu_si256((__m256i*)(k + i), _mm256_i32gather_epi64((long long const*)(base + i*s), offs, 1));
+    }
+  }
+#endif
+  for (; i<n; ++i)
+    memcpy(k + i, base + i*s, sizeof(U));
+  for (i=0; i<n; ++i)
+    p[i] = (P)i;
+}
+
+// Small arrays, (key, index) pairs ordered on mapped keys then indices (stable)
+// 32 bits keys: packed into 64 bits values, sorted by simdsort_hybrid (networks)
+template <int Kind, typename P>
+static inline void simdrecords_small(uint32_t* __restrict k, P* __restrict p, size_t n)
+{
+  std::vector<uint64_t> kp(n);
+  for (size_t i=0; i<n; ++i)
+    kp[i] = ((uint64_t)simdradix_enc<uint32_t, Kind>(k[i]) << 32) | (uint64_t)p[i];
+  simdsort_hybrid(kp.data(), n);
+  for (size_t i=0; i<n; ++i)
+  {
+    k[i] = simdradix_dec<uint32_t, Kind>((uint32_t)(kp[i] >> 32));
+    p[i] = (P)(uint32_t)kp[i];
+  }
+}
+
+// 64 bits keys: std::sort of pairs
+template <int Kind, typename P>
+static inline void simdrecords_small(uint64_t* __restrict k, P* __restrict p, size_t n)
+{
+  std::vector<std::pair<uint64_t, P>> kp(n);
+  for (size_t i=0; i<n; ++i)
+    kp[i] = std::make_pair(simdradix_enc<uint64_t, Kind>(k[i]), p[i]);
+  std::sort(kp.begin(), kp.end());
+  for (size_t i=0; i<n; ++i)
+  {
+    k[i] = simdradix_dec<uint64_t, Kind>(kp[i].first);
+    p[i] = kp[i].second;
+  }
+}
+
+// Move records in index order (buffer, then back)
+template <typename R, typename P>
+static inline void simdrecords_permute(R* v, size_t n, const P* __restrict p)
+{
+  const size_t D = SSORT_RECORDS_PREFETCH;
+  std::vector<char> buf(n * sizeof(R));  // raw bytes: records copied with memcpy
+  R* tmp = (R*)buf.data();
+
+  size_t i = 0;
+  for (; i + D < n; ++i)
+  {
+    _mm_prefetch((const char*)(v + p[i + D]), _MM_HINT_T0);
+    memcpy(tmp + i, v + p[i], sizeof(R));
+  }
+  for (; i<n; ++i)
+    memcpy(tmp + i, v + p[i], sizeof(R));
+
+  memcpy(v, tmp, n * sizeof(R));
+}
+
+
+//
+template <typename R, typename U, int Kind, typename P>
+static inline void simdrecords_sort(R* v, size_t n, size_t off)
+{
+  std::vector<U> k(n);
+  std::vector<P> p(n);
+  simdrecords_gather((const char*)v + off, n, sizeof(R), k.data(), p.data());
+
+  if (n < SSORT_RECORDS_MIN)
+    simdrecords_small<Kind, P>(k.data(), p.data(), n);
+  else
+    simdradix_sort<U, Kind, P>(k.data(), p.data(), n);
+
+  simdrecords_permute(v, n, p.data());
+}
+
+template <typename R, typename K>
+static inline void simdsort_records(R* v, size_t n, K R::* key)
+{
+  static_assert(std::is_trivially_copyable<R>::value, "simdsort_records: trivially copyable records only");
+  typedef typename simdrecords_key<K>::U U;
+  const int Kind = simdrecords_key<K>::Kind;
+  if (n < 2)
+    return;
+
+  const size_t off = (size_t)((const char*)&(v->*key) - (const char*)v);
+  if ((uint64_t)n <= UINT32_MAX)
+    simdrecords_sort<R, U, Kind, uint32_t>(v, n, off);
+  else
+    simdrecords_sort<R, U, Kind, uint64_t>(v, n, off);
+}
+
+// Reference: std::stable_sort with key comparison (NaN not supported)
+template <typename R, typename K>
+static inline void simdsort_records_std(R* v, size_t n, K R::* key)
+{
+  std::stable_sort(v, v + n, [key](const R& a, const R& b) { return a.*key < b.*key; });
+}
+
+
+#endif // SSORT_RECORDS_H
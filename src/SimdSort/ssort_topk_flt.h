@@ -0,0 +1,409 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_TOPK_FLT_H
+#define SSORT_TOPK_FLT_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_flt.h"
+#include "ssort_flt.h"    // simdsort_partition_flt, simdsort_pivot_flt
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_TOPK_FLT_MIN_ROOM
+  #define SSORT_TOPK_FLT_MIN_ROOM 256   // minimum candidates buffer room past k
+#endif
+
+// Same top-k as ssort_topk_i32.h (NaN not supported)
+
+//
+static inline void simdtopk_flt_partial_sort(const float* v, size_t n, size_t k, float* __restrict out)
+{
+  k = std::min(k, n);
+  std::partial_sort_copy(v, v + n, out, out + k, std::greater<float>());
+}
+
+//
+static inline void simdtopk_flt_nth_element(const float* v, size_t n, size_t k, float* __restrict out)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  std::vector<float> tmp(v, v + n);
+  std::nth_element(tmp.begin(), tmp.begin() + (k - 1), tmp.end(), std::greater<float>());
+  std::sort(tmp.begin(), tmp.begin() + k, std::greater<float>());
+  std::copy(tmp.begin(), tmp.begin() + k, out);
+}
+
+// Ties are broken by lowest index
+static inline void simdtopk_idx_flt_std(const float* v, size_t n, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  std::vector< std::pair<float, int32_t> > tmp(n);
+  for (size_t i=0; i<n; ++i)
+    tmp[i] = std::make_pair(v[i], (int32_t)i);
+
+  std::partial_sort(tmp.begin(), tmp.begin() + k, tmp.end(),
+                    [](const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b)
+                    { return (a.first > b.first) || (a.first == b.first && a.second < b.second); });
+  for (size_t i=0; i<k; ++i)
+  {
+    out[i] = tmp[i].first;
+    idx[i] = tmp[i].second;
+  }
+}
+
+// Keep the k largest candidates (first ones on ties, order preserved), return the smallest kept
+static inline float simdtopk_compact_flt(float* keys, int32_t* idx, size_t& cnt, size_t k, float t)
+{
+  size_t gt = 0;
+  for (size_t i=0; i<cnt; ++i)
+    gt += (keys[i] > t);
+
+  size_t eq = k - gt;
+  size_t w = 0;
+  for (size_t i=0; i<cnt; ++i)
+  {
+    float e = keys[i];
+    if (e > t || (e == t && eq))
+    {
+      eq -= (e == t);
+      keys[w] = e;
+      if (idx) idx[w] = idx[i];
+      ++w;
+    }
+  }
+  cnt = w;
+  return t;
+}
+
+// Sort k candidates in descending order (candidates are in input order: ties keep lowest index first)
+static inline void simdtopk_output_flt(const float* keys, const int32_t* cidx, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  if (!idx)
+  {
+    std::copy(keys, keys + k, out);
+    std::sort(out, out + k, std::greater<float>());
+    return;
+  }
+
+  std::vector< std::pair<float, int32_t> > tmp(k);
+  for (size_t i=0; i<k; ++i)
+    tmp[i] = std::make_pair(keys[i], cidx[i]);
+  std::stable_sort(tmp.begin(), tmp.end(),
+                   [](const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) { return a.first > b.first; });
+  for (size_t i=0; i<k; ++i)
+  {
+    out[i] = tmp[i].first;
+    idx[i] = tmp[i].second;
+  }
+}
+
+//
+#ifdef HAS_AVX2_
+// Quickselect: v[p] is the p-th smallest value, vectorized partitions
+static inline float simdtopk_select_flt_avx2(float* __restrict v, size_t n, size_t p)
+{
+  size_t depth = 2 * simdsort_log2(n);
+  while (n > SSORT_FLT_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::nth_element(v, v + p, v + n);
+      return v[p];
+    }
+
+    float pivot = simdsort_pivot_flt(v, n);
+    size_t m = simdsort_partition_flt_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off
+      if (pivot == INFINITY)
+        return pivot;
+      m = simdsort_partition_flt_avx2(v, n, nextafterf(pivot, INFINITY));
+      if (p < m)
+        return pivot;
+    }
+
+    if (p < m)
+      n = m;
+    else
+    {
+      v += m;
+      n -= m;
+      p -= m;
+    }
+  }
+
+  netsort_small_flt_avx2(v, n);
+  return v[p];
+}
+
+// Keep the k largest of cnt candidates, return new threshold
+static inline float simdtopk_shrink_flt_avx2(float* keys, int32_t* idx, size_t& cnt, size_t k, float* tmp)
+{
+  std::copy(keys, keys + cnt, tmp);
+  return simdtopk_compact_flt(keys, idx, cnt, k, simdtopk_select_flt_avx2(tmp, cnt, cnt - k));
+}
+
+// Append values of x above threshold (c: comparison result)
+static inline void simdtopk_push_flt_avx2(float* keys, int32_t* idx, size_t& cnt, const __m256 x, const __m256 c, const __m256i iv)
+{
+  int m = _mm256_movemask_ps(c);
+  if (m == 0)
+    return;
+
+  __m256i perm = ssort_perm_idx_avx2(ssort_perm_8[m]);
+  _mm256_storeu_ps(keys + cnt, _mm256_permutevar8x32_ps(x, perm));
+  if (idx)
+    _mm256_storeu_si256((__m256i*)(idx + cnt), _mm256_permutevar8x32_epi32(iv, perm));
+  cnt += _mm_popcnt_u32(m);
+}
+
+// idx may be NULL
+static inline void simdtopk_flt_avx2_impl(const float* v, size_t n, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  // Candidates buffer (room for a full vector past capacity)
+  const size_t cap = std::max(2 * k, k + SSORT_TOPK_FLT_MIN_ROOM);
+  std::vector<float> keys(cap + 8), tmp(cap + 8);
+  std::vector<int32_t> cidx(idx ? cap + 8 : 0);
+  int32_t* pidx = idx ? cidx.data() : NULL;
+
+  // First values, unfiltered
+  size_t cnt = std::min(n, cap);
+  std::copy(v, v + cnt, keys.begin());
+  if (pidx)
+    for (size_t i=0; i<cnt; ++i) pidx[i] = (int32_t)i;
+
+  size_t i = cnt;
+  if (i < n)
+  {
+    float thr = simdtopk_shrink_flt_avx2(keys.data(), pidx, cnt, k, tmp.data());
+    __m256 t = _mm256_set1_ps(thr);
+    __m256i iv = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int32_t)i));
+    const __m256i step = _mm256_set1_epi32(8);
+
+    // 4 vectors per step, skipped at once when nothing passes the threshold
+    for (; i + 32 <= n; i += 32)
+    {
+      __m256 x0 = _mm256_loadu_ps(v + i);
+      __m256 x1 = _mm256_loadu_ps(v + i + 8);
+      __m256 x2 = _mm256_loadu_ps(v + i + 16);
+      __m256 x3 = _mm256_loadu_ps(v + i + 24);
+      __m256 c0 = _mm256_cmp_ps(x0, t, _CMP_GT_OQ);
+      __m256 c1 = _mm256_cmp_ps(x1, t, _CMP_GT_OQ);
+      __m256 c2 = _mm256_cmp_ps(x2, t, _CMP_GT_OQ);
+      __m256 c3 = _mm256_cmp_ps(x3, t, _CMP_GT_OQ);
+      if (_mm256_movemask_ps(_mm256_or_ps(_mm256_or_ps(c0, c1), _mm256_or_ps(c2, c3))) == 0)
+      {
+        iv = _mm256_add_epi32(iv, _mm256_slli_epi32(step, 2));
+        continue;
+      }
+
+      // Threshold may rise in between: stale candidates are dropped on next shrink
+      __m256 xs[4] = { x0, x1, x2, x3 };
+      __m256 cs[4] = { c0, c1, c2, c3 };
+      for (size_t j=0; j<4; ++j)
+      {
+        simdtopk_push_flt_avx2(keys.data(), pidx, cnt, xs[j], cs[j], iv);
+        iv = _mm256_add_epi32(iv, step);
+        if (cnt > cap)
+        {
+          thr = simdtopk_shrink_flt_avx2(keys.data(), pidx, cnt, k, tmp.data());
+          t = _mm256_set1_ps(thr);
+        }
+      }
+    }
+
+    // Remaining values
+    for (; i < n; ++i)
+    {
+      if (v[i] > thr)
+      {
+        keys[cnt] = v[i];
+        if (pidx) pidx[cnt] = (int32_t)i;
+        if (++cnt > cap)
+          thr = simdtopk_shrink_flt_avx2(keys.data(), pidx, cnt, k, tmp.data());
+      }
+    }
+  }
+
+  if (cnt > k)
+    simdtopk_shrink_flt_avx2(keys.data(), pidx, cnt, k, tmp.data());
+  simdtopk_output_flt(keys.data(), pidx, k, out, idx);
+}
+
+// k largest values in descending order, min(k, n) outputs
+static inline void simdtopk_flt_avx2(const float* v, size_t n, size_t k, float* __restrict out)
+{
+  simdtopk_flt_avx2_impl(v, n, k, out, NULL);
+}
+
+// Same with their indices (ties: lowest index first)
+static inline void simdtopk_idx_flt_avx2(const float* v, size_t n, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  simdtopk_flt_avx2_impl(v, n, k, out, idx);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Quickselect: v[p] is the p-th smallest value, vectorized partitions
+static inline float simdtopk_select_flt_avx512(float* __restrict v, size_t n, size_t p)
+{
+  size_t depth = 2 * simdsort_log2(n);
+  while (n > SSORT_FLT_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::nth_element(v, v + p, v + n);
+      return v[p];
+    }
+
+    float pivot = simdsort_pivot_flt(v, n);
+    size_t m = simdsort_partition_flt_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off
+      if (pivot == INFINITY)
+        return pivot;
+      m = simdsort_partition_flt_avx512(v, n, nextafterf(pivot, INFINITY));
+      if (p < m)
+        return pivot;
+    }
+
+    if (p < m)
+      n = m;
+    else
+    {
+      v += m;
+      n -= m;
+      p -= m;
+    }
+  }
+
+  netsort_small_flt_avx2(v, n);
+  return v[p];
+}
+
+// Keep the k largest of cnt candidates, return new threshold
+static inline float simdtopk_shrink_flt_avx512(float* keys, int32_t* idx, size_t& cnt, size_t k, float* tmp)
+{
+  std::copy(keys, keys + cnt, tmp);
+  return simdtopk_compact_flt(keys, idx, cnt, k, simdtopk_select_flt_avx512(tmp, cnt, cnt - k));
+}
+
+// idx may be NULL
+static inline void simdtopk_flt_avx512_impl(const float* v, size_t n, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  // Candidates buffer (room for a full vector past capacity)
+  const size_t cap = std::max(2 * k, k + SSORT_TOPK_FLT_MIN_ROOM);
+  std::vector<float> keys(cap + 16), tmp(cap + 16);
+  std::vector<int32_t> cidx(idx ? cap + 16 : 0);
+  int32_t* pidx = idx ? cidx.data() : NULL;
+
+  // First values, unfiltered
+  size_t cnt = std::min(n, cap);
+  std::copy(v, v + cnt, keys.begin());
+  if (pidx)
+    for (size_t i=0; i<cnt; ++i) pidx[i] = (int32_t)i;
+
+  size_t i = cnt;
+  if (i < n)
+  {
+    float thr = simdtopk_shrink_flt_avx512(keys.data(), pidx, cnt, k, tmp.data());
+    __m512 t = _mm512_set1_ps(thr);
+    __m512i iv = _mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                  _mm512_set1_epi32((int32_t)i));
+    const __m512i step = _mm512_set1_epi32(16);
+
+    // 4 vectors per step, skipped at once when nothing passes the threshold
+    for (; i + 64 <= n; i += 64)
+    {
+      __m512 xs[4];
+      __mmask16 ms[4];
+      for (size_t j=0; j<4; ++j)
+      {
+        xs[j] = _mm512_loadu_ps(v + i + 16*j);
+        ms[j] = _mm512_cmp_ps_mask(xs[j], t, _CMP_GT_OQ);
+      }
+      if ((ms[0] | ms[1] | ms[2] | ms[3]) == 0)
+      {
+        iv = _mm512_add_epi32(iv, _mm512_slli_epi32(step, 2));
+        continue;
+      }
+
+      // Threshold may rise in between: stale candidates are dropped on next shrink
+      for (size_t j=0; j<4; ++j)
+      {
+        _mm512_mask_compressstoreu_ps(keys.data() + cnt, ms[j], xs[j]);
+        if (pidx)
+          _mm512_mask_compressstoreu_epi32(pidx + cnt, ms[j], iv);
+        cnt += _mm_popcnt_u32(ms[j]);
+        iv = _mm512_add_epi32(iv, step);
+        if (cnt > cap)
+        {
+          thr = simdtopk_shrink_flt_avx512(keys.data(), pidx, cnt, k, tmp.data());
+          t = _mm512_set1_ps(thr);
+        }
+      }
+    }
+
+    // Remaining values
+    for (; i < n; ++i)
+    {
+      if (v[i] > thr)
+      {
+        keys[cnt] = v[i];
+        if (pidx) pidx[cnt] = (int32_t)i;
+        if (++cnt > cap)
+          thr = simdtopk_shrink_flt_avx512(keys.data(), pidx, cnt, k, tmp.data());
+      }
+    }
+  }
+
+  if (cnt > k)
+    simdtopk_shrink_flt_avx512(keys.data(), pidx, cnt, k, tmp.data());
+  simdtopk_output_flt(keys.data(), pidx, k, out, idx);
+}
+
+// k largest values in descending order, min(k, n) outputs
+static inline void simdtopk_flt_avx512(const float* v, size_t n, size_t k, float* __restrict out)
+{
+  simdtopk_flt_avx512_impl(v, n, k, out, NULL);
+}
+
+// Same with their indices (ties: lowest index first)
+static inline void simdtopk_idx_flt_avx512(const float* v, size_t n, size_t k, float* __restrict out, int32_t* __restrict idx)
+{
+  simdtopk_flt_avx512_impl(v, n, k, out, idx);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_TOPK_FLT_H
@@ -0,0 +1,417 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_TOPK_I32_H
+#define SSORT_TOPK_I32_H
+
+#include "Utils/compiler_utils.h"
+#include "NetSort/nsort_small_i32.h"
+#include "ssort_i32.h"    // simdsort_partition_i32, simdsort_pivot_i32
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// SIMD optimization options
+#ifndef SSORT_TOPK_I32_MIN_ROOM
+  #define SSORT_TOPK_I32_MIN_ROOM 256   // minimum candidates buffer room past k
+#endif
+
+// Top-k: k largest values (optionally with their index) in descending order
+// - values are compared to a threshold, the smallest of the current k best:
+//   survivors are compressed and appended to a candidates buffer (AVX2:
+//   permutation from movemask LUT, AVX-512: compress store), 4 vectors with
+//   no survivor are skipped with a single test
+// - when the buffer is full (max(2k, k + room) values), it is shrunk back to
+//   its k largest with a vectorized quickselect (simdsort partitions and
+//   netsort_small base case) and the threshold rises
+// - the k remaining candidates are sorted at the end
+// Buffer is filled unfiltered first, so any value can be selected.
+
+//
+static inline void simdtopk_i32_partial_sort(const int32_t* v, size_t n, size_t k, int32_t* __restrict out)
+{
+  k = std::min(k, n);
+  std::partial_sort_copy(v, v + n, out, out + k, std::greater<int32_t>());
+}
+
+//
+static inline void simdtopk_i32_nth_element(const int32_t* v, size_t n, size_t k, int32_t* __restrict out)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  std::vector<int32_t> tmp(v, v + n);
+  std::nth_element(tmp.begin(), tmp.begin() + (k - 1), tmp.end(), std::greater<int32_t>());
+  std::sort(tmp.begin(), tmp.begin() + k, std::greater<int32_t>());
+  std::copy(tmp.begin(), tmp.begin() + k, out);
+}
+
+// Ties are broken by lowest index
+static inline void simdtopk_idx_i32_std(const int32_t* v, size_t n, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  std::vector< std::pair<int32_t, int32_t> > tmp(n);
+  for (size_t i=0; i<n; ++i)
+    tmp[i] = std::make_pair(v[i], (int32_t)i);
+
+  std::partial_sort(tmp.begin(), tmp.begin() + k, tmp.end(),
+                    [](const std::pair<int32_t, int32_t>& a, const std::pair<int32_t, int32_t>& b)
+                    { return (a.first > b.first) || (a.first == b.first && a.second < b.second); });
+  for (size_t i=0; i<k; ++i)
+  {
+    out[i] = tmp[i].first;
+    idx[i] = tmp[i].second;
+  }
+}
+
+// Keep the k largest candidates (first ones on ties, order preserved), return the smallest kept
+static inline int32_t simdtopk_compact_i32(int32_t* keys, int32_t* idx, size_t& cnt, size_t k, int32_t t)
+{
+  size_t gt = 0;
+  for (size_t i=0; i<cnt; ++i)
+    gt += (keys[i] > t);
+
+  size_t eq = k - gt;
+  size_t w = 0;
+  for (size_t i=0; i<cnt; ++i)
+  {
+    int32_t e = keys[i];
+    if (e > t || (e == t && eq))
+    {
+      eq -= (e == t);
+      keys[w] = e;
+      if (idx) idx[w] = idx[i];
+      ++w;
+    }
+  }
+  cnt = w;
+  return t;
+}
+
+// Sort k candidates in descending order (candidates are in input order: ties keep lowest index first)
+static inline void simdtopk_output_i32(const int32_t* keys, const int32_t* cidx, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  if (!idx)
+  {
+    std::copy(keys, keys + k, out);
+    std::sort(out, out + k, std::greater<int32_t>());
+    return;
+  }
+
+  std::vector< std::pair<int32_t, int32_t> > tmp(k);
+  for (size_t i=0; i<k; ++i)
+    tmp[i] = std::make_pair(keys[i], cidx[i]);
+  std::stable_sort(tmp.begin(), tmp.end(),
+                   [](const std::pair<int32_t, int32_t>& a, const std::pair<int32_t, int32_t>& b) { return a.first > b.first; });
+  for (size_t i=0; i<k; ++i)
+  {
+    out[i] = tmp[i].first;
+    idx[i] = tmp[i].second;
+  }
+}
+
+//
+#ifdef HAS_AVX2_
+// Quickselect: v[p] is the p-th smallest value, vectorized partitions
+static inline int32_t simdtopk_select_i32_avx2(int32_t* __restrict v, size_t n, size_t p)
+{
+  size_t depth = 2 * simdsort_log2(n);
+  while (n > SSORT_I32_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::nth_element(v, v + p, v + n);
+      return v[p];
+    }
+
+    int32_t pivot = simdsort_pivot_i32(v, n);
+    size_t m = simdsort_partition_i32_avx2(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off
+      if (pivot == INT32_MAX)
+        return pivot;
+      m = simdsort_partition_i32_avx2(v, n, pivot + 1);
+      if (p < m)
+        return pivot;
+    }
+
+    if (p < m)
+      n = m;
+    else
+    {
+      v += m;
+      n -= m;
+      p -= m;
+    }
+  }
+
+  netsort_small_i32_avx2(v, n);
+  return v[p];
+}
+
+// Keep the k largest of cnt candidates, return new threshold
+static inline int32_t simdtopk_shrink_i32_avx2(int32_t* keys, int32_t* idx, size_t& cnt, size_t k, int32_t* tmp)
+{
+  std::copy(keys, keys + cnt, tmp);
+  return simdtopk_compact_i32(keys, idx, cnt, k, simdtopk_select_i32_avx2(tmp, cnt, cnt - k));
+}
+
+// Append values of x above threshold (c: comparison result)
+static inline void simdtopk_push_i32_avx2(int32_t* keys, int32_t* idx, size_t& cnt, const __m256i x, const __m256i c, const __m256i iv)
+{
+  int m = _mm256_movemask_ps(_mm256_castsi256_ps(c));
+  if (m == 0)
+    return;
+
+  __m256i perm = ssort_perm_idx_avx2(ssort_perm_8[m]);
+  _mm256_storeu_si256((__m256i*)(keys + cnt), _mm256_permutevar8x32_epi32(x, perm));
+  if (idx)
+    _mm256_storeu_si256((__m256i*)(idx + cnt), _mm256_permutevar8x32_epi32(iv, perm));
+  cnt += _mm_popcnt_u32(m);
+}
+
+// idx may be NULL
+static inline void simdtopk_i32_avx2_impl(const int32_t* v, size_t n, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  // Candidates buffer (room for a full vector past capacity)
+  const size_t cap = std::max(2 * k, k + SSORT_TOPK_I32_MIN_ROOM);
+  std::vector<int32_t> keys(cap + 8), tmp(cap + 8);
+  std::vector<int32_t> cidx(idx ? cap + 8 : 0);
+  int32_t* pidx = idx ? cidx.data() : NULL;
+
+  // First values, unfiltered
+  size_t cnt = std::min(n, cap);
+  std::copy(v, v + cnt, keys.begin());
+  if (pidx)
+    for (size_t i=0; i<cnt; ++i) pidx[i] = (int32_t)i;
+
+  size_t i = cnt;
+  if (i < n)
+  {
+    int32_t thr = simdtopk_shrink_i32_avx2(keys.data(), pidx, cnt, k, tmp.data());
+    __m256i t = _mm256_set1_epi32(thr);
+    __m256i iv = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int32_t)i));
+    const __m256i step = _mm256_set1_epi32(8);
+
+    // 4 vectors per step, skipped at once when nothing passes the threshold
+    for (; i + 32 <= n; i += 32)
+    {
+      __m256i x0 = _mm256_loadu_si256((__m256i const*)(v + i));
+      __m256i x1 = _mm256_loadu_si256((__m256i const*)(v + i + 8));
+      __m256i x2 = _mm256_loadu_si256((__m256i const*)(v + i + 16));
+      __m256i x3 = _mm256_loadu_si256((__m256i const*)(v + i + 24));
+      __m256i c0 = _mm256_cmpgt_epi32(x0, t);
+      __m256i c1 = _mm256_cmpgt_epi32(x1, t);
+      __m256i c2 = _mm256_cmpgt_epi32(x2, t);
+      __m256i c3 = _mm256_cmpgt_epi32(x3, t);
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3)))) == 0)
+      {
+        iv = _mm256_add_epi32(iv, _mm256_slli_epi32(step, 2));
+        continue;
+      }
+
+      // Threshold may rise in between: stale candidates are dropped on next shrink
+      __m256i xs[4] = { x0, x1, x2, x3 };
+      __m256i cs[4] = { c0, c1, c2, c3 };
+      for (size_t j=0; j<4; ++j)
+      {
+        simdtopk_push_i32_avx2(keys.data(), pidx, cnt, xs[j], cs[j], iv);
+        iv = _mm256_add_epi32(iv, step);
+        if (cnt > cap)
+        {
+          thr = simdtopk_shrink_i32_avx2(keys.data(), pidx, cnt, k, tmp.data());
+          t = _mm256_set1_epi32(thr);
+        }
+      }
+    }
+
+    // Remaining values
+    for (; i < n; ++i)
+    {
+      if (v[i] > thr)
+      {
+        keys[cnt] = v[i];
+        if (pidx) pidx[cnt] = (int32_t)i;
+        if (++cnt > cap)
+          thr = simdtopk_shrink_i32_avx2(keys.data(), pidx, cnt, k, tmp.data());
+      }
+    }
+  }
+
+  if (cnt > k)
+    simdtopk_shrink_i32_avx2(keys.data(), pidx, cnt, k, tmp.data());
+  simdtopk_output_i32(keys.data(), pidx, k, out, idx);
+}
+
+// k largest values in descending order, min(k, n) outputs
+static inline void simdtopk_i32_avx2(const int32_t* v, size_t n, size_t k, int32_t* __restrict out)
+{
+  simdtopk_i32_avx2_impl(v, n, k, out, NULL);
+}
+
+// Same with their indices (ties: lowest index first)
+static inline void simdtopk_idx_i32_avx2(const int32_t* v, size_t n, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  simdtopk_i32_avx2_impl(v, n, k, out, idx);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// Quickselect: v[p] is the p-th smallest value, vectorized partitions
+static inline int32_t simdtopk_select_i32_avx512(int32_t* __restrict v, size_t n, size_t p)
+{
+  size_t depth = 2 * simdsort_log2(n);
+  while (n > SSORT_I32_BASE)
+  {
+    // Degenerated recursion: fallback
+    if (depth-- == 0)
+    {
+      std::nth_element(v, v + p, v + n);
+      return v[p];
+    }
+
+    int32_t pivot = simdsort_pivot_i32(v, n);
+    size_t m = simdsort_partition_i32_avx512(v, n, pivot);
+    if (m == 0)
+    {
+      // Pivot is the minimum: split equal values off
+      if (pivot == INT32_MAX)
+        return pivot;
+      m = simdsort_partition_i32_avx512(v, n, pivot + 1);
+      if (p < m)
+        return pivot;
+    }
+
+    if (p < m)
+      n = m;
+    else
+    {
+      v += m;
+      n -= m;
+      p -= m;
+    }
+  }
+
+  netsort_small_i32_avx2(v, n);
+  return v[p];
+}
+
+// Keep the k largest of cnt candidates, return new threshold
+static inline int32_t simdtopk_shrink_i32_avx512(int32_t* keys, int32_t* idx, size_t& cnt, size_t k, int32_t* tmp)
+{
+  std::copy(keys, keys + cnt, tmp);
+  return simdtopk_compact_i32(keys, idx, cnt, k, simdtopk_select_i32_avx512(tmp, cnt, cnt - k));
+}
+
+// idx may be NULL
+static inline void simdtopk_i32_avx512_impl(const int32_t* v, size_t n, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  k = std::min(k, n);
+  if (k == 0)
+    return;
+
+  // Candidates buffer (room for a full vector past capacity)
+  const size_t cap = std::max(2 * k, k + SSORT_TOPK_I32_MIN_ROOM);
+  std::vector<int32_t> keys(cap + 16), tmp(cap + 16);
+  std::vector<int32_t> cidx(idx ? cap + 16 : 0);
+  int32_t* pidx = idx ? cidx.data() : NULL;
+
+  // First values, unfiltered
+  size_t cnt = std::min(n, cap);
+  std::copy(v, v + cnt, keys.begin());
+  if (pidx)
+    for (size_t i=0; i<cnt; ++i) pidx[i] = (int32_t)i;
+
+  size_t i = cnt;
+  if (i < n)
+  {
+    int32_t thr = simdtopk_shrink_i32_avx512(keys.data(), pidx, cnt, k, tmp.data());
+    __m512i t = _mm512_set1_epi32(thr);
+    __m512i iv = _mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                  _mm512_set1_epi32((int32_t)i));
+    const __m512i step = _mm512_set1_epi32(16);
+
+    // 4 vectors per step, skipped at once when nothing passes the threshold
+    for (; i + 64 <= n; i += 64)
+    {
+      __m512i xs[4];
+      __mmask16 ms[4];
+      for (size_t j=0; j<4; ++j)
+      {
+        xs[j] = _mm512_loadu_si512(v + i + 16*j);
+        ms[j] = _mm512_cmpgt_epi32_mask(xs[j], t);
+      }
+      if ((ms[0] | ms[1] | ms[2] | ms[3]) == 0)
+      {
+        iv = _mm512_add_epi32(iv, _mm512_slli_epi32(step, 2));
+        continue;
+      }
+
+      // Threshold may rise in between: stale candidates are dropped on next shrink
+      for (size_t j=0; j<4; ++j)
+      {
+        _mm512_mask_compressstoreu_epi32(keys.data() + cnt, ms[j], xs[j]);
+        if (pidx)
+          _mm512_mask_compressstoreu_epi32(pidx + cnt, ms[j], iv);
+        cnt += _mm_popcnt_u32(ms[j]);
+        iv = _mm512_add_epi32(iv, step);
+        if (cnt > cap)
+        {
+          thr = simdtopk_shrink_i32_avx512(keys.data(), pidx, cnt, k, tmp.data());
+          t = _mm512_set1_epi32(thr);
+        }
+      }
+    }
+
+    // Remaining values
+    for (; i < n; ++i)
+    {
+      if (v[i] > thr)
+      {
+        keys[cnt] = v[i];
+        if (pidx) pidx[cnt] = (int32_t)i;
+        if (++cnt > cap)
+          thr = simdtopk_shrink_i32_avx512(keys.data(), pidx, cnt, k, tmp.data());
+      }
+    }
+  }
+
+  if (cnt > k)
+    simdtopk_shrink_i32_avx512(keys.data(), pidx, cnt, k, tmp.data());
+  simdtopk_output_i32(keys.data(), pidx, k, out, idx);
+}
+
+// k largest values in descending order, min(k, n) outputs
+static inline void simdtopk_i32_avx512(const int32_t* v, size_t n, size_t k, int32_t* __restrict out)
+{
+  simdtopk_i32_avx512_impl(v, n, k, out, NULL);
+}
+
+// Same with their indices (ties: lowest index first)
+static inline void simdtopk_idx_i32_avx512(const int32_t* v, size_t n, size_t k, int32_t* __restrict out, int32_t* __restrict idx)
+{
+  simdtopk_i32_avx512_impl(v, n, k, out, idx);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_TOPK_I32_H
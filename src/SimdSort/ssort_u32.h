@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_U32_H
+#define SSORT_U32_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_i32.h"
+#include "NetSort/nsort_u32.h"  // cmpfunc_u32
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2
+#endif
+
+// uint32 keys are sorted as int32 after flipping the sign bit (order preserving
+// bijection), one vectorized pass before and after the int32 sort.
+
+
+//
+static inline void simdsort_u32_std(uint32_t* __restrict v, size_t n)
+{
+  std::sort(v, v + n);
+}
+
+//
+static inline void simdsort_u32_qsort(uint32_t* __restrict v, size_t n)
+{
+  qsort(v, n, sizeof(uint32_t), cmpfunc_u32);
+}
+
+//
+#ifdef HAS_AVX2_
+static inline void simdsort_u32_bias_avx2(uint32_t* __restrict v, size_t n)
+{
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  size_t i = 0;
+
+  for (; i+8<=n; i+=8)
+  {
+    __m256i x = _mm256_loadu_si256((__m256i const*)(v + i));
+    _mm256_storeu_si256((__m256i*)(v + i), _mm256_xor_si256(x, sign));
+  }
+  for (; i<n; ++i)
+    v[i] ^= 0x80000000u;
+}
+
+static inline void simdsort_u32_avx2(uint32_t* __restrict v, size_t n)
+{
+  simdsort_u32_bias_avx2(v, n);
+  simdsort_i32_avx2((int32_t*)v, n);
+  simdsort_u32_bias_avx2(v, n);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+static inline void simdsort_u32_avx512(uint32_t* __restrict v, size_t n)
+{
+  simdsort_u32_bias_avx2(v, n);
+  simdsort_i32_avx512((int32_t*)v, n);
+  simdsort_u32_bias_avx2(v, n);
+}
+#endif // HAS_AVX512F_
+
+
+#endif // SSORT_U32_H
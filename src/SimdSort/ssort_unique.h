@@ -0,0 +1,331 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_UNIQUE_H
+#define SSORT_UNIQUE_H
+
+#include "Utils/compiler_utils.h"
+#include "ssort_lut.h"
+#include "ssort_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <type_traits>
+#ifdef HAS_AVX2_
+  #include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+// Unique values and run lengths of sorted arrays (std::unique semantic: first
+// value of each run of equal adjacent values is kept), for (u)int8 to (u)int64,
+// float and double:
+// - 'simdunique(v, n, out)' returns the number of values written to out,
+//   'simdunique_count(v, n, out, cnt)' also writes the length of each run
+// - each vector is compared with the same vector shifted by one value, the
+//   previous vector carried in register (alignr), so out may be v (in-place)
+// - kept values are compressed and stored with one (or a few) unaligned
+//   stores, AVX2: permutation LUTs (ssort_lut.h, pshufb on 8 lanes groups for
+//   8/16 bits), AVX-512: compress store (32/64 bits)
+// - run lengths: differences between run starts, from the set bits of the
+//   keep masks
+// - best available: AVX-512 for 32/64 bits values, AVX2 otherwise
+// Float/double: '==' compares (-0 and +0 merged, NaNs all kept)
+// out must hold n values (or be v), cnt the number of runs
+
+
+// Reference
+template <typename T>
+static inline size_t simdunique_std(const T* v, size_t n, T* out)
+{
+  if (out == v)
+    return std::unique(out, out + n) - out;
+  return std::unique_copy(v, v + n, out) - out;
+}
+
+template <typename T>
+static inline size_t simdunique_count_std(const T* v, size_t n, T* out, size_t* __restrict cnt)
+{
+  size_t w = 0;
+  for (size_t i=0; i<n; )
+  {
+    const T x = v[i];
+    size_t j = i + 1;
+    while (j < n && v[j] == x)
+      ++j;
+    out[w] = x;
+    cnt[w++] = j - i;
+    i = j;
+  }
+  return w;
+}
+
+//
+#ifdef HAS_AVX2_
+// Run starts of a keep mask (vector at i, w values kept so far)
+static inline void simdunique_runs(size_t* __restrict cnt, uint32_t m, size_t i, size_t w, size_t& last)
+{
+  for (; m; m &= m - 1)
+  {
+    const size_t s = i + simdsort_ctz(m);
+    if (w)
+      cnt[w-1] = s - last;
+    last = s;
+    ++w;
+  }
+}
+
+// Vector loop on Op (see below), scalar tail, cnt may be NULL
+template <typename T, typename Op>
+static inline size_t simdunique_k(const T* v, size_t n, T* out, size_t* __restrict cnt)
+{
+  const size_t L = Op::L;
+  size_t i = 0, w = 0, last = 0;
+  T prev = T();
+  if (n >= L)
+  {
+    // First value always kept
+    typename Op::V p = Op::load(v);
+    uint32_t m = Op::keep(p, Op::shift(p, p)) | 1;
+    if (cnt)
+      simdunique_runs(cnt, m, 0, w, last);
+    Op::store(out, p, m);
+    w = _mm_popcnt_u32(m);
+
+    for (i=L; i + L <= n; i += L)
+    {
+      const typename Op::V x = Op::load(v + i);
+      m = Op::keep(x, Op::shift(x, p));
+      if (cnt)
+        simdunique_runs(cnt, m, i, w, last);
+      Op::store(out + w, x, m);
+      w += _mm_popcnt_u32(m);
+      p = x;
+    }
+
+    // Last value of previous vector (may be overwritten in v)
+    T b[L];
+    Op::storeu(b, p);
+    prev = b[L-1];
+  }
+
+  for (; i<n; ++i)
+  {
+    const T x = v[i];
+    if (i == 0 || !(x == prev))
+    {
+      if (cnt)
+      {
+        if (w)
+          cnt[w-1] = i - last;
+        last = i;
+      }
+      out[w++] = x;
+    }
+    prev = x;
+  }
+  if (cnt && w)
+    cnt[w-1] = n - last;
+  return w;
+}
+
+// Per value size S and floating point F: keep mask (value differs from the
+// previous one) and compress store (up to L values written)
+template <size_t S, bool F> struct simdunique_op_avx2;
+
+template <size_t S>
+struct simdunique_vec_avx2
+{
+  typedef __m256i V;
+  static const size_t L = 32 / S;
+  static inline V load(const void* p)             { return _mm256_loadu_si256((__m256i const*)p); }
+  static inline void storeu(void* p, const V x)   { _mm256_storeu_si256((__m256i*)p, x); }
+  // Lanes (p[L-1], x[0], ..., x[L-2])
+  static inline V shift(const V x, const V p)     { return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(p, x, 0x21), 16 - S); }
+};
+
+template <>
+struct simdunique_op_avx2<1, false> : simdunique_vec_avx2<1>
+{
+  static inline uint32_t keep(const V x, const V s) { return ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, s)); }
+  static inline void store(void* out, const V x, uint32_t m)
+  {
+    // 4 groups of 8 lanes, 8 bytes stores
+    char* o = (char*)out;
+    const __m128i lo = _mm256_castsi256_si128(x);
+    const __m128i hi = _mm256_extracti128_si256(x, 1);
+    const uint32_t m0 = m & 0xFF, m1 = (m >> 8) & 0xFF, m2 = (m >> 16) & 0xFF, m3 = m >> 24;
+    _mm_storel_epi64((__m128i*)o, _mm_shuffle_epi8(lo, ssort_perm_b8_avx2(m0, 0))); o += _mm_popcnt_u32(m0);
+    _mm_storel_epi64((__m128i*)o, _mm_shuffle_epi8(lo, ssort_perm_b8_avx2(m1, 8))); o += _mm_popcnt_u32(m1);
+    _mm_storel_epi64((__m128i*)o, _mm_shuffle_epi8(hi, ssort_perm_b8_avx2(m2, 0))); o += _mm_popcnt_u32(m2);
+    _mm_storel_epi64((__m128i*)o, _mm_shuffle_epi8(hi, ssort_perm_b8_avx2(m3, 8)));
+  }
+};
+
+template <>
+struct simdunique_op_avx2<2, false> : simdunique_vec_avx2<2>
+{
+  static inline uint32_t keep(const V x, const V s)
+  {
+    const __m256i c = _mm256_cmpeq_epi16(x, s);
+    return ~(uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(c), _mm256_extracti128_si256(c, 1))) & 0xFFFF;
+  }
+  static inline void store(void* out, const V x, uint32_t m)
+  {
+    // 2 groups of 8 lanes
+    int16_t* o = (int16_t*)out;
+    const uint32_t m0 = m & 0xFF, m1 = m >> 8;
+    _mm_storeu_si128((__m128i*)o, _mm_shuffle_epi8(_mm256_castsi256_si128(x), ssort_perm_w8_avx2(m0))); o += _mm_popcnt_u32(m0);
+    _mm_storeu_si128((__m128i*)o, _mm_shuffle_epi8(_mm256_extracti128_si256(x, 1), ssort_perm_w8_avx2(m1)));
+  }
+};
+
+template <>
+struct simdunique_op_avx2<4, false> : simdunique_vec_avx2<4>
+{
+  static inline uint32_t keep(const V x, const V s) { return ~(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, s))) & 0xFF; }
+  static inline void store(void* out, const V x, uint32_t m)
+  {
+    _mm256_storeu_si256((__m256i*)out, _mm256_permutevar8x32_epi32(x, ssort_perm_idx_avx2(ssort_perm_8[m])));
+  }
+};
+
+template <>
+struct simdunique_op_avx2<8, false> : simdunique_vec_avx2<8>
+{
+  static inline uint32_t keep(const V x, const V s) { return ~(uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, s))) & 0xF; }
+  static inline void store(void* out, const V x, uint32_t m)
+  {
+    _mm256_storeu_si256((__m256i*)out, _mm256_permutevar8x32_epi32(x, ssort_perm_idx_avx2(ssort_perm_4[m])));
+  }
+};
+
+template <>
+struct simdunique_op_avx2<4, true> : simdunique_op_avx2<4, false>
+{
+  static inline uint32_t keep(const V x, const V s) { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(x), _mm256_castsi256_ps(s), _CMP_NEQ_UQ)); }
+};
+
+template <>
+struct simdunique_op_avx2<8, true> : simdunique_op_avx2<8, false>
+{
+  static inline uint32_t keep(const V x, const V s) { return (uint32_t)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(x), _mm256_castsi256_pd(s), _CMP_NEQ_UQ)); }
+};
+
+template <typename T>
+static inline size_t simdunique_avx2(const T* v, size_t n, T* out)
+{
+  return simdunique_k<T, simdunique_op_avx2<sizeof(T), std::is_floating_point<T>::value>>(v, n, out, NULL);
+}
+
+template <typename T>
+static inline size_t simdunique_count_avx2(const T* v, size_t n, T* out, size_t* __restrict cnt)
+{
+  return simdunique_k<T, simdunique_op_avx2<sizeof(T), std::is_floating_point<T>::value>>(v, n, out, cnt);
+}
+#endif // HAS_AVX2_
+
+//
+#ifdef HAS_AVX512F_
+// 32/64 bits values only (8/16 bits compress store requires VBMI2)
+template <size_t S, bool F> struct simdunique_op_avx512;
+
+template <size_t S>
+struct simdunique_vec_avx512
+{
+  typedef __m512i V;
+  static const size_t L = 64 / S;
+  static inline V load(const void* p)           { return _mm512_loadu_si512(p); }
+  static inline void storeu(void* p, const V x) { _mm512_storeu_si512(p, x); }
+};
+
+template <>
+struct simdunique_op_avx512<4, false> : simdunique_vec_avx512<4>
+{
+  static inline V shift(const V x, const V p)                { return _mm512_alignr_epi32(x, p, 15); }
+  static inline uint32_t keep(const V x, const V s)          { return _mm512_cmpneq_epi32_mask(x, s); }
+  static inline void store(void* out, const V x, uint32_t m) { _mm512_mask_compressstoreu_epi32(out, (__mmask16)m, x); }
+};
+
+template <>
+struct simdunique_op_avx512<8, false> : simdunique_vec_avx512<8>
+{
+  static inline V shift(const V x, const V p)                { return _mm512_alignr_epi64(x, p, 7); }
+  static inline uint32_t keep(const V x, const V s)          { return _mm512_cmpneq_epi64_mask(x, s); }
+  static inline void store(void* out, const V x, uint32_t m) { _mm512_mask_compressstoreu_epi64(out, (__mmask8)m, x); }
+};
+
+template <>
+struct simdunique_op_avx512<4, true> : simdunique_op_avx512<4, false>
+{
+  static inline uint32_t keep(const V x, const V s) { return _mm512_cmp_ps_mask(_mm512_castsi512_ps(x), _mm512_castsi512_ps(s), _CMP_NEQ_UQ); }
+};
+
+template <>
+struct simdunique_op_avx512<8, true> : simdunique_op_avx512<8, false>
+{
+  static inline uint32_t keep(const V x, const V s) { return _mm512_cmp_pd_mask(_mm512_castsi512_pd(x), _mm512_castsi512_pd(s), _CMP_NEQ_UQ); }
+};
+
+template <typename T>
+static inline size_t simdunique_avx512(const T* v, size_t n, T* out)
+{
+  return simdunique_k<T, simdunique_op_avx512<sizeof(T), std::is_floating_point<T>::value>>(v, n, out, NULL);
+}
+
+template <typename T>
+static inline size_t simdunique_count_avx512(const T* v, size_t n, T* out, size_t* __restrict cnt)
+{
+  return simdunique_k<T, simdunique_op_avx512<sizeof(T), std::is_floating_point<T>::value>>(v, n, out, cnt);
+}
+#endif // HAS_AVX512F_
+
+
+// Best available version (reference for other types)
+template <typename T>
+static inline size_t simdunique(const T* v, size_t n, T* out)                               { return simdunique_std(v, n, out); }
+template <typename T>
+static inline size_t simdunique_count(const T* v, size_t n, T* out, size_t* __restrict cnt) { return simdunique_count_std(v, n, out, cnt); }
+
+#ifdef HAS_AVX2_
+static inline size_t simdunique(const int8_t* v, size_t n, int8_t* out)     { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const uint8_t* v, size_t n, uint8_t* out)   { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const int16_t* v, size_t n, int16_t* out)   { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const uint16_t* v, size_t n, uint16_t* out) { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique_count(const int8_t* v, size_t n, int8_t* out, size_t* __restrict cnt)     { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint8_t* v, size_t n, uint8_t* out, size_t* __restrict cnt)   { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const int16_t* v, size_t n, int16_t* out, size_t* __restrict cnt)   { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint16_t* v, size_t n, uint16_t* out, size_t* __restrict cnt) { return simdunique_count_avx2(v, n, out, cnt); }
+#endif // HAS_AVX2_
+
+#if defined(HAS_AVX512F_)
+static inline size_t simdunique(const int32_t* v, size_t n, int32_t* out)   { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique(const uint32_t* v, size_t n, uint32_t* out) { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique(const int64_t* v, size_t n, int64_t* out)   { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique(const uint64_t* v, size_t n, uint64_t* out) { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique(const float* v, size_t n, float* out)       { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique(const double* v, size_t n, double* out)     { return simdunique_avx512(v, n, out); }
+static inline size_t simdunique_count(const int32_t* v, size_t n, int32_t* out, size_t* __restrict cnt)   { return simdunique_count_avx512(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint32_t* v, size_t n, uint32_t* out, size_t* __restrict cnt) { return simdunique_count_avx512(v, n, out, cnt); }
+static inline size_t simdunique_count(const int64_t* v, size_t n, int64_t* out, size_t* __restrict cnt)   { return simdunique_count_avx512(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint64_t* v, size_t n, uint64_t* out, size_t* __restrict cnt) { return simdunique_count_avx512(v, n, out, cnt); }
+static inline size_t simdunique_count(const float* v, size_t n, float* out, size_t* __restrict cnt)       { return simdunique_count_avx512(v, n, out, cnt); }
+static inline size_t simdunique_count(const double* v, size_t n, double* out, size_t* __restrict cnt)     { return simdunique_count_avx512(v, n, out, cnt); }
+#elif defined(HAS_AVX2_)
+static inline size_t simdunique(const int32_t* v, size_t n, int32_t* out)   { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const uint32_t* v, size_t n, uint32_t* out) { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const int64_t* v, size_t n, int64_t* out)   { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const uint64_t* v, size_t n, uint64_t* out) { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const float* v, size_t n, float* out)       { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique(const double* v, size_t n, double* out)     { return simdunique_avx2(v, n, out); }
+static inline size_t simdunique_count(const int32_t* v, size_t n, int32_t* out, size_t* __restrict cnt)   { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint32_t* v, size_t n, uint32_t* out, size_t* __restrict cnt) { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const int64_t* v, size_t n, int64_t* out, size_t* __restrict cnt)   { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const uint64_t* v, size_t n, uint64_t* out, size_t* __restrict cnt) { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const float* v, size_t n, float* out, size_t* __restrict cnt)       { return simdunique_count_avx2(v, n, out, cnt); }
+static inline size_t simdunique_count(const double* v, size_t n, double* out, size_t* __restrict cnt)     { return simdunique_count_avx2(v, n, out, cnt); }
+#endif
+
+
+#endif // SSORT_UNIQUE_H
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#ifndef SSORT_UTILS_H
+#define SSORT_UTILS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+
+// Recursion depth budget
+static inline size_t simdsort_log2(size_t n)
+{
+  size_t l = 0;
+  while (n >>= 1)
+    ++l;
+  return l;
+}
+
+// Index of lowest set bit (m != 0)
+static inline unsigned simdsort_ctz(uint32_t m)
+{
+#ifdef _MSC_VER
+  unsigned long r;
+  _BitScanForward(&r, m);
+  return (unsigned)r;
+#else
+  return (unsigned)__builtin_ctz(m);
+#endif
+}
+
+// Median of 3
+template <typename T>
+static inline T simdsort_med3(T a, T b, T c)
+{
+  if (a < b)
+    return (b < c) ? b : ((a < c) ? c : a);
+  else
+    return (a < c) ? a : ((b < c) ? c : b);
+}
+
+// Merge path: number of values taken from a among the first d values of the
+// merge of a (na) and b (nb), ties taken from a first.
+// Output chunks [d0, d1) then merge a[i0..i1) with b[d0-i0..d1-i1) independently.
+template <typename T>
+static inline size_t simdmerge_path(const T* a, size_t na, const T* b, size_t nb, size_t d)
+{
+  size_t lo = (d > nb) ? d - nb : 0;
+  size_t hi = (d < na) ? d : na;
+  while (lo < hi)
+  {
+    size_t mid = lo + ((hi - lo) >> 1);
+    if (a[mid] <= b[d - 1 - mid])
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+
+#endif // SSORT_UTILS_H
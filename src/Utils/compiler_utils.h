@@ -47,6 +47,21 @@
     #ifdef __FMA__
       #define HAS_FMA_
     #endif
+    #ifdef __AVX512F__
+      #define HAS_AVX512F_
+    #endif
+    #ifdef __AVX512BW__
+      #define HAS_AVX512BW_
+    #endif
+    #ifdef __AVX512DQ__
+      #define HAS_AVX512DQ_
+    #endif
+    #ifdef __AVX512VL__
+      #define HAS_AVX512VL_
+    #endif
+    #ifdef __AVX512VNNI__
+      #define HAS_AVX512VNNI_
+    #endif
   #endif
 
 #elif defined(_MSC_VER)
@@ -61,6 +76,12 @@
     
   #else
     #define IS_X86_
+    #ifdef __AVX512F__
+      #define HAS_AVX512F_
+      #define HAS_AVX512BW_
+      #define HAS_AVX512DQ_
+      #define HAS_AVX512VL_
+    #endif
     #ifdef __AVX2__
       #define HAS_AVX2_
       #define HAS_AVX_
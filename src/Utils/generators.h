@@ -244,14 +244,14 @@ template <typename T>
 inline void vec_rrd(T* v, size_t N, T max)
 {
   for (size_t i=0; i<N; ++i)
-    v[i] = (T)(std::round(max * std::rand()/(float)RAND_MAX));
+    v[i] = (T)(std::round(max * (std::rand()/(double)RAND_MAX)));
 }
 
 template <typename T>
 inline void vec_rrd(std::vector<T>& v, T max)
 {
   std::generate(v.begin(), v.end(), [max]() {
-      return (T)(std::round(max * std::rand()/(float)RAND_MAX));
+      return (T)(std::round(max * (std::rand()/(double)RAND_MAX)));
     });
 }
 
@@ -259,14 +259,14 @@ template <typename T>
 inline void vec_rrd(T* v, size_t N, T min, T max)
 {
   for (size_t i=0; i<N; ++i)
-    v[i] = min + (T)(std::round((max-min) * std::rand()/(float)RAND_MAX));
+    v[i] = min + (T)(std::round((max-min) * (std::rand()/(double)RAND_MAX)));
 }
 
 template <typename T>
 inline void vec_rrd(std::vector<T>& v, T min, T max)
 {
   std::generate(v.begin(), v.end(), [min, max]() {
-      return min + (T)(std::round((max-min) * std::rand()/(float)RAND_MAX));
+      return min + (T)(std::round((max-min) * (std::rand()/(double)RAND_MAX)));
     });
 }
 
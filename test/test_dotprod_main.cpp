@@ -10,17 +10,30 @@
 
 #include "DotProd/dotp_i8.h"
 #include "DotProd/dotp_i8ui8.h"
+#include "DotProd/dotp_ui8.h"
 #include "DotProd/dotp_i16i8.h"
 #include "DotProd/dotp_i16.h"
+#include "DotProd/dotp_ui16.h"
 #include "DotProd/dotp_i32i16.h"
 #include "DotProd/dotp_i32.h"
 #include "DotProd/dotp_flt.h"
+#include "DotProd/dotp_flti8.h"
+#include "DotProd/dotp_fltui8.h"
+#include "DotProd/dotp_flti16.h"
 #include "DotProd/dotp_dbl.h"
+#include "DotProd/dotp_cflt.h"
+#include "DotProd/dotp_cdbl.h"
+#include "DotProd/dotp_wflt.h"
+#include "DotProd/dotp_wdbl.h"
+#include "DotProd/xcorr_i16.h"
+#include "DotProd/xcorr_flt.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <vector>
+#include <complex>
 
 static unsigned int _seed = static_cast<unsigned int>(std::time(nullptr));
 
@@ -63,6 +76,23 @@ TEST(DotProdTest, DotProd_i8ui8) {
 #endif
 }
 
+// Test DotProd for uint8
+TEST(DotProdTest, DotProd_ui8) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrd<uint8_t, uint8_t>(1, count, 0, 255);
+
+  uint32_t expected = dotProduct_ui8_scalar(dv[0].u.data(), dv[0].v.data(), count);
+
+  EXPECT_EQ(expected, dotProduct_ui8_sse(dv[0].u.data(), dv[0].v.data(), count));
+#ifdef HAS_AVX2_
+  EXPECT_EQ(expected, dotProduct_ui8_avx2(dv[0].u.data(), dv[0].v.data(), count));
+#endif
+#if defined(HAS_AVX512VNNI_) && defined(HAS_AVX512VL_)
+  EXPECT_EQ(expected, dotProduct_ui8_vnni(dv[0].u.data(), dv[0].v.data(), count));
+#endif
+}
+
 // Test DotProd for int16 x int8
 TEST(DotProdTest, DotProd_i16i8) {
   std::srand(_seed);
@@ -97,6 +127,20 @@ TEST(DotProdTest, DotProd_i16) {
 #endif
 }
 
+// Test DotProd for uint16
+TEST(DotProdTest, DotProd_ui16) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrd<uint16_t, uint16_t>(1, count, 0, 65535);
+
+  uint64_t expected = dotProduct_ui16_scalar(dv[0].u.data(), dv[0].v.data(), count);
+
+  EXPECT_EQ(expected, dotProduct_ui16_sse(dv[0].u.data(), dv[0].v.data(), count));
+#ifdef HAS_AVX2_
+  EXPECT_EQ(expected, dotProduct_ui16_avx2(dv[0].u.data(), dv[0].v.data(), count));
+#endif
+}
+
 // Test DotProd for int32 x int16
 TEST(DotProdTest, DotProd_i32i16) {
   std::srand(_seed);
@@ -151,6 +195,54 @@ TEST(DotProdTest, DotProd_flt) {
 #endif
 }
 
+// Test DotProd for float x int8
+TEST(DotProdTest, DotProd_flti8) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<float>(1, count, -1.f, 1.f);
+  std::vector<int8_t> q(count);
+  vec_rrd<int8_t>(q, -128, 127);
+
+  double expected = (double)dotProduct_flti8_scalar(dv[0].u.data(), q.data(), count);
+
+  EXPECT_NEAR(expected, (double)dotProduct_flti8_sse(dv[0].u.data(), q.data(), count), 0.015);
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  EXPECT_NEAR(expected, (double)dotProduct_flti8_fma(dv[0].u.data(), q.data(), count), 0.015);
+#endif
+}
+
+// Test DotProd for float x uint8
+TEST(DotProdTest, DotProd_fltui8) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<float>(1, count, -1.f, 1.f);
+  std::vector<uint8_t> q(count);
+  vec_rrd<uint8_t>(q, 0, 255);
+
+  double expected = (double)dotProduct_fltui8_scalar(dv[0].u.data(), q.data(), count);
+
+  EXPECT_NEAR(expected, (double)dotProduct_fltui8_sse(dv[0].u.data(), q.data(), count), 0.015);
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  EXPECT_NEAR(expected, (double)dotProduct_fltui8_fma(dv[0].u.data(), q.data(), count), 0.015);
+#endif
+}
+
+// Test DotProd for float x int16
+TEST(DotProdTest, DotProd_flti16) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<float>(1, count, -1.f, 1.f);
+  std::vector<int16_t> q(count);
+  vec_rrd<int16_t>(q, -1000, 1000);
+
+  double expected = (double)dotProduct_flti16_scalar(dv[0].u.data(), q.data(), count);
+
+  EXPECT_NEAR(expected, (double)dotProduct_flti16_sse(dv[0].u.data(), q.data(), count), 0.15);
+#if defined(HAS_AVX2_) && defined(HAS_FMA_)
+  EXPECT_NEAR(expected, (double)dotProduct_flti16_fma(dv[0].u.data(), q.data(), count), 0.15);
+#endif
+}
+
 // Test DotProd for double
 TEST(DotProdTest, DotProd_dbl) {
   std::srand(_seed);
@@ -170,3 +262,210 @@ TEST(DotProdTest, DotProd_dbl) {
   EXPECT_NEAR(expected, (double)dotProduct_dbl_fma(dv[0].u.data(), dv[0].v.data(), count), 0.0000015);
 #endif
 }
+
+// Test DotProd for complex float
+TEST(DotProdTest, DotProd_cflt) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<float>(1, 2*count, -1.f, 1.f);
+  auto u = reinterpret_cast<std::complex<float> const*>(dv[0].u.data());
+  auto v = reinterpret_cast<std::complex<float> const*>(dv[0].v.data());
+  
+  std::complex<float> expected  = dotProduct_cflt_scalar(u, v, count);
+  std::complex<float> expectedc = dotProductConj_cflt_scalar(u, v, count);
+  std::complex<float> res;
+  
+#ifdef HAS_SSE3_
+  res = dotProduct_cflt_sse(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0015);
+  res = dotProductConj_cflt_sse(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0015);
+#endif
+#ifdef HAS_AVX_
+  res = dotProduct_cflt_avx(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0015);
+  res = dotProductConj_cflt_avx(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0015);
+#endif
+#ifdef HAS_FMA_
+  res = dotProduct_cflt_fma(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0015);
+  res = dotProductConj_cflt_fma(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0015);
+#endif
+}
+
+// Test DotProd for complex double
+TEST(DotProdTest, DotProd_cdbl) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<double>(1, 2*count, -1., 1.);
+  auto u = reinterpret_cast<std::complex<double> const*>(dv[0].u.data());
+  auto v = reinterpret_cast<std::complex<double> const*>(dv[0].v.data());
+  
+  std::complex<double> expected  = dotProduct_cdbl_scalar(u, v, count);
+  std::complex<double> expectedc = dotProductConj_cdbl_scalar(u, v, count);
+  std::complex<double> res;
+  
+#ifdef HAS_SSE3_
+  res = dotProduct_cdbl_sse(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0000015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0000015);
+  res = dotProductConj_cdbl_sse(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0000015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0000015);
+#endif
+#ifdef HAS_AVX_
+  res = dotProduct_cdbl_avx(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0000015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0000015);
+  res = dotProductConj_cdbl_avx(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0000015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0000015);
+#endif
+#ifdef HAS_FMA_
+  res = dotProduct_cdbl_fma(u, v, count);
+  EXPECT_NEAR(expected.real(), res.real(), 0.0000015); EXPECT_NEAR(expected.imag(), res.imag(), 0.0000015);
+  res = dotProductConj_cdbl_fma(u, v, count);
+  EXPECT_NEAR(expectedc.real(), res.real(), 0.0000015); EXPECT_NEAR(expectedc.imag(), res.imag(), 0.0000015);
+#endif
+}
+
+// Test weighted/masked DotProd for float
+TEST(DotProdTest, DotProd_wflt) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<float>(2, count, -1.f, 1.f);
+  float const* u = dv[0].u.data();
+  float const* v = dv[0].v.data();
+  float const* w = dv[1].u.data();
+  std::vector<uint8_t> mask((count + 7) / 8);
+  vec_rrd<uint8_t>(mask, 0, 255);
+
+  double expected = (double)dotProductWeighted_flt_scalar(u, v, w, count);
+
+  EXPECT_NEAR(expected, (double)dotProductWeighted_flt_sse(u, v, w, count), 0.0015);
+#ifdef HAS_AVX_
+  EXPECT_NEAR(expected, (double)dotProductWeighted_flt_avx(u, v, w, count), 0.0015);
+#endif
+#ifdef HAS_FMA_
+  EXPECT_NEAR(expected, (double)dotProductWeighted_flt_fma(u, v, w, count), 0.0015);
+#endif
+
+  expected = (double)dotProductMasked_flt_scalar(u, v, mask.data(), count);
+
+#ifdef HAS_AVX2_
+  EXPECT_NEAR(expected, (double)dotProductMasked_flt_avx2(u, v, mask.data(), count), 0.0015);
+#endif
+#ifdef HAS_AVX512F_
+  EXPECT_NEAR(expected, (double)dotProductMasked_flt_avx512(u, v, mask.data(), count), 0.0015);
+#endif
+}
+
+// Test weighted/masked DotProd for double
+TEST(DotProdTest, DotProd_wdbl) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrdf<double>(2, count, -1., 1.);
+  double const* u = dv[0].u.data();
+  double const* v = dv[0].v.data();
+  double const* w = dv[1].u.data();
+  std::vector<uint8_t> mask((count + 7) / 8);
+  vec_rrd<uint8_t>(mask, 0, 255);
+
+  double expected = dotProductWeighted_dbl_scalar(u, v, w, count);
+
+  EXPECT_NEAR(expected, dotProductWeighted_dbl_sse(u, v, w, count), 0.0000015);
+#ifdef HAS_AVX_
+  EXPECT_NEAR(expected, dotProductWeighted_dbl_avx(u, v, w, count), 0.0000015);
+#endif
+#ifdef HAS_FMA_
+  EXPECT_NEAR(expected, dotProductWeighted_dbl_fma(u, v, w, count), 0.0000015);
+#endif
+
+  expected = dotProductMasked_dbl_scalar(u, v, mask.data(), count);
+
+#ifdef HAS_AVX2_
+  EXPECT_NEAR(expected, dotProductMasked_dbl_avx2(u, v, mask.data(), count), 0.0000015);
+#endif
+#ifdef HAS_AVX512F_
+  EXPECT_NEAR(expected, dotProductMasked_dbl_avx512(u, v, mask.data(), count), 0.0000015);
+#endif
+}
+
+// Sliding correlation and convolution for int16, against scalar references
+// (several chunks, single tap, long kernels, signal shorter than kernel)
+static void test_xcorr_i16(size_t count, size_t taps)
+{
+  auto dv = dual_vec_rrd<int16_t, int16_t>(1, std::max(count, taps), -1000, 1000);
+  int16_t const* x = dv[0].u.data();
+  int16_t const* k = dv[0].v.data();
+  size_t nout = xcorr_i16_out_size(count, taps);
+
+  std::vector<int32_t> expected(nout), res(nout + 1, -1);
+  correlate_i16_scalar(x, count, k, taps, expected.data());
+
+  correlate_i16_sse(x, count, k, taps, res.data());
+  EXPECT_EQ(expected, std::vector<int32_t>(res.begin(), res.begin() + nout)) << count << "x" << taps;
+  EXPECT_EQ(-1, res[nout]) << count << "x" << taps;
+#ifdef HAS_AVX2_
+  correlate_i16_avx2(x, count, k, taps, res.data());
+  EXPECT_EQ(expected, std::vector<int32_t>(res.begin(), res.begin() + nout)) << count << "x" << taps;
+  EXPECT_EQ(-1, res[nout]) << count << "x" << taps;
+#endif
+
+  // Convolution: reversed kernel
+  for (size_t i=0; i<nout; ++i)
+  {
+    expected[i] = 0;
+    for (size_t j=0; j<taps; ++j)
+      expected[i] += x[i+j] * k[taps-1-j];
+  }
+  convolve_i16(x, count, k, taps, res.data());
+  EXPECT_EQ(expected, std::vector<int32_t>(res.begin(), res.begin() + nout)) << count << "x" << taps;
+}
+
+// Test sliding correlation for int16
+TEST(DotProdTest, XCorr_i16) {
+  std::srand(_seed);
+  for (size_t taps : { 1, 16, 36, 37, 256 })
+    for (size_t count : { taps - 1, taps, taps + 30, (size_t)1023, (size_t)3000, (size_t)4200 })
+      test_xcorr_i16(count, taps);
+}
+
+// Sliding correlation and convolution for float, against scalar references
+static void test_xcorr_flt(size_t count, size_t taps)
+{
+  auto dv = dual_vec_rrdf<float>(1, std::max(count, taps), -1.f, 1.f);
+  float const* x = dv[0].u.data();
+  float const* k = dv[0].v.data();
+  size_t nout = xcorr_flt_out_size(count, taps);
+
+  std::vector<float> expected(nout), res(nout);
+  correlate_flt_scalar(x, count, k, taps, expected.data());
+
+  correlate_flt_sse(x, count, k, taps, res.data());
+  for (size_t i=0; i<nout; ++i) EXPECT_NEAR(expected[i], res[i], 0.001) << count << "x" << taps;
+#ifdef HAS_AVX_
+  correlate_flt_avx(x, count, k, taps, res.data());
+  for (size_t i=0; i<nout; ++i) EXPECT_NEAR(expected[i], res[i], 0.001) << count << "x" << taps;
+#endif
+#ifdef HAS_FMA_
+  correlate_flt_fma(x, count, k, taps, res.data());
+  for (size_t i=0; i<nout; ++i) EXPECT_NEAR(expected[i], res[i], 0.001) << count << "x" << taps;
+#endif
+
+  // Convolution: reversed kernel
+  for (size_t i=0; i<nout; ++i)
+  {
+    expected[i] = 0.f;
+    for (size_t j=0; j<taps; ++j)
+      expected[i] += x[i+j] * k[taps-1-j];
+  }
+  convolve_flt(x, count, k, taps, res.data());
+  for (size_t i=0; i<nout; ++i) EXPECT_NEAR(expected[i], res[i], 0.001) << count << "x" << taps;
+}
+
+// Test sliding correlation for float
+TEST(DotProdTest, XCorr_flt) {
+  std::srand(_seed);
+  for (size_t taps : { 1, 16, 36, 37, 256 })
+    for (size_t count : { taps - 1, taps, taps + 30, (size_t)1023, (size_t)3000 })
+      test_xcorr_flt(count, taps);
+}
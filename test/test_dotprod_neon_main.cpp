@@ -13,8 +13,10 @@
 #endif
 
 #include "DotProd_neon/dotp_i8_neon.h"
+#include "DotProd_neon/dotp_ui8_neon.h"
 #include "DotProd_neon/dotp_i16i8_neon.h"
 #include "DotProd_neon/dotp_i16_neon.h"
+#include "DotProd_neon/dotp_ui16_neon.h"
 #include "DotProd_neon/dotp_i32i16_neon.h"
 #include "DotProd_neon/dotp_i32_neon.h"
 #include "DotProd_neon/dotp_flt_neon.h"
@@ -39,6 +41,17 @@ TEST(DotProdTest, DotProd_i8_neon) {
   EXPECT_EQ(expected, dotProduct_i8_neon(dv[0].u.data(), dv[0].v.data(), count));
 }
 
+// Test DotProd for uint8
+TEST(DotProdTest, DotProd_ui8_neon) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrd<uint8_t, uint8_t>(1, count, 0, 255);
+
+  uint32_t expected = dotProduct_ui8_neon_scalar(dv[0].u.data(), dv[0].v.data(), count);
+
+  EXPECT_EQ(expected, dotProduct_ui8_neon(dv[0].u.data(), dv[0].v.data(), count));
+}
+
 // Test DotProd for int16 x int8
 TEST(DotProdTest, DotProd_i16i8_neon) {
   std::srand(_seed);
@@ -63,6 +76,17 @@ TEST(DotProdTest, DotProd_i16_neon) {
   EXPECT_EQ(expected, dotProduct_i16_neon(dv[0].u.data(), dv[0].v.data(), count));
 }
 
+// Test DotProd for uint16
+TEST(DotProdTest, DotProd_ui16_neon) {
+  std::srand(_seed);
+  size_t count = 1023;
+  auto dv = dual_vec_rrd<uint16_t, uint16_t>(1, count, 0, 65535);
+
+  uint64_t expected = dotProduct_ui16_neon_scalar(dv[0].u.data(), dv[0].v.data(), count);
+
+  EXPECT_EQ(expected, dotProduct_ui16_neon(dv[0].u.data(), dv[0].v.data(), count));
+}
+
 // Test DotProd for int32 x int16
 TEST(DotProdTest, DotProd_i32i16_neon) {
   std::srand(_seed);
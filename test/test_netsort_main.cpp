@@ -13,11 +13,47 @@
 #include "NetSort/nsort_8_i32.h"
 #include "NetSort/nsort_8_flt.h"
 #include "NetSort/nsort_8_dbl.h"
+#include "NetSort/nsort_8_batch_i32.h"
+#include "NetSort/nsort_8_batch_flt.h"
+#include "NetSort/nsort_8_batch_i8.h"
+#include "NetSort/nsort_8_batch_i16.h"
+#include "NetSort/nsort_16_i8.h"
+#include "NetSort/nsort_16_i16.h"
+#include "NetSort/nsort_16_i32.h"
+#include "NetSort/nsort_16_flt.h"
+#include "NetSort/nsort_16_dbl.h"
+#include "NetSort/nsort_32_i8.h"
+#include "NetSort/nsort_32_i16.h"
+#include "NetSort/nsort_32_i32.h"
+#include "NetSort/nsort_32_flt.h"
+#include "NetSort/nsort_32_dbl.h"
+#include "NetSort/nsort_64_i8.h"
+#include "NetSort/nsort_64_i16.h"
+#include "NetSort/nsort_64_i32.h"
+#include "NetSort/nsort_64_flt.h"
+#include "NetSort/nsort_64_dbl.h"
+#include "NetSort/nsort_u8.h"
+#include "NetSort/nsort_u16.h"
+#include "NetSort/nsort_u32.h"
+#include "NetSort/nsort_i64.h"
+#include "NetSort/nsort_u64.h"
+#include "NetSort/nsort_small.h"
+#include "NetSort/nsort_sorted.h"
+#include "NetSort/nsort_kv.h"
+#include "NetSort/nsort_order.h"
+#include "NetSort/nsort_select_i16.h"
+#include "NetSort/nsort_select_i32.h"
+#include "NetSort/nsort_select_flt.h"
+#include "NetSort/nsort_select_dbl.h"
 
 #include <cstdint>
 #include <cstdlib>
+#include <algorithm>
+#include <limits>
 #include <ctime>
 #include <vector>
+#include <cstring>
+#include <cmath>
 
 #ifndef HAS_AVX_
   #warning "Testing non-optimal version (SSSE3/SSE4.1/AVX recommended)"
@@ -99,3 +135,1052 @@ TEST(NetSortTest, NetSort_8_dbl) {
   netsort_8_dbl_avx(v2.data()); EXPECT_EQ(v0, v2);
 #endif
 }
+
+// Test register-level 8 values networks (upper int8 lanes ignored)
+TEST(NetSortTest, NetSort_8_reg) {
+  std::srand(_seed);
+  for (int it=0; it<100; ++it)
+  {
+    int8_t   a8[16];
+    int32_t  a32[8];
+    float    af[8];
+    double   ad[8];
+    vec_rrd(a8, 16, (int8_t)-127, (int8_t)127);
+    vec_rrd(a32, 8, -5000, 5000);
+    vec_rrdf(af, 8, -1.f, 1.f);
+    vec_rrdf(ad, 8, -1., 1.);
+    std::vector<int8_t>  r8(a8, a8 + 8);
+    std::vector<int32_t> r32(a32, a32 + 8);
+    std::vector<float>   rf(af, af + 8);
+    std::vector<double>  rd(ad, ad + 8);
+    std::sort(r8.begin(), r8.end());
+    std::sort(r32.begin(), r32.end());
+    std::sort(rf.begin(), rf.end());
+    std::sort(rd.begin(), rd.end());
+
+#ifdef HAS_SSSE3_
+    int8_t o8[16];
+    _mm_storeu_si128((__m128i*)o8, netsort_8_i8_sse(_mm_loadu_si128((__m128i const*)a8)));
+    EXPECT_EQ(r8, std::vector<int8_t>(o8, o8 + 8));
+#endif
+#ifdef HAS_SSE4_1_
+    int32_t o32[8];
+    __m128i x[2] = { _mm_loadu_si128((__m128i const*)a32), _mm_loadu_si128((__m128i const*)(a32 + 4)) };
+    netsort_8_i32_sse(x);
+    _mm_storeu_si128((__m128i*)o32, x[0]);
+    _mm_storeu_si128((__m128i*)(o32 + 4), x[1]);
+    EXPECT_EQ(r32, std::vector<int32_t>(o32, o32 + 8));
+#endif
+    float of[8];
+    __m128 xf[2] = { _mm_loadu_ps(af), _mm_loadu_ps(af + 4) };
+    netsort_8_flt_sse(xf);
+    _mm_storeu_ps(of, xf[0]);
+    _mm_storeu_ps(of + 4, xf[1]);
+    EXPECT_EQ(rf, std::vector<float>(of, of + 8));
+#ifdef HAS_AVX2_
+    _mm256_storeu_si256((__m256i*)o32, netsort_8_i32_avx2(_mm256_loadu_si256((__m256i const*)a32)));
+    EXPECT_EQ(r32, std::vector<int32_t>(o32, o32 + 8));
+#endif
+#ifdef HAS_AVX_
+    _mm256_storeu_ps(of, netsort_8_flt_avx(_mm256_loadu_ps(af)));
+    EXPECT_EQ(rf, std::vector<float>(of, of + 8));
+    double od[8];
+    __m256d xd[2] = { _mm256_loadu_pd(ad), _mm256_loadu_pd(ad + 4) };
+    netsort_8_dbl_avx(xd);
+    _mm256_storeu_pd(od, xd[0]);
+    _mm256_storeu_pd(od + 4, xd[1]);
+    EXPECT_EQ(rd, std::vector<double>(od, od + 8));
+#endif
+#ifdef HAS_AVX512F_
+    _mm512_storeu_pd(od, bitonic_sort_8_dbl_avx512(_mm512_loadu_pd(ad)));
+    EXPECT_EQ(rd, std::vector<double>(od, od + 8));
+#endif
+  }
+}
+
+// Test NetSort for 16 x int8
+TEST(NetSortTest, NetSort_16_i8) {
+  std::srand(_seed);
+  std::vector<int8_t> v0(16);
+  vec_rrd(v0, (int8_t)-127, (int8_t)127);
+  auto v1 = v0;
+
+  netsort_16_i8_qsort(v0.data());
+
+#ifdef HAS_SSE4_1_
+  netsort_16_i8_sse(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 16 x int16
+TEST(NetSortTest, NetSort_16_i16) {
+  std::srand(_seed);
+  std::vector<int16_t> v0(16);
+  vec_rrd(v0, (int16_t)-5000, (int16_t)5000);
+  auto v1 = v0;
+
+  netsort_16_i16_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_16_i16_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 16 x int32
+TEST(NetSortTest, NetSort_16_i32) {
+  std::srand(_seed);
+  std::vector<int32_t> v0(16);
+  vec_rrd(v0, -5000, 5000);
+  auto v1 = v0, v2 = v0;
+
+  netsort_16_i32_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_16_i32_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_16_i32_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 16 x float
+TEST(NetSortTest, NetSort_16_flt) {
+  std::srand(_seed);
+  std::vector<float> v0(16);
+  vec_rrdf(v0, -1.f, 1.f);
+  auto v1 = v0, v2 = v0;
+
+  netsort_16_flt_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_16_flt_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_16_flt_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 16 x double
+TEST(NetSortTest, NetSort_16_dbl) {
+  std::srand(_seed);
+  std::vector<double> v0(16);
+  vec_rrdf(v0, -1., 1.);
+  auto v1 = v0, v2 = v0;
+
+  netsort_16_dbl_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_16_dbl_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_16_dbl_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 32 x int8
+TEST(NetSortTest, NetSort_32_i8) {
+  std::srand(_seed);
+  std::vector<int8_t> v0(32);
+  vec_rrd(v0, (int8_t)-127, (int8_t)127);
+  auto v1 = v0;
+
+  netsort_32_i8_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_32_i8_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 32 x int16
+TEST(NetSortTest, NetSort_32_i16) {
+  std::srand(_seed);
+  std::vector<int16_t> v0(32);
+  vec_rrd(v0, (int16_t)-5000, (int16_t)5000);
+  auto v1 = v0;
+
+  netsort_32_i16_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_32_i16_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 32 x int32
+TEST(NetSortTest, NetSort_32_i32) {
+  std::srand(_seed);
+  std::vector<int32_t> v0(32);
+  vec_rrd(v0, -5000, 5000);
+  auto v1 = v0, v2 = v0;
+
+  netsort_32_i32_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_32_i32_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_32_i32_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 32 x float
+TEST(NetSortTest, NetSort_32_flt) {
+  std::srand(_seed);
+  std::vector<float> v0(32);
+  vec_rrdf(v0, -1.f, 1.f);
+  auto v1 = v0, v2 = v0;
+
+  netsort_32_flt_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_32_flt_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_32_flt_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 32 x double
+TEST(NetSortTest, NetSort_32_dbl) {
+  std::srand(_seed);
+  std::vector<double> v0(32);
+  vec_rrdf(v0, -1., 1.);
+  auto v1 = v0, v2 = v0;
+
+  netsort_32_dbl_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_32_dbl_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_32_dbl_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 64 x int8
+TEST(NetSortTest, NetSort_64_i8) {
+  std::srand(_seed);
+  std::vector<int8_t> v0(64);
+  vec_rrd(v0, (int8_t)-127, (int8_t)127);
+  auto v1 = v0;
+
+  netsort_64_i8_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_64_i8_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 64 x int16
+TEST(NetSortTest, NetSort_64_i16) {
+  std::srand(_seed);
+  std::vector<int16_t> v0(64);
+  vec_rrd(v0, (int16_t)-5000, (int16_t)5000);
+  auto v1 = v0;
+
+  netsort_64_i16_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_64_i16_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+}
+
+// Test NetSort for 64 x int32
+TEST(NetSortTest, NetSort_64_i32) {
+  std::srand(_seed);
+  std::vector<int32_t> v0(64);
+  vec_rrd(v0, -5000, 5000);
+  auto v1 = v0, v2 = v0;
+
+  netsort_64_i32_qsort(v0.data());
+
+#ifdef HAS_AVX2_
+  netsort_64_i32_avx2(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_64_i32_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 64 x float
+TEST(NetSortTest, NetSort_64_flt) {
+  std::srand(_seed);
+  std::vector<float> v0(64);
+  vec_rrdf(v0, -1.f, 1.f);
+  auto v1 = v0, v2 = v0;
+
+  netsort_64_flt_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_64_flt_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_64_flt_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 64 x double
+TEST(NetSortTest, NetSort_64_dbl) {
+  std::srand(_seed);
+  std::vector<double> v0(64);
+  vec_rrdf(v0, -1., 1.);
+  auto v1 = v0, v2 = v0;
+
+  netsort_64_dbl_qsort(v0.data());
+
+#ifdef HAS_AVX_
+  netsort_64_dbl_avx(v1.data()); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+  netsort_64_dbl_avx512(v2.data()); EXPECT_EQ(v0, v2);
+#endif
+}
+
+// Test NetSort for 0..64 x int8 (values past n untouched)
+TEST(NetSortTest, NetSort_small_i8) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<int8_t> v0(64);
+    vec_rrd(v0, (int8_t)-127, (int8_t)127);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_i8_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_i8_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Test NetSort for 0..64 x int16 (values past n untouched)
+TEST(NetSortTest, NetSort_small_i16) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<int16_t> v0(64);
+    vec_rrd(v0, (int16_t)-5000, (int16_t)5000);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_i16_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_i16_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Test NetSort for 0..64 x int32 (values past n untouched)
+TEST(NetSortTest, NetSort_small_i32) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<int32_t> v0(64);
+    vec_rrd(v0, -5000, 5000);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_i32_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_i32_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Test NetSort for 0..64 x int64 (values past n untouched)
+TEST(NetSortTest, NetSort_small_i64) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<int64_t> v0(64);
+    vec_rrd(v0, (int64_t)-5000, (int64_t)5000);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_i64_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_i64_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Test NetSort for 0..64 x float (values past n untouched)
+TEST(NetSortTest, NetSort_small_flt) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<float> v0(64);
+    vec_rrdf(v0, -1.f, 1.f);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_flt_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_flt_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Test NetSort for 0..64 x double (values past n untouched)
+TEST(NetSortTest, NetSort_small_dbl) {
+  std::srand(_seed);
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<double> v0(64);
+    vec_rrdf(v0, -1., 1.);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_small_dbl_qsort(v0.data(), n);
+
+#ifdef HAS_AVX2_
+    netsort_small_dbl_avx2(v1.data(), n); EXPECT_EQ(v0, v1);
+#endif
+    netsort_small(v2.data(), n); EXPECT_EQ(v0, v2);
+  }
+}
+
+// Check fixed size networks, bounds of the range repeated every other run
+template <typename T>
+static void test_netsort_n(void (*ref)(T*), void (*func)(T*), size_t n, T min, T max)
+{
+  for (int it=0; it<100; ++it)
+  {
+    std::vector<T> v0(n);
+    vec_rrd(v0, min, max);
+    if (it & 1)
+      for (size_t i=0; i<n; i+=3)
+        v0[i] = (i & 4) ? max : min;
+    auto v1 = v0;
+
+    ref(v0.data());
+    func(v1.data()); EXPECT_EQ(v0, v1);
+  }
+}
+
+// Check 0..64 values networks (values past n untouched)
+template <typename T>
+static void test_netsort_small_n(void (*ref)(T*, size_t), void (*func)(T*, size_t), T min, T max)
+{
+  for (size_t n=0; n<=64; ++n)
+  {
+    std::vector<T> v0(64);
+    vec_rrd(v0, min, max);
+    if (n & 1)
+      for (size_t i=0; i<64; i+=3)
+        v0[i] = (i & 4) ? max : min;
+    auto v1 = v0;
+
+    ref(v0.data(), n);
+    func(v1.data(), n); EXPECT_EQ(v0, v1);
+  }
+}
+
+// Test NetSort for 8/16/32/64 and 0..64 x uint8
+TEST(NetSortTest, NetSort_u8) {
+  std::srand(_seed);
+  const uint8_t lo = 0, hi = UINT8_MAX;
+#ifdef HAS_SSSE3_
+  test_netsort_n<uint8_t>(netsort_8_u8_qsort,  netsort_8_u8_sse,   8, lo, hi);
+#endif
+#ifdef HAS_SSE4_1_
+  test_netsort_n<uint8_t>(netsort_16_u8_qsort, netsort_16_u8_sse, 16, lo, hi);
+#endif
+#ifdef HAS_AVX2_
+  test_netsort_n<uint8_t>(netsort_32_u8_qsort, netsort_32_u8_avx2, 32, lo, hi);
+  test_netsort_n<uint8_t>(netsort_64_u8_qsort, netsort_64_u8_avx2, 64, lo, hi);
+  test_netsort_small_n<uint8_t>(netsort_small_u8_qsort, netsort_small_u8_avx2, lo, hi);
+#endif
+  test_netsort_small_n<uint8_t>(netsort_small_u8_qsort, netsort_small, lo, hi);
+}
+
+// Test NetSort for 8/16/32/64 and 0..64 x uint16
+TEST(NetSortTest, NetSort_u16) {
+  std::srand(_seed);
+  const uint16_t lo = 0, hi = UINT16_MAX;
+#ifdef HAS_SSSE3_
+  test_netsort_n<uint16_t>(netsort_8_u16_qsort,  netsort_8_u16_sse,    8, lo, hi);
+#endif
+#ifdef HAS_AVX2_
+  test_netsort_n<uint16_t>(netsort_16_u16_qsort, netsort_16_u16_avx2, 16, lo, hi);
+  test_netsort_n<uint16_t>(netsort_32_u16_qsort, netsort_32_u16_avx2, 32, lo, hi);
+  test_netsort_n<uint16_t>(netsort_64_u16_qsort, netsort_64_u16_avx2, 64, lo, hi);
+  test_netsort_small_n<uint16_t>(netsort_small_u16_qsort, netsort_small_u16_avx2, lo, hi);
+#endif
+  test_netsort_small_n<uint16_t>(netsort_small_u16_qsort, netsort_small, lo, hi);
+}
+
+// Test NetSort for 8/16/32/64 and 0..64 x uint32
+TEST(NetSortTest, NetSort_u32) {
+  std::srand(_seed);
+  const uint32_t lo = 0, hi = UINT32_MAX;
+#ifdef HAS_AVX2_
+  test_netsort_n<uint32_t>(netsort_8_u32_qsort,  netsort_8_u32_avx2,   8, lo, hi);
+  test_netsort_n<uint32_t>(netsort_16_u32_qsort, netsort_16_u32_avx2, 16, lo, hi);
+  test_netsort_n<uint32_t>(netsort_32_u32_qsort, netsort_32_u32_avx2, 32, lo, hi);
+  test_netsort_n<uint32_t>(netsort_64_u32_qsort, netsort_64_u32_avx2, 64, lo, hi);
+  test_netsort_small_n<uint32_t>(netsort_small_u32_qsort, netsort_small_u32_avx2, lo, hi);
+#endif
+  test_netsort_small_n<uint32_t>(netsort_small_u32_qsort, netsort_small, lo, hi);
+}
+
+// Test NetSort for 8/16/32/64 x int64
+TEST(NetSortTest, NetSort_i64) {
+  std::srand(_seed);
+  const int64_t lo = -4000000000000000000ll, hi = 4000000000000000000ll;
+#ifdef HAS_AVX2_
+  test_netsort_n<int64_t>(netsort_8_i64_qsort,  netsort_8_i64_avx2,   8, lo, hi);
+  test_netsort_n<int64_t>(netsort_16_i64_qsort, netsort_16_i64_avx2, 16, lo, hi);
+  test_netsort_n<int64_t>(netsort_32_i64_qsort, netsort_32_i64_avx2, 32, lo, hi);
+  test_netsort_n<int64_t>(netsort_64_i64_qsort, netsort_64_i64_avx2, 64, lo, hi);
+#endif
+}
+
+// Test NetSort for 8/16/32/64 and 0..64 x uint64
+TEST(NetSortTest, NetSort_u64) {
+  std::srand(_seed);
+  const uint64_t lo = 0, hi = 0xFFFFFFFFFFFFF000ull;  // exact as double
+#ifdef HAS_AVX2_
+  test_netsort_n<uint64_t>(netsort_8_u64_qsort,  netsort_8_u64_avx2,   8, lo, hi);
+  test_netsort_n<uint64_t>(netsort_16_u64_qsort, netsort_16_u64_avx2, 16, lo, hi);
+  test_netsort_n<uint64_t>(netsort_32_u64_qsort, netsort_32_u64_avx2, 32, lo, hi);
+  test_netsort_n<uint64_t>(netsort_64_u64_qsort, netsort_64_u64_avx2, 64, lo, hi);
+  test_netsort_small_n<uint64_t>(netsort_small_u64_qsort, netsort_small_u64_avx2, lo, hi);
+#endif
+  test_netsort_small_n<uint64_t>(netsort_small_u64_qsort, netsort_small, lo, hi);
+}
+
+// Random values in [min, max]
+template <typename T>
+static inline void test_gen(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static inline void test_gen(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static inline void test_gen(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+// Check order policies of fixed size networks against 'std::sort' with the same policy
+template <typename T, typename Order>
+static void test_netsort_order(void (*func)(T*), size_t n, T min, T max)
+{
+  for (int it=0; it<100; ++it)
+  {
+    std::vector<T> v0(n);
+    test_gen(v0, min, max);
+    if (it & 1)
+      for (size_t i=0; i<n; i+=3)
+        v0[i] = (i & 4) ? -v0[i] : v0[(i + 1) % n];  // opposite values and duplicates
+    auto v1 = v0;
+
+    netsort_order_std<Order>(v0.data(), n);
+    func(v1.data());
+    EXPECT_EQ(0, memcmp(v0.data(), v1.data(), n*sizeof(T)));  // bitwise (-0.f vs 0.f)
+  }
+}
+
+// Test NetSort order policies for int16/int32/int64
+TEST(NetSortTest, NetSortOrder_int) {
+  std::srand(_seed);
+#ifdef HAS_AVX2_
+  test_netsort_order<int16_t, netsort_asc> (netsort_16_i16_avx2_ord<netsort_asc>,  16, (int16_t)-5000, (int16_t)5000);
+  test_netsort_order<int16_t, netsort_desc>(netsort_16_i16_avx2_ord<netsort_desc>, 16, (int16_t)-5000, (int16_t)5000);
+  test_netsort_order<int16_t, netsort_desc>(netsort_32_i16_avx2_ord<netsort_desc>, 32, (int16_t)-5000, (int16_t)5000);
+  test_netsort_order<int16_t, netsort_desc>(netsort_64_i16_avx2_ord<netsort_desc>, 64, (int16_t)-5000, (int16_t)5000);
+
+  test_netsort_order<int32_t, netsort_asc> (netsort_8_i32_avx2_ord<netsort_asc>,   8, -5000, 5000);
+  test_netsort_order<int32_t, netsort_desc>(netsort_8_i32_avx2_ord<netsort_desc>,  8, -5000, 5000);
+  test_netsort_order<int32_t, netsort_desc>(netsort_16_i32_avx2_ord<netsort_desc>, 16, -5000, 5000);
+  test_netsort_order<int32_t, netsort_desc>(netsort_32_i32_avx2_ord<netsort_desc>, 32, -5000, 5000);
+  test_netsort_order<int32_t, netsort_desc>(netsort_64_i32_avx2_ord<netsort_desc>, 64, -5000, 5000);
+
+  test_netsort_order<int64_t, netsort_asc> (netsort_8_i64_avx2_ord<netsort_asc>,   8, (int64_t)-5000000000ll, (int64_t)5000000000ll);
+  test_netsort_order<int64_t, netsort_desc>(netsort_8_i64_avx2_ord<netsort_desc>,  8, (int64_t)-5000000000ll, (int64_t)5000000000ll);
+  test_netsort_order<int64_t, netsort_desc>(netsort_16_i64_avx2_ord<netsort_desc>, 16, (int64_t)-5000000000ll, (int64_t)5000000000ll);
+  test_netsort_order<int64_t, netsort_desc>(netsort_32_i64_avx2_ord<netsort_desc>, 32, (int64_t)-5000000000ll, (int64_t)5000000000ll);
+  test_netsort_order<int64_t, netsort_desc>(netsort_64_i64_avx2_ord<netsort_desc>, 64, (int64_t)-5000000000ll, (int64_t)5000000000ll);
+#endif
+}
+
+// Test NetSort order policies for float/double
+TEST(NetSortTest, NetSortOrder_flt_dbl) {
+  std::srand(_seed);
+#ifdef HAS_AVX_
+  test_netsort_order<float, netsort_asc> (netsort_8_flt_avx_ord<netsort_asc>,   8, -1.f, 1.f);
+  test_netsort_order<float, netsort_desc>(netsort_8_flt_avx_ord<netsort_desc>,  8, -1.f, 1.f);
+  test_netsort_order<float, netsort_desc>(netsort_16_flt_avx_ord<netsort_desc>, 16, -1.f, 1.f);
+  test_netsort_order<float, netsort_desc>(netsort_32_flt_avx_ord<netsort_desc>, 32, -1.f, 1.f);
+  test_netsort_order<float, netsort_desc>(netsort_64_flt_avx_ord<netsort_desc>, 64, -1.f, 1.f);
+
+  test_netsort_order<double, netsort_asc> (netsort_8_dbl_avx_ord<netsort_asc>,   8, -1., 1.);
+  test_netsort_order<double, netsort_desc>(netsort_8_dbl_avx_ord<netsort_desc>,  8, -1., 1.);
+  test_netsort_order<double, netsort_desc>(netsort_16_dbl_avx_ord<netsort_desc>, 16, -1., 1.);
+  test_netsort_order<double, netsort_desc>(netsort_32_dbl_avx_ord<netsort_desc>, 32, -1., 1.);
+  test_netsort_order<double, netsort_desc>(netsort_64_dbl_avx_ord<netsort_desc>, 64, -1., 1.);
+#endif
+#ifdef HAS_AVX2_
+  test_netsort_order<float, netsort_abs>(netsort_8_flt_avx_ord<netsort_abs>,   8, -1.f, 1.f);
+  test_netsort_order<float, netsort_abs>(netsort_16_flt_avx_ord<netsort_abs>, 16, -1.f, 1.f);
+  test_netsort_order<float, netsort_abs>(netsort_32_flt_avx_ord<netsort_abs>, 32, -1.f, 1.f);
+  test_netsort_order<float, netsort_abs>(netsort_64_flt_avx_ord<netsort_abs>, 64, -1.f, 1.f);
+
+  test_netsort_order<double, netsort_abs>(netsort_8_dbl_avx_ord<netsort_abs>,   8, -1., 1.);
+  test_netsort_order<double, netsort_abs>(netsort_16_dbl_avx_ord<netsort_abs>, 16, -1., 1.);
+  test_netsort_order<double, netsort_abs>(netsort_32_dbl_avx_ord<netsort_abs>, 32, -1., 1.);
+  test_netsort_order<double, netsort_abs>(netsort_64_dbl_avx_ord<netsort_abs>, 64, -1., 1.);
+
+  // NaN last, signed zeros (+0 before -0)
+  float f[8] = { NAN, -0.f, 2.f, 0.f, -INFINITY, -1.f, 1.f, -NAN };
+  netsort_8_flt_avx_ord<netsort_abs>(f);
+  EXPECT_FALSE(std::signbit(f[0])); EXPECT_EQ(0.f, f[0]);
+  EXPECT_TRUE(std::signbit(f[1]));  EXPECT_EQ(0.f, f[1]);
+  EXPECT_EQ(1.f, f[2]); EXPECT_EQ(-1.f, f[3]); EXPECT_EQ(2.f, f[4]); EXPECT_EQ(-INFINITY, f[5]);
+  EXPECT_TRUE(std::isnan(f[6])); EXPECT_TRUE(std::isnan(f[7]));
+#endif
+}
+
+// Same with NaN (both signs, distinct payloads), +-0 and +-inf among values
+template <typename T, typename Order>
+static void test_netsort_order_nan(void (*func)(T*), size_t n)
+{
+  const T special[8] = { std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN(),
+                         std::numeric_limits<T>::signaling_NaN(), (T)0, -(T)0,
+                         std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                         std::numeric_limits<T>::denorm_min() };
+  for (int it=0; it<100; ++it)
+  {
+    std::vector<T> v0(n);
+    test_gen(v0, (T)-1, (T)1);
+    for (size_t i=0; i<n; ++i)
+      if (std::rand() % 3 == 0)
+        v0[i] = special[std::rand() % 8];
+    auto v1 = v0;
+
+    netsort_order_std<Order>(v0.data(), n);
+    func(v1.data());
+    EXPECT_EQ(0, memcmp(v0.data(), v1.data(), n*sizeof(T)));  // bitwise (NaN payloads kept)
+  }
+}
+
+// Test NetSort totalOrder and NaN-last policies for float/double
+TEST(NetSortTest, NetSortOrder_nan) {
+  std::srand(_seed);
+#ifdef HAS_AVX2_
+  test_netsort_order_nan<float, netsort_total>(netsort_8_flt_avx_ord<netsort_total>,   8);
+  test_netsort_order_nan<float, netsort_total>(netsort_16_flt_avx_ord<netsort_total>, 16);
+  test_netsort_order_nan<float, netsort_total>(netsort_32_flt_avx_ord<netsort_total>, 32);
+  test_netsort_order_nan<float, netsort_total>(netsort_64_flt_avx_ord<netsort_total>, 64);
+  test_netsort_order_nan<float, netsort_nan_last>(netsort_8_flt_avx_ord<netsort_nan_last>,   8);
+  test_netsort_order_nan<float, netsort_nan_last>(netsort_16_flt_avx_ord<netsort_nan_last>, 16);
+  test_netsort_order_nan<float, netsort_nan_last>(netsort_32_flt_avx_ord<netsort_nan_last>, 32);
+  test_netsort_order_nan<float, netsort_nan_last>(netsort_64_flt_avx_ord<netsort_nan_last>, 64);
+
+  test_netsort_order_nan<double, netsort_total>(netsort_8_dbl_avx_ord<netsort_total>,   8);
+  test_netsort_order_nan<double, netsort_total>(netsort_16_dbl_avx_ord<netsort_total>, 16);
+  test_netsort_order_nan<double, netsort_total>(netsort_32_dbl_avx_ord<netsort_total>, 32);
+  test_netsort_order_nan<double, netsort_total>(netsort_64_dbl_avx_ord<netsort_total>, 64);
+  test_netsort_order_nan<double, netsort_nan_last>(netsort_8_dbl_avx_ord<netsort_nan_last>,   8);
+  test_netsort_order_nan<double, netsort_nan_last>(netsort_16_dbl_avx_ord<netsort_nan_last>, 16);
+  test_netsort_order_nan<double, netsort_nan_last>(netsort_32_dbl_avx_ord<netsort_nan_last>, 32);
+  test_netsort_order_nan<double, netsort_nan_last>(netsort_64_dbl_avx_ord<netsort_nan_last>, 64);
+
+  // -NaN < -inf < -0 < +0 < +inf < +NaN, NaN last
+  float f[8] = { NAN, -0.f, 2.f, 0.f, -INFINITY, -1.f, INFINITY, -NAN };
+  float g[8];
+  memcpy(g, f, sizeof(f));
+  netsort_8_flt_avx_ord<netsort_total>(f);
+  EXPECT_TRUE(std::isnan(f[0]) && std::signbit(f[0])); EXPECT_EQ(-INFINITY, f[1]); EXPECT_EQ(-1.f, f[2]);
+  EXPECT_TRUE(std::signbit(f[3]));  EXPECT_EQ(0.f, f[3]);
+  EXPECT_FALSE(std::signbit(f[4])); EXPECT_EQ(0.f, f[4]);
+  EXPECT_EQ(2.f, f[5]); EXPECT_EQ(INFINITY, f[6]); EXPECT_TRUE(std::isnan(f[7]) && !std::signbit(f[7]));
+
+  netsort_8_flt_avx_ord<netsort_nan_last>(g);
+  EXPECT_EQ(-INFINITY, g[0]); EXPECT_EQ(-1.f, g[1]); EXPECT_EQ(INFINITY, g[5]);
+  EXPECT_TRUE(std::isnan(g[6]) && !std::signbit(g[6])); EXPECT_TRUE(std::isnan(g[7]) && std::signbit(g[7]));
+#endif
+}
+
+// Check key-value networks: sorted keys, payload follows its key
+template <typename K, typename P>
+static void test_netsort_kv(void (*func8)(K*, P*), void (*func16)(K*, P*))
+{
+  for (int it=0; it<100; ++it)
+  {
+    for (size_t n=8; n<=16; n+=8)
+    {
+      std::vector<K> k0(n), k1(n);
+      std::vector<P> p1(n);
+      vec_rrd(k0, (K)0, (K)9);
+      for (size_t i=0; i<n; ++i) { k1[i] = k0[i]; p1[i] = (P)i; }
+      (n == 8 ? func8 : func16)(k1.data(), p1.data());
+
+      auto k2 = k0;
+      std::sort(k2.begin(), k2.end());
+      EXPECT_EQ(k2, k1);
+      for (size_t i=0; i<n; ++i) EXPECT_EQ(k0[p1[i]], k1[i]);
+      std::sort(p1.begin(), p1.end());
+      for (size_t i=0; i<n; ++i) EXPECT_EQ(p1[i], (P)i);
+    }
+  }
+}
+
+// Check argsort for 0..40 keys (max keys tied with network padding)
+template <typename K, typename P>
+static void test_argsort(void (*argsort)(const K*, P*, size_t))
+{
+  for (int it=0; it<100; ++it)
+  {
+    for (size_t n=0; n<=40; ++n)
+    {
+      std::vector<K> k0(n), k1, k2;
+      std::vector<P> idx(n);
+      vec_rrd(k0, (K)0, (K)9);
+      if (n && (it & 1)) k0[it % n] = std::numeric_limits<K>::max();
+      argsort(k0.data(), idx.data(), n);
+
+      k2 = k0;
+      std::sort(k2.begin(), k2.end());
+      for (size_t i=0; i<n; ++i) k1.push_back(k0[idx[i]]);
+      EXPECT_EQ(k2, k1) << "n=" << n;
+      std::sort(idx.begin(), idx.end());
+      for (size_t i=0; i<n; ++i) EXPECT_EQ(idx[i], (P)i);
+    }
+  }
+}
+
+// Test key-value NetSort and argsort for int32 keys (int32 payload)
+TEST(NetSortTest, NetSort_kv_i32) {
+  std::srand(_seed);
+  test_argsort<int32_t, int32_t>(netsort_argsort_i32_std);
+#ifdef HAS_AVX2_
+  test_netsort_kv<int32_t, int32_t>(netsort_kv_8_i32_avx2, netsort_kv_16_i32_avx2);
+#endif
+  test_argsort<int32_t, int32_t>(netsort_argsort);
+}
+
+// Test key-value NetSort and argsort for float keys (int32 payload)
+TEST(NetSortTest, NetSort_kv_flt) {
+  std::srand(_seed);
+  test_argsort<float, int32_t>(netsort_argsort_flt_std);
+#ifdef HAS_AVX2_
+  test_netsort_kv<float, int32_t>(netsort_kv_8_flt_avx2, netsort_kv_16_flt_avx2);
+#endif
+  test_argsort<float, int32_t>(netsort_argsort);
+}
+
+// Test key-value NetSort and argsort for int64 keys (int64 payload)
+TEST(NetSortTest, NetSort_kv_i64) {
+  std::srand(_seed);
+  test_argsort<int64_t, int64_t>(netsort_argsort_i64_std);
+#ifdef HAS_AVX2_
+  test_netsort_kv<int64_t, int64_t>(netsort_kv_8_i64_avx2, netsort_kv_16_i64_avx2);
+#endif
+  test_argsort<int64_t, int64_t>(netsort_argsort);
+}
+
+// Test key-value NetSort and argsort for double keys (int64 payload)
+TEST(NetSortTest, NetSort_kv_dbl) {
+  std::srand(_seed);
+  test_argsort<double, int64_t>(netsort_argsort_dbl_std);
+#ifdef HAS_AVX2_
+  test_netsort_kv<double, int64_t>(netsort_kv_8_dbl_avx2, netsort_kv_16_dbl_avx2);
+#endif
+  test_argsort<double, int64_t>(netsort_argsort);
+}
+
+// Test batch NetSort for 0..40 groups of 8 x int32 (values past groups untouched)
+TEST(NetSortTest, NetSort_8_batch_i32) {
+  std::srand(_seed);
+  for (size_t g=0; g<=40; ++g)
+  {
+    std::vector<int32_t> v0(8*40 + 8);
+    vec_rrd(v0, -5000, 5000);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_8_batch_i32_qsort(v0.data(), g);
+
+#ifdef HAS_AVX2_
+    netsort_8_batch_i32_avx2(v1.data(), g); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+    netsort_8_batch_i32_avx512(v2.data(), g); EXPECT_EQ(v0, v2);
+#endif
+  }
+}
+
+// Test batch NetSort for 0..40 groups of 8 x float (values past groups untouched)
+TEST(NetSortTest, NetSort_8_batch_flt) {
+  std::srand(_seed);
+  for (size_t g=0; g<=40; ++g)
+  {
+    std::vector<float> v0(8*40 + 8);
+    vec_rrdf(v0, -1.f, 1.f);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_8_batch_flt_qsort(v0.data(), g);
+
+#ifdef HAS_AVX_
+    netsort_8_batch_flt_avx(v1.data(), g); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512F_
+    netsort_8_batch_flt_avx512(v2.data(), g); EXPECT_EQ(v0, v2);
+#endif
+  }
+}
+
+// Test batch NetSort for 0..40 groups of 8 x int8 (values past groups untouched)
+TEST(NetSortTest, NetSort_8_batch_i8) {
+  std::srand(_seed);
+  for (size_t g=0; g<=40; ++g)
+  {
+    std::vector<int8_t> v0(8*40 + 8);
+    vec_rrd(v0, (int8_t)-127, (int8_t)127);
+    auto v1 = v0;
+    auto v2 = v0;
+    auto v3 = v0;
+
+    netsort_8_batch_i8_qsort(v0.data(), g);
+
+#ifdef HAS_SSE4_1_
+    netsort_8_batch_i8_sse(v1.data(), g); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX2_
+    netsort_8_batch_i8_avx2(v2.data(), g); EXPECT_EQ(v0, v2);
+#endif
+#ifdef HAS_AVX512BW_
+    netsort_8_batch_i8_avx512(v3.data(), g); EXPECT_EQ(v0, v3);
+#endif
+  }
+}
+
+// Test batch NetSort for 0..40 groups of 8 x int16 (values past groups untouched)
+TEST(NetSortTest, NetSort_8_batch_i16) {
+  std::srand(_seed);
+  for (size_t g=0; g<=40; ++g)
+  {
+    std::vector<int16_t> v0(8*40 + 8);
+    vec_rrd(v0, (int16_t)-5000, (int16_t)5000);
+    auto v1 = v0;
+    auto v2 = v0;
+
+    netsort_8_batch_i16_qsort(v0.data(), g);
+
+#ifdef HAS_AVX2_
+    netsort_8_batch_i16_avx2(v1.data(), g); EXPECT_EQ(v0, v1);
+#endif
+#ifdef HAS_AVX512BW_
+    netsort_8_batch_i16_avx512(v2.data(), g); EXPECT_EQ(v0, v2);
+#endif
+  }
+}
+
+// Median filter for w in {3,5,7,9,25} (and a fallback width) over 0..100 values
+template <typename T>
+static void test_median_filter(void (*filter)(const T*, size_t, size_t, T*))
+{
+  const size_t widths[] = { 3, 5, 7, 9, 25, 4 };
+  for (size_t w : widths)
+  {
+    for (size_t n=0; n<=100; ++n)
+    {
+      std::vector<T> v(n);
+      vec_rrd(v, (T)0, (T)9);
+      if (n && (n & 1)) v[n/2] = std::numeric_limits<T>::max();
+      std::vector<T> out0(n + 1, (T)-1), out1(n + 1, (T)-1);
+
+      for (size_t i=0; i + w <= n; ++i)
+      {
+        std::vector<T> win(v.begin() + i, v.begin() + i + w);
+        std::sort(win.begin(), win.end());
+        out0[i] = win[w/2];
+      }
+      filter(v.data(), n, w, out1.data());
+      EXPECT_EQ(out0, out1) << "w=" << w << " n=" << n;
+    }
+  }
+}
+
+// k-th smallest of 8/16 values, one problem per lane
+template <typename T, typename V>
+static void test_kth(V (*kth8)(const V*, const size_t), V (*kth16)(const V*, const size_t))
+{
+  const size_t W = sizeof(V) / sizeof(T);
+  for (int it=0; it<20; ++it)
+  {
+    for (size_t n=8; n<=16; n+=8)
+    {
+      std::vector<T> v(16*W), out(W);
+      vec_rrd(v, (T)0, (T)9);
+      V r[16];
+      memcpy(r, v.data(), n*sizeof(V));
+
+      for (size_t k=0; k<n; ++k)
+      {
+        V res = (n == 8) ? kth8(r, k) : kth16(r, k);
+        memcpy(out.data(), &res, sizeof(V));
+        for (size_t l=0; l<W; ++l)
+        {
+          std::vector<T> col;
+          for (size_t j=0; j<n; ++j) col.push_back(v[j*W + l]);
+          std::sort(col.begin(), col.end());
+          EXPECT_EQ(col[k], out[l]) << "n=" << n << " k=" << k;
+        }
+      }
+    }
+  }
+}
+
+// k-th smallest of 0..20 groups of 8/16 values, for every k
+template <typename T>
+static void test_kth_batch(void (*batch8)(const T*, size_t, size_t, T*), void (*batch16)(const T*, size_t, size_t, T*))
+{
+  for (size_t g=0; g<=20; ++g)
+  {
+    std::vector<T> v(16*g);
+    vec_rrd(v, (T)-50, (T)50);
+    for (size_t n=8; n<=16; n+=8)
+    {
+      for (size_t k=0; k<n; ++k)
+      {
+        std::vector<T> out0(g + 1, (T)-100), out1(g + 1, (T)-100);
+        for (size_t i=0; i<g; ++i)
+        {
+          std::vector<T> grp(v.begin() + n*i, v.begin() + n*(i + 1));
+          std::sort(grp.begin(), grp.end());
+          out0[i] = grp[k];
+        }
+        (n == 8 ? batch8 : batch16)(v.data(), g, k, out1.data());
+        EXPECT_EQ(out0, out1) << "g=" << g << " n=" << n << " k=" << k;
+      }
+    }
+  }
+}
+
+// Test selection networks and median filter for int16
+TEST(NetSortTest, NetSelect_i16) {
+  std::srand(_seed);
+  test_median_filter<int16_t>(netselect_median_filter_i16_std);
+#ifdef HAS_AVX2_
+  test_median_filter<int16_t>(netselect_median_filter_i16_avx2);
+  test_kth<int16_t, __m256i>(netselect_kth_8_i16_avx2, netselect_kth_16_i16_avx2);
+#endif
+}
+
+// Test selection networks and median filter for int32
+TEST(NetSortTest, NetSelect_i32) {
+  std::srand(_seed);
+  test_median_filter<int32_t>(netselect_median_filter_i32_std);
+  test_kth_batch<int32_t>(netselect_kth_8_batch_i32_std, netselect_kth_16_batch_i32_std);
+#ifdef HAS_AVX2_
+  test_median_filter<int32_t>(netselect_median_filter_i32_avx2);
+  test_kth<int32_t, __m256i>(netselect_kth_8_i32_avx2, netselect_kth_16_i32_avx2);
+  test_kth_batch<int32_t>(netselect_kth_8_batch_i32_avx2, netselect_kth_16_batch_i32_avx2);
+#endif
+}
+
+// Test selection networks and median filter for float
+TEST(NetSortTest, NetSelect_flt) {
+  std::srand(_seed);
+  test_median_filter<float>(netselect_median_filter_flt_std);
+  test_kth_batch<float>(netselect_kth_8_batch_flt_std, netselect_kth_16_batch_flt_std);
+#ifdef HAS_AVX_
+  test_median_filter<float>(netselect_median_filter_flt_avx);
+  test_kth<float, __m256>(netselect_kth_8_flt_avx, netselect_kth_16_flt_avx);
+  test_kth_batch<float>(netselect_kth_8_batch_flt_avx, netselect_kth_16_batch_flt_avx);
+#endif
+}
+
+// Test selection networks and median filter for double
+TEST(NetSortTest, NetSelect_dbl) {
+  std::srand(_seed);
+  test_median_filter<double>(netselect_median_filter_dbl_std);
+#ifdef HAS_AVX_
+  test_median_filter<double>(netselect_median_filter_dbl_avx);
+  test_kth<double, __m256d>(netselect_kth_8_dbl_avx, netselect_kth_16_dbl_avx);
+#endif
+}
+
+// Check sorted tests against std::is_sorted for 0..200 values: sorted, reversed,
+// one swapped pair (every position) and random, including type bounds
+template <typename T>
+static void test_is_sorted()
+{
+  const T lo = std::numeric_limits<T>::lowest();
+  const T hi = std::numeric_limits<T>::max();
+  for (size_t n=0; n<=200; ++n)
+  {
+    std::vector<T> v(n);
+    for (size_t i=0; i<n; ++i)
+      v[i] = (i % 7 == 0) ? ((i & 8) ? hi : lo) : (T)(std::rand() % 100);
+    EXPECT_EQ(netsort_is_sorted(v.data(), n), netsort_is_sorted_std(v.data(), n));
+    EXPECT_EQ(netsort_is_sorted_desc(v.data(), n), netsort_is_sorted_desc_std(v.data(), n));
+
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(netsort_is_sorted(v.data(), n));
+    EXPECT_EQ(netsort_is_sorted_desc(v.data(), n), v.empty() || v.front() == v.back());
+    for (size_t i=0; i+1<n; ++i)
+      if (v[i] != v[i+1])
+      {
+        std::swap(v[i], v[i+1]);
+        EXPECT_FALSE(netsort_is_sorted(v.data(), n));
+        std::swap(v[i], v[i+1]);
+      }
+
+    std::reverse(v.begin(), v.end());
+    EXPECT_TRUE(netsort_is_sorted_desc(v.data(), n));
+    for (size_t i=0; i+1<n; ++i)
+      if (v[i] != v[i+1])
+      {
+        std::swap(v[i], v[i+1]);
+        EXPECT_FALSE(netsort_is_sorted_desc(v.data(), n));
+        std::swap(v[i], v[i+1]);
+      }
+  }
+}
+
+// Check adaptive sort on random, sorted and reversed inputs of 0..64 values
+template <typename T>
+static void test_adaptive()
+{
+  for (size_t n=0; n<=64; ++n)
+    for (int it=0; it<3; ++it)
+    {
+      std::vector<T> v0(n);
+      for (size_t i=0; i<n; ++i)
+        v0[i] = (T)(std::rand() % 100);
+      if (it > 0)
+        std::sort(v0.begin(), v0.end());
+      if (it > 1)
+        std::reverse(v0.begin(), v0.end());
+      auto v1 = v0;
+
+      std::sort(v0.begin(), v0.end());
+      netsort_adaptive(v1.data(), n); EXPECT_EQ(v0, v1);
+    }
+}
+
+// Test vectorized sorted checks and adaptive sort for all types
+TEST(NetSortTest, NetSort_is_sorted) {
+  std::srand(_seed);
+  test_is_sorted<int8_t>();   test_is_sorted<uint8_t>();
+  test_is_sorted<int16_t>();  test_is_sorted<uint16_t>();
+  test_is_sorted<int32_t>();  test_is_sorted<uint32_t>();
+  test_is_sorted<int64_t>();  test_is_sorted<uint64_t>();
+  test_is_sorted<float>();    test_is_sorted<double>();
+}
+
+TEST(NetSortTest, NetSort_adaptive) {
+  std::srand(_seed);
+  test_adaptive<int8_t>();   test_adaptive<uint8_t>();
+  test_adaptive<int16_t>();  test_adaptive<uint16_t>();
+  test_adaptive<int32_t>();  test_adaptive<uint32_t>();
+  test_adaptive<int64_t>();  test_adaptive<uint64_t>();
+  test_adaptive<float>();    test_adaptive<double>();
+}
@@ -0,0 +1,736 @@
+/**
+ * Copyright 2020 Guillaume AUJAY. All rights reserved.
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Utils/compiler_utils.h"
+#include "Utils/generators.h"
+
+#include "SimdSort/ssort_i32.h"
+#include "SimdSort/ssort_u32.h"
+#include "SimdSort/ssort_i64.h"
+#include "SimdSort/ssort_flt.h"
+#include "SimdSort/ssort_dbl.h"
+#include "SimdSort/ssort_merge_i32.h"
+#include "SimdSort/ssort_merge_flt.h"
+#include "SimdSort/ssort_merge_dbl.h"
+#include "SimdSort/ssort_topk_i32.h"
+#include "SimdSort/ssort_topk_flt.h"
+#include "SimdSort/ssort_hybrid.h"
+#include "SimdSort/ssort_radix.h"
+#include "SimdSort/ssort_parallel.h"
+#include "SimdSort/ssort_records.h"
+#include "SimdSort/ssort_unique.h"
+#include "SimdSort/ssort_partition.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <ctime>
+#include <utility>
+#include <vector>
+
+#ifndef HAS_AVX2_
+  #warning "Testing reference versions only (AVX2 recommended)"
+#endif
+
+static unsigned int _seed = static_cast<unsigned int>(std::time(nullptr));
+static const size_t _sizes[] = { 0, 1, 7, 63, 64, 65, 100, 257, 1000, 4099, 65536, 100003 };
+
+// Random values (uniform real for float types)
+template <typename T>
+static void test_rnd(std::vector<T>& v, T min, T max) { vec_rrd(v, min, max); }
+static void test_rnd(std::vector<float>& v, float min, float max) { vec_rrdf(v, min, max); }
+static void test_rnd(std::vector<double>& v, double min, double max) { vec_rrdf(v, min, max); }
+
+// Check every input kind against reference
+template <typename T>
+static void test_simdsort(void (*ref)(T*, size_t), void (*func)(T*, size_t), std::vector<T>& v0, size_t n, T min, T max)
+{
+  std::vector<T> v1;
+
+  for (int kind=0; kind<5; ++kind)
+  {
+    v0.resize(n);
+    switch (kind)
+    {
+      case 0: test_rnd(v0, min, max); break;  // random
+      case 1: vec_seq(v0, min);       break;  // sorted
+      case 2: vec_inv(v0, min);       break;  // reversed
+      case 3: vec_rrd(v0, (T)0, (T)4); break; // few unique
+      default: if (n > 1) vec_pip(v0, min); break; // organ pipe
+    }
+    v1 = v0;
+    ref(v0.data(), n);
+    func(v1.data(), n); EXPECT_EQ(v0, v1) << "n=" << n << " kind=" << kind;
+  }
+}
+
+// Merge sorted random (or few unique, with max values) arrays, whole and
+// split into chunks with merge path
+template <typename T>
+static void test_simdmerge(void (*func)(const T*, size_t, const T*, size_t, T*), size_t na, size_t nb, T min, T max)
+{
+  std::vector<T> a(na), b(nb), o0(na + nb), o1(na + nb);
+
+  for (int kind=0; kind<2; ++kind)
+  {
+    if (kind == 0) { test_rnd(a, min, max); test_rnd(b, min, max); }
+    else           { vec_rrd(a, (T)0, (T)4); vec_rrd(b, (T)0, (T)4); }
+    if (kind == 1 && na) a[0] = std::numeric_limits<T>::max();
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), o0.begin());
+
+    std::fill(o1.begin(), o1.end(), (T)0);
+    func(a.data(), na, b.data(), nb, o1.data()); EXPECT_EQ(o0, o1) << "na=" << na << " nb=" << nb << " kind=" << kind;
+
+    std::fill(o1.begin(), o1.end(), (T)0);
+    for (size_t d0=0; d0<na+nb; d0+=97)
+    {
+      size_t d1 = std::min(d0 + 97, na + nb);
+      size_t i0 = simdmerge_path(a.data(), na, b.data(), nb, d0);
+      size_t i1 = simdmerge_path(a.data(), na, b.data(), nb, d1);
+      func(a.data() + i0, i1 - i0, b.data() + d0 - i0, (d1 - i1) - (d0 - i0), o1.data() + d0);
+    }
+    EXPECT_EQ(o0, o1) << "path na=" << na << " nb=" << nb << " kind=" << kind;
+  }
+}
+
+template <typename T>
+static void test_simdmerge_sizes(void (*func)(const T*, size_t, const T*, size_t, T*), T min, T max)
+{
+  static const size_t sizes[] = { 0, 1, 5, 8, 15, 16, 17, 33, 100, 1000, 4099 };
+  for (size_t na : sizes)
+    for (size_t nb : sizes)
+      test_simdmerge<T>(func, na, nb, min, max);
+}
+
+// Top-k of random, few unique (ties, with max and lowest values) and ascending
+// (threshold rising all along) inputs, with and without indices
+template <typename T>
+static void test_simdtopk(void (*ref)(const T*, size_t, size_t, T*, int32_t*),
+                          void (*func)(const T*, size_t, size_t, T*),
+                          void (*func_idx)(const T*, size_t, size_t, T*, int32_t*), T min, T max)
+{
+  static const size_t sizes[] = { 0, 1, 7, 64, 100, 1000, 4099, 100003 };
+  static const size_t ks[] = { 0, 1, 7, 10, 100, 1000, 5000 };
+  for (size_t n : sizes)
+  {
+    std::vector<T> v(n);
+    for (int kind=0; kind<3; ++kind)
+    {
+      if (kind == 0) test_rnd(v, min, max);
+      else if (kind == 1) vec_rrd(v, (T)0, (T)4);
+      else for (size_t i=0; i<n; ++i) v[i] = (T)(int)i;
+      if (kind == 1 && n > 1) { v[n/3] = std::numeric_limits<T>::max(); v[n/2] = std::numeric_limits<T>::lowest(); }
+
+      for (size_t k : ks)
+      {
+        size_t m = std::min(k, n);
+        std::vector<T> o0(m + 1, (T)0), o1(m + 1, (T)0), o2(m + 1, (T)0);
+        std::vector<int32_t> i0(m + 1, -1), i2(m + 1, -1);
+        ref(v.data(), n, k, o0.data(), i0.data());
+        func(v.data(), n, k, o1.data());
+        func_idx(v.data(), n, k, o2.data(), i2.data());
+        EXPECT_EQ(o0, o1) << "n=" << n << " k=" << k << " kind=" << kind;
+        EXPECT_EQ(o0, o2) << "idx n=" << n << " k=" << k << " kind=" << kind;
+        EXPECT_EQ(i0, i2) << "idx n=" << n << " k=" << k << " kind=" << kind;
+      }
+    }
+  }
+}
+
+// Test SimdSort for int32
+TEST(SimdSortTest, SimdSort_i32) {
+  std::srand(_seed);
+  std::vector<int32_t> v0;
+
+  for (size_t n : _sizes)
+  {
+    test_simdsort<int32_t>(simdsort_i32_std, simdsort_i32_qsort, v0, n, -5000, 5000);
+#ifdef HAS_AVX2_
+    test_simdsort<int32_t>(simdsort_i32_std, simdsort_i32_avx2,  v0, n, -5000, 5000);
+#endif
+#ifdef HAS_AVX512F_
+    test_simdsort<int32_t>(simdsort_i32_std, simdsort_i32_avx512, v0, n, -5000, 5000);
+#endif
+  }
+}
+
+// Test SimdSort for uint32
+TEST(SimdSortTest, SimdSort_u32) {
+  std::srand(_seed);
+  std::vector<uint32_t> v0;
+
+  for (size_t n : _sizes)
+  {
+    test_simdsort<uint32_t>(simdsort_u32_std, simdsort_u32_qsort, v0, n, (uint32_t)0, (uint32_t)4000000000u);
+#ifdef HAS_AVX2_
+    test_simdsort<uint32_t>(simdsort_u32_std, simdsort_u32_avx2,  v0, n, (uint32_t)0, (uint32_t)4000000000u);
+#endif
+#ifdef HAS_AVX512F_
+    test_simdsort<uint32_t>(simdsort_u32_std, simdsort_u32_avx512, v0, n, (uint32_t)0, (uint32_t)4000000000u);
+#endif
+  }
+}
+
+// Test SimdSort for int64
+TEST(SimdSortTest, SimdSort_i64) {
+  std::srand(_seed);
+  std::vector<int64_t> v0;
+
+  for (size_t n : _sizes)
+  {
+    test_simdsort<int64_t>(simdsort_i64_std, simdsort_i64_qsort, v0, n, (int64_t)-5000, (int64_t)5000);
+#ifdef HAS_AVX2_
+    test_simdsort<int64_t>(simdsort_i64_std, simdsort_i64_avx2,  v0, n, (int64_t)-5000, (int64_t)5000);
+#endif
+#ifdef HAS_AVX512F_
+    test_simdsort<int64_t>(simdsort_i64_std, simdsort_i64_avx512, v0, n, (int64_t)-5000, (int64_t)5000);
+#endif
+  }
+}
+
+// NaNs (about 1 in 10): other values sorted, NaNs all kept at the end
+template <typename T>
+static void test_simdsort_nan(void (*func)(T*, size_t))
+{
+  for (size_t n : _sizes)
+  {
+    std::vector<T> v(n), r;
+    test_rnd(v, (T)-1, (T)1);
+    for (size_t i=0; i<n; ++i)
+      if (std::rand() % 10 == 0)
+        v[i] = std::numeric_limits<T>::quiet_NaN();
+    for (size_t i=0; i<n; ++i)
+      if (!std::isnan(v[i]))
+        r.push_back(v[i]);
+    std::sort(r.begin(), r.end());
+
+    func(v.data(), n);
+    EXPECT_EQ(r, std::vector<T>(v.begin(), v.begin() + r.size())) << "n=" << n;
+    for (size_t i=r.size(); i<n; ++i)
+      ASSERT_TRUE(std::isnan(v[i])) << "n=" << n << " i=" << i;
+  }
+}
+
+// Test SimdSort for float
+TEST(SimdSortTest, SimdSort_flt) {
+  std::srand(_seed);
+  std::vector<float> v0;
+
+  for (size_t n : _sizes)
+  {
+    test_simdsort<float>(simdsort_flt_std, simdsort_flt_qsort, v0, n, -1.f, 1.f);
+#ifdef HAS_AVX2_
+    test_simdsort<float>(simdsort_flt_std, simdsort_flt_avx2,  v0, n, -1.f, 1.f);
+#endif
+#ifdef HAS_AVX512F_
+    test_simdsort<float>(simdsort_flt_std, simdsort_flt_avx512, v0, n, -1.f, 1.f);
+#endif
+  }
+#ifdef HAS_AVX2_
+  test_simdsort_nan<float>(simdsort_flt_avx2);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdsort_nan<float>(simdsort_flt_avx512);
+#endif
+}
+
+// Test SimdSort for double
+TEST(SimdSortTest, SimdSort_dbl) {
+  std::srand(_seed);
+  std::vector<double> v0;
+
+  for (size_t n : _sizes)
+  {
+    test_simdsort<double>(simdsort_dbl_std, simdsort_dbl_qsort, v0, n, -1., 1.);
+#ifdef HAS_AVX2_
+    test_simdsort<double>(simdsort_dbl_std, simdsort_dbl_avx2,  v0, n, -1., 1.);
+#endif
+#ifdef HAS_AVX512F_
+    test_simdsort<double>(simdsort_dbl_std, simdsort_dbl_avx512, v0, n, -1., 1.);
+#endif
+  }
+#ifdef HAS_AVX2_
+  test_simdsort_nan<double>(simdsort_dbl_avx2);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdsort_nan<double>(simdsort_dbl_avx512);
+#endif
+}
+
+// Hybrid sort, every arithmetic type through the same template
+template <typename T>
+static void test_std_sort(T* v, size_t n) { std::sort(v, v + n); }
+
+template <typename T>
+static void test_simdsort_hybrid(T min, T max)
+{
+  std::vector<T> v0;
+  for (size_t n : _sizes)
+    test_simdsort<T>(test_std_sort<T>, simdsort_hybrid<T>, v0, n, min, max);
+}
+
+// Test hybrid SimdSort (netsort_small base case) for all arithmetic types
+TEST(SimdSortTest, SimdSort_hybrid) {
+  std::srand(_seed);
+
+  test_simdsort_hybrid<int8_t>((int8_t)-100, (int8_t)100);
+  test_simdsort_hybrid<uint8_t>((uint8_t)0, (uint8_t)250);
+  test_simdsort_hybrid<int16_t>((int16_t)-5000, (int16_t)5000);
+  test_simdsort_hybrid<uint16_t>((uint16_t)0, (uint16_t)60000);
+  test_simdsort_hybrid<int32_t>(-5000, 5000);
+  test_simdsort_hybrid<uint32_t>((uint32_t)0, (uint32_t)4000000000u);
+  test_simdsort_hybrid<int64_t>((int64_t)-5000000000ll, (int64_t)5000000000ll);
+  test_simdsort_hybrid<uint64_t>((uint64_t)0, (uint64_t)5000000000ull);
+  test_simdsort_hybrid<float>(-1.f, 1.f);
+  test_simdsort_hybrid<double>(-1., 1.);
+  test_simdsort_hybrid<long long>(-5000ll, 5000ll);  // insertion sort base case
+  test_simdsort_nan<float>(simdsort_hybrid<float>);
+  test_simdsort_nan<double>(simdsort_hybrid<double>);
+
+  // Iterator interface
+  std::vector<int32_t> v0(4099);
+  test_rnd(v0, -5000, 5000);
+  auto v1 = v0;
+  std::sort(v0.begin(), v0.end());
+  simd_sort(v1.begin(), v1.end()); EXPECT_EQ(v0, v1);
+  simd_sort(v1.begin(), v1.begin());
+  std::vector<float> f = { 2.f, std::numeric_limits<float>::quiet_NaN(), 1.f };
+  simd_sort(f.begin(), f.end());
+  EXPECT_TRUE(f[0] == 1.f && f[1] == 2.f && std::isnan(f[2]));
+}
+
+// Radix sort, keys only then key-value against std::stable_sort of pairs
+template <typename T>
+static void test_simdsort_radix(void (*func)(T*, size_t), T min, T max)
+{
+  std::vector<T> v0;
+  for (size_t n : _sizes)
+    test_simdsort<T>(test_std_sort<T>, func, v0, n, min, max);
+}
+
+template <typename K, typename P>
+static void test_simdsort_radix_kv(void (*func)(K*, P*, size_t), K min, K max)
+{
+  for (size_t n : _sizes)
+  {
+    std::vector<K> k(n);
+    std::vector<P> p(n);
+    test_rnd(k, min, max);
+    for (size_t i=0; i<n; ++i)
+      p[i] = (P)i;
+
+    std::vector<std::pair<K, P>> r(n);
+    for (size_t i=0; i<n; ++i)
+      r[i] = std::make_pair(k[i], p[i]);
+    std::stable_sort(r.begin(), r.end(), [](const std::pair<K, P>& a, const std::pair<K, P>& b) { return a.first < b.first; });
+
+    func(k.data(), p.data(), n);
+    for (size_t i=0; i<n; ++i) {
+      ASSERT_EQ(r[i].first, k[i]) << "n=" << n << " i=" << i;
+      ASSERT_EQ(r[i].second, p[i]) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+// Infinities, signed zeros and NaNs: negative NaN first, positive last, -0
+// before +0, below and above SSORT_RADIX_MIN (values kept)
+template <typename T>
+static void test_simdsort_radix_specials(void (*func)(T*, size_t))
+{
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  for (size_t n : { 16, 33, 100, 1000, 5000, 20000 })
+  {
+    std::vector<T> f(n);
+    for (size_t i=0; i<n; ++i)
+      f[i] = (i % 4 == 0) ? (T)-0. : (i % 4 == 1) ? (T)0. : (i % 4 == 2) ? inf : -inf;
+    f[3] = nan;
+    f[n/2] = -nan;
+    const size_t nz0 = std::count_if(f.begin(), f.end(), [](T x) { return x == 0 && std::signbit(x); });
+    const size_t pz0 = std::count_if(f.begin(), f.end(), [](T x) { return x == 0 && !std::signbit(x); });
+    func(f.data(), n);
+
+    ASSERT_TRUE(std::isnan(f.front()) && std::signbit(f.front())) << "n=" << n;
+    ASSERT_TRUE(std::isnan(f.back()) && !std::signbit(f.back())) << "n=" << n;
+    EXPECT_EQ((size_t)2, (size_t)std::count_if(f.begin(), f.end(), [](T x) { return std::isnan(x); })) << "n=" << n;
+    EXPECT_EQ(-inf, f[1]) << "n=" << n;
+    EXPECT_EQ(inf, f[n-2]) << "n=" << n;
+    size_t nz = 0, pz = 0;
+    for (size_t i=0; i<n; ++i)
+    {
+      if (f[i] != 0)
+        continue;
+      if (std::signbit(f[i]))
+      {
+        EXPECT_EQ((size_t)0, pz) << "n=" << n << " i=" << i;  // -0 before +0
+      }
+      (std::signbit(f[i]) ? nz : pz)++;
+    }
+    EXPECT_EQ(nz0, nz) << "n=" << n;
+    EXPECT_EQ(pz0, pz) << "n=" << n;
+  }
+}
+
+// Test radix SimdSort (32/64 bits keys, key-value stability, float specials)
+TEST(SimdSortTest, SimdSort_radix) {
+  std::srand(_seed);
+
+  test_simdsort_radix<uint32_t>(simdsort_radix_u32, (uint32_t)0, (uint32_t)4000000000u);
+  test_simdsort_radix<int32_t>(simdsort_radix_i32, -2000000000, 2000000000);
+  test_simdsort_radix<float>(simdsort_radix_flt, -1000.f, 1000.f);
+  test_simdsort_radix<uint64_t>(simdsort_radix_u64, (uint64_t)0, (uint64_t)5000000000000ull);
+  test_simdsort_radix<int64_t>(simdsort_radix_i64, (int64_t)-5000000000000ll, (int64_t)5000000000000ll);
+  test_simdsort_radix<double>(simdsort_radix_dbl, -1000., 1000.);
+
+  test_simdsort_radix_kv<uint32_t, int32_t>(simdsort_radix_kv_u32, (uint32_t)0, (uint32_t)100);  // many ties
+  test_simdsort_radix_kv<int32_t, int32_t>(simdsort_radix_kv_i32, -50, 50);
+  test_simdsort_radix_kv<float, int32_t>(simdsort_radix_kv_flt, -1.f, 1.f);
+  test_simdsort_radix_kv<uint64_t, int64_t>(simdsort_radix_kv_u64, (uint64_t)0, (uint64_t)100);
+  test_simdsort_radix_kv<int64_t, int64_t>(simdsort_radix_kv_i64, (int64_t)-50, (int64_t)50);
+  test_simdsort_radix_kv<double, int64_t>(simdsort_radix_kv_dbl, -1., 1.);
+
+  // Infinities, signed zeros and NaNs (hybrid and radix paths)
+  test_simdsort_radix_specials<float>(simdsort_radix_flt);
+  test_simdsort_radix_specials<double>(simdsort_radix_dbl);
+}
+
+// Parallel sort, single chunk and several chunks (odd runs counts included)
+template <typename T>
+static void test_simdsort_parallel(void (*func)(T*, size_t, unsigned), T min, T max)
+{
+  static const size_t sizes[] = { 0, 1, 1000, 65536, 2*65536+1, 1000003 };
+  static const unsigned threads[] = { 0, 1, 2, 3, 4, 7, 16 };
+  for (size_t n : sizes)
+  {
+    std::vector<T> v0(n);
+    test_rnd(v0, min, max);
+    std::vector<T> v1 = v0;
+    std::sort(v0.begin(), v0.end());
+    for (unsigned t : threads)
+    {
+      std::vector<T> v2 = v1;
+      func(v2.data(), n, t); EXPECT_EQ(v0, v2) << "n=" << n << " threads=" << t;
+    }
+  }
+}
+
+// Test parallel SimdSort
+TEST(SimdSortTest, SimdSort_parallel) {
+  std::srand(_seed);
+
+  test_simdsort_parallel<int32_t>(simdsort_parallel_i32_std, -5000, 5000);
+  test_simdsort_parallel<float>(simdsort_parallel_flt_std, -1.f, 1.f);
+  test_simdsort_parallel<double>(simdsort_parallel_dbl_std, -1., 1.);
+#ifdef HAS_AVX2_
+  test_simdsort_parallel<int32_t>(simdsort_parallel_i32_avx2, -5000, 5000);
+  test_simdsort_parallel<float>(simdsort_parallel_flt_avx2, -1.f, 1.f);
+  test_simdsort_parallel<double>(simdsort_parallel_dbl_avx2, -1., 1.);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdsort_parallel<int32_t>(simdsort_parallel_i32_avx512, -5000, 5000);
+  test_simdsort_parallel<float>(simdsort_parallel_flt_avx512, -1.f, 1.f);
+  test_simdsort_parallel<double>(simdsort_parallel_dbl_avx512, -1., 1.);
+#endif
+}
+
+// Records sort, against std::stable_sort by key (ties keep their order)
+struct TestRec16 { uint64_t key; uint32_t id; uint32_t flags; };
+struct TestRecFlt { int32_t id; float key; double pad; };
+
+template <typename R, typename K>
+static void test_simdsort_records(K R::* key, K min, K max)
+{
+  for (size_t n : _sizes)
+  {
+    std::vector<K> k(n);
+    test_rnd(k, min, max);
+    std::vector<R> v0(n);
+    for (size_t i=0; i<n; ++i)
+    {
+      memset(&v0[i], (int)(i & 0xFF), sizeof(R));
+      v0[i].*key = k[i];
+    }
+    std::vector<R> v1 = v0;
+    simdsort_records_std(v0.data(), n, key);
+    simdsort_records(v1.data(), n, key);
+    EXPECT_TRUE(n == 0 || memcmp(v0.data(), v1.data(), n * sizeof(R)) == 0) << "n=" << n;
+  }
+}
+
+// Test records SimdSort (64 bits and float keys, many ties)
+TEST(SimdSortTest, SimdSort_records) {
+  std::srand(_seed);
+
+  test_simdsort_records<TestRec16, uint64_t>(&TestRec16::key, (uint64_t)0, (uint64_t)5000000000000ull);
+  test_simdsort_records<TestRec16, uint64_t>(&TestRec16::key, (uint64_t)0, (uint64_t)100);
+  test_simdsort_records<TestRecFlt, float>(&TestRecFlt::key, -1000.f, 1000.f);
+  test_simdsort_records<TestRecFlt, float>(&TestRecFlt::key, -1.f, 1.f);
+}
+
+// Unique values and run lengths of sorted inputs (out-of-place and in-place),
+// against std::unique and a scalar run count
+template <typename T>
+static void test_simdunique(size_t (*func)(const T*, size_t, T*), size_t (*count)(const T*, size_t, T*, size_t*), T min, T max)
+{
+  for (size_t n : _sizes)
+  {
+    std::vector<T> v(n);
+    test_rnd(v, min, max);
+    if (std::is_floating_point<T>::value)
+      for (size_t i=0; i<n; ++i) v[i] = (T)std::floor(v[i]);  // runs of equal values
+    std::sort(v.begin(), v.end());
+
+    std::vector<T> u0(v), u1(n), u2(v);
+    std::vector<size_t> c0(n), c1(n);
+    const size_t r = std::unique(u0.begin(), u0.end()) - u0.begin();
+    u0.resize(r);
+    size_t s = 0;
+    for (size_t i=0, j=0; i<n; i=j, ++s)
+      for (c0[s] = 0; j<n && v[j] == v[i]; ++j) ++c0[s];
+    c0.resize(r);
+
+    ASSERT_EQ(r, func(v.data(), n, u1.data())) << "n=" << n;
+    u1.resize(r); EXPECT_EQ(u0, u1) << "n=" << n;
+    ASSERT_EQ(r, func(u2.data(), n, u2.data())) << "n=" << n;
+    u2.resize(r); EXPECT_EQ(u0, u2) << "n=" << n;
+    u1.assign(n, T());
+    ASSERT_EQ(r, count(v.data(), n, u1.data(), c1.data())) << "n=" << n;
+    u1.resize(r); c1.resize(r);
+    EXPECT_EQ(u0, u1) << "n=" << n;
+    EXPECT_EQ(c0, c1) << "n=" << n;
+  }
+}
+
+template <typename T>
+static void test_simdunique_all(T min, T max)
+{
+  test_simdunique<T>(simdunique_std<T>, simdunique_count_std<T>, min, max);
+  test_simdunique<T>(static_cast<size_t (*)(const T*, size_t, T*)>(simdunique),  // best available overload
+                     static_cast<size_t (*)(const T*, size_t, T*, size_t*)>(simdunique_count), min, max);
+#ifdef HAS_AVX2_
+  test_simdunique<T>(simdunique_avx2<T>, simdunique_count_avx2<T>, min, max);
+#endif
+}
+
+// Test unique and run lengths (all types, few and many duplicates, float specials)
+TEST(SimdSortTest, SimdSort_unique) {
+  std::srand(_seed);
+
+  test_simdunique_all<int8_t>((int8_t)-127, (int8_t)127);
+  test_simdunique_all<uint8_t>((uint8_t)0, (uint8_t)255);
+  test_simdunique_all<int16_t>((int16_t)-30000, (int16_t)30000);
+  test_simdunique_all<int16_t>((int16_t)-20, (int16_t)20);
+  test_simdunique_all<uint16_t>((uint16_t)0, (uint16_t)65000);
+  test_simdunique_all<int32_t>(-2000000000, 2000000000);
+  test_simdunique_all<int32_t>(-20, 20);
+  test_simdunique_all<uint32_t>((uint32_t)0, (uint32_t)4000000000u);
+  test_simdunique_all<int64_t>((int64_t)-5000000000000ll, (int64_t)5000000000000ll);
+  test_simdunique_all<int64_t>((int64_t)-20, (int64_t)20);
+  test_simdunique_all<uint64_t>((uint64_t)0, (uint64_t)50);
+  test_simdunique_all<float>(-1000.f, 1000.f);
+  test_simdunique_all<float>(-20.f, 20.f);
+  test_simdunique_all<double>(-1000., 1000.);
+  test_simdunique_all<double>(-20., 20.);
+#ifdef HAS_AVX512F_
+  test_simdunique<int32_t>(simdunique_avx512<int32_t>, simdunique_count_avx512<int32_t>, -20, 20);
+  test_simdunique<uint32_t>(simdunique_avx512<uint32_t>, simdunique_count_avx512<uint32_t>, (uint32_t)0, (uint32_t)4000000000u);
+  test_simdunique<int64_t>(simdunique_avx512<int64_t>, simdunique_count_avx512<int64_t>, (int64_t)-20, (int64_t)20);
+  test_simdunique<uint64_t>(simdunique_avx512<uint64_t>, simdunique_count_avx512<uint64_t>, (uint64_t)0, (uint64_t)50);
+  test_simdunique<float>(simdunique_avx512<float>, simdunique_count_avx512<float>, -20.f, 20.f);
+  test_simdunique<double>(simdunique_avx512<double>, simdunique_count_avx512<double>, -20., 20.);
+#endif
+
+  // Signed zeros merged, NaNs all kept (as std::unique)
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> f(100);
+  for (size_t i=0; i<f.size(); ++i)
+    f[i] = (i < 30) ? -0.f : (i < 60) ? 0.f : (i < 70) ? 1.f : nan;
+  std::vector<float> u(f.size());
+  std::vector<size_t> c(f.size());
+  ASSERT_EQ((size_t)32, simdunique_count(f.data(), f.size(), u.data(), c.data()));
+  EXPECT_TRUE(std::signbit(u[0]) && u[1] == 1.f && std::isnan(u[31]));
+  EXPECT_EQ((size_t)60, c[0]);
+  EXPECT_EQ((size_t)1, c[31]);
+}
+
+// Partition predicate: values in the middle third of [min, max)
+template <typename T>
+struct TestPartPred
+{
+  T lo, hi;
+  bool operator()(T x) const { return lo <= x && x < hi; }
+};
+
+// In-place partitions (counts, sides and values kept), out-of-place and
+// k-way bucket partitions (same outputs as the stable references)
+template <typename T>
+static void test_simdpartition(size_t (*part)(T*, size_t, T),
+                               size_t (*part_if)(T*, size_t, TestPartPred<T>),
+                               size_t (*copy)(const T*, size_t, T, T*, T*),
+                               void (*buckets)(const T*, size_t, const T*, size_t, T*, size_t*), T min, T max)
+{
+  const TestPartPred<T> pred = { (T)(min + (max - min) / 3), (T)(max - (max - min) / 3) };
+  for (size_t n : _sizes)
+  {
+    std::vector<T> v(n);
+    test_rnd(v, min, max);
+    const T pivot = n ? v[std::rand() % n] : min;
+    std::vector<T> vs(v);
+    std::sort(vs.begin(), vs.end());
+
+    std::vector<T> w(v);
+    const size_t c = part(w.data(), n, pivot);
+    ASSERT_EQ((size_t)(std::lower_bound(vs.begin(), vs.end(), pivot) - vs.begin()), c) << "n=" << n;
+    for (size_t i=0; i<n; ++i)
+      ASSERT_EQ(i < c, w[i] < pivot) << "n=" << n << " i=" << i;
+    std::sort(w.begin(), w.end());
+    EXPECT_EQ(vs, w) << "n=" << n;
+
+    w = v;
+    const size_t ci = part_if(w.data(), n, pred);
+    ASSERT_EQ((size_t)std::count_if(v.begin(), v.end(), pred), ci) << "n=" << n;
+    for (size_t i=0; i<n; ++i)
+      ASSERT_EQ(i < ci, pred(w[i])) << "n=" << n << " i=" << i;
+    std::sort(w.begin(), w.end());
+    EXPECT_EQ(vs, w) << "n=" << n;
+
+    std::vector<T> t0(n), f0(n), t1(n), f1(n);
+    const size_t r = simdpartition_copy_std(v.data(), n, pivot, t0.data(), f0.data());
+    ASSERT_EQ(r, copy(v.data(), n, pivot, t1.data(), f1.data())) << "n=" << n;
+    t0.resize(r); t1.resize(r); f0.resize(n - r); f1.resize(n - r);
+    EXPECT_EQ(t0, t1) << "n=" << n;
+    EXPECT_EQ(f0, f1) << "n=" << n;
+
+    for (size_t k : { 1, 2, 5, 16, 17 })
+    {
+      std::vector<T> s(k - 1), o0(n), o1(n);
+      std::vector<size_t> b0(k + 1), b1(k + 1);
+      test_rnd(s, min, max);
+      std::sort(s.begin(), s.end());
+      simdpartition_buckets_std(v.data(), n, s.data(), k, o0.data(), b0.data());
+      buckets(v.data(), n, s.data(), k, o1.data(), b1.data());
+      EXPECT_EQ(b0, b1) << "n=" << n << " k=" << k;
+      EXPECT_EQ(o0, o1) << "n=" << n << " k=" << k;
+    }
+  }
+}
+
+template <typename T>
+static void test_simdpartition_all(T min, T max)
+{
+  test_simdpartition<T>(simdpartition_std<T>, simdpartition_if_std<T, TestPartPred<T>>,
+                        simdpartition_copy_std<T>, simdpartition_buckets_std<T>, min, max);
+  test_simdpartition<T>(simdpartition<T>, simdpartition_if<T, TestPartPred<T>>,
+                        simdpartition_copy<T>, simdpartition_buckets<T>, min, max);
+#ifdef HAS_AVX2_
+  test_simdpartition<T>(simdpartition_avx2<T>, simdpartition_if_avx2<T, TestPartPred<T>>,
+                        simdpartition_copy_avx2<T>, simdpartition_buckets_avx2<T>, min, max);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdpartition<T>(simdpartition_avx512<T>, simdpartition_if_avx512<T, TestPartPred<T>>,
+                        simdpartition_copy_avx512<T>, simdpartition_buckets_avx512<T>, min, max);
+#endif
+}
+
+// Test partitions (by pivot, by predicate, out-of-place, k-way) and NaNs
+TEST(SimdSortTest, SimdSort_partition) {
+  std::srand(_seed);
+
+  test_simdpartition_all<int32_t>(-2000000000, 2000000000);
+  test_simdpartition_all<int32_t>(-20, 20);
+  test_simdpartition_all<uint32_t>((uint32_t)0, (uint32_t)4000000000u);
+  test_simdpartition_all<float>(-1000.f, 1000.f);
+  test_simdpartition_all<float>(-20.f, 20.f);
+  test_simdpartition_all<double>(-1000., 1000.);
+
+  // NaNs not below pivot, in the last bucket (as std::upper_bound)
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> f(100), t(100), u(100), o(100);
+  for (size_t i=0; i<f.size(); ++i)
+    f[i] = (i % 10 == 0) ? nan : (float)i;
+  ASSERT_EQ((size_t)45, simdpartition_copy(f.data(), f.size(), 50.f, t.data(), u.data()));
+  EXPECT_TRUE(std::isnan(u[0]) && std::isnan(u[5]) && u[6] == 51.f);
+  const float s[2] = { 10.f, 50.f };
+  size_t b[4];
+  simdpartition_buckets(f.data(), f.size(), s, 3, o.data(), b);
+  EXPECT_EQ((size_t)9, b[1]);
+  EXPECT_EQ((size_t)45, b[2]);
+  EXPECT_TRUE(std::isnan(o[45]) && std::isnan(o[50]) && o[51] == 51.f);
+  EXPECT_EQ((size_t)45, simdpartition(f.data(), f.size(), 50.f));
+}
+
+// Test SimdMerge for int32
+TEST(SimdSortTest, SimdMerge_i32) {
+  std::srand(_seed);
+
+  test_simdmerge_sizes<int32_t>(simdmerge_i32_std, -5000, 5000);
+#ifdef HAS_AVX2_
+  test_simdmerge_sizes<int32_t>(simdmerge_i32_avx2, -5000, 5000);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdmerge_sizes<int32_t>(simdmerge_i32_avx512, -5000, 5000);
+#endif
+}
+
+// Test SimdMerge for float
+TEST(SimdSortTest, SimdMerge_flt) {
+  std::srand(_seed);
+
+  test_simdmerge_sizes<float>(simdmerge_flt_std, -1.f, 1.f);
+#ifdef HAS_AVX_
+  test_simdmerge_sizes<float>(simdmerge_flt_avx, -1.f, 1.f);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdmerge_sizes<float>(simdmerge_flt_avx512, -1.f, 1.f);
+#endif
+}
+
+// Test SimdMerge for double
+TEST(SimdSortTest, SimdMerge_dbl) {
+  std::srand(_seed);
+
+  test_simdmerge_sizes<double>(simdmerge_dbl_std, -1., 1.);
+#ifdef HAS_AVX_
+  test_simdmerge_sizes<double>(simdmerge_dbl_avx, -1., 1.);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdmerge_sizes<double>(simdmerge_dbl_avx512, -1., 1.);
+#endif
+}
+
+// Test SimdTopK for int32
+TEST(SimdSortTest, SimdTopK_i32) {
+  std::srand(_seed);
+
+  test_simdtopk<int32_t>(simdtopk_idx_i32_std, simdtopk_i32_partial_sort, simdtopk_idx_i32_std, -5000, 5000);
+  test_simdtopk<int32_t>(simdtopk_idx_i32_std, simdtopk_i32_nth_element, simdtopk_idx_i32_std, -5000, 5000);
+#ifdef HAS_AVX2_
+  test_simdtopk<int32_t>(simdtopk_idx_i32_std, simdtopk_i32_avx2, simdtopk_idx_i32_avx2, -5000, 5000);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdtopk<int32_t>(simdtopk_idx_i32_std, simdtopk_i32_avx512, simdtopk_idx_i32_avx512, -5000, 5000);
+#endif
+}
+
+// Test SimdTopK for float
+TEST(SimdSortTest, SimdTopK_flt) {
+  std::srand(_seed);
+
+  test_simdtopk<float>(simdtopk_idx_flt_std, simdtopk_flt_partial_sort, simdtopk_idx_flt_std, -1.f, 1.f);
+  test_simdtopk<float>(simdtopk_idx_flt_std, simdtopk_flt_nth_element, simdtopk_idx_flt_std, -1.f, 1.f);
+#ifdef HAS_AVX2_
+  test_simdtopk<float>(simdtopk_idx_flt_std, simdtopk_flt_avx2, simdtopk_idx_flt_avx2, -1.f, 1.f);
+#endif
+#ifdef HAS_AVX512F_
+  test_simdtopk<float>(simdtopk_idx_flt_std, simdtopk_flt_avx512, simdtopk_idx_flt_avx512, -1.f, 1.f);
+#endif
+}